@@ -5,7 +5,6 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/extension_set.h>
 #include <google/protobuf/wire_format_lite.h>
@@ -15,554 +14,1185 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DirectoryResponse_FileInfo_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DownloadRequest_FileInfo_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DownloadResponse_FileResult_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestHeader_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResponseHeader_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UploadRequest_FileInfo_transfer_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transfer_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UploadResponse_FileResult_transfer_2eproto;
-namespace transfer {
-class RequestHeaderDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestHeader> _instance;
-} _RequestHeader_default_instance_;
-class ResponseHeaderDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ResponseHeader> _instance;
-} _ResponseHeader_default_instance_;
-class DirectoryRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DirectoryRequest> _instance;
-} _DirectoryRequest_default_instance_;
-class DirectoryResponse_FileInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DirectoryResponse_FileInfo> _instance;
-} _DirectoryResponse_FileInfo_default_instance_;
-class DirectoryResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DirectoryResponse> _instance;
-} _DirectoryResponse_default_instance_;
-class UploadRequest_FileInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UploadRequest_FileInfo> _instance;
-} _UploadRequest_FileInfo_default_instance_;
-class UploadRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UploadRequest> _instance;
-} _UploadRequest_default_instance_;
-class UploadResponse_FileResultDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UploadResponse_FileResult> _instance;
-} _UploadResponse_FileResult_default_instance_;
-class UploadResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UploadResponse> _instance;
-} _UploadResponse_default_instance_;
-class DownloadRequest_FileInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DownloadRequest_FileInfo> _instance;
-} _DownloadRequest_FileInfo_default_instance_;
-class DownloadRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DownloadRequest> _instance;
-} _DownloadRequest_default_instance_;
-class DownloadResponse_FileResultDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DownloadResponse_FileResult> _instance;
-} _DownloadResponse_FileResult_default_instance_;
-class DownloadResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DownloadResponse> _instance;
-} _DownloadResponse_default_instance_;
-class TransferControlRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransferControlRequest> _instance;
-} _TransferControlRequest_default_instance_;
-class TransferControlResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransferControlResponse> _instance;
-} _TransferControlResponse_default_instance_;
-class TransferProgressRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransferProgressRequest> _instance;
-} _TransferProgressRequest_default_instance_;
-class TransferProgressResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransferProgressResponse> _instance;
-} _TransferProgressResponse_default_instance_;
-}  // namespace transfer
-static void InitDefaultsscc_info_DirectoryRequest_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DirectoryRequest_default_instance_;
-    new (ptr) ::transfer::DirectoryRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DirectoryRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DirectoryRequest_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_DirectoryRequest_transfer_2eproto}, {
-      &scc_info_RequestHeader_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_DirectoryResponse_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DirectoryResponse_default_instance_;
-    new (ptr) ::transfer::DirectoryResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DirectoryResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_DirectoryResponse_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_DirectoryResponse_transfer_2eproto}, {
-      &scc_info_ResponseHeader_transfer_2eproto.base,
-      &scc_info_DirectoryResponse_FileInfo_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_DirectoryResponse_FileInfo_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DirectoryResponse_FileInfo_default_instance_;
-    new (ptr) ::transfer::DirectoryResponse_FileInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DirectoryResponse_FileInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DirectoryResponse_FileInfo_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_DirectoryResponse_FileInfo_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_DownloadRequest_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DownloadRequest_default_instance_;
-    new (ptr) ::transfer::DownloadRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DownloadRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_DownloadRequest_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_DownloadRequest_transfer_2eproto}, {
-      &scc_info_RequestHeader_transfer_2eproto.base,
-      &scc_info_DownloadRequest_FileInfo_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_DownloadRequest_FileInfo_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DownloadRequest_FileInfo_default_instance_;
-    new (ptr) ::transfer::DownloadRequest_FileInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DownloadRequest_FileInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DownloadRequest_FileInfo_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_DownloadRequest_FileInfo_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_DownloadResponse_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DownloadResponse_default_instance_;
-    new (ptr) ::transfer::DownloadResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DownloadResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_DownloadResponse_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_DownloadResponse_transfer_2eproto}, {
-      &scc_info_ResponseHeader_transfer_2eproto.base,
-      &scc_info_DownloadResponse_FileResult_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_DownloadResponse_FileResult_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_DownloadResponse_FileResult_default_instance_;
-    new (ptr) ::transfer::DownloadResponse_FileResult();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::DownloadResponse_FileResult::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DownloadResponse_FileResult_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_DownloadResponse_FileResult_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestHeader_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_RequestHeader_default_instance_;
-    new (ptr) ::transfer::RequestHeader();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::RequestHeader::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestHeader_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_RequestHeader_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_ResponseHeader_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_ResponseHeader_default_instance_;
-    new (ptr) ::transfer::ResponseHeader();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::ResponseHeader::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResponseHeader_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_ResponseHeader_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_TransferControlRequest_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_TransferControlRequest_default_instance_;
-    new (ptr) ::transfer::TransferControlRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::TransferControlRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TransferControlRequest_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_TransferControlRequest_transfer_2eproto}, {
-      &scc_info_RequestHeader_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_TransferControlResponse_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_TransferControlResponse_default_instance_;
-    new (ptr) ::transfer::TransferControlResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::TransferControlResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TransferControlResponse_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_TransferControlResponse_transfer_2eproto}, {
-      &scc_info_ResponseHeader_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_TransferProgressRequest_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_TransferProgressRequest_default_instance_;
-    new (ptr) ::transfer::TransferProgressRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::TransferProgressRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TransferProgressRequest_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_TransferProgressRequest_transfer_2eproto}, {
-      &scc_info_RequestHeader_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_TransferProgressResponse_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_TransferProgressResponse_default_instance_;
-    new (ptr) ::transfer::TransferProgressResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::TransferProgressResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TransferProgressResponse_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_TransferProgressResponse_transfer_2eproto}, {
-      &scc_info_ResponseHeader_transfer_2eproto.base,}};
 
-static void InitDefaultsscc_info_UploadRequest_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::transfer::_UploadRequest_default_instance_;
-    new (ptr) ::transfer::UploadRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::UploadRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_UploadRequest_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_UploadRequest_transfer_2eproto}, {
-      &scc_info_RequestHeader_transfer_2eproto.base,
-      &scc_info_UploadRequest_FileInfo_transfer_2eproto.base,}};
-
-static void InitDefaultsscc_info_UploadRequest_FileInfo_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_UploadRequest_FileInfo_default_instance_;
-    new (ptr) ::transfer::UploadRequest_FileInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::UploadRequest_FileInfo::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UploadRequest_FileInfo_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_UploadRequest_FileInfo_transfer_2eproto}, {}};
-
-static void InitDefaultsscc_info_UploadResponse_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_UploadResponse_default_instance_;
-    new (ptr) ::transfer::UploadResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::UploadResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_UploadResponse_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_UploadResponse_transfer_2eproto}, {
-      &scc_info_ResponseHeader_transfer_2eproto.base,
-      &scc_info_UploadResponse_FileResult_transfer_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static void InitDefaultsscc_info_UploadResponse_FileResult_transfer_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::transfer::_UploadResponse_FileResult_default_instance_;
-    new (ptr) ::transfer::UploadResponse_FileResult();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::transfer::UploadResponse_FileResult::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_UploadResponse_FileResult_transfer_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_UploadResponse_FileResult_transfer_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_transfer_2eproto[17];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_transfer_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_transfer_2eproto = nullptr;
+namespace transfer {
+PROTOBUF_CONSTEXPR RequestHeader::RequestHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestHeaderDefaultTypeInternal() {}
+  union {
+    RequestHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestHeaderDefaultTypeInternal _RequestHeader_default_instance_;
+PROTOBUF_CONSTEXPR ResponseHeader::ResponseHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResponseHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseHeaderDefaultTypeInternal() {}
+  union {
+    ResponseHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseHeaderDefaultTypeInternal _ResponseHeader_default_instance_;
+PROTOBUF_CONSTEXPR DirectoryRequest::DirectoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.current_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dir_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.if_none_match_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.is_parent_)*/false
+  , /*decltype(_impl_.page_size_)*/0u
+  , /*decltype(_impl_.since_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DirectoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectoryRequestDefaultTypeInternal() {}
+  union {
+    DirectoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectoryRequestDefaultTypeInternal _DirectoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR ListingColumns::ListingColumns(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_lengths_)*/{}
+  , /*decltype(_impl_._name_lengths_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sizes_)*/{}
+  , /*decltype(_impl_._sizes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.modify_times_)*/{}
+  , /*decltype(_impl_._modify_times_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.modes_)*/{}
+  , /*decltype(_impl_._modes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.names_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListingColumnsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListingColumnsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListingColumnsDefaultTypeInternal() {}
+  union {
+    ListingColumns _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListingColumnsDefaultTypeInternal _ListingColumns_default_instance_;
+PROTOBUF_CONSTEXPR DirectoryResponse_FileInfo::DirectoryResponse_FileInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.modify_time_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.permissions_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.is_directory_)*/false
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.modify_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.mode_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DirectoryResponse_FileInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectoryResponse_FileInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectoryResponse_FileInfoDefaultTypeInternal() {}
+  union {
+    DirectoryResponse_FileInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectoryResponse_FileInfoDefaultTypeInternal _DirectoryResponse_FileInfo_default_instance_;
+PROTOBUF_CONSTEXPR DirectoryResponse::DirectoryResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.files_)*/{}
+  , /*decltype(_impl_.removed_)*/{}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.etag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.columns_)*/nullptr
+  , /*decltype(_impl_.total_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_more_)*/false
+  , /*decltype(_impl_.not_modified_)*/false
+  , /*decltype(_impl_.is_delta_)*/false
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.base_version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DirectoryResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectoryResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectoryResponseDefaultTypeInternal() {}
+  union {
+    DirectoryResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectoryResponseDefaultTypeInternal _DirectoryResponse_default_instance_;
+PROTOBUF_CONSTEXPR ListingCacheFile_Listing::ListingCacheFile_Listing(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.stored_at_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListingCacheFile_ListingDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListingCacheFile_ListingDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListingCacheFile_ListingDefaultTypeInternal() {}
+  union {
+    ListingCacheFile_Listing _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListingCacheFile_ListingDefaultTypeInternal _ListingCacheFile_Listing_default_instance_;
+PROTOBUF_CONSTEXPR ListingCacheFile::ListingCacheFile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.listings_)*/{}
+  , /*decltype(_impl_.server_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.home_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListingCacheFileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListingCacheFileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListingCacheFileDefaultTypeInternal() {}
+  union {
+    ListingCacheFile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListingCacheFileDefaultTypeInternal _ListingCacheFile_default_instance_;
+PROTOBUF_CONSTEXPR MakeDirectoryRequest::MakeDirectoryRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.paths_)*/{}
+  , /*decltype(_impl_.base_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MakeDirectoryRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MakeDirectoryRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MakeDirectoryRequestDefaultTypeInternal() {}
+  union {
+    MakeDirectoryRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MakeDirectoryRequestDefaultTypeInternal _MakeDirectoryRequest_default_instance_;
+PROTOBUF_CONSTEXPR MakeDirectoryResponse::MakeDirectoryResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.failed_paths_)*/{}
+  , /*decltype(_impl_.errors_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MakeDirectoryResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MakeDirectoryResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MakeDirectoryResponseDefaultTypeInternal() {}
+  union {
+    MakeDirectoryResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MakeDirectoryResponseDefaultTypeInternal _MakeDirectoryResponse_default_instance_;
+PROTOBUF_CONSTEXPR TreeListRequest::TreeListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.root_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.page_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TreeListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TreeListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TreeListRequestDefaultTypeInternal() {}
+  union {
+    TreeListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TreeListRequestDefaultTypeInternal _TreeListRequest_default_instance_;
+PROTOBUF_CONSTEXPR TreeListResponse_Entry::TreeListResponse_Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.relative_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.modify_time_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.is_directory_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TreeListResponse_EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TreeListResponse_EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TreeListResponse_EntryDefaultTypeInternal() {}
+  union {
+    TreeListResponse_Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TreeListResponse_EntryDefaultTypeInternal _TreeListResponse_Entry_default_instance_;
+PROTOBUF_CONSTEXPR TreeListResponse::TreeListResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.has_more_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TreeListResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TreeListResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TreeListResponseDefaultTypeInternal() {}
+  union {
+    TreeListResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TreeListResponseDefaultTypeInternal _TreeListResponse_default_instance_;
+PROTOBUF_CONSTEXPR ArchiveRequest::ArchiveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.archive_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.base_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.direction_)*/0
+  , /*decltype(_impl_.compression_)*/0u
+  , /*decltype(_impl_.block_sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.is_last_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ArchiveRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArchiveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArchiveRequestDefaultTypeInternal() {}
+  union {
+    ArchiveRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArchiveRequestDefaultTypeInternal _ArchiveRequest_default_instance_;
+PROTOBUF_CONSTEXPR ArchiveResponse::ArchiveResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.archive_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.block_sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.compression_)*/0u
+  , /*decltype(_impl_.is_last_)*/false
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_files_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ArchiveResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArchiveResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArchiveResponseDefaultTypeInternal() {}
+  union {
+    ArchiveResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArchiveResponseDefaultTypeInternal _ArchiveResponse_default_instance_;
+PROTOBUF_CONSTEXPR SearchRequest::SearchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.root_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_pattern_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.min_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.modified_after_)*/uint64_t{0u}
+  , /*decltype(_impl_.pattern_type_)*/0
+  , /*decltype(_impl_.case_sensitive_)*/false
+  , /*decltype(_impl_.include_directories_)*/false
+  , /*decltype(_impl_.cancel_)*/false
+  , /*decltype(_impl_.modified_before_)*/uint64_t{0u}
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_.page_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchRequestDefaultTypeInternal() {}
+  union {
+    SearchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchRequestDefaultTypeInternal _SearchRequest_default_instance_;
+PROTOBUF_CONSTEXPR SearchResponse_Entry::SearchResponse_Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.relative_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.modify_time_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.is_directory_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchResponse_EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchResponse_EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchResponse_EntryDefaultTypeInternal() {}
+  union {
+    SearchResponse_Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchResponse_EntryDefaultTypeInternal _SearchResponse_Entry_default_instance_;
+PROTOBUF_CONSTEXPR SearchResponse::SearchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.scanned_count_)*/uint64_t{0u}
+  , /*decltype(_impl_.has_more_)*/false
+  , /*decltype(_impl_.truncated_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SearchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SearchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SearchResponseDefaultTypeInternal() {}
+  union {
+    SearchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchResponseDefaultTypeInternal _SearchResponse_default_instance_;
+PROTOBUF_CONSTEXPR UploadRequest_FileInfo::UploadRequest_FileInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.md5_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.upload_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.need_chunk_)*/false
+  , /*decltype(_impl_.chunk_size_)*/0u
+  , /*decltype(_impl_.chunk_sequence_)*/0u
+  , /*decltype(_impl_.checksum_)*/0u
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadRequest_FileInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadRequest_FileInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadRequest_FileInfoDefaultTypeInternal() {}
+  union {
+    UploadRequest_FileInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadRequest_FileInfoDefaultTypeInternal _UploadRequest_FileInfo_default_instance_;
+PROTOBUF_CONSTEXPR UploadRequest::UploadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.files_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadRequestDefaultTypeInternal() {}
+  union {
+    UploadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
+PROTOBUF_CONSTEXPR UploadResponse_FileResult::UploadResponse_FileResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.need_chunk_)*/false
+  , /*decltype(_impl_.next_sequence_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadResponse_FileResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadResponse_FileResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadResponse_FileResultDefaultTypeInternal() {}
+  union {
+    UploadResponse_FileResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadResponse_FileResultDefaultTypeInternal _UploadResponse_FileResult_default_instance_;
+PROTOBUF_CONSTEXPR UploadResponse::UploadResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UploadResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UploadResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UploadResponseDefaultTypeInternal() {}
+  union {
+    UploadResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UploadResponseDefaultTypeInternal _UploadResponse_default_instance_;
+PROTOBUF_CONSTEXPR DownloadRequest_FileInfo::DownloadRequest_FileInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.download_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.chunk_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DownloadRequest_FileInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DownloadRequest_FileInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DownloadRequest_FileInfoDefaultTypeInternal() {}
+  union {
+    DownloadRequest_FileInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DownloadRequest_FileInfoDefaultTypeInternal _DownloadRequest_FileInfo_default_instance_;
+PROTOBUF_CONSTEXPR DownloadRequest::DownloadRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.files_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DownloadRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DownloadRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DownloadRequestDefaultTypeInternal() {}
+  union {
+    DownloadRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DownloadRequestDefaultTypeInternal _DownloadRequest_default_instance_;
+PROTOBUF_CONSTEXPR DownloadResponse_FileResult::DownloadResponse_FileResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.file_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.target_path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.md5_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.file_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.exists_)*/false
+  , /*decltype(_impl_.need_chunk_)*/false
+  , /*decltype(_impl_.is_last_)*/false
+  , /*decltype(_impl_.chunk_size_)*/0u
+  , /*decltype(_impl_.chunk_sequence_)*/0u
+  , /*decltype(_impl_.checksum_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DownloadResponse_FileResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DownloadResponse_FileResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DownloadResponse_FileResultDefaultTypeInternal() {}
+  union {
+    DownloadResponse_FileResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DownloadResponse_FileResultDefaultTypeInternal _DownloadResponse_FileResult_default_instance_;
+PROTOBUF_CONSTEXPR DownloadResponse::DownloadResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DownloadResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DownloadResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DownloadResponseDefaultTypeInternal() {}
+  union {
+    DownloadResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DownloadResponseDefaultTypeInternal _DownloadResponse_default_instance_;
+PROTOBUF_CONSTEXPR TransferControlRequest::TransferControlRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.control_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferControlRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferControlRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferControlRequestDefaultTypeInternal() {}
+  union {
+    TransferControlRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferControlRequestDefaultTypeInternal _TransferControlRequest_default_instance_;
+PROTOBUF_CONSTEXPR TransferControlResponse::TransferControlResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.new_status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferControlResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferControlResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferControlResponseDefaultTypeInternal() {}
+  union {
+    TransferControlResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferControlResponseDefaultTypeInternal _TransferControlResponse_default_instance_;
+PROTOBUF_CONSTEXPR TransferProgressRequest::TransferProgressRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferProgressRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferProgressRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferProgressRequestDefaultTypeInternal() {}
+  union {
+    TransferProgressRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferProgressRequestDefaultTypeInternal _TransferProgressRequest_default_instance_;
+PROTOBUF_CONSTEXPR TransferProgressResponse::TransferProgressResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.task_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.task_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.transferred_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.speed_)*/0u
+  , /*decltype(_impl_.total_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.progress_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransferProgressResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransferProgressResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransferProgressResponseDefaultTypeInternal() {}
+  union {
+    TransferProgressResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferProgressResponseDefaultTypeInternal _TransferProgressResponse_default_instance_;
+PROTOBUF_CONSTEXPR WatchRequest::WatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.paths_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchRequestDefaultTypeInternal() {}
+  union {
+    WatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR WatchResponse::WatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchResponseDefaultTypeInternal() {}
+  union {
+    WatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchResponseDefaultTypeInternal _WatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR ChangeNotification::ChangeNotification(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.changed_)*/{}
+  , /*decltype(_impl_.removed_)*/{}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.base_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangeNotificationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeNotificationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeNotificationDefaultTypeInternal() {}
+  union {
+    ChangeNotification _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeNotificationDefaultTypeInternal _ChangeNotification_default_instance_;
+PROTOBUF_CONSTEXPR HelloRequest::HelloRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.compressions_)*/{}
+  , /*decltype(_impl_.hash_algorithms_)*/{}
+  , /*decltype(_impl_.features_)*/{}
+  , /*decltype(_impl_.client_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.protocol_version_)*/0u
+  , /*decltype(_impl_.min_protocol_version_)*/0u
+  , /*decltype(_impl_.max_frame_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.window_size_)*/0u
+  , /*decltype(_impl_.raw_data_frames_)*/false
+  , /*decltype(_impl_.multiplexing_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HelloRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HelloRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HelloRequestDefaultTypeInternal() {}
+  union {
+    HelloRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HelloRequestDefaultTypeInternal _HelloRequest_default_instance_;
+PROTOBUF_CONSTEXPR HelloResponse::HelloResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.features_)*/{}
+  , /*decltype(_impl_.compression_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hash_algorithm_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.server_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.max_frame_size_)*/uint64_t{0u}
+  , /*decltype(_impl_.protocol_version_)*/0u
+  , /*decltype(_impl_.window_size_)*/0u
+  , /*decltype(_impl_.raw_data_frames_)*/false
+  , /*decltype(_impl_.multiplexing_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HelloResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HelloResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HelloResponseDefaultTypeInternal() {}
+  union {
+    HelloResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HelloResponseDefaultTypeInternal _HelloResponse_default_instance_;
+PROTOBUF_CONSTEXPR HeartbeatRequest::HeartbeatRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.timestamp_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HeartbeatRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatRequestDefaultTypeInternal() {}
+  union {
+    HeartbeatRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatRequestDefaultTypeInternal _HeartbeatRequest_default_instance_;
+PROTOBUF_CONSTEXPR HeartbeatResponse::HeartbeatResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.timestamp_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HeartbeatResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatResponseDefaultTypeInternal() {}
+  union {
+    HeartbeatResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatResponseDefaultTypeInternal _HeartbeatResponse_default_instance_;
+}  // namespace transfer
+static ::_pb::Metadata file_level_metadata_transfer_2eproto[37];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transfer_2eproto[6];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transfer_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_transfer_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_transfer_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, session_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, type_),
-  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, timestamp_),
-  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, sequence_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::transfer::RequestHeader, _impl_.sequence_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, session_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, type_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, timestamp_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, success_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, error_code_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, error_message_),
-  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, sequence_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.error_code_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.error_message_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ResponseHeader, _impl_.sequence_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, current_path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, dir_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, is_parent_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.current_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.dir_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.is_parent_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.page_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.if_none_match_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.since_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryRequest, _impl_.encoding_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _impl_.names_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _impl_.name_lengths_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _impl_.sizes_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _impl_.modify_times_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingColumns, _impl_.modes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, is_directory_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, modify_time_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, permissions_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, task_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.is_directory_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.modify_time_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.permissions_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.modify_time_ns_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse_FileInfo, _impl_.mode_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, files_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.files_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.has_more_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.etag_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.not_modified_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.is_delta_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.removed_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.base_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DirectoryResponse, _impl_.columns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile_Listing, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile_Listing, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile_Listing, _impl_.stored_at_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile, _impl_.server_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile, _impl_.home_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ListingCacheFile, _impl_.listings_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryRequest, _impl_.base_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryRequest, _impl_.paths_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryResponse, _impl_.failed_paths_),
+  PROTOBUF_FIELD_OFFSET(::transfer::MakeDirectoryResponse, _impl_.errors_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListRequest, _impl_.root_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListRequest, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListRequest, _impl_.page_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse_Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse_Entry, _impl_.relative_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse_Entry, _impl_.is_directory_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse_Entry, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse_Entry, _impl_.modify_time_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TreeListResponse, _impl_.has_more_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.direction_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.archive_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.base_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.block_sequence_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveRequest, _impl_.is_last_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.archive_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.block_sequence_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.is_last_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ArchiveResponse, _impl_.total_files_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.root_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.name_pattern_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.pattern_type_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.case_sensitive_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.min_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.max_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.modified_after_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.modified_before_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.include_directories_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.page_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchRequest, _impl_.cancel_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse_Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse_Entry, _impl_.relative_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse_Entry, _impl_.is_directory_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse_Entry, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse_Entry, _impl_.modify_time_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.has_more_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.truncated_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.scanned_count_),
+  PROTOBUF_FIELD_OFFSET(::transfer::SearchResponse, _impl_.next_cursor_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, file_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, target_path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, file_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, md5_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, need_chunk_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, chunk_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, chunk_sequence_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, data_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, checksum_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, task_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, status_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, offset_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, upload_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.target_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.file_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.md5_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.need_chunk_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.chunk_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.chunk_sequence_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.checksum_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest_FileInfo, _impl_.upload_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest, files_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadRequest, _impl_.files_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, file_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, target_path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, success_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, need_chunk_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, next_sequence_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.target_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.need_chunk_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.next_sequence_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse_FileResult, _impl_.error_message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse, results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::UploadResponse, _impl_.results_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, file_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, target_path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, chunk_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, offset_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, download_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _impl_.target_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _impl_.chunk_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest_FileInfo, _impl_.download_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest, files_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadRequest, _impl_.files_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, file_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, target_path_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, exists_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, file_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, md5_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, need_chunk_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, chunk_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, chunk_sequence_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, data_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, checksum_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, is_last_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, error_message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.file_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.target_path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.exists_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.file_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.md5_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.need_chunk_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.chunk_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.chunk_sequence_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.checksum_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.is_last_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse_FileResult, _impl_.error_message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse, results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::DownloadResponse, _impl_.results_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, task_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, control_type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlRequest, _impl_.control_type_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, task_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, success_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, new_status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferControlResponse, _impl_.new_status_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressRequest, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressRequest, task_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressRequest, _impl_.task_id_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, header_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, task_id_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, task_name_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, status_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, transferred_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, total_size_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, speed_),
-  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, progress_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.task_id_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.task_name_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.transferred_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.total_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.speed_),
+  PROTOBUF_FIELD_OFFSET(::transfer::TransferProgressResponse, _impl_.progress_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::WatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::WatchRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::WatchRequest, _impl_.paths_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::WatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::WatchResponse, _impl_.header_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.changed_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.removed_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.base_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::ChangeNotification, _impl_.version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.min_protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.max_frame_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.compressions_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.hash_algorithms_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.raw_data_frames_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.window_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.multiplexing_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloRequest, _impl_.client_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.protocol_version_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.max_frame_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.hash_algorithm_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.raw_data_frames_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.window_size_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.multiplexing_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HelloResponse, _impl_.server_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatRequest, _impl_.timestamp_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::transfer::HeartbeatResponse, _impl_.timestamp_ms_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::transfer::RequestHeader)},
-  { 9, -1, sizeof(::transfer::ResponseHeader)},
-  { 21, -1, sizeof(::transfer::DirectoryRequest)},
-  { 30, -1, sizeof(::transfer::DirectoryResponse_FileInfo)},
-  { 42, -1, sizeof(::transfer::DirectoryResponse)},
-  { 50, -1, sizeof(::transfer::UploadRequest_FileInfo)},
-  { 68, -1, sizeof(::transfer::UploadRequest)},
-  { 75, -1, sizeof(::transfer::UploadResponse_FileResult)},
-  { 86, -1, sizeof(::transfer::UploadResponse)},
-  { 93, -1, sizeof(::transfer::DownloadRequest_FileInfo)},
-  { 103, -1, sizeof(::transfer::DownloadRequest)},
-  { 110, -1, sizeof(::transfer::DownloadResponse_FileResult)},
-  { 127, -1, sizeof(::transfer::DownloadResponse)},
-  { 134, -1, sizeof(::transfer::TransferControlRequest)},
-  { 142, -1, sizeof(::transfer::TransferControlResponse)},
-  { 151, -1, sizeof(::transfer::TransferProgressRequest)},
-  { 158, -1, sizeof(::transfer::TransferProgressResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::transfer::RequestHeader)},
+  { 10, -1, -1, sizeof(::transfer::ResponseHeader)},
+  { 23, -1, -1, sizeof(::transfer::DirectoryRequest)},
+  { 38, -1, -1, sizeof(::transfer::ListingColumns)},
+  { 49, -1, -1, sizeof(::transfer::DirectoryResponse_FileInfo)},
+  { 64, -1, -1, sizeof(::transfer::DirectoryResponse)},
+  { 84, -1, -1, sizeof(::transfer::ListingCacheFile_Listing)},
+  { 92, -1, -1, sizeof(::transfer::ListingCacheFile)},
+  { 102, -1, -1, sizeof(::transfer::MakeDirectoryRequest)},
+  { 111, -1, -1, sizeof(::transfer::MakeDirectoryResponse)},
+  { 120, -1, -1, sizeof(::transfer::TreeListRequest)},
+  { 130, -1, -1, sizeof(::transfer::TreeListResponse_Entry)},
+  { 140, -1, -1, sizeof(::transfer::TreeListResponse)},
+  { 150, -1, -1, sizeof(::transfer::ArchiveRequest)},
+  { 164, -1, -1, sizeof(::transfer::ArchiveResponse)},
+  { 178, -1, -1, sizeof(::transfer::SearchRequest)},
+  { 198, -1, -1, sizeof(::transfer::SearchResponse_Entry)},
+  { 208, -1, -1, sizeof(::transfer::SearchResponse)},
+  { 220, -1, -1, sizeof(::transfer::UploadRequest_FileInfo)},
+  { 239, -1, -1, sizeof(::transfer::UploadRequest)},
+  { 247, -1, -1, sizeof(::transfer::UploadResponse_FileResult)},
+  { 259, -1, -1, sizeof(::transfer::UploadResponse)},
+  { 267, -1, -1, sizeof(::transfer::DownloadRequest_FileInfo)},
+  { 278, -1, -1, sizeof(::transfer::DownloadRequest)},
+  { 286, -1, -1, sizeof(::transfer::DownloadResponse_FileResult)},
+  { 304, -1, -1, sizeof(::transfer::DownloadResponse)},
+  { 312, -1, -1, sizeof(::transfer::TransferControlRequest)},
+  { 321, -1, -1, sizeof(::transfer::TransferControlResponse)},
+  { 331, -1, -1, sizeof(::transfer::TransferProgressRequest)},
+  { 339, -1, -1, sizeof(::transfer::TransferProgressResponse)},
+  { 353, -1, -1, sizeof(::transfer::WatchRequest)},
+  { 361, -1, -1, sizeof(::transfer::WatchResponse)},
+  { 368, -1, -1, sizeof(::transfer::ChangeNotification)},
+  { 380, -1, -1, sizeof(::transfer::HelloRequest)},
+  { 397, -1, -1, sizeof(::transfer::HelloResponse)},
+  { 413, -1, -1, sizeof(::transfer::HeartbeatRequest)},
+  { 421, -1, -1, sizeof(::transfer::HeartbeatResponse)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_RequestHeader_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_ResponseHeader_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DirectoryRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DirectoryResponse_FileInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DirectoryResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_UploadRequest_FileInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_UploadRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_UploadResponse_FileResult_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_UploadResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DownloadRequest_FileInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DownloadRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DownloadResponse_FileResult_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_DownloadResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_TransferControlRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_TransferControlResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_TransferProgressRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::transfer::_TransferProgressResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::transfer::_RequestHeader_default_instance_._instance,
+  &::transfer::_ResponseHeader_default_instance_._instance,
+  &::transfer::_DirectoryRequest_default_instance_._instance,
+  &::transfer::_ListingColumns_default_instance_._instance,
+  &::transfer::_DirectoryResponse_FileInfo_default_instance_._instance,
+  &::transfer::_DirectoryResponse_default_instance_._instance,
+  &::transfer::_ListingCacheFile_Listing_default_instance_._instance,
+  &::transfer::_ListingCacheFile_default_instance_._instance,
+  &::transfer::_MakeDirectoryRequest_default_instance_._instance,
+  &::transfer::_MakeDirectoryResponse_default_instance_._instance,
+  &::transfer::_TreeListRequest_default_instance_._instance,
+  &::transfer::_TreeListResponse_Entry_default_instance_._instance,
+  &::transfer::_TreeListResponse_default_instance_._instance,
+  &::transfer::_ArchiveRequest_default_instance_._instance,
+  &::transfer::_ArchiveResponse_default_instance_._instance,
+  &::transfer::_SearchRequest_default_instance_._instance,
+  &::transfer::_SearchResponse_Entry_default_instance_._instance,
+  &::transfer::_SearchResponse_default_instance_._instance,
+  &::transfer::_UploadRequest_FileInfo_default_instance_._instance,
+  &::transfer::_UploadRequest_default_instance_._instance,
+  &::transfer::_UploadResponse_FileResult_default_instance_._instance,
+  &::transfer::_UploadResponse_default_instance_._instance,
+  &::transfer::_DownloadRequest_FileInfo_default_instance_._instance,
+  &::transfer::_DownloadRequest_default_instance_._instance,
+  &::transfer::_DownloadResponse_FileResult_default_instance_._instance,
+  &::transfer::_DownloadResponse_default_instance_._instance,
+  &::transfer::_TransferControlRequest_default_instance_._instance,
+  &::transfer::_TransferControlResponse_default_instance_._instance,
+  &::transfer::_TransferProgressRequest_default_instance_._instance,
+  &::transfer::_TransferProgressResponse_default_instance_._instance,
+  &::transfer::_WatchRequest_default_instance_._instance,
+  &::transfer::_WatchResponse_default_instance_._instance,
+  &::transfer::_ChangeNotification_default_instance_._instance,
+  &::transfer::_HelloRequest_default_instance_._instance,
+  &::transfer::_HelloResponse_default_instance_._instance,
+  &::transfer::_HeartbeatRequest_default_instance_._instance,
+  &::transfer::_HeartbeatResponse_default_instance_._instance,
 };
 
-const char descriptor_table_protodef_transfer_2eproto[] =
+const char descriptor_table_protodef_transfer_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\016transfer.proto\022\010transfer\"m\n\rRequestHea"
   "der\022\022\n\nsession_id\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025."
   "transfer.MessageType\022\021\n\ttimestamp\030\003 \001(\004\022"
@@ -570,149 +1200,288 @@ const char descriptor_table_protodef_transfer_2eproto[] =
   "session_id\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025.transfe"
   "r.MessageType\022\021\n\ttimestamp\030\003 \001(\004\022\017\n\007succ"
   "ess\030\004 \001(\010\022\022\n\nerror_code\030\005 \001(\t\022\025\n\rerror_m"
-  "essage\030\006 \001(\t\022\020\n\010sequence\030\007 \001(\004\"v\n\020Direct"
-  "oryRequest\022\'\n\006header\030\001 \001(\0132\027.transfer.Re"
-  "questHeader\022\024\n\014current_path\030\002 \001(\t\022\020\n\010dir"
-  "_name\030\003 \001(\t\022\021\n\tis_parent\030\004 \001(\010\"\244\002\n\021Direc"
-  "toryResponse\022(\n\006header\030\001 \001(\0132\030.transfer."
-  "ResponseHeader\022\014\n\004path\030\002 \001(\t\0223\n\005files\030\003 "
-  "\003(\0132$.transfer.DirectoryResponse.FileInf"
-  "o\032\241\001\n\010FileInfo\022\014\n\004name\030\001 \001(\t\022\024\n\014is_direc"
-  "tory\030\002 \001(\010\022\014\n\004size\030\003 \001(\004\022\023\n\013modify_time\030"
-  "\004 \001(\t\022\023\n\013permissions\030\005 \001(\t\022\017\n\007task_id\030\006 "
-  "\001(\t\022(\n\006status\030\007 \001(\0162\030.transfer.TransferS"
-  "tatus\"\374\002\n\rUploadRequest\022\'\n\006header\030\001 \001(\0132"
-  "\027.transfer.RequestHeader\022/\n\005files\030\002 \003(\0132"
-  " .transfer.UploadRequest.FileInfo\032\220\002\n\010Fi"
-  "leInfo\022\021\n\tfile_name\030\001 \001(\t\022\023\n\013target_path"
-  "\030\002 \001(\t\022\021\n\tfile_size\030\003 \001(\004\022\013\n\003md5\030\004 \001(\t\022\022"
-  "\n\nneed_chunk\030\005 \001(\010\022\022\n\nchunk_size\030\006 \001(\r\022\026"
-  "\n\016chunk_sequence\030\007 \001(\r\022\014\n\004data\030\010 \001(\014\022\020\n\010"
-  "checksum\030\t \001(\r\022\017\n\007task_id\030\n \001(\t\022(\n\006statu"
-  "s\030\013 \001(\0162\030.transfer.TransferStatus\022\016\n\006off"
-  "set\030\014 \001(\004\022\021\n\tupload_id\030\r \001(\t\"\372\001\n\016UploadR"
-  "esponse\022(\n\006header\030\001 \001(\0132\030.transfer.Respo"
-  "nseHeader\0224\n\007results\030\002 \003(\0132#.transfer.Up"
-  "loadResponse.FileResult\032\207\001\n\nFileResult\022\021"
-  "\n\tfile_name\030\001 \001(\t\022\023\n\013target_path\030\002 \001(\t\022\017"
-  "\n\007success\030\003 \001(\010\022\022\n\nneed_chunk\030\004 \001(\010\022\025\n\rn"
-  "ext_sequence\030\005 \001(\005\022\025\n\rerror_message\030\006 \001("
-  "\t\"\332\001\n\017DownloadRequest\022\'\n\006header\030\001 \001(\0132\027."
-  "transfer.RequestHeader\0221\n\005files\030\002 \003(\0132\"."
-  "transfer.DownloadRequest.FileInfo\032k\n\010Fil"
-  "eInfo\022\021\n\tfile_name\030\001 \001(\t\022\023\n\013target_path\030"
-  "\002 \001(\t\022\022\n\nchunk_size\030\003 \001(\r\022\016\n\006offset\030\004 \001("
-  "\004\022\023\n\013download_id\030\005 \001(\t\"\343\002\n\020DownloadRespo"
-  "nse\022(\n\006header\030\001 \001(\0132\030.transfer.ResponseH"
-  "eader\0226\n\007results\030\002 \003(\0132%.transfer.Downlo"
-  "adResponse.FileResult\032\354\001\n\nFileResult\022\021\n\t"
-  "file_name\030\001 \001(\t\022\023\n\013target_path\030\002 \001(\t\022\016\n\006"
-  "exists\030\003 \001(\010\022\021\n\tfile_size\030\004 \001(\004\022\013\n\003md5\030\005"
-  " \001(\t\022\022\n\nneed_chunk\030\006 \001(\010\022\022\n\nchunk_size\030\007"
-  " \001(\r\022\026\n\016chunk_sequence\030\010 \001(\r\022\014\n\004data\030\t \001"
-  "(\014\022\020\n\010checksum\030\n \001(\r\022\017\n\007is_last\030\013 \001(\010\022\025\n"
-  "\rerror_message\030\014 \001(\t\"\310\001\n\026TransferControl"
-  "Request\022\'\n\006header\030\001 \001(\0132\027.transfer.Reque"
-  "stHeader\022\017\n\007task_id\030\002 \001(\t\022B\n\014control_typ"
-  "e\030\003 \001(\0162,.transfer.TransferControlReques"
-  "t.ControlType\"0\n\013ControlType\022\t\n\005PAUSE\020\000\022"
-  "\n\n\006RESUME\020\001\022\n\n\006CANCEL\020\002\"\223\001\n\027TransferCont"
-  "rolResponse\022(\n\006header\030\001 \001(\0132\030.transfer.R"
-  "esponseHeader\022\017\n\007task_id\030\002 \001(\t\022\017\n\007succes"
-  "s\030\003 \001(\010\022,\n\nnew_status\030\004 \001(\0162\030.transfer.T"
-  "ransferStatus\"S\n\027TransferProgressRequest"
-  "\022\'\n\006header\030\001 \001(\0132\027.transfer.RequestHeade"
-  "r\022\017\n\007task_id\030\002 \001(\t\"\341\001\n\030TransferProgressR"
-  "esponse\022(\n\006header\030\001 \001(\0132\030.transfer.Respo"
-  "nseHeader\022\017\n\007task_id\030\002 \001(\t\022\021\n\ttask_name\030"
-  "\003 \001(\t\022(\n\006status\030\004 \001(\0162\030.transfer.Transfe"
-  "rStatus\022\030\n\020transferred_size\030\005 \001(\004\022\022\n\ntot"
-  "al_size\030\006 \001(\004\022\r\n\005speed\030\007 \001(\r\022\020\n\010progress"
-  "\030\010 \001(\r*p\n\013MessageType\022\013\n\007UNKNOWN\020\000\022\r\n\tDI"
-  "RECTORY\020\001\022\n\n\006UPLOAD\020\002\022\014\n\010DOWNLOAD\020\003\022\024\n\020T"
-  "RANSFER_CONTROL\020\004\022\025\n\021TRANSFER_PROGRESS\020\005"
-  "*S\n\016TransferStatus\022\010\n\004INIT\020\000\022\020\n\014TRANSFER"
-  "RING\020\001\022\n\n\006PAUSED\020\002\022\r\n\tCOMPLETED\020\003\022\n\n\006FAI"
-  "LED\020\004b\006proto3"
+  "essage\030\006 \001(\t\022\020\n\010sequence\030\007 \001(\004\"\364\001\n\020Direc"
+  "toryRequest\022\'\n\006header\030\001 \001(\0132\027.transfer.R"
+  "equestHeader\022\024\n\014current_path\030\002 \001(\t\022\020\n\010di"
+  "r_name\030\003 \001(\t\022\021\n\tis_parent\030\004 \001(\010\022\016\n\006curso"
+  "r\030\005 \001(\t\022\021\n\tpage_size\030\006 \001(\r\022\025\n\rif_none_ma"
+  "tch\030\007 \001(\t\022\025\n\rsince_version\030\010 \001(\004\022+\n\010enco"
+  "ding\030\t \001(\0162\031.transfer.ListingEncoding\"i\n"
+  "\016ListingColumns\022\r\n\005names\030\001 \001(\014\022\024\n\014name_l"
+  "engths\030\002 \003(\r\022\r\n\005sizes\030\003 \003(\004\022\024\n\014modify_ti"
+  "mes\030\004 \003(\004\022\r\n\005modes\030\005 \003(\r\"\314\004\n\021DirectoryRe"
+  "sponse\022(\n\006header\030\001 \001(\0132\030.transfer.Respon"
+  "seHeader\022\014\n\004path\030\002 \001(\t\0223\n\005files\030\003 \003(\0132$."
+  "transfer.DirectoryResponse.FileInfo\022\023\n\013n"
+  "ext_cursor\030\004 \001(\t\022\020\n\010has_more\030\005 \001(\010\022\023\n\013to"
+  "tal_count\030\006 \001(\004\022\014\n\004etag\030\007 \001(\t\022\024\n\014not_mod"
+  "ified\030\010 \001(\010\022\017\n\007version\030\t \001(\004\022\020\n\010is_delta"
+  "\030\n \001(\010\022\017\n\007removed\030\013 \003(\t\022\024\n\014base_version\030"
+  "\014 \001(\004\022+\n\010encoding\030\r \001(\0162\031.transfer.Listi"
+  "ngEncoding\022)\n\007columns\030\016 \001(\0132\030.transfer.L"
+  "istingColumns\032\307\001\n\010FileInfo\022\014\n\004name\030\001 \001(\t"
+  "\022\024\n\014is_directory\030\002 \001(\010\022\014\n\004size\030\003 \001(\004\022\023\n\013"
+  "modify_time\030\004 \001(\t\022\023\n\013permissions\030\005 \001(\t\022\017"
+  "\n\007task_id\030\006 \001(\t\022(\n\006status\030\007 \001(\0162\030.transf"
+  "er.TransferStatus\022\026\n\016modify_time_ns\030\010 \001("
+  "\004\022\014\n\004mode\030\t \001(\r\"\311\001\n\020ListingCacheFile\022\017\n\007"
+  "version\030\001 \001(\r\022\016\n\006server\030\002 \001(\t\022\021\n\thome_pa"
+  "th\030\003 \001(\t\0224\n\010listings\030\004 \003(\0132\".transfer.Li"
+  "stingCacheFile.Listing\032K\n\007Listing\022-\n\010res"
+  "ponse\030\001 \001(\0132\033.transfer.DirectoryResponse"
+  "\022\021\n\tstored_at\030\002 \001(\004\"a\n\024MakeDirectoryRequ"
+  "est\022\'\n\006header\030\001 \001(\0132\027.transfer.RequestHe"
+  "ader\022\021\n\tbase_path\030\002 \001(\t\022\r\n\005paths\030\003 \003(\t\"g"
+  "\n\025MakeDirectoryResponse\022(\n\006header\030\001 \001(\0132"
+  "\030.transfer.ResponseHeader\022\024\n\014failed_path"
+  "s\030\002 \003(\t\022\016\n\006errors\030\003 \003(\t\"p\n\017TreeListReque"
+  "st\022\'\n\006header\030\001 \001(\0132\027.transfer.RequestHea"
+  "der\022\021\n\troot_path\030\002 \001(\t\022\016\n\006cursor\030\003 \001(\t\022\021"
+  "\n\tpage_size\030\004 \001(\r\"\357\001\n\020TreeListResponse\022("
+  "\n\006header\030\001 \001(\0132\030.transfer.ResponseHeader"
+  "\0221\n\007entries\030\002 \003(\0132 .transfer.TreeListRes"
+  "ponse.Entry\022\023\n\013next_cursor\030\003 \001(\t\022\020\n\010has_"
+  "more\030\004 \001(\010\032W\n\005Entry\022\025\n\rrelative_path\030\001 \001"
+  "(\t\022\024\n\014is_directory\030\002 \001(\010\022\014\n\004size\030\003 \001(\004\022\023"
+  "\n\013modify_time\030\004 \001(\t\"\204\002\n\016ArchiveRequest\022\'"
+  "\n\006header\030\001 \001(\0132\027.transfer.RequestHeader\022"
+  "5\n\tdirection\030\002 \001(\0162\".transfer.ArchiveReq"
+  "uest.Direction\022\022\n\narchive_id\030\003 \001(\t\022\021\n\tba"
+  "se_path\030\004 \001(\t\022\023\n\013compression\030\005 \001(\r\022\026\n\016bl"
+  "ock_sequence\030\006 \001(\004\022\014\n\004data\030\007 \001(\014\022\017\n\007is_l"
+  "ast\030\010 \001(\010\"\037\n\tDirection\022\010\n\004PUSH\020\000\022\010\n\004PULL"
+  "\020\001\"\304\001\n\017ArchiveResponse\022(\n\006header\030\001 \001(\0132\030"
+  ".transfer.ResponseHeader\022\022\n\narchive_id\030\002"
+  " \001(\t\022\026\n\016block_sequence\030\003 \001(\004\022\023\n\013compress"
+  "ion\030\004 \001(\r\022\014\n\004data\030\005 \001(\014\022\017\n\007is_last\030\006 \001(\010"
+  "\022\022\n\ntotal_size\030\007 \001(\004\022\023\n\013total_files\030\010 \001("
+  "\004\"\214\003\n\rSearchRequest\022\'\n\006header\030\001 \001(\0132\027.tr"
+  "ansfer.RequestHeader\022\021\n\troot_path\030\002 \001(\t\022"
+  "\024\n\014name_pattern\030\003 \001(\t\0229\n\014pattern_type\030\004 "
+  "\001(\0162#.transfer.SearchRequest.PatternType"
+  "\022\026\n\016case_sensitive\030\005 \001(\010\022\020\n\010min_size\030\006 \001"
+  "(\004\022\020\n\010max_size\030\007 \001(\004\022\026\n\016modified_after\030\010"
+  " \001(\004\022\027\n\017modified_before\030\t \001(\004\022\033\n\023include"
+  "_directories\030\n \001(\010\022\r\n\005limit\030\013 \001(\r\022\021\n\tpag"
+  "e_size\030\014 \001(\r\022\016\n\006cursor\030\r \001(\t\022\016\n\006cancel\030\016"
+  " \001(\010\"\"\n\013PatternType\022\010\n\004GLOB\020\000\022\t\n\005REGEX\020\001"
+  "\"\225\002\n\016SearchResponse\022(\n\006header\030\001 \001(\0132\030.tr"
+  "ansfer.ResponseHeader\022/\n\007entries\030\002 \003(\0132\036"
+  ".transfer.SearchResponse.Entry\022\020\n\010has_mo"
+  "re\030\003 \001(\010\022\021\n\ttruncated\030\004 \001(\010\022\025\n\rscanned_c"
+  "ount\030\005 \001(\004\022\023\n\013next_cursor\030\006 \001(\t\032W\n\005Entry"
+  "\022\025\n\rrelative_path\030\001 \001(\t\022\024\n\014is_directory\030"
+  "\002 \001(\010\022\014\n\004size\030\003 \001(\004\022\023\n\013modify_time\030\004 \001(\t"
+  "\"\374\002\n\rUploadRequest\022\'\n\006header\030\001 \001(\0132\027.tra"
+  "nsfer.RequestHeader\022/\n\005files\030\002 \003(\0132 .tra"
+  "nsfer.UploadRequest.FileInfo\032\220\002\n\010FileInf"
+  "o\022\021\n\tfile_name\030\001 \001(\t\022\023\n\013target_path\030\002 \001("
+  "\t\022\021\n\tfile_size\030\003 \001(\004\022\013\n\003md5\030\004 \001(\t\022\022\n\nnee"
+  "d_chunk\030\005 \001(\010\022\022\n\nchunk_size\030\006 \001(\r\022\026\n\016chu"
+  "nk_sequence\030\007 \001(\r\022\014\n\004data\030\010 \001(\014\022\020\n\010check"
+  "sum\030\t \001(\r\022\017\n\007task_id\030\n \001(\t\022(\n\006status\030\013 \001"
+  "(\0162\030.transfer.TransferStatus\022\016\n\006offset\030\014"
+  " \001(\004\022\021\n\tupload_id\030\r \001(\t\"\372\001\n\016UploadRespon"
+  "se\022(\n\006header\030\001 \001(\0132\030.transfer.ResponseHe"
+  "ader\0224\n\007results\030\002 \003(\0132#.transfer.UploadR"
+  "esponse.FileResult\032\207\001\n\nFileResult\022\021\n\tfil"
+  "e_name\030\001 \001(\t\022\023\n\013target_path\030\002 \001(\t\022\017\n\007suc"
+  "cess\030\003 \001(\010\022\022\n\nneed_chunk\030\004 \001(\010\022\025\n\rnext_s"
+  "equence\030\005 \001(\005\022\025\n\rerror_message\030\006 \001(\t\"\332\001\n"
+  "\017DownloadRequest\022\'\n\006header\030\001 \001(\0132\027.trans"
+  "fer.RequestHeader\0221\n\005files\030\002 \003(\0132\".trans"
+  "fer.DownloadRequest.FileInfo\032k\n\010FileInfo"
+  "\022\021\n\tfile_name\030\001 \001(\t\022\023\n\013target_path\030\002 \001(\t"
+  "\022\022\n\nchunk_size\030\003 \001(\r\022\016\n\006offset\030\004 \001(\004\022\023\n\013"
+  "download_id\030\005 \001(\t\"\343\002\n\020DownloadResponse\022("
+  "\n\006header\030\001 \001(\0132\030.transfer.ResponseHeader"
+  "\0226\n\007results\030\002 \003(\0132%.transfer.DownloadRes"
+  "ponse.FileResult\032\354\001\n\nFileResult\022\021\n\tfile_"
+  "name\030\001 \001(\t\022\023\n\013target_path\030\002 \001(\t\022\016\n\006exist"
+  "s\030\003 \001(\010\022\021\n\tfile_size\030\004 \001(\004\022\013\n\003md5\030\005 \001(\t\022"
+  "\022\n\nneed_chunk\030\006 \001(\010\022\022\n\nchunk_size\030\007 \001(\r\022"
+  "\026\n\016chunk_sequence\030\010 \001(\r\022\014\n\004data\030\t \001(\014\022\020\n"
+  "\010checksum\030\n \001(\r\022\017\n\007is_last\030\013 \001(\010\022\025\n\rerro"
+  "r_message\030\014 \001(\t\"\310\001\n\026TransferControlReque"
+  "st\022\'\n\006header\030\001 \001(\0132\027.transfer.RequestHea"
+  "der\022\017\n\007task_id\030\002 \001(\t\022B\n\014control_type\030\003 \001"
+  "(\0162,.transfer.TransferControlRequest.Con"
+  "trolType\"0\n\013ControlType\022\t\n\005PAUSE\020\000\022\n\n\006RE"
+  "SUME\020\001\022\n\n\006CANCEL\020\002\"\223\001\n\027TransferControlRe"
+  "sponse\022(\n\006header\030\001 \001(\0132\030.transfer.Respon"
+  "seHeader\022\017\n\007task_id\030\002 \001(\t\022\017\n\007success\030\003 \001"
+  "(\010\022,\n\nnew_status\030\004 \001(\0162\030.transfer.Transf"
+  "erStatus\"S\n\027TransferProgressRequest\022\'\n\006h"
+  "eader\030\001 \001(\0132\027.transfer.RequestHeader\022\017\n\007"
+  "task_id\030\002 \001(\t\"\341\001\n\030TransferProgressRespon"
+  "se\022(\n\006header\030\001 \001(\0132\030.transfer.ResponseHe"
+  "ader\022\017\n\007task_id\030\002 \001(\t\022\021\n\ttask_name\030\003 \001(\t"
+  "\022(\n\006status\030\004 \001(\0162\030.transfer.TransferStat"
+  "us\022\030\n\020transferred_size\030\005 \001(\004\022\022\n\ntotal_si"
+  "ze\030\006 \001(\004\022\r\n\005speed\030\007 \001(\r\022\020\n\010progress\030\010 \001("
+  "\r\"F\n\014WatchRequest\022\'\n\006header\030\001 \001(\0132\027.tran"
+  "sfer.RequestHeader\022\r\n\005paths\030\002 \003(\t\"9\n\rWat"
+  "chResponse\022(\n\006header\030\001 \001(\0132\030.transfer.Re"
+  "sponseHeader\"\273\001\n\022ChangeNotification\022(\n\006h"
+  "eader\030\001 \001(\0132\030.transfer.ResponseHeader\022\014\n"
+  "\004path\030\002 \001(\t\0225\n\007changed\030\003 \003(\0132$.transfer."
+  "DirectoryResponse.FileInfo\022\017\n\007removed\030\004 "
+  "\003(\t\022\024\n\014base_version\030\005 \001(\004\022\017\n\007version\030\006 \001"
+  "(\004\"\241\002\n\014HelloRequest\022\'\n\006header\030\001 \001(\0132\027.tr"
+  "ansfer.RequestHeader\022\030\n\020protocol_version"
+  "\030\002 \001(\r\022\034\n\024min_protocol_version\030\003 \001(\r\022\026\n\016"
+  "max_frame_size\030\004 \001(\004\022\024\n\014compressions\030\005 \003"
+  "(\t\022\027\n\017hash_algorithms\030\006 \003(\t\022\027\n\017raw_data_"
+  "frames\030\007 \001(\010\022\023\n\013window_size\030\010 \001(\r\022\024\n\014mul"
+  "tiplexing\030\t \001(\010\022\020\n\010features\030\n \003(\t\022\023\n\013cli"
+  "ent_name\030\013 \001(\t\"\203\002\n\rHelloResponse\022(\n\006head"
+  "er\030\001 \001(\0132\030.transfer.ResponseHeader\022\030\n\020pr"
+  "otocol_version\030\002 \001(\r\022\026\n\016max_frame_size\030\003"
+  " \001(\004\022\023\n\013compression\030\004 \001(\t\022\026\n\016hash_algori"
+  "thm\030\005 \001(\t\022\027\n\017raw_data_frames\030\006 \001(\010\022\023\n\013wi"
+  "ndow_size\030\007 \001(\r\022\024\n\014multiplexing\030\010 \001(\010\022\020\n"
+  "\010features\030\t \003(\t\022\023\n\013server_name\030\n \001(\t\"Q\n\020"
+  "HeartbeatRequest\022\'\n\006header\030\001 \001(\0132\027.trans"
+  "fer.RequestHeader\022\024\n\014timestamp_ms\030\002 \001(\004\""
+  "S\n\021HeartbeatResponse\022(\n\006header\030\001 \001(\0132\030.t"
+  "ransfer.ResponseHeader\022\024\n\014timestamp_ms\030\002"
+  " \001(\004*\333\001\n\013MessageType\022\013\n\007UNKNOWN\020\000\022\r\n\tDIR"
+  "ECTORY\020\001\022\n\n\006UPLOAD\020\002\022\014\n\010DOWNLOAD\020\003\022\024\n\020TR"
+  "ANSFER_CONTROL\020\004\022\025\n\021TRANSFER_PROGRESS\020\005\022"
+  "\t\n\005MKDIR\020\006\022\r\n\tTREE_LIST\020\007\022\013\n\007ARCHIVE\020\010\022\n"
+  "\n\006SEARCH\020\t\022\t\n\005WATCH\020\n\022\021\n\rCHANGE_NOTIFY\020\013"
+  "\022\t\n\005HELLO\020\014\022\r\n\tHEARTBEAT\020\r*I\n\017ListingEnc"
+  "oding\022\016\n\nLISTING_V1\020\000\022\016\n\nLISTING_V2\020\001\022\026\n"
+  "\022LISTING_V2_COLUMNS\020\002*S\n\016TransferStatus\022"
+  "\010\n\004INIT\020\000\022\020\n\014TRANSFERRING\020\001\022\n\n\006PAUSED\020\002\022"
+  "\r\n\tCOMPLETED\020\003\022\n\n\006FAILED\020\004b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_transfer_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_transfer_2eproto_sccs[17] = {
-  &scc_info_DirectoryRequest_transfer_2eproto.base,
-  &scc_info_DirectoryResponse_transfer_2eproto.base,
-  &scc_info_DirectoryResponse_FileInfo_transfer_2eproto.base,
-  &scc_info_DownloadRequest_transfer_2eproto.base,
-  &scc_info_DownloadRequest_FileInfo_transfer_2eproto.base,
-  &scc_info_DownloadResponse_transfer_2eproto.base,
-  &scc_info_DownloadResponse_FileResult_transfer_2eproto.base,
-  &scc_info_RequestHeader_transfer_2eproto.base,
-  &scc_info_ResponseHeader_transfer_2eproto.base,
-  &scc_info_TransferControlRequest_transfer_2eproto.base,
-  &scc_info_TransferControlResponse_transfer_2eproto.base,
-  &scc_info_TransferProgressRequest_transfer_2eproto.base,
-  &scc_info_TransferProgressResponse_transfer_2eproto.base,
-  &scc_info_UploadRequest_transfer_2eproto.base,
-  &scc_info_UploadRequest_FileInfo_transfer_2eproto.base,
-  &scc_info_UploadResponse_transfer_2eproto.base,
-  &scc_info_UploadResponse_FileResult_transfer_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_transfer_2eproto_once;
-static bool descriptor_table_transfer_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transfer_2eproto = {
-  &descriptor_table_transfer_2eproto_initialized, descriptor_table_protodef_transfer_2eproto, "transfer.proto", 2813,
-  &descriptor_table_transfer_2eproto_once, descriptor_table_transfer_2eproto_sccs, descriptor_table_transfer_2eproto_deps, 17, 0,
-  schemas, file_default_instances, TableStruct_transfer_2eproto::offsets,
-  file_level_metadata_transfer_2eproto, 17, file_level_enum_descriptors_transfer_2eproto, file_level_service_descriptors_transfer_2eproto,
+static ::_pbi::once_flag descriptor_table_transfer_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transfer_2eproto = {
+    false, false, 6474, descriptor_table_protodef_transfer_2eproto,
+    "transfer.proto",
+    &descriptor_table_transfer_2eproto_once, nullptr, 0, 37,
+    schemas, file_default_instances, TableStruct_transfer_2eproto::offsets,
+    file_level_metadata_transfer_2eproto, file_level_enum_descriptors_transfer_2eproto,
+    file_level_service_descriptors_transfer_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transfer_2eproto_getter() {
+  return &descriptor_table_transfer_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_transfer_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_transfer_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transfer_2eproto(&descriptor_table_transfer_2eproto);
 namespace transfer {
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TransferControlRequest_ControlType_descriptor() {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ArchiveRequest_Direction_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
   return file_level_enum_descriptors_transfer_2eproto[0];
 }
-bool TransferControlRequest_ControlType_IsValid(int value) {
+bool ArchiveRequest_Direction_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
-    case 2:
       return true;
     default:
       return false;
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
-constexpr TransferControlRequest_ControlType TransferControlRequest::PAUSE;
-constexpr TransferControlRequest_ControlType TransferControlRequest::RESUME;
-constexpr TransferControlRequest_ControlType TransferControlRequest::CANCEL;
-constexpr TransferControlRequest_ControlType TransferControlRequest::ControlType_MIN;
-constexpr TransferControlRequest_ControlType TransferControlRequest::ControlType_MAX;
-constexpr int TransferControlRequest::ControlType_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ArchiveRequest_Direction ArchiveRequest::PUSH;
+constexpr ArchiveRequest_Direction ArchiveRequest::PULL;
+constexpr ArchiveRequest_Direction ArchiveRequest::Direction_MIN;
+constexpr ArchiveRequest_Direction ArchiveRequest::Direction_MAX;
+constexpr int ArchiveRequest::Direction_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SearchRequest_PatternType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
   return file_level_enum_descriptors_transfer_2eproto[1];
 }
-bool MessageType_IsValid(int value) {
+bool SearchRequest_PatternType_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
-    case 2:
-    case 3:
-    case 4:
-    case 5:
       return true;
     default:
       return false;
   }
 }
 
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TransferStatus_descriptor() {
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SearchRequest_PatternType SearchRequest::GLOB;
+constexpr SearchRequest_PatternType SearchRequest::REGEX;
+constexpr SearchRequest_PatternType SearchRequest::PatternType_MIN;
+constexpr SearchRequest_PatternType SearchRequest::PatternType_MAX;
+constexpr int SearchRequest::PatternType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TransferControlRequest_ControlType_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
   return file_level_enum_descriptors_transfer_2eproto[2];
 }
+bool TransferControlRequest_ControlType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr TransferControlRequest_ControlType TransferControlRequest::PAUSE;
+constexpr TransferControlRequest_ControlType TransferControlRequest::RESUME;
+constexpr TransferControlRequest_ControlType TransferControlRequest::CANCEL;
+constexpr TransferControlRequest_ControlType TransferControlRequest::ControlType_MIN;
+constexpr TransferControlRequest_ControlType TransferControlRequest::ControlType_MAX;
+constexpr int TransferControlRequest::ControlType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
+  return file_level_enum_descriptors_transfer_2eproto[3];
+}
+bool MessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ListingEncoding_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
+  return file_level_enum_descriptors_transfer_2eproto[4];
+}
+bool ListingEncoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TransferStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transfer_2eproto);
+  return file_level_enum_descriptors_transfer_2eproto[5];
+}
 bool TransferStatus_IsValid(int value) {
   switch (value) {
     case 0:
@@ -729,295 +1498,191 @@ bool TransferStatus_IsValid(int value) {
 
 // ===================================================================
 
-void RequestHeader::InitAsDefaultInstance() {
-}
-class RequestHeader::HasBitSetters {
+class RequestHeader::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RequestHeader::kSessionIdFieldNumber;
-const int RequestHeader::kTypeFieldNumber;
-const int RequestHeader::kTimestampFieldNumber;
-const int RequestHeader::kSequenceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-RequestHeader::RequestHeader()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.RequestHeader)
+RequestHeader::RequestHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.RequestHeader)
 }
 RequestHeader::RequestHeader(const RequestHeader& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  session_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.session_id().size() > 0) {
-    session_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.session_id_);
-  }
-  ::memcpy(&timestamp_, &from.timestamp_,
-    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
-    reinterpret_cast<char*>(&timestamp_)) + sizeof(type_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.sequence_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.type_));
   // @@protoc_insertion_point(copy_constructor:transfer.RequestHeader)
 }
 
-void RequestHeader::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RequestHeader_transfer_2eproto.base);
-  session_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&type_) -
-      reinterpret_cast<char*>(&timestamp_)) + sizeof(type_));
+inline void RequestHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RequestHeader::~RequestHeader() {
   // @@protoc_insertion_point(destructor:transfer.RequestHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RequestHeader::SharedDtor() {
-  session_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RequestHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
 }
 
 void RequestHeader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestHeader& RequestHeader::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestHeader_transfer_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RequestHeader::Clear() {
 // @@protoc_insertion_point(message_clear_start:transfer.RequestHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  session_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&type_) -
-      reinterpret_cast<char*>(&timestamp_)) + sizeof(type_));
-  _internal_metadata_.Clear();
+  _impl_.session_id_.ClearToEmpty();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* RequestHeader::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RequestHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string session_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_session_id(), ptr, ctx, "transfer.RequestHeader.session_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.RequestHeader.session_id"));
+        } else
+          goto handle_unusual;
         continue;
       // .transfer.MessageType type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          set_type(static_cast<::transfer::MessageType>(val));
-        } else goto handle_unusual;
+          _internal_set_type(static_cast<::transfer::MessageType>(val));
+        } else
+          goto handle_unusual;
         continue;
       // uint64 timestamp = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint64 sequence = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool RequestHeader::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.RequestHeader)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string session_id = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_session_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->session_id().data(), static_cast<int>(this->session_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.RequestHeader.session_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .transfer.MessageType type = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::transfer::MessageType >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 timestamp = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &timestamp_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 sequence = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &sequence_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.RequestHeader)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.RequestHeader)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void RequestHeader::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.RequestHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string session_id = 1;
-  if (this->session_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->session_id().data(), static_cast<int>(this->session_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.RequestHeader.session_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->session_id(), output);
-  }
-
-  // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
-  }
-
-  // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(3, this->timestamp(), output);
-  }
-
-  // uint64 sequence = 4;
-  if (this->sequence() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(4, this->sequence(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.RequestHeader)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestHeader::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+uint8_t* RequestHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:transfer.RequestHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string session_id = 1;
-  if (this->session_id().size() > 0) {
+  if (!this->_internal_session_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->session_id().data(), static_cast<int>(this->session_id().length()),
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.RequestHeader.session_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->session_id(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_session_id(), target);
   }
 
   // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
   // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->timestamp(), target);
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
   }
 
   // uint64 sequence = 4;
-  if (this->sequence() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->sequence(), target);
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sequence(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:transfer.RequestHeader)
   return target;
@@ -1027,89 +1692,64 @@ size_t RequestHeader::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:transfer.RequestHeader)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string session_id = 1;
-  if (this->session_id().size() > 0) {
+  if (!this->_internal_session_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->session_id());
+        this->_internal_session_id());
   }
 
   // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->timestamp());
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
   }
 
   // uint64 sequence = 4;
-  if (this->sequence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->sequence());
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
   }
 
   // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestHeader::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.RequestHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestHeader* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestHeader>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.RequestHeader)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.RequestHeader)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestHeader::GetClassData() const { return &_class_data_; }
 
-void RequestHeader::MergeFrom(const RequestHeader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.RequestHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.session_id().size() > 0) {
+void RequestHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestHeader*>(&to_msg);
+  auto& from = static_cast<const RequestHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.RequestHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    session_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.session_id_);
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
   }
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
-  if (from.sequence() != 0) {
-    set_sequence(from.sequence());
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void RequestHeader::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.RequestHeader)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RequestHeader::CopyFrom(const RequestHeader& from) {
@@ -1123,449 +1763,304 @@ bool RequestHeader::IsInitialized() const {
   return true;
 }
 
-void RequestHeader::Swap(RequestHeader* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RequestHeader::InternalSwap(RequestHeader* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  session_id_.Swap(&other->session_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(timestamp_, other->timestamp_);
-  swap(sequence_, other->sequence_);
-  swap(type_, other->type_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestHeader, _impl_.type_)
+      + sizeof(RequestHeader::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(RequestHeader, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RequestHeader::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void ResponseHeader::InitAsDefaultInstance() {
-}
-class ResponseHeader::HasBitSetters {
+class ResponseHeader::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ResponseHeader::kSessionIdFieldNumber;
-const int ResponseHeader::kTypeFieldNumber;
-const int ResponseHeader::kTimestampFieldNumber;
-const int ResponseHeader::kSuccessFieldNumber;
-const int ResponseHeader::kErrorCodeFieldNumber;
-const int ResponseHeader::kErrorMessageFieldNumber;
-const int ResponseHeader::kSequenceFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ResponseHeader::ResponseHeader()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.ResponseHeader)
+ResponseHeader::ResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ResponseHeader)
 }
 ResponseHeader::ResponseHeader(const ResponseHeader& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  session_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.session_id().size() > 0) {
-    session_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.session_id_);
-  }
-  error_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.error_code().size() > 0) {
-    error_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_code_);
-  }
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&timestamp_, &from.timestamp_,
-    static_cast<size_t>(reinterpret_cast<char*>(&sequence_) -
-    reinterpret_cast<char*>(&timestamp_)) + sizeof(sequence_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResponseHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.error_code_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_code().empty()) {
+    _this->_impl_.error_code_.Set(from._internal_error_code(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.sequence_));
   // @@protoc_insertion_point(copy_constructor:transfer.ResponseHeader)
 }
 
-void ResponseHeader::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ResponseHeader_transfer_2eproto.base);
-  session_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sequence_) -
-      reinterpret_cast<char*>(&timestamp_)) + sizeof(sequence_));
+inline void ResponseHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.error_code_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.timestamp_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ResponseHeader::~ResponseHeader() {
   // @@protoc_insertion_point(destructor:transfer.ResponseHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ResponseHeader::SharedDtor() {
-  session_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_code_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ResponseHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  _impl_.error_code_.Destroy();
+  _impl_.error_message_.Destroy();
 }
 
 void ResponseHeader::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ResponseHeader& ResponseHeader::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ResponseHeader_transfer_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ResponseHeader::Clear() {
 // @@protoc_insertion_point(message_clear_start:transfer.ResponseHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  session_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&timestamp_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&sequence_) -
-      reinterpret_cast<char*>(&timestamp_)) + sizeof(sequence_));
-  _internal_metadata_.Clear();
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.error_code_.ClearToEmpty();
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* ResponseHeader::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ResponseHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string session_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_session_id(), ptr, ctx, "transfer.ResponseHeader.session_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ResponseHeader.session_id"));
+        } else
+          goto handle_unusual;
         continue;
       // .transfer.MessageType type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          set_type(static_cast<::transfer::MessageType>(val));
-        } else goto handle_unusual;
+          _internal_set_type(static_cast<::transfer::MessageType>(val));
+        } else
+          goto handle_unusual;
         continue;
       // uint64 timestamp = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool success = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string error_code = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_error_code(), ptr, ctx, "transfer.ResponseHeader.error_code");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_error_code();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ResponseHeader.error_code"));
+        } else
+          goto handle_unusual;
         continue;
       // string error_message = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_error_message(), ptr, ctx, "transfer.ResponseHeader.error_message");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ResponseHeader.error_message"));
+        } else
+          goto handle_unusual;
         continue;
       // uint64 sequence = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool ResponseHeader::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.ResponseHeader)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string session_id = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_session_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->session_id().data(), static_cast<int>(this->session_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.ResponseHeader.session_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .transfer.MessageType type = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::transfer::MessageType >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 timestamp = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &timestamp_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool success = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string error_code = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_code()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->error_code().data(), static_cast<int>(this->error_code().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.ResponseHeader.error_code"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string error_message = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.ResponseHeader.error_message"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 sequence = 7;
-      case 7: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &sequence_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.ResponseHeader)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.ResponseHeader)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void ResponseHeader::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.ResponseHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string session_id = 1;
-  if (this->session_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->session_id().data(), static_cast<int>(this->session_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.ResponseHeader.session_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->session_id(), output);
-  }
-
-  // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      2, this->type(), output);
-  }
-
-  // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(3, this->timestamp(), output);
-  }
-
-  // bool success = 4;
-  if (this->success() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(4, this->success(), output);
-  }
-
-  // string error_code = 5;
-  if (this->error_code().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_code().data(), static_cast<int>(this->error_code().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.ResponseHeader.error_code");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->error_code(), output);
-  }
-
-  // string error_message = 6;
-  if (this->error_message().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.ResponseHeader.error_message");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->error_message(), output);
-  }
-
-  // uint64 sequence = 7;
-  if (this->sequence() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(7, this->sequence(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.ResponseHeader)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* ResponseHeader::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+uint8_t* ResponseHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:transfer.ResponseHeader)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string session_id = 1;
-  if (this->session_id().size() > 0) {
+  if (!this->_internal_session_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->session_id().data(), static_cast<int>(this->session_id().length()),
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.ResponseHeader.session_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->session_id(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_session_id(), target);
   }
 
   // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      2, this->type(), target);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
   // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->timestamp(), target);
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_timestamp(), target);
   }
 
   // bool success = 4;
-  if (this->success() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_success(), target);
   }
 
   // string error_code = 5;
-  if (this->error_code().size() > 0) {
+  if (!this->_internal_error_code().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_code().data(), static_cast<int>(this->error_code().length()),
+      this->_internal_error_code().data(), static_cast<int>(this->_internal_error_code().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.ResponseHeader.error_code");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        5, this->error_code(), target);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_error_code(), target);
   }
 
   // string error_message = 6;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.ResponseHeader.error_message");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        6, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_error_message(), target);
   }
 
   // uint64 sequence = 7;
-  if (this->sequence() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(7, this->sequence(), target);
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_sequence(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:transfer.ResponseHeader)
   return target;
@@ -1575,119 +2070,92 @@ size_t ResponseHeader::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:transfer.ResponseHeader)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string session_id = 1;
-  if (this->session_id().size() > 0) {
+  if (!this->_internal_session_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->session_id());
+        this->_internal_session_id());
   }
 
   // string error_code = 5;
-  if (this->error_code().size() > 0) {
+  if (!this->_internal_error_code().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->error_code());
+        this->_internal_error_code());
   }
 
   // string error_message = 6;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->error_message());
+        this->_internal_error_message());
   }
 
   // uint64 timestamp = 3;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->timestamp());
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
   }
 
   // .transfer.MessageType type = 2;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   // bool success = 4;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
   // uint64 sequence = 7;
-  if (this->sequence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->sequence());
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ResponseHeader::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.ResponseHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ResponseHeader* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ResponseHeader>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.ResponseHeader)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.ResponseHeader)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResponseHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResponseHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResponseHeader::GetClassData() const { return &_class_data_; }
 
-void ResponseHeader::MergeFrom(const ResponseHeader& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.ResponseHeader)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.session_id().size() > 0) {
+void ResponseHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResponseHeader*>(&to_msg);
+  auto& from = static_cast<const ResponseHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ResponseHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    session_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.session_id_);
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
   }
-  if (from.error_code().size() > 0) {
-
-    error_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_code_);
+  if (!from._internal_error_code().empty()) {
+    _this->_internal_set_error_code(from._internal_error_code());
   }
-  if (from.error_message().size() > 0) {
-
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-  if (from.sequence() != 0) {
-    set_sequence(from.sequence());
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
   }
-}
-
-void ResponseHeader::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.ResponseHeader)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ResponseHeader::CopyFrom(const ResponseHeader& from) {
@@ -1701,351 +2169,378 @@ bool ResponseHeader::IsInitialized() const {
   return true;
 }
 
-void ResponseHeader::Swap(ResponseHeader* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ResponseHeader::InternalSwap(ResponseHeader* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  session_id_.Swap(&other->session_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  error_code_.Swap(&other->error_code_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  error_message_.Swap(&other->error_message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(timestamp_, other->timestamp_);
-  swap(type_, other->type_);
-  swap(success_, other->success_);
-  swap(sequence_, other->sequence_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_code_, lhs_arena,
+      &other->_impl_.error_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResponseHeader, _impl_.sequence_)
+      + sizeof(ResponseHeader::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(ResponseHeader, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ResponseHeader::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void DirectoryRequest::InitAsDefaultInstance() {
-  ::transfer::_DirectoryRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::RequestHeader*>(
-      ::transfer::RequestHeader::internal_default_instance());
-}
-class DirectoryRequest::HasBitSetters {
+class DirectoryRequest::_Internal {
  public:
   static const ::transfer::RequestHeader& header(const DirectoryRequest* msg);
 };
 
 const ::transfer::RequestHeader&
-DirectoryRequest::HasBitSetters::header(const DirectoryRequest* msg) {
-  return *msg->header_;
+DirectoryRequest::_Internal::header(const DirectoryRequest* msg) {
+  return *msg->_impl_.header_;
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DirectoryRequest::kHeaderFieldNumber;
-const int DirectoryRequest::kCurrentPathFieldNumber;
-const int DirectoryRequest::kDirNameFieldNumber;
-const int DirectoryRequest::kIsParentFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DirectoryRequest::DirectoryRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DirectoryRequest)
+DirectoryRequest::DirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DirectoryRequest)
 }
 DirectoryRequest::DirectoryRequest(const DirectoryRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  current_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.current_path().size() > 0) {
-    current_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.current_path_);
-  }
-  dir_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.dir_name().size() > 0) {
-    dir_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.dir_name_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::RequestHeader(*from.header_);
-  } else {
-    header_ = nullptr;
-  }
-  is_parent_ = from.is_parent_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.current_path_){}
+    , decltype(_impl_.dir_name_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.if_none_match_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.is_parent_){}
+    , decltype(_impl_.page_size_){}
+    , decltype(_impl_.since_version_){}
+    , decltype(_impl_.encoding_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.current_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.current_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_current_path().empty()) {
+    _this->_impl_.current_path_.Set(from._internal_current_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.dir_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dir_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dir_name().empty()) {
+    _this->_impl_.dir_name_.Set(from._internal_dir_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cursor().empty()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.if_none_match_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.if_none_match_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_if_none_match().empty()) {
+    _this->_impl_.if_none_match_.Set(from._internal_if_none_match(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.is_parent_, &from._impl_.is_parent_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.encoding_) -
+    reinterpret_cast<char*>(&_impl_.is_parent_)) + sizeof(_impl_.encoding_));
   // @@protoc_insertion_point(copy_constructor:transfer.DirectoryRequest)
 }
 
-void DirectoryRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DirectoryRequest_transfer_2eproto.base);
-  current_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  dir_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&is_parent_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(is_parent_));
+inline void DirectoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.current_path_){}
+    , decltype(_impl_.dir_name_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.if_none_match_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.is_parent_){false}
+    , decltype(_impl_.page_size_){0u}
+    , decltype(_impl_.since_version_){uint64_t{0u}}
+    , decltype(_impl_.encoding_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.current_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.current_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.dir_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dir_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.if_none_match_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.if_none_match_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DirectoryRequest::~DirectoryRequest() {
   // @@protoc_insertion_point(destructor:transfer.DirectoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DirectoryRequest::SharedDtor() {
-  current_path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  dir_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void DirectoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.current_path_.Destroy();
+  _impl_.dir_name_.Destroy();
+  _impl_.cursor_.Destroy();
+  _impl_.if_none_match_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
 void DirectoryRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const DirectoryRequest& DirectoryRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DirectoryRequest_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void DirectoryRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:transfer.DirectoryRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  current_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  dir_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.current_path_.ClearToEmpty();
+  _impl_.dir_name_.ClearToEmpty();
+  _impl_.cursor_.ClearToEmpty();
+  _impl_.if_none_match_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  is_parent_ = false;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.is_parent_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.encoding_) -
+      reinterpret_cast<char*>(&_impl_.is_parent_)) + sizeof(_impl_.encoding_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DirectoryRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DirectoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string current_path = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_current_path(), ptr, ctx, "transfer.DirectoryRequest.current_path");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_current_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryRequest.current_path"));
+        } else
+          goto handle_unusual;
         continue;
       // string dir_name = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_dir_name(), ptr, ctx, "transfer.DirectoryRequest.dir_name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_dir_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryRequest.dir_name"));
+        } else
+          goto handle_unusual;
         continue;
       // bool is_parent = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          is_parent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.is_parent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cursor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryRequest.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.page_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string if_none_match = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_if_none_match();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryRequest.if_none_match"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 since_version = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.since_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .transfer.ListingEncoding encoding = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::transfer::ListingEncoding>(val));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DirectoryRequest::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DirectoryRequest)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.RequestHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string current_path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_current_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->current_path().data(), static_cast<int>(this->current_path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryRequest.current_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string dir_name = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_dir_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->dir_name().data(), static_cast<int>(this->dir_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryRequest.dir_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool is_parent = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_parent_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DirectoryRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DirectoryRequest)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DirectoryRequest::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DirectoryRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DirectoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DirectoryRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
   // string current_path = 2;
-  if (this->current_path().size() > 0) {
+  if (!this->_internal_current_path().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->current_path().data(), static_cast<int>(this->current_path().length()),
+      this->_internal_current_path().data(), static_cast<int>(this->_internal_current_path().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryRequest.current_path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->current_path(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_current_path(), target);
   }
 
   // string dir_name = 3;
-  if (this->dir_name().size() > 0) {
+  if (!this->_internal_dir_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->dir_name().data(), static_cast<int>(this->dir_name().length()),
+      this->_internal_dir_name().data(), static_cast<int>(this->_internal_dir_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryRequest.dir_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->dir_name(), output);
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_dir_name(), target);
   }
 
   // bool is_parent = 4;
-  if (this->is_parent() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(4, this->is_parent(), output);
+  if (this->_internal_is_parent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_is_parent(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // string cursor = 5;
+  if (!this->_internal_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DirectoryRequest.cursor");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_cursor(), target);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DirectoryRequest)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* DirectoryRequest::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DirectoryRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // uint32 page_size = 6;
+  if (this->_internal_page_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_page_size(), target);
   }
 
-  // string current_path = 2;
-  if (this->current_path().size() > 0) {
+  // string if_none_match = 7;
+  if (!this->_internal_if_none_match().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->current_path().data(), static_cast<int>(this->current_path().length()),
+      this->_internal_if_none_match().data(), static_cast<int>(this->_internal_if_none_match().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryRequest.current_path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->current_path(), target);
+      "transfer.DirectoryRequest.if_none_match");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_if_none_match(), target);
   }
 
-  // string dir_name = 3;
-  if (this->dir_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->dir_name().data(), static_cast<int>(this->dir_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryRequest.dir_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        3, this->dir_name(), target);
+  // uint64 since_version = 8;
+  if (this->_internal_since_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_since_version(), target);
   }
 
-  // bool is_parent = 4;
-  if (this->is_parent() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->is_parent(), target);
+  // .transfer.ListingEncoding encoding = 9;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_encoding(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:transfer.DirectoryRequest)
   return target;
@@ -2055,89 +2550,113 @@ size_t DirectoryRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:transfer.DirectoryRequest)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string current_path = 2;
-  if (this->current_path().size() > 0) {
+  if (!this->_internal_current_path().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->current_path());
+        this->_internal_current_path());
   }
 
   // string dir_name = 3;
-  if (this->dir_name().size() > 0) {
+  if (!this->_internal_dir_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_dir_name());
+  }
+
+  // string cursor = 5;
+  if (!this->_internal_cursor().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->dir_name());
+        this->_internal_cursor());
+  }
+
+  // string if_none_match = 7;
+  if (!this->_internal_if_none_match().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_if_none_match());
   }
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
   // bool is_parent = 4;
-  if (this->is_parent() != 0) {
+  if (this->_internal_is_parent() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint32 page_size = 6;
+  if (this->_internal_page_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page_size());
+  }
+
+  // uint64 since_version = 8;
+  if (this->_internal_since_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_since_version());
+  }
 
-void DirectoryRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DirectoryRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DirectoryRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DirectoryRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DirectoryRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DirectoryRequest)
-    MergeFrom(*source);
+  // .transfer.ListingEncoding encoding = 9;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DirectoryRequest::MergeFrom(const DirectoryRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectoryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectoryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectoryRequest::GetClassData() const { return &_class_data_; }
 
-  if (from.current_path().size() > 0) {
 
-    current_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.current_path_);
-  }
-  if (from.dir_name().size() > 0) {
+void DirectoryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectoryRequest*>(&to_msg);
+  auto& from = static_cast<const DirectoryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    dir_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.dir_name_);
+  if (!from._internal_current_path().empty()) {
+    _this->_internal_set_current_path(from._internal_current_path());
   }
-  if (from.has_header()) {
-    mutable_header()->::transfer::RequestHeader::MergeFrom(from.header());
+  if (!from._internal_dir_name().empty()) {
+    _this->_internal_set_dir_name(from._internal_dir_name());
   }
-  if (from.is_parent() != 0) {
-    set_is_parent(from.is_parent());
+  if (!from._internal_cursor().empty()) {
+    _this->_internal_set_cursor(from._internal_cursor());
   }
-}
-
-void DirectoryRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DirectoryRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_if_none_match().empty()) {
+    _this->_internal_set_if_none_match(from._internal_if_none_match());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_is_parent() != 0) {
+    _this->_internal_set_is_parent(from._internal_is_parent());
+  }
+  if (from._internal_page_size() != 0) {
+    _this->_internal_set_page_size(from._internal_page_size());
+  }
+  if (from._internal_since_version() != 0) {
+    _this->_internal_set_since_version(from._internal_since_version());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DirectoryRequest::CopyFrom(const DirectoryRequest& from) {
@@ -2151,470 +2670,734 @@ bool DirectoryRequest::IsInitialized() const {
   return true;
 }
 
-void DirectoryRequest::Swap(DirectoryRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DirectoryRequest::InternalSwap(DirectoryRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  current_path_.Swap(&other->current_path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  dir_name_.Swap(&other->dir_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
-  swap(is_parent_, other->is_parent_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.current_path_, lhs_arena,
+      &other->_impl_.current_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dir_name_, lhs_arena,
+      &other->_impl_.dir_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.if_none_match_, lhs_arena,
+      &other->_impl_.if_none_match_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DirectoryRequest, _impl_.encoding_)
+      + sizeof(DirectoryRequest::_impl_.encoding_)
+      - PROTOBUF_FIELD_OFFSET(DirectoryRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DirectoryRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void DirectoryResponse_FileInfo::InitAsDefaultInstance() {
-}
-class DirectoryResponse_FileInfo::HasBitSetters {
+class ListingColumns::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DirectoryResponse_FileInfo::kNameFieldNumber;
-const int DirectoryResponse_FileInfo::kIsDirectoryFieldNumber;
-const int DirectoryResponse_FileInfo::kSizeFieldNumber;
-const int DirectoryResponse_FileInfo::kModifyTimeFieldNumber;
-const int DirectoryResponse_FileInfo::kPermissionsFieldNumber;
-const int DirectoryResponse_FileInfo::kTaskIdFieldNumber;
-const int DirectoryResponse_FileInfo::kStatusFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DirectoryResponse_FileInfo::DirectoryResponse_FileInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DirectoryResponse.FileInfo)
-}
-DirectoryResponse_FileInfo::DirectoryResponse_FileInfo(const DirectoryResponse_FileInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  modify_time_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.modify_time().size() > 0) {
-    modify_time_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modify_time_);
-  }
-  permissions_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.permissions().size() > 0) {
-    permissions_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.permissions_);
-  }
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  ::memcpy(&size_, &from.size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&status_) -
-    reinterpret_cast<char*>(&size_)) + sizeof(status_));
-  // @@protoc_insertion_point(copy_constructor:transfer.DirectoryResponse.FileInfo)
-}
-
-void DirectoryResponse_FileInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DirectoryResponse_FileInfo_transfer_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modify_time_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  permissions_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(status_));
-}
-
-DirectoryResponse_FileInfo::~DirectoryResponse_FileInfo() {
-  // @@protoc_insertion_point(destructor:transfer.DirectoryResponse.FileInfo)
+ListingColumns::ListingColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ListingColumns)
+}
+ListingColumns::ListingColumns(const ListingColumns& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListingColumns* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_lengths_){from._impl_.name_lengths_}
+    , /*decltype(_impl_._name_lengths_cached_byte_size_)*/{0}
+    , decltype(_impl_.sizes_){from._impl_.sizes_}
+    , /*decltype(_impl_._sizes_cached_byte_size_)*/{0}
+    , decltype(_impl_.modify_times_){from._impl_.modify_times_}
+    , /*decltype(_impl_._modify_times_cached_byte_size_)*/{0}
+    , decltype(_impl_.modes_){from._impl_.modes_}
+    , /*decltype(_impl_._modes_cached_byte_size_)*/{0}
+    , decltype(_impl_.names_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.names_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.names_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_names().empty()) {
+    _this->_impl_.names_.Set(from._internal_names(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.ListingColumns)
+}
+
+inline void ListingColumns::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_lengths_){arena}
+    , /*decltype(_impl_._name_lengths_cached_byte_size_)*/{0}
+    , decltype(_impl_.sizes_){arena}
+    , /*decltype(_impl_._sizes_cached_byte_size_)*/{0}
+    , decltype(_impl_.modify_times_){arena}
+    , /*decltype(_impl_._modify_times_cached_byte_size_)*/{0}
+    , decltype(_impl_.modes_){arena}
+    , /*decltype(_impl_._modes_cached_byte_size_)*/{0}
+    , decltype(_impl_.names_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.names_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.names_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ListingColumns::~ListingColumns() {
+  // @@protoc_insertion_point(destructor:transfer.ListingColumns)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DirectoryResponse_FileInfo::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modify_time_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  permissions_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ListingColumns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_lengths_.~RepeatedField();
+  _impl_.sizes_.~RepeatedField();
+  _impl_.modify_times_.~RepeatedField();
+  _impl_.modes_.~RepeatedField();
+  _impl_.names_.Destroy();
 }
 
-void DirectoryResponse_FileInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DirectoryResponse_FileInfo& DirectoryResponse_FileInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DirectoryResponse_FileInfo_transfer_2eproto.base);
-  return *internal_default_instance();
+void ListingColumns::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void DirectoryResponse_FileInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.DirectoryResponse.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ListingColumns::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ListingColumns)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  modify_time_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  permissions_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&size_)) + sizeof(status_));
-  _internal_metadata_.Clear();
+  _impl_.name_lengths_.Clear();
+  _impl_.sizes_.Clear();
+  _impl_.modify_times_.Clear();
+  _impl_.modes_.Clear();
+  _impl_.names_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DirectoryResponse_FileInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ListingColumns::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string name = 1;
+      // bytes names = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_name(), ptr, ctx, "transfer.DirectoryResponse.FileInfo.name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_names();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool is_directory = 2;
+      // repeated uint32 name_lengths = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          is_directory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_name_lengths(), ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_name_lengths(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // uint64 size = 3;
+      // repeated uint64 sizes = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_sizes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_sizes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string modify_time = 4;
+      // repeated uint64 modify_times = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_modify_time(), ptr, ctx, "transfer.DirectoryResponse.FileInfo.modify_time");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_modify_times(), ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_modify_times(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // string permissions = 5;
+      // repeated uint32 modes = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_permissions(), ptr, ctx, "transfer.DirectoryResponse.FileInfo.permissions");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_modes(), ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string task_id = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.DirectoryResponse.FileInfo.task_id");
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_modes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .transfer.TransferStatus status = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-          set_status(static_cast<::transfer::TransferStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DirectoryResponse_FileInfo::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DirectoryResponse.FileInfo)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->name().data(), static_cast<int>(this->name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryResponse.FileInfo.name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool is_directory = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_directory_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
 
-      // uint64 size = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+uint8_t* ListingColumns::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ListingColumns)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // bytes names = 1;
+  if (!this->_internal_names().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_names(), target);
+  }
 
-      // string modify_time = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_modify_time()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->modify_time().data(), static_cast<int>(this->modify_time().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryResponse.FileInfo.modify_time"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated uint32 name_lengths = 2;
+  {
+    int byte_size = _impl_._name_lengths_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_name_lengths(), byte_size, target);
+    }
+  }
 
-      // string permissions = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_permissions()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->permissions().data(), static_cast<int>(this->permissions().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryResponse.FileInfo.permissions"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated uint64 sizes = 3;
+  {
+    int byte_size = _impl_._sizes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          3, _internal_sizes(), byte_size, target);
+    }
+  }
 
-      // string task_id = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryResponse.FileInfo.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // repeated uint64 modify_times = 4;
+  {
+    int byte_size = _impl_._modify_times_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          4, _internal_modify_times(), byte_size, target);
+    }
+  }
 
-      // .transfer.TransferStatus status = 7;
-      case 7: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::transfer::TransferStatus >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+  // repeated uint32 modes = 5;
+  {
+    int byte_size = _impl_._modes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_modes(), byte_size, target);
     }
   }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DirectoryResponse.FileInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DirectoryResponse.FileInfo)
-  return false;
-#undef DO_
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ListingColumns)
+  return target;
 }
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DirectoryResponse_FileInfo::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DirectoryResponse.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+size_t ListingColumns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ListingColumns)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string name = 1;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryResponse.FileInfo.name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
+  // repeated uint32 name_lengths = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.name_lengths_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._name_lengths_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // bool is_directory = 2;
-  if (this->is_directory() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(2, this->is_directory(), output);
+  // repeated uint64 sizes = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.sizes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._sizes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // uint64 size = 3;
-  if (this->size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(3, this->size(), output);
+  // repeated uint64 modify_times = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.modify_times_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._modify_times_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // string modify_time = 4;
-  if (this->modify_time().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->modify_time().data(), static_cast<int>(this->modify_time().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryResponse.FileInfo.modify_time");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->modify_time(), output);
+  // repeated uint32 modes = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.modes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._modes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // string permissions = 5;
-  if (this->permissions().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->permissions().data(), static_cast<int>(this->permissions().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryResponse.FileInfo.permissions");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->permissions(), output);
+  // bytes names = 1;
+  if (!this->_internal_names().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_names());
   }
 
-  // string task_id = 6;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryResponse.FileInfo.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->task_id(), output);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // .transfer.TransferStatus status = 7;
-  if (this->status() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      7, this->status(), output);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListingColumns::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListingColumns::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListingColumns::GetClassData() const { return &_class_data_; }
+
+
+void ListingColumns::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListingColumns*>(&to_msg);
+  auto& from = static_cast<const ListingColumns&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ListingColumns)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.name_lengths_.MergeFrom(from._impl_.name_lengths_);
+  _this->_impl_.sizes_.MergeFrom(from._impl_.sizes_);
+  _this->_impl_.modify_times_.MergeFrom(from._impl_.modify_times_);
+  _this->_impl_.modes_.MergeFrom(from._impl_.modes_);
+  if (!from._internal_names().empty()) {
+    _this->_internal_set_names(from._internal_names());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListingColumns::CopyFrom(const ListingColumns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ListingColumns)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListingColumns::IsInitialized() const {
+  return true;
+}
+
+void ListingColumns::InternalSwap(ListingColumns* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.name_lengths_.InternalSwap(&other->_impl_.name_lengths_);
+  _impl_.sizes_.InternalSwap(&other->_impl_.sizes_);
+  _impl_.modify_times_.InternalSwap(&other->_impl_.modify_times_);
+  _impl_.modes_.InternalSwap(&other->_impl_.modes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.names_, lhs_arena,
+      &other->_impl_.names_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListingColumns::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[3]);
+}
+
+// ===================================================================
+
+class DirectoryResponse_FileInfo::_Internal {
+ public:
+};
+
+DirectoryResponse_FileInfo::DirectoryResponse_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DirectoryResponse.FileInfo)
+}
+DirectoryResponse_FileInfo::DirectoryResponse_FileInfo(const DirectoryResponse_FileInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectoryResponse_FileInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.permissions_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.is_directory_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.modify_time_ns_){}
+    , decltype(_impl_.mode_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_modify_time().empty()) {
+    _this->_impl_.modify_time_.Set(from._internal_modify_time(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.permissions_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.permissions_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_permissions().empty()) {
+    _this->_impl_.permissions_.Set(from._internal_permissions(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.mode_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.mode_));
+  // @@protoc_insertion_point(copy_constructor:transfer.DirectoryResponse.FileInfo)
+}
+
+inline void DirectoryResponse_FileInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.permissions_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.is_directory_){false}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.modify_time_ns_){uint64_t{0u}}
+    , decltype(_impl_.mode_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.permissions_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.permissions_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+DirectoryResponse_FileInfo::~DirectoryResponse_FileInfo() {
+  // @@protoc_insertion_point(destructor:transfer.DirectoryResponse.FileInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DirectoryResponse.FileInfo)
+  SharedDtor();
+}
+
+inline void DirectoryResponse_FileInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.modify_time_.Destroy();
+  _impl_.permissions_.Destroy();
+  _impl_.task_id_.Destroy();
+}
+
+void DirectoryResponse_FileInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DirectoryResponse_FileInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.DirectoryResponse.FileInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _impl_.modify_time_.ClearToEmpty();
+  _impl_.permissions_.ClearToEmpty();
+  _impl_.task_id_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.mode_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.mode_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DirectoryResponse_FileInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.FileInfo.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_directory = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.is_directory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string modify_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_modify_time();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.FileInfo.modify_time"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string permissions = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_permissions();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.FileInfo.permissions"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.FileInfo.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.TransferStatus status = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::transfer::TransferStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 modify_time_ns = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.modify_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 mode = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* DirectoryResponse_FileInfo::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+uint8_t* DirectoryResponse_FileInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:transfer.DirectoryResponse.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->name().data(), static_cast<int>(this->name().length()),
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryResponse.FileInfo.name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
   // bool is_directory = 2;
-  if (this->is_directory() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->is_directory(), target);
+  if (this->_internal_is_directory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_is_directory(), target);
   }
 
   // uint64 size = 3;
-  if (this->size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->size(), target);
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
   }
 
   // string modify_time = 4;
-  if (this->modify_time().size() > 0) {
+  if (!this->_internal_modify_time().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->modify_time().data(), static_cast<int>(this->modify_time().length()),
+      this->_internal_modify_time().data(), static_cast<int>(this->_internal_modify_time().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryResponse.FileInfo.modify_time");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        4, this->modify_time(), target);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_modify_time(), target);
   }
 
   // string permissions = 5;
-  if (this->permissions().size() > 0) {
+  if (!this->_internal_permissions().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->permissions().data(), static_cast<int>(this->permissions().length()),
+      this->_internal_permissions().data(), static_cast<int>(this->_internal_permissions().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryResponse.FileInfo.permissions");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        5, this->permissions(), target);
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_permissions(), target);
   }
 
   // string task_id = 6;
-  if (this->task_id().size() > 0) {
+  if (!this->_internal_task_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryResponse.FileInfo.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        6, this->task_id(), target);
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_task_id(), target);
   }
 
   // .transfer.TransferStatus status = 7;
-  if (this->status() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      7, this->status(), target);
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_status(), target);
+  }
+
+  // uint64 modify_time_ns = 8;
+  if (this->_internal_modify_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_modify_time_ns(), target);
+  }
+
+  // uint32 mode = 9;
+  if (this->_internal_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_mode(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:transfer.DirectoryResponse.FileInfo)
   return target;
@@ -2624,124 +3407,114 @@ size_t DirectoryResponse_FileInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:transfer.DirectoryResponse.FileInfo)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->name());
+        this->_internal_name());
   }
 
   // string modify_time = 4;
-  if (this->modify_time().size() > 0) {
+  if (!this->_internal_modify_time().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->modify_time());
+        this->_internal_modify_time());
   }
 
   // string permissions = 5;
-  if (this->permissions().size() > 0) {
+  if (!this->_internal_permissions().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->permissions());
+        this->_internal_permissions());
   }
 
   // string task_id = 6;
-  if (this->task_id().size() > 0) {
+  if (!this->_internal_task_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
+        this->_internal_task_id());
   }
 
   // uint64 size = 3;
-  if (this->size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->size());
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
   }
 
   // bool is_directory = 2;
-  if (this->is_directory() != 0) {
+  if (this->_internal_is_directory() != 0) {
     total_size += 1 + 1;
   }
 
   // .transfer.TransferStatus status = 7;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 modify_time_ns = 8;
+  if (this->_internal_modify_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_modify_time_ns());
+  }
 
-void DirectoryResponse_FileInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DirectoryResponse.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DirectoryResponse_FileInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DirectoryResponse_FileInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DirectoryResponse.FileInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DirectoryResponse.FileInfo)
-    MergeFrom(*source);
+  // uint32 mode = 9;
+  if (this->_internal_mode() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mode());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DirectoryResponse_FileInfo::MergeFrom(const DirectoryResponse_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryResponse.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectoryResponse_FileInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectoryResponse_FileInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectoryResponse_FileInfo::GetClassData() const { return &_class_data_; }
 
-  if (from.name().size() > 0) {
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
-  }
-  if (from.modify_time().size() > 0) {
+void DirectoryResponse_FileInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectoryResponse_FileInfo*>(&to_msg);
+  auto& from = static_cast<const DirectoryResponse_FileInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryResponse.FileInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    modify_time_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.modify_time_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.permissions().size() > 0) {
-
-    permissions_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.permissions_);
+  if (!from._internal_modify_time().empty()) {
+    _this->_internal_set_modify_time(from._internal_modify_time());
   }
-  if (from.task_id().size() > 0) {
-
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
+  if (!from._internal_permissions().empty()) {
+    _this->_internal_set_permissions(from._internal_permissions());
+  }
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_is_directory() != 0) {
+    _this->_internal_set_is_directory(from._internal_is_directory());
   }
-  if (from.size() != 0) {
-    set_size(from.size());
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
-  if (from.is_directory() != 0) {
-    set_is_directory(from.is_directory());
+  if (from._internal_modify_time_ns() != 0) {
+    _this->_internal_set_modify_time_ns(from._internal_modify_time_ns());
   }
-  if (from.status() != 0) {
-    set_status(from.status());
+  if (from._internal_mode() != 0) {
+    _this->_internal_set_mode(from._internal_mode());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DirectoryResponse_FileInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DirectoryResponse.FileInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void DirectoryResponse_FileInfo::CopyFrom(const DirectoryResponse_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DirectoryResponse.FileInfo)
+void DirectoryResponse_FileInfo::CopyFrom(const DirectoryResponse_FileInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DirectoryResponse.FileInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
@@ -2751,309 +3524,478 @@ bool DirectoryResponse_FileInfo::IsInitialized() const {
   return true;
 }
 
-void DirectoryResponse_FileInfo::Swap(DirectoryResponse_FileInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DirectoryResponse_FileInfo::InternalSwap(DirectoryResponse_FileInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  modify_time_.Swap(&other->modify_time_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  permissions_.Swap(&other->permissions_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(size_, other->size_);
-  swap(is_directory_, other->is_directory_);
-  swap(status_, other->status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.modify_time_, lhs_arena,
+      &other->_impl_.modify_time_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.permissions_, lhs_arena,
+      &other->_impl_.permissions_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DirectoryResponse_FileInfo, _impl_.mode_)
+      + sizeof(DirectoryResponse_FileInfo::_impl_.mode_)
+      - PROTOBUF_FIELD_OFFSET(DirectoryResponse_FileInfo, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DirectoryResponse_FileInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void DirectoryResponse::InitAsDefaultInstance() {
-  ::transfer::_DirectoryResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::ResponseHeader*>(
-      ::transfer::ResponseHeader::internal_default_instance());
-}
-class DirectoryResponse::HasBitSetters {
+class DirectoryResponse::_Internal {
  public:
   static const ::transfer::ResponseHeader& header(const DirectoryResponse* msg);
+  static const ::transfer::ListingColumns& columns(const DirectoryResponse* msg);
 };
 
 const ::transfer::ResponseHeader&
-DirectoryResponse::HasBitSetters::header(const DirectoryResponse* msg) {
-  return *msg->header_;
+DirectoryResponse::_Internal::header(const DirectoryResponse* msg) {
+  return *msg->_impl_.header_;
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DirectoryResponse::kHeaderFieldNumber;
-const int DirectoryResponse::kPathFieldNumber;
-const int DirectoryResponse::kFilesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DirectoryResponse::DirectoryResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DirectoryResponse)
+const ::transfer::ListingColumns&
+DirectoryResponse::_Internal::columns(const DirectoryResponse* msg) {
+  return *msg->_impl_.columns_;
+}
+DirectoryResponse::DirectoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DirectoryResponse)
 }
 DirectoryResponse::DirectoryResponse(const DirectoryResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      files_(from.files_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.path_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::ResponseHeader(*from.header_);
-  } else {
-    header_ = nullptr;
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectoryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){from._impl_.files_}
+    , decltype(_impl_.removed_){from._impl_.removed_}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.etag_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.columns_){nullptr}
+    , decltype(_impl_.total_count_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.has_more_){}
+    , decltype(_impl_.not_modified_){}
+    , decltype(_impl_.is_delta_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.base_version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_next_cursor().empty()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.etag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.etag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_etag().empty()) {
+    _this->_impl_.etag_.Set(from._internal_etag(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  if (from._internal_has_columns()) {
+    _this->_impl_.columns_ = new ::transfer::ListingColumns(*from._impl_.columns_);
+  }
+  ::memcpy(&_impl_.total_count_, &from._impl_.total_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.base_version_) -
+    reinterpret_cast<char*>(&_impl_.total_count_)) + sizeof(_impl_.base_version_));
   // @@protoc_insertion_point(copy_constructor:transfer.DirectoryResponse)
 }
 
-void DirectoryResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DirectoryResponse_transfer_2eproto.base);
-  path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  header_ = nullptr;
+inline void DirectoryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){arena}
+    , decltype(_impl_.removed_){arena}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.etag_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.columns_){nullptr}
+    , decltype(_impl_.total_count_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.has_more_){false}
+    , decltype(_impl_.not_modified_){false}
+    , decltype(_impl_.is_delta_){false}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.base_version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.etag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.etag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DirectoryResponse::~DirectoryResponse() {
   // @@protoc_insertion_point(destructor:transfer.DirectoryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DirectoryResponse::SharedDtor() {
-  path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void DirectoryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.files_.~RepeatedPtrField();
+  _impl_.removed_.~RepeatedPtrField();
+  _impl_.path_.Destroy();
+  _impl_.next_cursor_.Destroy();
+  _impl_.etag_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+  if (this != internal_default_instance()) delete _impl_.columns_;
 }
 
 void DirectoryResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const DirectoryResponse& DirectoryResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DirectoryResponse_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void DirectoryResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:transfer.DirectoryResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  files_.Clear();
-  path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.files_.Clear();
+  _impl_.removed_.Clear();
+  _impl_.path_.ClearToEmpty();
+  _impl_.next_cursor_.ClearToEmpty();
+  _impl_.etag_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.columns_ != nullptr) {
+    delete _impl_.columns_;
+  }
+  _impl_.columns_ = nullptr;
+  ::memset(&_impl_.total_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.base_version_) -
+      reinterpret_cast<char*>(&_impl_.total_count_)) + sizeof(_impl_.base_version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DirectoryResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DirectoryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string path = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_path(), ptr, ctx, "transfer.DirectoryResponse.path");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.path"));
+        } else
+          goto handle_unusual;
         continue;
       // repeated .transfer.DirectoryResponse.FileInfo files = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_files(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string next_cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool has_more = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.has_more_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string etag = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_etag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.etag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool not_modified = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.not_modified_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_delta = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.is_delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string removed = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_files(), ptr);
+            auto str = _internal_add_removed();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.DirectoryResponse.removed"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 26);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 base_version = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.base_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.ListingEncoding encoding = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::transfer::ListingEncoding>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.ListingColumns columns = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_columns(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DirectoryResponse::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DirectoryResponse)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->path().data(), static_cast<int>(this->path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DirectoryResponse.path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .transfer.DirectoryResponse.FileInfo files = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_files()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DirectoryResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DirectoryResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DirectoryResponse::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DirectoryResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DirectoryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DirectoryResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
   // string path = 2;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "transfer.DirectoryResponse.path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->path(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
   }
 
   // repeated .transfer.DirectoryResponse.FileInfo files = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3,
-      this->files(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_files_size()); i < n; i++) {
+    const auto& repfield = this->_internal_files(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // string next_cursor = 4;
+  if (!this->_internal_next_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DirectoryResponse.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next_cursor(), target);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DirectoryResponse)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* DirectoryResponse::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DirectoryResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // bool has_more = 5;
+  if (this->_internal_has_more() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_has_more(), target);
+  }
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // uint64 total_count = 6;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_total_count(), target);
   }
 
-  // string path = 2;
-  if (this->path().size() > 0) {
+  // string etag = 7;
+  if (!this->_internal_etag().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->path().data(), static_cast<int>(this->path().length()),
+      this->_internal_etag().data(), static_cast<int>(this->_internal_etag().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DirectoryResponse.path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->path(), target);
+      "transfer.DirectoryResponse.etag");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_etag(), target);
   }
 
-  // repeated .transfer.DirectoryResponse.FileInfo files = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
+  // bool not_modified = 8;
+  if (this->_internal_not_modified() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_not_modified(), target);
+  }
+
+  // uint64 version = 9;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_version(), target);
+  }
+
+  // bool is_delta = 10;
+  if (this->_internal_is_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_is_delta(), target);
+  }
+
+  // repeated string removed = 11;
+  for (int i = 0, n = this->_internal_removed_size(); i < n; i++) {
+    const auto& s = this->_internal_removed(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DirectoryResponse.removed");
+    target = stream->WriteString(11, s, target);
+  }
+
+  // uint64 base_version = 12;
+  if (this->_internal_base_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_base_version(), target);
+  }
+
+  // .transfer.ListingEncoding encoding = 13;
+  if (this->_internal_encoding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      13, this->_internal_encoding(), target);
+  }
+
+  // .transfer.ListingColumns columns = 14;
+  if (this->_internal_has_columns()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->files(static_cast<int>(i)), target);
+      InternalWriteMessage(14, _Internal::columns(this),
+        _Internal::columns(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:transfer.DirectoryResponse)
   return target;
@@ -3063,82 +4005,155 @@ size_t DirectoryResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:transfer.DirectoryResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .transfer.DirectoryResponse.FileInfo files = 3;
-  {
-    unsigned int count = static_cast<unsigned int>(this->files_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->files(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_files_size();
+  for (const auto& msg : this->_impl_.files_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string removed = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.removed_.size());
+  for (int i = 0, n = _impl_.removed_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.removed_.Get(i));
   }
 
   // string path = 2;
-  if (this->path().size() > 0) {
+  if (!this->_internal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
+  }
+
+  // string next_cursor = 4;
+  if (!this->_internal_next_cursor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_next_cursor());
+  }
+
+  // string etag = 7;
+  if (!this->_internal_etag().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->path());
+        this->_internal_etag());
   }
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // .transfer.ListingColumns columns = 14;
+  if (this->_internal_has_columns()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.columns_);
+  }
 
-void DirectoryResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DirectoryResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DirectoryResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DirectoryResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DirectoryResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DirectoryResponse)
-    MergeFrom(*source);
+  // uint64 total_count = 6;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_count());
   }
-}
 
-void DirectoryResponse::MergeFrom(const DirectoryResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint64 version = 9;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
 
-  files_.MergeFrom(from.files_);
-  if (from.path().size() > 0) {
+  // bool has_more = 5;
+  if (this->_internal_has_more() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool not_modified = 8;
+  if (this->_internal_not_modified() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool is_delta = 10;
+  if (this->_internal_is_delta() != 0) {
+    total_size += 1 + 1;
+  }
 
-    path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.path_);
+  // .transfer.ListingEncoding encoding = 13;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
   }
-  if (from.has_header()) {
-    mutable_header()->::transfer::ResponseHeader::MergeFrom(from.header());
+
+  // uint64 base_version = 12;
+  if (this->_internal_base_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_base_version());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DirectoryResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DirectoryResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectoryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectoryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectoryResponse::GetClassData() const { return &_class_data_; }
+
+
+void DirectoryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectoryResponse*>(&to_msg);
+  auto& from = static_cast<const DirectoryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DirectoryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.files_.MergeFrom(from._impl_.files_);
+  _this->_impl_.removed_.MergeFrom(from._impl_.removed_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
+  }
+  if (!from._internal_next_cursor().empty()) {
+    _this->_internal_set_next_cursor(from._internal_next_cursor());
+  }
+  if (!from._internal_etag().empty()) {
+    _this->_internal_set_etag(from._internal_etag());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_has_columns()) {
+    _this->_internal_mutable_columns()->::transfer::ListingColumns::MergeFrom(
+        from._internal_columns());
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_has_more() != 0) {
+    _this->_internal_set_has_more(from._internal_has_more());
+  }
+  if (from._internal_not_modified() != 0) {
+    _this->_internal_set_not_modified(from._internal_not_modified());
+  }
+  if (from._internal_is_delta() != 0) {
+    _this->_internal_set_is_delta(from._internal_is_delta());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  if (from._internal_base_version() != 0) {
+    _this->_internal_set_base_version(from._internal_base_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DirectoryResponse::CopyFrom(const DirectoryResponse& from) {
@@ -3152,5917 +4167,10785 @@ bool DirectoryResponse::IsInitialized() const {
   return true;
 }
 
-void DirectoryResponse::Swap(DirectoryResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void DirectoryResponse::InternalSwap(DirectoryResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&files_)->InternalSwap(CastToBase(&other->files_));
-  path_.Swap(&other->path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.files_.InternalSwap(&other->_impl_.files_);
+  _impl_.removed_.InternalSwap(&other->_impl_.removed_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.etag_, lhs_arena,
+      &other->_impl_.etag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DirectoryResponse, _impl_.base_version_)
+      + sizeof(DirectoryResponse::_impl_.base_version_)
+      - PROTOBUF_FIELD_OFFSET(DirectoryResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DirectoryResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void UploadRequest_FileInfo::InitAsDefaultInstance() {
-}
-class UploadRequest_FileInfo::HasBitSetters {
+class ListingCacheFile_Listing::_Internal {
  public:
+  static const ::transfer::DirectoryResponse& response(const ListingCacheFile_Listing* msg);
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadRequest_FileInfo::kFileNameFieldNumber;
-const int UploadRequest_FileInfo::kTargetPathFieldNumber;
-const int UploadRequest_FileInfo::kFileSizeFieldNumber;
-const int UploadRequest_FileInfo::kMd5FieldNumber;
-const int UploadRequest_FileInfo::kNeedChunkFieldNumber;
-const int UploadRequest_FileInfo::kChunkSizeFieldNumber;
-const int UploadRequest_FileInfo::kChunkSequenceFieldNumber;
-const int UploadRequest_FileInfo::kDataFieldNumber;
-const int UploadRequest_FileInfo::kChecksumFieldNumber;
-const int UploadRequest_FileInfo::kTaskIdFieldNumber;
-const int UploadRequest_FileInfo::kStatusFieldNumber;
-const int UploadRequest_FileInfo::kOffsetFieldNumber;
-const int UploadRequest_FileInfo::kUploadIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-UploadRequest_FileInfo::UploadRequest_FileInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.UploadRequest.FileInfo)
-}
-UploadRequest_FileInfo::UploadRequest_FileInfo(const UploadRequest_FileInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.file_name().size() > 0) {
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.target_path().size() > 0) {
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  md5_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.md5().size() > 0) {
-    md5_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.md5_);
-  }
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  upload_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.upload_id().size() > 0) {
-    upload_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.upload_id_);
-  }
-  ::memcpy(&file_size_, &from.file_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&status_) -
-    reinterpret_cast<char*>(&file_size_)) + sizeof(status_));
-  // @@protoc_insertion_point(copy_constructor:transfer.UploadRequest.FileInfo)
-}
-
-void UploadRequest_FileInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UploadRequest_FileInfo_transfer_2eproto.base);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  upload_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(status_));
-}
-
-UploadRequest_FileInfo::~UploadRequest_FileInfo() {
-  // @@protoc_insertion_point(destructor:transfer.UploadRequest.FileInfo)
+const ::transfer::DirectoryResponse&
+ListingCacheFile_Listing::_Internal::response(const ListingCacheFile_Listing* msg) {
+  return *msg->_impl_.response_;
+}
+ListingCacheFile_Listing::ListingCacheFile_Listing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ListingCacheFile.Listing)
+}
+ListingCacheFile_Listing::ListingCacheFile_Listing(const ListingCacheFile_Listing& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListingCacheFile_Listing* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.stored_at_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::transfer::DirectoryResponse(*from._impl_.response_);
+  }
+  _this->_impl_.stored_at_ = from._impl_.stored_at_;
+  // @@protoc_insertion_point(copy_constructor:transfer.ListingCacheFile.Listing)
+}
+
+inline void ListingCacheFile_Listing::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.stored_at_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ListingCacheFile_Listing::~ListingCacheFile_Listing() {
+  // @@protoc_insertion_point(destructor:transfer.ListingCacheFile.Listing)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UploadRequest_FileInfo::SharedDtor() {
-  file_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  upload_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ListingCacheFile_Listing::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.response_;
 }
 
-void UploadRequest_FileInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UploadRequest_FileInfo& UploadRequest_FileInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UploadRequest_FileInfo_transfer_2eproto.base);
-  return *internal_default_instance();
+void ListingCacheFile_Listing::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UploadRequest_FileInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.UploadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ListingCacheFile_Listing::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ListingCacheFile.Listing)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  upload_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(status_));
-  _internal_metadata_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  _impl_.stored_at_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* UploadRequest_FileInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ListingCacheFile_Listing::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string file_name = 1;
+      // .transfer.DirectoryResponse response = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_file_name(), ptr, ctx, "transfer.UploadRequest.FileInfo.file_name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string target_path = 2;
+      // uint64 stored_at = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_target_path(), ptr, ctx, "transfer.UploadRequest.FileInfo.target_path");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 file_size = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          file_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string md5 = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_md5(), ptr, ctx, "transfer.UploadRequest.FileInfo.md5");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool need_chunk = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 chunk_size = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 chunk_sequence = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          chunk_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bytes data = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_data(), ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 checksum = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
-          checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string task_id = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.UploadRequest.FileInfo.task_id");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .transfer.TransferStatus status = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-          set_status(static_cast<::transfer::TransferStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      // uint64 offset = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 96)) {
-          offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string upload_id = 13;
-      case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_upload_id(), ptr, ctx, "transfer.UploadRequest.FileInfo.upload_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.stored_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool UploadRequest_FileInfo::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.UploadRequest.FileInfo)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string file_name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->file_name().data(), static_cast<int>(this->file_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadRequest.FileInfo.file_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
 
-      // string target_path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_target_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->target_path().data(), static_cast<int>(this->target_path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadRequest.FileInfo.target_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* ListingCacheFile_Listing::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ListingCacheFile.Listing)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // uint64 file_size = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+  // .transfer.DirectoryResponse response = 1;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &file_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // uint64 stored_at = 2;
+  if (this->_internal_stored_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_stored_at(), target);
+  }
 
-      // string md5 = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_md5()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->md5().data(), static_cast<int>(this->md5().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadRequest.FileInfo.md5"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ListingCacheFile.Listing)
+  return target;
+}
 
-      // bool need_chunk = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+size_t ListingCacheFile_Listing::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ListingCacheFile.Listing)
+  size_t total_size = 0;
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &need_chunk_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-      // uint32 chunk_size = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
+  // .transfer.DirectoryResponse response = 1;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chunk_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  // uint64 stored_at = 2;
+  if (this->_internal_stored_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stored_at());
+  }
 
-      // uint32 chunk_sequence = 7;
-      case 7: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chunk_sequence_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListingCacheFile_Listing::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListingCacheFile_Listing::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListingCacheFile_Listing::GetClassData() const { return &_class_data_; }
 
-      // bytes data = 8;
-      case 8: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (66 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 checksum = 9;
-      case 9: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (72 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &checksum_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string task_id = 10;
-      case 10: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (82 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadRequest.FileInfo.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .transfer.TransferStatus status = 11;
-      case 11: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (88 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::transfer::TransferStatus >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 offset = 12;
-      case 12: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (96 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &offset_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string upload_id = 13;
-      case 13: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (106 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_upload_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->upload_id().data(), static_cast<int>(this->upload_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadRequest.FileInfo.upload_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.UploadRequest.FileInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.UploadRequest.FileInfo)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void UploadRequest_FileInfo::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.UploadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ListingCacheFile_Listing::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListingCacheFile_Listing*>(&to_msg);
+  auto& from = static_cast<const ListingCacheFile_Listing&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ListingCacheFile.Listing)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.file_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->file_name(), output);
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::transfer::DirectoryResponse::MergeFrom(
+        from._internal_response());
   }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.target_path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->target_path(), output);
+  if (from._internal_stored_at() != 0) {
+    _this->_internal_set_stored_at(from._internal_stored_at());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // uint64 file_size = 3;
-  if (this->file_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(3, this->file_size(), output);
-  }
+void ListingCacheFile_Listing::CopyFrom(const ListingCacheFile_Listing& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ListingCacheFile.Listing)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
-  // string md5 = 4;
-  if (this->md5().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->md5().data(), static_cast<int>(this->md5().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.md5");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->md5(), output);
-  }
+bool ListingCacheFile_Listing::IsInitialized() const {
+  return true;
+}
 
-  // bool need_chunk = 5;
-  if (this->need_chunk() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(5, this->need_chunk(), output);
-  }
+void ListingCacheFile_Listing::InternalSwap(ListingCacheFile_Listing* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ListingCacheFile_Listing, _impl_.stored_at_)
+      + sizeof(ListingCacheFile_Listing::_impl_.stored_at_)
+      - PROTOBUF_FIELD_OFFSET(ListingCacheFile_Listing, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
 
-  // uint32 chunk_size = 6;
-  if (this->chunk_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(6, this->chunk_size(), output);
-  }
+::PROTOBUF_NAMESPACE_ID::Metadata ListingCacheFile_Listing::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[6]);
+}
 
-  // uint32 chunk_sequence = 7;
-  if (this->chunk_sequence() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(7, this->chunk_sequence(), output);
-  }
+// ===================================================================
 
-  // bytes data = 8;
-  if (this->data().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
-      8, this->data(), output);
-  }
+class ListingCacheFile::_Internal {
+ public:
+};
 
-  // uint32 checksum = 9;
-  if (this->checksum() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(9, this->checksum(), output);
+ListingCacheFile::ListingCacheFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ListingCacheFile)
+}
+ListingCacheFile::ListingCacheFile(const ListingCacheFile& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListingCacheFile* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.listings_){from._impl_.listings_}
+    , decltype(_impl_.server_){}
+    , decltype(_impl_.home_path_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server().empty()) {
+    _this->_impl_.server_.Set(from._internal_server(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.home_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.home_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_home_path().empty()) {
+    _this->_impl_.home_path_.Set(from._internal_home_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.version_ = from._impl_.version_;
+  // @@protoc_insertion_point(copy_constructor:transfer.ListingCacheFile)
+}
+
+inline void ListingCacheFile::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.listings_){arena}
+    , decltype(_impl_.server_){}
+    , decltype(_impl_.home_path_){}
+    , decltype(_impl_.version_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.server_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.home_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.home_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ListingCacheFile::~ListingCacheFile() {
+  // @@protoc_insertion_point(destructor:transfer.ListingCacheFile)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // string task_id = 10;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      10, this->task_id(), output);
-  }
+inline void ListingCacheFile::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.listings_.~RepeatedPtrField();
+  _impl_.server_.Destroy();
+  _impl_.home_path_.Destroy();
+}
 
-  // .transfer.TransferStatus status = 11;
-  if (this->status() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      11, this->status(), output);
-  }
+void ListingCacheFile::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  // uint64 offset = 12;
-  if (this->offset() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(12, this->offset(), output);
-  }
+void ListingCacheFile::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ListingCacheFile)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // string upload_id = 13;
-  if (this->upload_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->upload_id().data(), static_cast<int>(this->upload_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.upload_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      13, this->upload_id(), output);
-  }
+  _impl_.listings_.Clear();
+  _impl_.server_.ClearToEmpty();
+  _impl_.home_path_.ClearToEmpty();
+  _impl_.version_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.UploadRequest.FileInfo)
+const char* ListingCacheFile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string server = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_server();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ListingCacheFile.server"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string home_path = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_home_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ListingCacheFile.home_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.ListingCacheFile.Listing listings = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_listings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UploadRequest_FileInfo::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ListingCacheFile::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ListingCacheFile)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.file_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->file_name(), target);
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.target_path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->target_path(), target);
-  }
-
-  // uint64 file_size = 3;
-  if (this->file_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(3, this->file_size(), target);
+  // uint32 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_version(), target);
   }
 
-  // string md5 = 4;
-  if (this->md5().size() > 0) {
+  // string server = 2;
+  if (!this->_internal_server().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->md5().data(), static_cast<int>(this->md5().length()),
+      this->_internal_server().data(), static_cast<int>(this->_internal_server().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.md5");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        4, this->md5(), target);
-  }
-
-  // bool need_chunk = 5;
-  if (this->need_chunk() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->need_chunk(), target);
-  }
-
-  // uint32 chunk_size = 6;
-  if (this->chunk_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(6, this->chunk_size(), target);
-  }
-
-  // uint32 chunk_sequence = 7;
-  if (this->chunk_sequence() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(7, this->chunk_sequence(), target);
-  }
-
-  // bytes data = 8;
-  if (this->data().size() > 0) {
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
-        8, this->data(), target);
-  }
-
-  // uint32 checksum = 9;
-  if (this->checksum() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(9, this->checksum(), target);
+      "transfer.ListingCacheFile.server");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_server(), target);
   }
 
-  // string task_id = 10;
-  if (this->task_id().size() > 0) {
+  // string home_path = 3;
+  if (!this->_internal_home_path().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      this->_internal_home_path().data(), static_cast<int>(this->_internal_home_path().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        10, this->task_id(), target);
-  }
-
-  // .transfer.TransferStatus status = 11;
-  if (this->status() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      11, this->status(), target);
-  }
-
-  // uint64 offset = 12;
-  if (this->offset() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(12, this->offset(), target);
+      "transfer.ListingCacheFile.home_path");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_home_path(), target);
   }
 
-  // string upload_id = 13;
-  if (this->upload_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->upload_id().data(), static_cast<int>(this->upload_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadRequest.FileInfo.upload_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        13, this->upload_id(), target);
+  // repeated .transfer.ListingCacheFile.Listing listings = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_listings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_listings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadRequest.FileInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ListingCacheFile)
   return target;
 }
 
-size_t UploadRequest_FileInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.UploadRequest.FileInfo)
+size_t ListingCacheFile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ListingCacheFile)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->file_name());
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->target_path());
-  }
-
-  // string md5 = 4;
-  if (this->md5().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->md5());
-  }
-
-  // bytes data = 8;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->data());
+  // repeated .transfer.ListingCacheFile.Listing listings = 4;
+  total_size += 1UL * this->_internal_listings_size();
+  for (const auto& msg : this->_impl_.listings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string task_id = 10;
-  if (this->task_id().size() > 0) {
+  // string server = 2;
+  if (!this->_internal_server().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
+        this->_internal_server());
   }
 
-  // string upload_id = 13;
-  if (this->upload_id().size() > 0) {
+  // string home_path = 3;
+  if (!this->_internal_home_path().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->upload_id());
-  }
-
-  // uint64 file_size = 3;
-  if (this->file_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->file_size());
-  }
-
-  // bool need_chunk = 5;
-  if (this->need_chunk() != 0) {
-    total_size += 1 + 1;
-  }
-
-  // uint32 chunk_size = 6;
-  if (this->chunk_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->chunk_size());
+        this->_internal_home_path());
   }
 
-  // uint32 chunk_sequence = 7;
-  if (this->chunk_sequence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->chunk_sequence());
-  }
-
-  // uint32 checksum = 9;
-  if (this->checksum() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->checksum());
-  }
-
-  // uint64 offset = 12;
-  if (this->offset() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->offset());
-  }
-
-  // .transfer.TransferStatus status = 11;
-  if (this->status() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->status());
+  // uint32 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void UploadRequest_FileInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.UploadRequest.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UploadRequest_FileInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UploadRequest_FileInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.UploadRequest.FileInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.UploadRequest.FileInfo)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UploadRequest_FileInfo::MergeFrom(const UploadRequest_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadRequest.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.file_name().size() > 0) {
-
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  if (from.target_path().size() > 0) {
-
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  if (from.md5().size() > 0) {
-
-    md5_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.md5_);
-  }
-  if (from.data().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListingCacheFile::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListingCacheFile::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListingCacheFile::GetClassData() const { return &_class_data_; }
 
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  if (from.task_id().size() > 0) {
 
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  if (from.upload_id().size() > 0) {
+void ListingCacheFile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListingCacheFile*>(&to_msg);
+  auto& from = static_cast<const ListingCacheFile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ListingCacheFile)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    upload_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.upload_id_);
-  }
-  if (from.file_size() != 0) {
-    set_file_size(from.file_size());
-  }
-  if (from.need_chunk() != 0) {
-    set_need_chunk(from.need_chunk());
-  }
-  if (from.chunk_size() != 0) {
-    set_chunk_size(from.chunk_size());
+  _this->_impl_.listings_.MergeFrom(from._impl_.listings_);
+  if (!from._internal_server().empty()) {
+    _this->_internal_set_server(from._internal_server());
   }
-  if (from.chunk_sequence() != 0) {
-    set_chunk_sequence(from.chunk_sequence());
+  if (!from._internal_home_path().empty()) {
+    _this->_internal_set_home_path(from._internal_home_path());
   }
-  if (from.checksum() != 0) {
-    set_checksum(from.checksum());
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
   }
-  if (from.offset() != 0) {
-    set_offset(from.offset());
-  }
-  if (from.status() != 0) {
-    set_status(from.status());
-  }
-}
-
-void UploadRequest_FileInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.UploadRequest.FileInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UploadRequest_FileInfo::CopyFrom(const UploadRequest_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadRequest.FileInfo)
+void ListingCacheFile::CopyFrom(const ListingCacheFile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ListingCacheFile)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UploadRequest_FileInfo::IsInitialized() const {
+bool ListingCacheFile::IsInitialized() const {
   return true;
 }
 
-void UploadRequest_FileInfo::Swap(UploadRequest_FileInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UploadRequest_FileInfo::InternalSwap(UploadRequest_FileInfo* other) {
+void ListingCacheFile::InternalSwap(ListingCacheFile* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  file_name_.Swap(&other->file_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  target_path_.Swap(&other->target_path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  md5_.Swap(&other->md5_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  upload_id_.Swap(&other->upload_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(file_size_, other->file_size_);
-  swap(need_chunk_, other->need_chunk_);
-  swap(chunk_size_, other->chunk_size_);
-  swap(chunk_sequence_, other->chunk_sequence_);
-  swap(checksum_, other->checksum_);
-  swap(offset_, other->offset_);
-  swap(status_, other->status_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.listings_.InternalSwap(&other->_impl_.listings_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_, lhs_arena,
+      &other->_impl_.server_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.home_path_, lhs_arena,
+      &other->_impl_.home_path_, rhs_arena
+  );
+  swap(_impl_.version_, other->_impl_.version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListingCacheFile::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[7]);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UploadRequest_FileInfo::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
 // ===================================================================
 
-void UploadRequest::InitAsDefaultInstance() {
-  ::transfer::_UploadRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::RequestHeader*>(
-      ::transfer::RequestHeader::internal_default_instance());
-}
-class UploadRequest::HasBitSetters {
+class MakeDirectoryRequest::_Internal {
  public:
-  static const ::transfer::RequestHeader& header(const UploadRequest* msg);
+  static const ::transfer::RequestHeader& header(const MakeDirectoryRequest* msg);
 };
 
 const ::transfer::RequestHeader&
-UploadRequest::HasBitSetters::header(const UploadRequest* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadRequest::kHeaderFieldNumber;
-const int UploadRequest::kFilesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-UploadRequest::UploadRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.UploadRequest)
-}
-UploadRequest::UploadRequest(const UploadRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      files_(from.files_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_header()) {
-    header_ = new ::transfer::RequestHeader(*from.header_);
-  } else {
-    header_ = nullptr;
+MakeDirectoryRequest::_Internal::header(const MakeDirectoryRequest* msg) {
+  return *msg->_impl_.header_;
+}
+MakeDirectoryRequest::MakeDirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.MakeDirectoryRequest)
+}
+MakeDirectoryRequest::MakeDirectoryRequest(const MakeDirectoryRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MakeDirectoryRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paths_){from._impl_.paths_}
+    , decltype(_impl_.base_path_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.base_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_base_path().empty()) {
+    _this->_impl_.base_path_.Set(from._internal_base_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.MakeDirectoryRequest)
+}
+
+inline void MakeDirectoryRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paths_){arena}
+    , decltype(_impl_.base_path_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.base_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MakeDirectoryRequest::~MakeDirectoryRequest() {
+  // @@protoc_insertion_point(destructor:transfer.MakeDirectoryRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:transfer.UploadRequest)
+  SharedDtor();
 }
 
-void UploadRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UploadRequest_transfer_2eproto.base);
-  header_ = nullptr;
+inline void MakeDirectoryRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.paths_.~RepeatedPtrField();
+  _impl_.base_path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-UploadRequest::~UploadRequest() {
-  // @@protoc_insertion_point(destructor:transfer.UploadRequest)
-  SharedDtor();
+void MakeDirectoryRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void UploadRequest::SharedDtor() {
-  if (this != internal_default_instance()) delete header_;
-}
+void MakeDirectoryRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.MakeDirectoryRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void UploadRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UploadRequest& UploadRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UploadRequest_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void UploadRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.UploadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  files_.Clear();
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
-  }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.paths_.Clear();
+  _impl_.base_path_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* UploadRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* MakeDirectoryRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .transfer.UploadRequest.FileInfo files = 2;
+      // string base_path = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_base_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.MakeDirectoryRequest.base_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string paths = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_files(), ptr);
+            auto str = _internal_add_paths();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.MakeDirectoryRequest.paths"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool UploadRequest::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.UploadRequest)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.RequestHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .transfer.UploadRequest.FileInfo files = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_files()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.UploadRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.UploadRequest)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void UploadRequest::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.UploadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* MakeDirectoryRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.MakeDirectoryRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
-  }
-
-  // repeated .transfer.UploadRequest.FileInfo files = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->files(static_cast<int>(i)),
-      output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.UploadRequest)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* UploadRequest::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // string base_path = 2;
+  if (!this->_internal_base_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_base_path().data(), static_cast<int>(this->_internal_base_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.MakeDirectoryRequest.base_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_base_path(), target);
   }
 
-  // repeated .transfer.UploadRequest.FileInfo files = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->files(static_cast<int>(i)), target);
+  // repeated string paths = 3;
+  for (int i = 0, n = this->_internal_paths_size(); i < n; i++) {
+    const auto& s = this->_internal_paths(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.MakeDirectoryRequest.paths");
+    target = stream->WriteString(3, s, target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.MakeDirectoryRequest)
   return target;
 }
 
-size_t UploadRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.UploadRequest)
+size_t MakeDirectoryRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.MakeDirectoryRequest)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .transfer.UploadRequest.FileInfo files = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->files_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->files(static_cast<int>(i)));
-    }
+  // repeated string paths = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.paths_.size());
+  for (int i = 0, n = _impl_.paths_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.paths_.Get(i));
+  }
+
+  // string base_path = 2;
+  if (!this->_internal_base_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_base_path());
   }
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UploadRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.UploadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UploadRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UploadRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.UploadRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.UploadRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MakeDirectoryRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MakeDirectoryRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MakeDirectoryRequest::GetClassData() const { return &_class_data_; }
+
 
-void UploadRequest::MergeFrom(const UploadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void MakeDirectoryRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MakeDirectoryRequest*>(&to_msg);
+  auto& from = static_cast<const MakeDirectoryRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.MakeDirectoryRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  files_.MergeFrom(from.files_);
-  if (from.has_header()) {
-    mutable_header()->::transfer::RequestHeader::MergeFrom(from.header());
+  _this->_impl_.paths_.MergeFrom(from._impl_.paths_);
+  if (!from._internal_base_path().empty()) {
+    _this->_internal_set_base_path(from._internal_base_path());
   }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UploadRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.UploadRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void UploadRequest::CopyFrom(const UploadRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadRequest)
+void MakeDirectoryRequest::CopyFrom(const MakeDirectoryRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.MakeDirectoryRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UploadRequest::IsInitialized() const {
+bool MakeDirectoryRequest::IsInitialized() const {
   return true;
 }
 
-void UploadRequest::Swap(UploadRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UploadRequest::InternalSwap(UploadRequest* other) {
+void MakeDirectoryRequest::InternalSwap(MakeDirectoryRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&files_)->InternalSwap(CastToBase(&other->files_));
-  swap(header_, other->header_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.paths_.InternalSwap(&other->_impl_.paths_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.base_path_, lhs_arena,
+      &other->_impl_.base_path_, rhs_arena
+  );
+  swap(_impl_.header_, other->_impl_.header_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UploadRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata MakeDirectoryRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void UploadResponse_FileResult::InitAsDefaultInstance() {
-}
-class UploadResponse_FileResult::HasBitSetters {
+class MakeDirectoryResponse::_Internal {
  public:
+  static const ::transfer::ResponseHeader& header(const MakeDirectoryResponse* msg);
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadResponse_FileResult::kFileNameFieldNumber;
-const int UploadResponse_FileResult::kTargetPathFieldNumber;
-const int UploadResponse_FileResult::kSuccessFieldNumber;
-const int UploadResponse_FileResult::kNeedChunkFieldNumber;
-const int UploadResponse_FileResult::kNextSequenceFieldNumber;
-const int UploadResponse_FileResult::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-UploadResponse_FileResult::UploadResponse_FileResult()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.UploadResponse.FileResult)
-}
-UploadResponse_FileResult::UploadResponse_FileResult(const UploadResponse_FileResult& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.file_name().size() > 0) {
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.target_path().size() > 0) {
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&success_, &from.success_,
-    static_cast<size_t>(reinterpret_cast<char*>(&next_sequence_) -
-    reinterpret_cast<char*>(&success_)) + sizeof(next_sequence_));
-  // @@protoc_insertion_point(copy_constructor:transfer.UploadResponse.FileResult)
-}
-
-void UploadResponse_FileResult::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UploadResponse_FileResult_transfer_2eproto.base);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&next_sequence_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(next_sequence_));
-}
-
-UploadResponse_FileResult::~UploadResponse_FileResult() {
-  // @@protoc_insertion_point(destructor:transfer.UploadResponse.FileResult)
+const ::transfer::ResponseHeader&
+MakeDirectoryResponse::_Internal::header(const MakeDirectoryResponse* msg) {
+  return *msg->_impl_.header_;
+}
+MakeDirectoryResponse::MakeDirectoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.MakeDirectoryResponse)
+}
+MakeDirectoryResponse::MakeDirectoryResponse(const MakeDirectoryResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MakeDirectoryResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.failed_paths_){from._impl_.failed_paths_}
+    , decltype(_impl_.errors_){from._impl_.errors_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.MakeDirectoryResponse)
+}
+
+inline void MakeDirectoryResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.failed_paths_){arena}
+    , decltype(_impl_.errors_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MakeDirectoryResponse::~MakeDirectoryResponse() {
+  // @@protoc_insertion_point(destructor:transfer.MakeDirectoryResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void UploadResponse_FileResult::SharedDtor() {
-  file_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void MakeDirectoryResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.failed_paths_.~RepeatedPtrField();
+  _impl_.errors_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void UploadResponse_FileResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UploadResponse_FileResult& UploadResponse_FileResult::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UploadResponse_FileResult_transfer_2eproto.base);
-  return *internal_default_instance();
+void MakeDirectoryResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UploadResponse_FileResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.UploadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void MakeDirectoryResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.MakeDirectoryResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&next_sequence_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(next_sequence_));
-  _internal_metadata_.Clear();
+  _impl_.failed_paths_.Clear();
+  _impl_.errors_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* UploadResponse_FileResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* MakeDirectoryResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string file_name = 1;
+      // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_file_name(), ptr, ctx, "transfer.UploadResponse.FileResult.file_name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string target_path = 2;
+      // repeated string failed_paths = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_target_path(), ptr, ctx, "transfer.UploadResponse.FileResult.target_path");
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_failed_paths();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.MakeDirectoryResponse.failed_paths"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      // bool success = 3;
+      // repeated string errors = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool need_chunk = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 next_sequence = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          next_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string error_message = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_error_message(), ptr, ctx, "transfer.UploadResponse.FileResult.error_message");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_errors();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.MakeDirectoryResponse.errors"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool UploadResponse_FileResult::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.UploadResponse.FileResult)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string file_name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->file_name().data(), static_cast<int>(this->file_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadResponse.FileResult.file_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string target_path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_target_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->target_path().data(), static_cast<int>(this->target_path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadResponse.FileResult.target_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool success = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool need_chunk = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &need_chunk_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 next_sequence = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::int32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32>(
-                 input, &next_sequence_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string error_message = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.UploadResponse.FileResult.error_message"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.UploadResponse.FileResult)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.UploadResponse.FileResult)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void UploadResponse_FileResult::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.UploadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.file_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->file_name(), output);
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.target_path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->target_path(), output);
-  }
-
-  // bool success = 3;
-  if (this->success() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(3, this->success(), output);
-  }
-
-  // bool need_chunk = 4;
-  if (this->need_chunk() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(4, this->need_chunk(), output);
-  }
-
-  // int32 next_sequence = 5;
-  if (this->next_sequence() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32(5, this->next_sequence(), output);
-  }
-
-  // string error_message = 6;
-  if (this->error_message().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.error_message");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      6, this->error_message(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.UploadResponse.FileResult)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* UploadResponse_FileResult::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* MakeDirectoryResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.MakeDirectoryResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.file_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->file_name(), target);
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
+  // repeated string failed_paths = 2;
+  for (int i = 0, n = this->_internal_failed_paths_size(); i < n; i++) {
+    const auto& s = this->_internal_failed_paths(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.target_path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->target_path(), target);
-  }
-
-  // bool success = 3;
-  if (this->success() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->success(), target);
-  }
-
-  // bool need_chunk = 4;
-  if (this->need_chunk() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->need_chunk(), target);
+      "transfer.MakeDirectoryResponse.failed_paths");
+    target = stream->WriteString(2, s, target);
   }
 
-  // int32 next_sequence = 5;
-  if (this->next_sequence() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->next_sequence(), target);
-  }
-
-  // string error_message = 6;
-  if (this->error_message().size() > 0) {
+  // repeated string errors = 3;
+  for (int i = 0, n = this->_internal_errors_size(); i < n; i++) {
+    const auto& s = this->_internal_errors(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.UploadResponse.FileResult.error_message");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        6, this->error_message(), target);
+      "transfer.MakeDirectoryResponse.errors");
+    target = stream->WriteString(3, s, target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadResponse.FileResult)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.MakeDirectoryResponse)
   return target;
 }
 
-size_t UploadResponse_FileResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.UploadResponse.FileResult)
+size_t MakeDirectoryResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.MakeDirectoryResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->file_name());
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->target_path());
-  }
-
-  // string error_message = 6;
-  if (this->error_message().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->error_message());
-  }
-
-  // bool success = 3;
-  if (this->success() != 0) {
-    total_size += 1 + 1;
+  // repeated string failed_paths = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.failed_paths_.size());
+  for (int i = 0, n = _impl_.failed_paths_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.failed_paths_.Get(i));
   }
 
-  // bool need_chunk = 4;
-  if (this->need_chunk() != 0) {
-    total_size += 1 + 1;
+  // repeated string errors = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.errors_.size());
+  for (int i = 0, n = _impl_.errors_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.errors_.Get(i));
   }
 
-  // int32 next_sequence = 5;
-  if (this->next_sequence() != 0) {
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->next_sequence());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UploadResponse_FileResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.UploadResponse.FileResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UploadResponse_FileResult* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UploadResponse_FileResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.UploadResponse.FileResult)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.UploadResponse.FileResult)
-    MergeFrom(*source);
-  }
-}
-
-void UploadResponse_FileResult::MergeFrom(const UploadResponse_FileResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadResponse.FileResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.file_name().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MakeDirectoryResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MakeDirectoryResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MakeDirectoryResponse::GetClassData() const { return &_class_data_; }
 
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  if (from.target_path().size() > 0) {
 
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  if (from.error_message().size() > 0) {
+void MakeDirectoryResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MakeDirectoryResponse*>(&to_msg);
+  auto& from = static_cast<const MakeDirectoryResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.MakeDirectoryResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  if (from.success() != 0) {
-    set_success(from.success());
-  }
-  if (from.need_chunk() != 0) {
-    set_need_chunk(from.need_chunk());
-  }
-  if (from.next_sequence() != 0) {
-    set_next_sequence(from.next_sequence());
+  _this->_impl_.failed_paths_.MergeFrom(from._impl_.failed_paths_);
+  _this->_impl_.errors_.MergeFrom(from._impl_.errors_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UploadResponse_FileResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.UploadResponse.FileResult)
+void MakeDirectoryResponse::CopyFrom(const MakeDirectoryResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.MakeDirectoryResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void UploadResponse_FileResult::CopyFrom(const UploadResponse_FileResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadResponse.FileResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool UploadResponse_FileResult::IsInitialized() const {
+bool MakeDirectoryResponse::IsInitialized() const {
   return true;
 }
 
-void UploadResponse_FileResult::Swap(UploadResponse_FileResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UploadResponse_FileResult::InternalSwap(UploadResponse_FileResult* other) {
+void MakeDirectoryResponse::InternalSwap(MakeDirectoryResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  file_name_.Swap(&other->file_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  target_path_.Swap(&other->target_path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  error_message_.Swap(&other->error_message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(success_, other->success_);
-  swap(need_chunk_, other->need_chunk_);
-  swap(next_sequence_, other->next_sequence_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.failed_paths_.InternalSwap(&other->_impl_.failed_paths_);
+  _impl_.errors_.InternalSwap(&other->_impl_.errors_);
+  swap(_impl_.header_, other->_impl_.header_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UploadResponse_FileResult::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata MakeDirectoryResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void UploadResponse::InitAsDefaultInstance() {
-  ::transfer::_UploadResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::ResponseHeader*>(
-      ::transfer::ResponseHeader::internal_default_instance());
-}
-class UploadResponse::HasBitSetters {
+class TreeListRequest::_Internal {
  public:
-  static const ::transfer::ResponseHeader& header(const UploadResponse* msg);
+  static const ::transfer::RequestHeader& header(const TreeListRequest* msg);
 };
 
-const ::transfer::ResponseHeader&
-UploadResponse::HasBitSetters::header(const UploadResponse* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int UploadResponse::kHeaderFieldNumber;
-const int UploadResponse::kResultsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-UploadResponse::UploadResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.UploadResponse)
-}
-UploadResponse::UploadResponse(const UploadResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      results_(from.results_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_header()) {
-    header_ = new ::transfer::ResponseHeader(*from.header_);
-  } else {
-    header_ = nullptr;
+const ::transfer::RequestHeader&
+TreeListRequest::_Internal::header(const TreeListRequest* msg) {
+  return *msg->_impl_.header_;
+}
+TreeListRequest::TreeListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TreeListRequest)
+}
+TreeListRequest::TreeListRequest(const TreeListRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TreeListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.root_path_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.page_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.root_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_root_path().empty()) {
+    _this->_impl_.root_path_.Set(from._internal_root_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cursor().empty()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.page_size_ = from._impl_.page_size_;
+  // @@protoc_insertion_point(copy_constructor:transfer.TreeListRequest)
+}
+
+inline void TreeListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.root_path_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.page_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.root_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TreeListRequest::~TreeListRequest() {
+  // @@protoc_insertion_point(destructor:transfer.TreeListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:transfer.UploadResponse)
-}
-
-void UploadResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UploadResponse_transfer_2eproto.base);
-  header_ = nullptr;
-}
-
-UploadResponse::~UploadResponse() {
-  // @@protoc_insertion_point(destructor:transfer.UploadResponse)
   SharedDtor();
 }
 
-void UploadResponse::SharedDtor() {
-  if (this != internal_default_instance()) delete header_;
+inline void TreeListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.root_path_.Destroy();
+  _impl_.cursor_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void UploadResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void TreeListRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const UploadResponse& UploadResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UploadResponse_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void UploadResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.UploadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TreeListRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TreeListRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  results_.Clear();
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.root_path_.ClearToEmpty();
+  _impl_.cursor_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  _impl_.page_size_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* UploadResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TreeListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .transfer.ResponseHeader header = 1;
+      // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .transfer.UploadResponse.FileResult results = 2;
+      // string root_path = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(add_results(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_root_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TreeListRequest.root_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TreeListRequest.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.page_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool UploadResponse::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.UploadResponse)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .transfer.UploadResponse.FileResult results = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_results()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.UploadResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.UploadResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void UploadResponse::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.UploadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TreeListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TreeListRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
-  }
-
-  // repeated .transfer.UploadResponse.FileResult results = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->results(static_cast<int>(i)),
-      output);
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // string root_path = 2;
+  if (!this->_internal_root_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_root_path().data(), static_cast<int>(this->_internal_root_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TreeListRequest.root_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_root_path(), target);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.UploadResponse)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* UploadResponse::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // string cursor = 3;
+  if (!this->_internal_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TreeListRequest.cursor");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_cursor(), target);
   }
 
-  // repeated .transfer.UploadResponse.FileResult results = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->results(static_cast<int>(i)), target);
+  // uint32 page_size = 4;
+  if (this->_internal_page_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_page_size(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TreeListRequest)
   return target;
 }
 
-size_t UploadResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.UploadResponse)
+size_t TreeListRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TreeListRequest)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .transfer.UploadResponse.FileResult results = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->results_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->results(static_cast<int>(i)));
-    }
+  // string root_path = 2;
+  if (!this->_internal_root_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_root_path());
   }
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  // string cursor = 3;
+  if (!this->_internal_cursor().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cursor());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
 
-void UploadResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.UploadResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UploadResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UploadResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.UploadResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.UploadResponse)
-    MergeFrom(*source);
+  // uint32 page_size = 4;
+  if (this->_internal_page_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page_size());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UploadResponse::MergeFrom(const UploadResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TreeListRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TreeListRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TreeListRequest::GetClassData() const { return &_class_data_; }
+
+
+void TreeListRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TreeListRequest*>(&to_msg);
+  auto& from = static_cast<const TreeListRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TreeListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  results_.MergeFrom(from.results_);
-  if (from.has_header()) {
-    mutable_header()->::transfer::ResponseHeader::MergeFrom(from.header());
+  if (!from._internal_root_path().empty()) {
+    _this->_internal_set_root_path(from._internal_root_path());
   }
+  if (!from._internal_cursor().empty()) {
+    _this->_internal_set_cursor(from._internal_cursor());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_page_size() != 0) {
+    _this->_internal_set_page_size(from._internal_page_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UploadResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.UploadResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void UploadResponse::CopyFrom(const UploadResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadResponse)
+void TreeListRequest::CopyFrom(const TreeListRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TreeListRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UploadResponse::IsInitialized() const {
+bool TreeListRequest::IsInitialized() const {
   return true;
 }
 
-void UploadResponse::Swap(UploadResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void UploadResponse::InternalSwap(UploadResponse* other) {
+void TreeListRequest::InternalSwap(TreeListRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&results_)->InternalSwap(CastToBase(&other->results_));
-  swap(header_, other->header_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata UploadResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.root_path_, lhs_arena,
+      &other->_impl_.root_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TreeListRequest, _impl_.page_size_)
+      + sizeof(TreeListRequest::_impl_.page_size_)
+      - PROTOBUF_FIELD_OFFSET(TreeListRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TreeListRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void DownloadRequest_FileInfo::InitAsDefaultInstance() {
-}
-class DownloadRequest_FileInfo::HasBitSetters {
+class TreeListResponse_Entry::_Internal {
  public:
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadRequest_FileInfo::kFileNameFieldNumber;
-const int DownloadRequest_FileInfo::kTargetPathFieldNumber;
-const int DownloadRequest_FileInfo::kChunkSizeFieldNumber;
-const int DownloadRequest_FileInfo::kOffsetFieldNumber;
-const int DownloadRequest_FileInfo::kDownloadIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DownloadRequest_FileInfo::DownloadRequest_FileInfo()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DownloadRequest.FileInfo)
-}
-DownloadRequest_FileInfo::DownloadRequest_FileInfo(const DownloadRequest_FileInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.file_name().size() > 0) {
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.target_path().size() > 0) {
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  download_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.download_id().size() > 0) {
-    download_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.download_id_);
-  }
-  ::memcpy(&offset_, &from.offset_,
-    static_cast<size_t>(reinterpret_cast<char*>(&chunk_size_) -
-    reinterpret_cast<char*>(&offset_)) + sizeof(chunk_size_));
-  // @@protoc_insertion_point(copy_constructor:transfer.DownloadRequest.FileInfo)
-}
-
-void DownloadRequest_FileInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DownloadRequest_FileInfo_transfer_2eproto.base);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  download_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&offset_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chunk_size_) -
-      reinterpret_cast<char*>(&offset_)) + sizeof(chunk_size_));
-}
-
-DownloadRequest_FileInfo::~DownloadRequest_FileInfo() {
-  // @@protoc_insertion_point(destructor:transfer.DownloadRequest.FileInfo)
+TreeListResponse_Entry::TreeListResponse_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TreeListResponse.Entry)
+}
+TreeListResponse_Entry::TreeListResponse_Entry(const TreeListResponse_Entry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TreeListResponse_Entry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.relative_path_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.is_directory_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.relative_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_relative_path().empty()) {
+    _this->_impl_.relative_path_.Set(from._internal_relative_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_modify_time().empty()) {
+    _this->_impl_.modify_time_.Set(from._internal_modify_time(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_directory_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
+  // @@protoc_insertion_point(copy_constructor:transfer.TreeListResponse.Entry)
+}
+
+inline void TreeListResponse_Entry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.relative_path_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.is_directory_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.relative_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TreeListResponse_Entry::~TreeListResponse_Entry() {
+  // @@protoc_insertion_point(destructor:transfer.TreeListResponse.Entry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DownloadRequest_FileInfo::SharedDtor() {
-  file_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  download_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void TreeListResponse_Entry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.relative_path_.Destroy();
+  _impl_.modify_time_.Destroy();
 }
 
-void DownloadRequest_FileInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void TreeListResponse_Entry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const DownloadRequest_FileInfo& DownloadRequest_FileInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DownloadRequest_FileInfo_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void DownloadRequest_FileInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.DownloadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TreeListResponse_Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TreeListResponse.Entry)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  download_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&offset_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&chunk_size_) -
-      reinterpret_cast<char*>(&offset_)) + sizeof(chunk_size_));
-  _internal_metadata_.Clear();
+  _impl_.relative_path_.ClearToEmpty();
+  _impl_.modify_time_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_directory_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DownloadRequest_FileInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TreeListResponse_Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string file_name = 1;
+      // string relative_path = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_file_name(), ptr, ctx, "transfer.DownloadRequest.FileInfo.file_name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_relative_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TreeListResponse.Entry.relative_path"));
+        } else
+          goto handle_unusual;
         continue;
-      // string target_path = 2;
+      // bool is_directory = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_target_path(), ptr, ctx, "transfer.DownloadRequest.FileInfo.target_path");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.is_directory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 chunk_size = 3;
+      // uint64 size = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint64 offset = 4;
+      // string modify_time = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string download_id = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_download_id(), ptr, ctx, "transfer.DownloadRequest.FileInfo.download_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_modify_time();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TreeListResponse.Entry.modify_time"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DownloadRequest_FileInfo::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DownloadRequest.FileInfo)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string file_name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->file_name().data(), static_cast<int>(this->file_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadRequest.FileInfo.file_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string target_path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_target_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->target_path().data(), static_cast<int>(this->target_path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadRequest.FileInfo.target_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 chunk_size = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chunk_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 offset = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &offset_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string download_id = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_download_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->download_id().data(), static_cast<int>(this->download_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadRequest.FileInfo.download_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DownloadRequest.FileInfo)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DownloadRequest.FileInfo)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void DownloadRequest_FileInfo::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DownloadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.file_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->file_name(), output);
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.target_path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->target_path(), output);
-  }
-
-  // uint32 chunk_size = 3;
-  if (this->chunk_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(3, this->chunk_size(), output);
-  }
-
-  // uint64 offset = 4;
-  if (this->offset() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(4, this->offset(), output);
-  }
-
-  // string download_id = 5;
-  if (this->download_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->download_id().data(), static_cast<int>(this->download_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.download_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->download_id(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.DownloadRequest.FileInfo)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* DownloadRequest_FileInfo::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadRequest.FileInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TreeListResponse_Entry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TreeListResponse.Entry)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.file_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->file_name(), target);
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
+  // string relative_path = 1;
+  if (!this->_internal_relative_path().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
+      this->_internal_relative_path().data(), static_cast<int>(this->_internal_relative_path().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.target_path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->target_path(), target);
+      "transfer.TreeListResponse.Entry.relative_path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_relative_path(), target);
   }
 
-  // uint32 chunk_size = 3;
-  if (this->chunk_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->chunk_size(), target);
+  // bool is_directory = 2;
+  if (this->_internal_is_directory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_is_directory(), target);
   }
 
-  // uint64 offset = 4;
-  if (this->offset() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->offset(), target);
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
   }
 
-  // string download_id = 5;
-  if (this->download_id().size() > 0) {
+  // string modify_time = 4;
+  if (!this->_internal_modify_time().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->download_id().data(), static_cast<int>(this->download_id().length()),
+      this->_internal_modify_time().data(), static_cast<int>(this->_internal_modify_time().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadRequest.FileInfo.download_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        5, this->download_id(), target);
+      "transfer.TreeListResponse.Entry.modify_time");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_modify_time(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadRequest.FileInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TreeListResponse.Entry)
   return target;
 }
 
-size_t DownloadRequest_FileInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadRequest.FileInfo)
+size_t TreeListResponse_Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TreeListResponse.Entry)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->file_name());
-  }
-
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
+  // string relative_path = 1;
+  if (!this->_internal_relative_path().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->target_path());
+        this->_internal_relative_path());
   }
 
-  // string download_id = 5;
-  if (this->download_id().size() > 0) {
+  // string modify_time = 4;
+  if (!this->_internal_modify_time().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->download_id());
+        this->_internal_modify_time());
   }
 
-  // uint64 offset = 4;
-  if (this->offset() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->offset());
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
   }
 
-  // uint32 chunk_size = 3;
-  if (this->chunk_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->chunk_size());
+  // bool is_directory = 2;
+  if (this->_internal_is_directory() != 0) {
+    total_size += 1 + 1;
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DownloadRequest_FileInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DownloadRequest.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DownloadRequest_FileInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DownloadRequest_FileInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DownloadRequest.FileInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DownloadRequest.FileInfo)
-    MergeFrom(*source);
-  }
-}
-
-void DownloadRequest_FileInfo::MergeFrom(const DownloadRequest_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadRequest.FileInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TreeListResponse_Entry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TreeListResponse_Entry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TreeListResponse_Entry::GetClassData() const { return &_class_data_; }
 
-  if (from.file_name().size() > 0) {
 
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  if (from.target_path().size() > 0) {
+void TreeListResponse_Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TreeListResponse_Entry*>(&to_msg);
+  auto& from = static_cast<const TreeListResponse_Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TreeListResponse.Entry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  if (!from._internal_relative_path().empty()) {
+    _this->_internal_set_relative_path(from._internal_relative_path());
   }
-  if (from.download_id().size() > 0) {
-
-    download_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.download_id_);
+  if (!from._internal_modify_time().empty()) {
+    _this->_internal_set_modify_time(from._internal_modify_time());
   }
-  if (from.offset() != 0) {
-    set_offset(from.offset());
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
   }
-  if (from.chunk_size() != 0) {
-    set_chunk_size(from.chunk_size());
+  if (from._internal_is_directory() != 0) {
+    _this->_internal_set_is_directory(from._internal_is_directory());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DownloadRequest_FileInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DownloadRequest.FileInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void DownloadRequest_FileInfo::CopyFrom(const DownloadRequest_FileInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadRequest.FileInfo)
+void TreeListResponse_Entry::CopyFrom(const TreeListResponse_Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TreeListResponse.Entry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DownloadRequest_FileInfo::IsInitialized() const {
+bool TreeListResponse_Entry::IsInitialized() const {
   return true;
 }
 
-void DownloadRequest_FileInfo::Swap(DownloadRequest_FileInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DownloadRequest_FileInfo::InternalSwap(DownloadRequest_FileInfo* other) {
+void TreeListResponse_Entry::InternalSwap(TreeListResponse_Entry* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  file_name_.Swap(&other->file_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  target_path_.Swap(&other->target_path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  download_id_.Swap(&other->download_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(offset_, other->offset_);
-  swap(chunk_size_, other->chunk_size_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata DownloadRequest_FileInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.relative_path_, lhs_arena,
+      &other->_impl_.relative_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.modify_time_, lhs_arena,
+      &other->_impl_.modify_time_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TreeListResponse_Entry, _impl_.is_directory_)
+      + sizeof(TreeListResponse_Entry::_impl_.is_directory_)
+      - PROTOBUF_FIELD_OFFSET(TreeListResponse_Entry, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TreeListResponse_Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void DownloadRequest::InitAsDefaultInstance() {
-  ::transfer::_DownloadRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::RequestHeader*>(
-      ::transfer::RequestHeader::internal_default_instance());
-}
-class DownloadRequest::HasBitSetters {
+class TreeListResponse::_Internal {
  public:
-  static const ::transfer::RequestHeader& header(const DownloadRequest* msg);
+  static const ::transfer::ResponseHeader& header(const TreeListResponse* msg);
 };
 
-const ::transfer::RequestHeader&
-DownloadRequest::HasBitSetters::header(const DownloadRequest* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadRequest::kHeaderFieldNumber;
-const int DownloadRequest::kFilesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DownloadRequest::DownloadRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DownloadRequest)
-}
-DownloadRequest::DownloadRequest(const DownloadRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      files_(from.files_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_header()) {
-    header_ = new ::transfer::RequestHeader(*from.header_);
-  } else {
-    header_ = nullptr;
+const ::transfer::ResponseHeader&
+TreeListResponse::_Internal::header(const TreeListResponse* msg) {
+  return *msg->_impl_.header_;
+}
+TreeListResponse::TreeListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TreeListResponse)
+}
+TreeListResponse::TreeListResponse(const TreeListResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TreeListResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.has_more_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_next_cursor().empty()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  _this->_impl_.has_more_ = from._impl_.has_more_;
+  // @@protoc_insertion_point(copy_constructor:transfer.TreeListResponse)
+}
+
+inline void TreeListResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.has_more_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TreeListResponse::~TreeListResponse() {
+  // @@protoc_insertion_point(destructor:transfer.TreeListResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:transfer.DownloadRequest)
+  SharedDtor();
 }
 
-void DownloadRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DownloadRequest_transfer_2eproto.base);
-  header_ = nullptr;
+inline void TreeListResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.next_cursor_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-DownloadRequest::~DownloadRequest() {
-  // @@protoc_insertion_point(destructor:transfer.DownloadRequest)
-  SharedDtor();
+void TreeListResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void DownloadRequest::SharedDtor() {
-  if (this != internal_default_instance()) delete header_;
-}
-
-void DownloadRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DownloadRequest& DownloadRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DownloadRequest_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void DownloadRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.DownloadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TreeListResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TreeListResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  files_.Clear();
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.entries_.Clear();
+  _impl_.next_cursor_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  _impl_.has_more_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DownloadRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TreeListResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .transfer.RequestHeader header = 1;
+      // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .transfer.DownloadRequest.FileInfo files = 2;
+      // repeated .transfer.TreeListResponse.Entry entries = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_files(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TreeListResponse.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool has_more = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.has_more_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DownloadRequest::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DownloadRequest)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.RequestHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .transfer.DownloadRequest.FileInfo files = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_files()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DownloadRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DownloadRequest)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DownloadRequest::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DownloadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TreeListResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TreeListResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
-  }
-
-  // repeated .transfer.DownloadRequest.FileInfo files = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->files(static_cast<int>(i)),
-      output);
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // repeated .transfer.TreeListResponse.Entry entries = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DownloadRequest)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* DownloadRequest::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // string next_cursor = 3;
+  if (!this->_internal_next_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TreeListResponse.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_next_cursor(), target);
   }
 
-  // repeated .transfer.DownloadRequest.FileInfo files = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->files_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->files(static_cast<int>(i)), target);
+  // bool has_more = 4;
+  if (this->_internal_has_more() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_has_more(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TreeListResponse)
   return target;
 }
 
-size_t DownloadRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadRequest)
+size_t TreeListResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TreeListResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .transfer.DownloadRequest.FileInfo files = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->files_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->files(static_cast<int>(i)));
-    }
+  // repeated .transfer.TreeListResponse.Entry entries = 2;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  // string next_cursor = 3;
+  if (!this->_internal_next_cursor().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_next_cursor());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
 
-void DownloadRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DownloadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DownloadRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DownloadRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DownloadRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DownloadRequest)
-    MergeFrom(*source);
+  // bool has_more = 4;
+  if (this->_internal_has_more() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DownloadRequest::MergeFrom(const DownloadRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TreeListResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TreeListResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TreeListResponse::GetClassData() const { return &_class_data_; }
+
+
+void TreeListResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TreeListResponse*>(&to_msg);
+  auto& from = static_cast<const TreeListResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TreeListResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  files_.MergeFrom(from.files_);
-  if (from.has_header()) {
-    mutable_header()->::transfer::RequestHeader::MergeFrom(from.header());
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (!from._internal_next_cursor().empty()) {
+    _this->_internal_set_next_cursor(from._internal_next_cursor());
   }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_has_more() != 0) {
+    _this->_internal_set_has_more(from._internal_has_more());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DownloadRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DownloadRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void DownloadRequest::CopyFrom(const DownloadRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadRequest)
+void TreeListResponse::CopyFrom(const TreeListResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TreeListResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DownloadRequest::IsInitialized() const {
+bool TreeListResponse::IsInitialized() const {
   return true;
 }
 
-void DownloadRequest::Swap(DownloadRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DownloadRequest::InternalSwap(DownloadRequest* other) {
+void TreeListResponse::InternalSwap(TreeListResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&files_)->InternalSwap(CastToBase(&other->files_));
-  swap(header_, other->header_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata DownloadRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TreeListResponse, _impl_.has_more_)
+      + sizeof(TreeListResponse::_impl_.has_more_)
+      - PROTOBUF_FIELD_OFFSET(TreeListResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TreeListResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void DownloadResponse_FileResult::InitAsDefaultInstance() {
-}
-class DownloadResponse_FileResult::HasBitSetters {
+class ArchiveRequest::_Internal {
  public:
+  static const ::transfer::RequestHeader& header(const ArchiveRequest* msg);
 };
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadResponse_FileResult::kFileNameFieldNumber;
-const int DownloadResponse_FileResult::kTargetPathFieldNumber;
-const int DownloadResponse_FileResult::kExistsFieldNumber;
-const int DownloadResponse_FileResult::kFileSizeFieldNumber;
-const int DownloadResponse_FileResult::kMd5FieldNumber;
-const int DownloadResponse_FileResult::kNeedChunkFieldNumber;
-const int DownloadResponse_FileResult::kChunkSizeFieldNumber;
-const int DownloadResponse_FileResult::kChunkSequenceFieldNumber;
-const int DownloadResponse_FileResult::kDataFieldNumber;
-const int DownloadResponse_FileResult::kChecksumFieldNumber;
-const int DownloadResponse_FileResult::kIsLastFieldNumber;
-const int DownloadResponse_FileResult::kErrorMessageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DownloadResponse_FileResult::DownloadResponse_FileResult()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DownloadResponse.FileResult)
-}
-DownloadResponse_FileResult::DownloadResponse_FileResult(const DownloadResponse_FileResult& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.file_name().size() > 0) {
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
-  }
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.target_path().size() > 0) {
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
-  }
-  md5_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.md5().size() > 0) {
-    md5_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.md5_);
-  }
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.data().size() > 0) {
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&file_size_, &from.file_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&checksum_) -
-    reinterpret_cast<char*>(&file_size_)) + sizeof(checksum_));
-  // @@protoc_insertion_point(copy_constructor:transfer.DownloadResponse.FileResult)
-}
-
-void DownloadResponse_FileResult::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DownloadResponse_FileResult_transfer_2eproto.base);
-  file_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&checksum_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(checksum_));
-}
-
-DownloadResponse_FileResult::~DownloadResponse_FileResult() {
-  // @@protoc_insertion_point(destructor:transfer.DownloadResponse.FileResult)
+const ::transfer::RequestHeader&
+ArchiveRequest::_Internal::header(const ArchiveRequest* msg) {
+  return *msg->_impl_.header_;
+}
+ArchiveRequest::ArchiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ArchiveRequest)
+}
+ArchiveRequest::ArchiveRequest(const ArchiveRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ArchiveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.archive_id_){}
+    , decltype(_impl_.base_path_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.direction_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.block_sequence_){}
+    , decltype(_impl_.is_last_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.archive_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_archive_id().empty()) {
+    _this->_impl_.archive_id_.Set(from._internal_archive_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.base_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_base_path().empty()) {
+    _this->_impl_.base_path_.Set(from._internal_base_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.direction_, &from._impl_.direction_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_last_) -
+    reinterpret_cast<char*>(&_impl_.direction_)) + sizeof(_impl_.is_last_));
+  // @@protoc_insertion_point(copy_constructor:transfer.ArchiveRequest)
+}
+
+inline void ArchiveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.archive_id_){}
+    , decltype(_impl_.base_path_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.direction_){0}
+    , decltype(_impl_.compression_){0u}
+    , decltype(_impl_.block_sequence_){uint64_t{0u}}
+    , decltype(_impl_.is_last_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.archive_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.base_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ArchiveRequest::~ArchiveRequest() {
+  // @@protoc_insertion_point(destructor:transfer.ArchiveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DownloadResponse_FileResult::SharedDtor() {
-  file_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ArchiveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.archive_id_.Destroy();
+  _impl_.base_path_.Destroy();
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void DownloadResponse_FileResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void ArchiveRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const DownloadResponse_FileResult& DownloadResponse_FileResult::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DownloadResponse_FileResult_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void DownloadResponse_FileResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.DownloadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ArchiveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ArchiveRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  md5_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&file_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&checksum_) -
-      reinterpret_cast<char*>(&file_size_)) + sizeof(checksum_));
-  _internal_metadata_.Clear();
+  _impl_.archive_id_.ClearToEmpty();
+  _impl_.base_path_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.direction_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_last_) -
+      reinterpret_cast<char*>(&_impl_.direction_)) + sizeof(_impl_.is_last_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DownloadResponse_FileResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ArchiveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string file_name = 1;
+      // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_file_name(), ptr, ctx, "transfer.DownloadResponse.FileResult.file_name");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string target_path = 2;
+      // .transfer.ArchiveRequest.Direction direction = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_target_path(), ptr, ctx, "transfer.DownloadResponse.FileResult.target_path");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+          _internal_set_direction(static_cast<::transfer::ArchiveRequest_Direction>(val));
+        } else
+          goto handle_unusual;
         continue;
-      // bool exists = 3;
+      // string archive_id = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_archive_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ArchiveRequest.archive_id"));
+        } else
+          goto handle_unusual;
         continue;
-      // uint64 file_size = 4;
+      // string base_path = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          file_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_base_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ArchiveRequest.base_path"));
+        } else
+          goto handle_unusual;
         continue;
-      // string md5 = 5;
+      // uint32 compression = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_md5(), ptr, ctx, "transfer.DownloadResponse.FileResult.md5");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool need_chunk = 6;
+      // uint64 block_sequence = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.block_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 chunk_size = 7;
+      // bytes data = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 chunk_sequence = 8;
+      // bool is_last = 8;
       case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          chunk_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bytes data = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_data(), ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 checksum = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
-          checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bool is_last = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
-          is_last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string error_message = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_error_message(), ptr, ctx, "transfer.DownloadResponse.FileResult.error_message");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.is_last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DownloadResponse_FileResult::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DownloadResponse.FileResult)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // string file_name = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_file_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->file_name().data(), static_cast<int>(this->file_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadResponse.FileResult.file_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string target_path = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_target_path()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->target_path().data(), static_cast<int>(this->target_path().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadResponse.FileResult.target_path"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool exists = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &exists_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 file_size = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &file_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string md5 = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_md5()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->md5().data(), static_cast<int>(this->md5().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadResponse.FileResult.md5"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool need_chunk = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &need_chunk_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 chunk_size = 7;
-      case 7: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chunk_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 chunk_sequence = 8;
-      case 8: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (64 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &chunk_sequence_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bytes data = 9;
-      case 9: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (74 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
 
-      // uint32 checksum = 10;
-      case 10: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (80 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &checksum_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool is_last = 11;
-      case 11: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (88 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &is_last_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* ArchiveRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ArchiveRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // string error_message = 12;
-      case 12: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (98 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.DownloadResponse.FileResult.error_message"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DownloadResponse.FileResult)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DownloadResponse.FileResult)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DownloadResponse_FileResult::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DownloadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // .transfer.ArchiveRequest.Direction direction = 2;
+  if (this->_internal_direction() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_direction(), target);
+  }
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
+  // string archive_id = 3;
+  if (!this->_internal_archive_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
+      this->_internal_archive_id().data(), static_cast<int>(this->_internal_archive_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.file_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->file_name(), output);
+      "transfer.ArchiveRequest.archive_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_archive_id(), target);
   }
 
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
+  // string base_path = 4;
+  if (!this->_internal_base_path().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
+      this->_internal_base_path().data(), static_cast<int>(this->_internal_base_path().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.target_path");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->target_path(), output);
+      "transfer.ArchiveRequest.base_path");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_base_path(), target);
   }
 
-  // bool exists = 3;
-  if (this->exists() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(3, this->exists(), output);
+  // uint32 compression = 5;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_compression(), target);
   }
 
-  // uint64 file_size = 4;
-  if (this->file_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(4, this->file_size(), output);
+  // uint64 block_sequence = 6;
+  if (this->_internal_block_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_block_sequence(), target);
   }
 
-  // string md5 = 5;
-  if (this->md5().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->md5().data(), static_cast<int>(this->md5().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.md5");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      5, this->md5(), output);
+  // bytes data = 7;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_data(), target);
   }
 
-  // bool need_chunk = 6;
-  if (this->need_chunk() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(6, this->need_chunk(), output);
+  // bool is_last = 8;
+  if (this->_internal_is_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_is_last(), target);
   }
 
-  // uint32 chunk_size = 7;
-  if (this->chunk_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(7, this->chunk_size(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ArchiveRequest)
+  return target;
+}
 
-  // uint32 chunk_sequence = 8;
-  if (this->chunk_sequence() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(8, this->chunk_sequence(), output);
-  }
+size_t ArchiveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ArchiveRequest)
+  size_t total_size = 0;
 
-  // bytes data = 9;
-  if (this->data().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
-      9, this->data(), output);
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // uint32 checksum = 10;
-  if (this->checksum() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(10, this->checksum(), output);
+  // string archive_id = 3;
+  if (!this->_internal_archive_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_archive_id());
   }
 
-  // bool is_last = 11;
-  if (this->is_last() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(11, this->is_last(), output);
+  // string base_path = 4;
+  if (!this->_internal_base_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_base_path());
   }
 
-  // string error_message = 12;
-  if (this->error_message().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.error_message");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      12, this->error_message(), output);
+  // bytes data = 7;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DownloadResponse.FileResult)
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* DownloadResponse_FileResult::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadResponse.FileResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->file_name().data(), static_cast<int>(this->file_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.file_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        1, this->file_name(), target);
+  // .transfer.ArchiveRequest.Direction direction = 2;
+  if (this->_internal_direction() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_direction());
   }
 
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->target_path().data(), static_cast<int>(this->target_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.target_path");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->target_path(), target);
+  // uint32 compression = 5;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
   }
 
-  // bool exists = 3;
-  if (this->exists() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->exists(), target);
+  // uint64 block_sequence = 6;
+  if (this->_internal_block_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_sequence());
   }
 
-  // uint64 file_size = 4;
-  if (this->file_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(4, this->file_size(), target);
+  // bool is_last = 8;
+  if (this->_internal_is_last() != 0) {
+    total_size += 1 + 1;
   }
 
-  // string md5 = 5;
-  if (this->md5().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->md5().data(), static_cast<int>(this->md5().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.md5");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        5, this->md5(), target);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // bool need_chunk = 6;
-  if (this->need_chunk() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->need_chunk(), target);
-  }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ArchiveRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ArchiveRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ArchiveRequest::GetClassData() const { return &_class_data_; }
 
-  // uint32 chunk_size = 7;
-  if (this->chunk_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(7, this->chunk_size(), target);
-  }
 
-  // uint32 chunk_sequence = 8;
-  if (this->chunk_sequence() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(8, this->chunk_sequence(), target);
-  }
+void ArchiveRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ArchiveRequest*>(&to_msg);
+  auto& from = static_cast<const ArchiveRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ArchiveRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // bytes data = 9;
-  if (this->data().size() > 0) {
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
-        9, this->data(), target);
+  if (!from._internal_archive_id().empty()) {
+    _this->_internal_set_archive_id(from._internal_archive_id());
   }
-
-  // uint32 checksum = 10;
-  if (this->checksum() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(10, this->checksum(), target);
+  if (!from._internal_base_path().empty()) {
+    _this->_internal_set_base_path(from._internal_base_path());
   }
-
-  // bool is_last = 11;
-  if (this->is_last() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(11, this->is_last(), target);
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_direction() != 0) {
+    _this->_internal_set_direction(from._internal_direction());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_block_sequence() != 0) {
+    _this->_internal_set_block_sequence(from._internal_block_sequence());
+  }
+  if (from._internal_is_last() != 0) {
+    _this->_internal_set_is_last(from._internal_is_last());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ArchiveRequest::CopyFrom(const ArchiveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ArchiveRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ArchiveRequest::IsInitialized() const {
+  return true;
+}
+
+void ArchiveRequest::InternalSwap(ArchiveRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.archive_id_, lhs_arena,
+      &other->_impl_.archive_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.base_path_, lhs_arena,
+      &other->_impl_.base_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ArchiveRequest, _impl_.is_last_)
+      + sizeof(ArchiveRequest::_impl_.is_last_)
+      - PROTOBUF_FIELD_OFFSET(ArchiveRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ArchiveRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[13]);
+}
+
+// ===================================================================
+
+class ArchiveResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const ArchiveResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+ArchiveResponse::_Internal::header(const ArchiveResponse* msg) {
+  return *msg->_impl_.header_;
+}
+ArchiveResponse::ArchiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ArchiveResponse)
+}
+ArchiveResponse::ArchiveResponse(const ArchiveResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ArchiveResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.archive_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.block_sequence_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.is_last_){}
+    , decltype(_impl_.total_size_){}
+    , decltype(_impl_.total_files_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.archive_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_archive_id().empty()) {
+    _this->_impl_.archive_id_.Set(from._internal_archive_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.block_sequence_, &from._impl_.block_sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_files_) -
+    reinterpret_cast<char*>(&_impl_.block_sequence_)) + sizeof(_impl_.total_files_));
+  // @@protoc_insertion_point(copy_constructor:transfer.ArchiveResponse)
+}
+
+inline void ArchiveResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.archive_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.block_sequence_){uint64_t{0u}}
+    , decltype(_impl_.compression_){0u}
+    , decltype(_impl_.is_last_){false}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , decltype(_impl_.total_files_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.archive_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ArchiveResponse::~ArchiveResponse() {
+  // @@protoc_insertion_point(destructor:transfer.ArchiveResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ArchiveResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.archive_id_.Destroy();
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ArchiveResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ArchiveResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ArchiveResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.archive_id_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.block_sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.total_files_) -
+      reinterpret_cast<char*>(&_impl_.block_sequence_)) + sizeof(_impl_.total_files_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ArchiveResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string archive_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_archive_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ArchiveResponse.archive_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 block_sequence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.block_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_last = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.is_last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_files = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.total_files_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ArchiveResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ArchiveResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string archive_id = 2;
+  if (!this->_internal_archive_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_archive_id().data(), static_cast<int>(this->_internal_archive_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.ArchiveResponse.archive_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_archive_id(), target);
+  }
+
+  // uint64 block_sequence = 3;
+  if (this->_internal_block_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_block_sequence(), target);
+  }
+
+  // uint32 compression = 4;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_compression(), target);
+  }
+
+  // bytes data = 5;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
+  }
+
+  // bool is_last = 6;
+  if (this->_internal_is_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_is_last(), target);
+  }
+
+  // uint64 total_size = 7;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_total_size(), target);
+  }
+
+  // uint64 total_files = 8;
+  if (this->_internal_total_files() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_total_files(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ArchiveResponse)
+  return target;
+}
+
+size_t ArchiveResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ArchiveResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string archive_id = 2;
+  if (!this->_internal_archive_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_archive_id());
+  }
+
+  // bytes data = 5;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 block_sequence = 3;
+  if (this->_internal_block_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_sequence());
+  }
+
+  // uint32 compression = 4;
+  if (this->_internal_compression() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression());
+  }
+
+  // bool is_last = 6;
+  if (this->_internal_is_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 total_size = 7;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
+  }
+
+  // uint64 total_files = 8;
+  if (this->_internal_total_files() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_files());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ArchiveResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ArchiveResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ArchiveResponse::GetClassData() const { return &_class_data_; }
+
+
+void ArchiveResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ArchiveResponse*>(&to_msg);
+  auto& from = static_cast<const ArchiveResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ArchiveResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_archive_id().empty()) {
+    _this->_internal_set_archive_id(from._internal_archive_id());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_block_sequence() != 0) {
+    _this->_internal_set_block_sequence(from._internal_block_sequence());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_is_last() != 0) {
+    _this->_internal_set_is_last(from._internal_is_last());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
+  }
+  if (from._internal_total_files() != 0) {
+    _this->_internal_set_total_files(from._internal_total_files());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ArchiveResponse::CopyFrom(const ArchiveResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ArchiveResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ArchiveResponse::IsInitialized() const {
+  return true;
+}
+
+void ArchiveResponse::InternalSwap(ArchiveResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.archive_id_, lhs_arena,
+      &other->_impl_.archive_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ArchiveResponse, _impl_.total_files_)
+      + sizeof(ArchiveResponse::_impl_.total_files_)
+      - PROTOBUF_FIELD_OFFSET(ArchiveResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ArchiveResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[14]);
+}
+
+// ===================================================================
+
+class SearchRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const SearchRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+SearchRequest::_Internal::header(const SearchRequest* msg) {
+  return *msg->_impl_.header_;
+}
+SearchRequest::SearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.SearchRequest)
+}
+SearchRequest::SearchRequest(const SearchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.root_path_){}
+    , decltype(_impl_.name_pattern_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.min_size_){}
+    , decltype(_impl_.max_size_){}
+    , decltype(_impl_.modified_after_){}
+    , decltype(_impl_.pattern_type_){}
+    , decltype(_impl_.case_sensitive_){}
+    , decltype(_impl_.include_directories_){}
+    , decltype(_impl_.cancel_){}
+    , decltype(_impl_.modified_before_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.page_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.root_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_root_path().empty()) {
+    _this->_impl_.root_path_.Set(from._internal_root_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_pattern_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_pattern_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name_pattern().empty()) {
+    _this->_impl_.name_pattern_.Set(from._internal_name_pattern(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cursor().empty()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.min_size_, &from._impl_.min_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.page_size_) -
+    reinterpret_cast<char*>(&_impl_.min_size_)) + sizeof(_impl_.page_size_));
+  // @@protoc_insertion_point(copy_constructor:transfer.SearchRequest)
+}
+
+inline void SearchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.root_path_){}
+    , decltype(_impl_.name_pattern_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.min_size_){uint64_t{0u}}
+    , decltype(_impl_.max_size_){uint64_t{0u}}
+    , decltype(_impl_.modified_after_){uint64_t{0u}}
+    , decltype(_impl_.pattern_type_){0}
+    , decltype(_impl_.case_sensitive_){false}
+    , decltype(_impl_.include_directories_){false}
+    , decltype(_impl_.cancel_){false}
+    , decltype(_impl_.modified_before_){uint64_t{0u}}
+    , decltype(_impl_.limit_){0u}
+    , decltype(_impl_.page_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.root_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_pattern_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_pattern_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SearchRequest::~SearchRequest() {
+  // @@protoc_insertion_point(destructor:transfer.SearchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SearchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.root_path_.Destroy();
+  _impl_.name_pattern_.Destroy();
+  _impl_.cursor_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void SearchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SearchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.SearchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.root_path_.ClearToEmpty();
+  _impl_.name_pattern_.ClearToEmpty();
+  _impl_.cursor_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.min_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.page_size_) -
+      reinterpret_cast<char*>(&_impl_.min_size_)) + sizeof(_impl_.page_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string root_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_root_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchRequest.root_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name_pattern = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name_pattern();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchRequest.name_pattern"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.SearchRequest.PatternType pattern_type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_pattern_type(static_cast<::transfer::SearchRequest_PatternType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool case_sensitive = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.case_sensitive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 min_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.min_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 modified_after = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.modified_after_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 modified_before = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.modified_before_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool include_directories = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.include_directories_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 limit = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 page_size = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.page_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cursor = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchRequest.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cancel = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.cancel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.SearchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string root_path = 2;
+  if (!this->_internal_root_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_root_path().data(), static_cast<int>(this->_internal_root_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchRequest.root_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_root_path(), target);
+  }
+
+  // string name_pattern = 3;
+  if (!this->_internal_name_pattern().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name_pattern().data(), static_cast<int>(this->_internal_name_pattern().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchRequest.name_pattern");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name_pattern(), target);
+  }
+
+  // .transfer.SearchRequest.PatternType pattern_type = 4;
+  if (this->_internal_pattern_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_pattern_type(), target);
+  }
+
+  // bool case_sensitive = 5;
+  if (this->_internal_case_sensitive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_case_sensitive(), target);
+  }
+
+  // uint64 min_size = 6;
+  if (this->_internal_min_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_min_size(), target);
+  }
+
+  // uint64 max_size = 7;
+  if (this->_internal_max_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_max_size(), target);
+  }
+
+  // uint64 modified_after = 8;
+  if (this->_internal_modified_after() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_modified_after(), target);
+  }
+
+  // uint64 modified_before = 9;
+  if (this->_internal_modified_before() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_modified_before(), target);
+  }
+
+  // bool include_directories = 10;
+  if (this->_internal_include_directories() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_include_directories(), target);
+  }
+
+  // uint32 limit = 11;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_limit(), target);
+  }
+
+  // uint32 page_size = 12;
+  if (this->_internal_page_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_page_size(), target);
+  }
+
+  // string cursor = 13;
+  if (!this->_internal_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchRequest.cursor");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_cursor(), target);
+  }
+
+  // bool cancel = 14;
+  if (this->_internal_cancel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(14, this->_internal_cancel(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.SearchRequest)
+  return target;
+}
+
+size_t SearchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.SearchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string root_path = 2;
+  if (!this->_internal_root_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_root_path());
+  }
+
+  // string name_pattern = 3;
+  if (!this->_internal_name_pattern().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name_pattern());
+  }
+
+  // string cursor = 13;
+  if (!this->_internal_cursor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cursor());
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 min_size = 6;
+  if (this->_internal_min_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_min_size());
+  }
+
+  // uint64 max_size = 7;
+  if (this->_internal_max_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_size());
+  }
+
+  // uint64 modified_after = 8;
+  if (this->_internal_modified_after() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_modified_after());
+  }
+
+  // .transfer.SearchRequest.PatternType pattern_type = 4;
+  if (this->_internal_pattern_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_pattern_type());
+  }
+
+  // bool case_sensitive = 5;
+  if (this->_internal_case_sensitive() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool include_directories = 10;
+  if (this->_internal_include_directories() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool cancel = 14;
+  if (this->_internal_cancel() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 modified_before = 9;
+  if (this->_internal_modified_before() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_modified_before());
+  }
+
+  // uint32 limit = 11;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+  }
+
+  // uint32 page_size = 12;
+  if (this->_internal_page_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchRequest::GetClassData() const { return &_class_data_; }
+
+
+void SearchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchRequest*>(&to_msg);
+  auto& from = static_cast<const SearchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.SearchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_root_path().empty()) {
+    _this->_internal_set_root_path(from._internal_root_path());
+  }
+  if (!from._internal_name_pattern().empty()) {
+    _this->_internal_set_name_pattern(from._internal_name_pattern());
+  }
+  if (!from._internal_cursor().empty()) {
+    _this->_internal_set_cursor(from._internal_cursor());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_min_size() != 0) {
+    _this->_internal_set_min_size(from._internal_min_size());
+  }
+  if (from._internal_max_size() != 0) {
+    _this->_internal_set_max_size(from._internal_max_size());
+  }
+  if (from._internal_modified_after() != 0) {
+    _this->_internal_set_modified_after(from._internal_modified_after());
+  }
+  if (from._internal_pattern_type() != 0) {
+    _this->_internal_set_pattern_type(from._internal_pattern_type());
+  }
+  if (from._internal_case_sensitive() != 0) {
+    _this->_internal_set_case_sensitive(from._internal_case_sensitive());
+  }
+  if (from._internal_include_directories() != 0) {
+    _this->_internal_set_include_directories(from._internal_include_directories());
+  }
+  if (from._internal_cancel() != 0) {
+    _this->_internal_set_cancel(from._internal_cancel());
+  }
+  if (from._internal_modified_before() != 0) {
+    _this->_internal_set_modified_before(from._internal_modified_before());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  if (from._internal_page_size() != 0) {
+    _this->_internal_set_page_size(from._internal_page_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SearchRequest::CopyFrom(const SearchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.SearchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SearchRequest::IsInitialized() const {
+  return true;
+}
+
+void SearchRequest::InternalSwap(SearchRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.root_path_, lhs_arena,
+      &other->_impl_.root_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_pattern_, lhs_arena,
+      &other->_impl_.name_pattern_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchRequest, _impl_.page_size_)
+      + sizeof(SearchRequest::_impl_.page_size_)
+      - PROTOBUF_FIELD_OFFSET(SearchRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[15]);
+}
+
+// ===================================================================
+
+class SearchResponse_Entry::_Internal {
+ public:
+};
+
+SearchResponse_Entry::SearchResponse_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.SearchResponse.Entry)
+}
+SearchResponse_Entry::SearchResponse_Entry(const SearchResponse_Entry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchResponse_Entry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.relative_path_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.is_directory_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.relative_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_relative_path().empty()) {
+    _this->_impl_.relative_path_.Set(from._internal_relative_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_modify_time().empty()) {
+    _this->_impl_.modify_time_.Set(from._internal_modify_time(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.size_, &from._impl_.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.is_directory_) -
+    reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
+  // @@protoc_insertion_point(copy_constructor:transfer.SearchResponse.Entry)
+}
+
+inline void SearchResponse_Entry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.relative_path_){}
+    , decltype(_impl_.modify_time_){}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.is_directory_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.relative_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.modify_time_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SearchResponse_Entry::~SearchResponse_Entry() {
+  // @@protoc_insertion_point(destructor:transfer.SearchResponse.Entry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SearchResponse_Entry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.relative_path_.Destroy();
+  _impl_.modify_time_.Destroy();
+}
+
+void SearchResponse_Entry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SearchResponse_Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.SearchResponse.Entry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.relative_path_.ClearToEmpty();
+  _impl_.modify_time_.ClearToEmpty();
+  ::memset(&_impl_.size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.is_directory_) -
+      reinterpret_cast<char*>(&_impl_.size_)) + sizeof(_impl_.is_directory_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchResponse_Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string relative_path = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_relative_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchResponse.Entry.relative_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_directory = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.is_directory_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string modify_time = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_modify_time();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchResponse.Entry.modify_time"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchResponse_Entry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.SearchResponse.Entry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string relative_path = 1;
+  if (!this->_internal_relative_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_relative_path().data(), static_cast<int>(this->_internal_relative_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchResponse.Entry.relative_path");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_relative_path(), target);
+  }
+
+  // bool is_directory = 2;
+  if (this->_internal_is_directory() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_is_directory(), target);
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
+  }
+
+  // string modify_time = 4;
+  if (!this->_internal_modify_time().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_modify_time().data(), static_cast<int>(this->_internal_modify_time().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchResponse.Entry.modify_time");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_modify_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.SearchResponse.Entry)
+  return target;
+}
+
+size_t SearchResponse_Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.SearchResponse.Entry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string relative_path = 1;
+  if (!this->_internal_relative_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_relative_path());
+  }
+
+  // string modify_time = 4;
+  if (!this->_internal_modify_time().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_modify_time());
+  }
+
+  // uint64 size = 3;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  // bool is_directory = 2;
+  if (this->_internal_is_directory() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchResponse_Entry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchResponse_Entry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchResponse_Entry::GetClassData() const { return &_class_data_; }
+
+
+void SearchResponse_Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchResponse_Entry*>(&to_msg);
+  auto& from = static_cast<const SearchResponse_Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.SearchResponse.Entry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_relative_path().empty()) {
+    _this->_internal_set_relative_path(from._internal_relative_path());
+  }
+  if (!from._internal_modify_time().empty()) {
+    _this->_internal_set_modify_time(from._internal_modify_time());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_is_directory() != 0) {
+    _this->_internal_set_is_directory(from._internal_is_directory());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SearchResponse_Entry::CopyFrom(const SearchResponse_Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.SearchResponse.Entry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SearchResponse_Entry::IsInitialized() const {
+  return true;
+}
+
+void SearchResponse_Entry::InternalSwap(SearchResponse_Entry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.relative_path_, lhs_arena,
+      &other->_impl_.relative_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.modify_time_, lhs_arena,
+      &other->_impl_.modify_time_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchResponse_Entry, _impl_.is_directory_)
+      + sizeof(SearchResponse_Entry::_impl_.is_directory_)
+      - PROTOBUF_FIELD_OFFSET(SearchResponse_Entry, _impl_.size_)>(
+          reinterpret_cast<char*>(&_impl_.size_),
+          reinterpret_cast<char*>(&other->_impl_.size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchResponse_Entry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[16]);
+}
+
+// ===================================================================
+
+class SearchResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const SearchResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+SearchResponse::_Internal::header(const SearchResponse* msg) {
+  return *msg->_impl_.header_;
+}
+SearchResponse::SearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.SearchResponse)
+}
+SearchResponse::SearchResponse(const SearchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SearchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.scanned_count_){}
+    , decltype(_impl_.has_more_){}
+    , decltype(_impl_.truncated_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_next_cursor().empty()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.scanned_count_, &from._impl_.scanned_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.truncated_) -
+    reinterpret_cast<char*>(&_impl_.scanned_count_)) + sizeof(_impl_.truncated_));
+  // @@protoc_insertion_point(copy_constructor:transfer.SearchResponse)
+}
+
+inline void SearchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.next_cursor_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.scanned_count_){uint64_t{0u}}
+    , decltype(_impl_.has_more_){false}
+    , decltype(_impl_.truncated_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SearchResponse::~SearchResponse() {
+  // @@protoc_insertion_point(destructor:transfer.SearchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SearchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.next_cursor_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void SearchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SearchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.SearchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _impl_.next_cursor_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.scanned_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.truncated_) -
+      reinterpret_cast<char*>(&_impl_.scanned_count_)) + sizeof(_impl_.truncated_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SearchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.SearchResponse.Entry entries = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool has_more = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.has_more_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool truncated = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.truncated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 scanned_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.scanned_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string next_cursor = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.SearchResponse.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SearchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.SearchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .transfer.SearchResponse.Entry entries = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool has_more = 3;
+  if (this->_internal_has_more() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_has_more(), target);
+  }
+
+  // bool truncated = 4;
+  if (this->_internal_truncated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_truncated(), target);
+  }
+
+  // uint64 scanned_count = 5;
+  if (this->_internal_scanned_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_scanned_count(), target);
+  }
+
+  // string next_cursor = 6;
+  if (!this->_internal_next_cursor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.SearchResponse.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_next_cursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.SearchResponse)
+  return target;
+}
+
+size_t SearchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.SearchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .transfer.SearchResponse.Entry entries = 2;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string next_cursor = 6;
+  if (!this->_internal_next_cursor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_next_cursor());
+  }
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 scanned_count = 5;
+  if (this->_internal_scanned_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_scanned_count());
+  }
+
+  // bool has_more = 3;
+  if (this->_internal_has_more() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool truncated = 4;
+  if (this->_internal_truncated() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SearchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SearchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SearchResponse::GetClassData() const { return &_class_data_; }
+
+
+void SearchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SearchResponse*>(&to_msg);
+  auto& from = static_cast<const SearchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.SearchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (!from._internal_next_cursor().empty()) {
+    _this->_internal_set_next_cursor(from._internal_next_cursor());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_scanned_count() != 0) {
+    _this->_internal_set_scanned_count(from._internal_scanned_count());
+  }
+  if (from._internal_has_more() != 0) {
+    _this->_internal_set_has_more(from._internal_has_more());
+  }
+  if (from._internal_truncated() != 0) {
+    _this->_internal_set_truncated(from._internal_truncated());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SearchResponse::CopyFrom(const SearchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.SearchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SearchResponse::IsInitialized() const {
+  return true;
+}
+
+void SearchResponse::InternalSwap(SearchResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SearchResponse, _impl_.truncated_)
+      + sizeof(SearchResponse::_impl_.truncated_)
+      - PROTOBUF_FIELD_OFFSET(SearchResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SearchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[17]);
+}
+
+// ===================================================================
+
+class UploadRequest_FileInfo::_Internal {
+ public:
+};
+
+UploadRequest_FileInfo::UploadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.UploadRequest.FileInfo)
+}
+UploadRequest_FileInfo::UploadRequest_FileInfo(const UploadRequest_FileInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadRequest_FileInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.md5_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.upload_id_){}
+    , decltype(_impl_.file_size_){}
+    , decltype(_impl_.need_chunk_){}
+    , decltype(_impl_.chunk_size_){}
+    , decltype(_impl_.chunk_sequence_){}
+    , decltype(_impl_.checksum_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_path().empty()) {
+    _this->_impl_.target_path_.Set(from._internal_target_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.md5_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_md5().empty()) {
+    _this->_impl_.md5_.Set(from._internal_md5(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_upload_id().empty()) {
+    _this->_impl_.upload_id_.Set(from._internal_upload_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.file_size_, &from._impl_.file_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:transfer.UploadRequest.FileInfo)
+}
+
+inline void UploadRequest_FileInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.md5_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.task_id_){}
+    , decltype(_impl_.upload_id_){}
+    , decltype(_impl_.file_size_){uint64_t{0u}}
+    , decltype(_impl_.need_chunk_){false}
+    , decltype(_impl_.chunk_size_){0u}
+    , decltype(_impl_.chunk_sequence_){0u}
+    , decltype(_impl_.checksum_){0u}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.md5_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.upload_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UploadRequest_FileInfo::~UploadRequest_FileInfo() {
+  // @@protoc_insertion_point(destructor:transfer.UploadRequest.FileInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadRequest_FileInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.target_path_.Destroy();
+  _impl_.md5_.Destroy();
+  _impl_.data_.Destroy();
+  _impl_.task_id_.Destroy();
+  _impl_.upload_id_.Destroy();
+}
+
+void UploadRequest_FileInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadRequest_FileInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.UploadRequest.FileInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.target_path_.ClearToEmpty();
+  _impl_.md5_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  _impl_.task_id_.ClearToEmpty();
+  _impl_.upload_id_.ClearToEmpty();
+  ::memset(&_impl_.file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadRequest_FileInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadRequest.FileInfo.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadRequest.FileInfo.target_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 file_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.file_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string md5 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_md5();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadRequest.FileInfo.md5"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool need_chunk = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_sequence = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.chunk_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 checksum = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadRequest.FileInfo.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.TransferStatus status = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::transfer::TransferStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string upload_id = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          auto str = _internal_mutable_upload_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadRequest.FileInfo.upload_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadRequest_FileInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadRequest.FileInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadRequest.FileInfo.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_path().data(), static_cast<int>(this->_internal_target_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadRequest.FileInfo.target_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_target_path(), target);
+  }
+
+  // uint64 file_size = 3;
+  if (this->_internal_file_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_file_size(), target);
+  }
+
+  // string md5 = 4;
+  if (!this->_internal_md5().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_md5().data(), static_cast<int>(this->_internal_md5().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadRequest.FileInfo.md5");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_md5(), target);
+  }
+
+  // bool need_chunk = 5;
+  if (this->_internal_need_chunk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_need_chunk(), target);
+  }
+
+  // uint32 chunk_size = 6;
+  if (this->_internal_chunk_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_chunk_size(), target);
+  }
+
+  // uint32 chunk_sequence = 7;
+  if (this->_internal_chunk_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_chunk_sequence(), target);
+  }
+
+  // bytes data = 8;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        8, this->_internal_data(), target);
+  }
+
+  // uint32 checksum = 9;
+  if (this->_internal_checksum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_checksum(), target);
+  }
+
+  // string task_id = 10;
+  if (!this->_internal_task_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadRequest.FileInfo.task_id");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_task_id(), target);
+  }
+
+  // .transfer.TransferStatus status = 11;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_status(), target);
+  }
+
+  // uint64 offset = 12;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_offset(), target);
+  }
+
+  // string upload_id = 13;
+  if (!this->_internal_upload_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_upload_id().data(), static_cast<int>(this->_internal_upload_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadRequest.FileInfo.upload_id");
+    target = stream->WriteStringMaybeAliased(
+        13, this->_internal_upload_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadRequest.FileInfo)
+  return target;
+}
+
+size_t UploadRequest_FileInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.UploadRequest.FileInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_path());
+  }
+
+  // string md5 = 4;
+  if (!this->_internal_md5().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_md5());
+  }
+
+  // bytes data = 8;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // string task_id = 10;
+  if (!this->_internal_task_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_task_id());
+  }
+
+  // string upload_id = 13;
+  if (!this->_internal_upload_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_upload_id());
+  }
+
+  // uint64 file_size = 3;
+  if (this->_internal_file_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_file_size());
+  }
+
+  // bool need_chunk = 5;
+  if (this->_internal_need_chunk() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 chunk_size = 6;
+  if (this->_internal_chunk_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_size());
+  }
+
+  // uint32 chunk_sequence = 7;
+  if (this->_internal_chunk_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_sequence());
+  }
+
+  // uint32 checksum = 9;
+  if (this->_internal_checksum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_checksum());
+  }
+
+  // uint64 offset = 12;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // .transfer.TransferStatus status = 11;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadRequest_FileInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadRequest_FileInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadRequest_FileInfo::GetClassData() const { return &_class_data_; }
+
+
+void UploadRequest_FileInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadRequest_FileInfo*>(&to_msg);
+  auto& from = static_cast<const UploadRequest_FileInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadRequest.FileInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_target_path().empty()) {
+    _this->_internal_set_target_path(from._internal_target_path());
+  }
+  if (!from._internal_md5().empty()) {
+    _this->_internal_set_md5(from._internal_md5());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (!from._internal_upload_id().empty()) {
+    _this->_internal_set_upload_id(from._internal_upload_id());
+  }
+  if (from._internal_file_size() != 0) {
+    _this->_internal_set_file_size(from._internal_file_size());
+  }
+  if (from._internal_need_chunk() != 0) {
+    _this->_internal_set_need_chunk(from._internal_need_chunk());
+  }
+  if (from._internal_chunk_size() != 0) {
+    _this->_internal_set_chunk_size(from._internal_chunk_size());
+  }
+  if (from._internal_chunk_sequence() != 0) {
+    _this->_internal_set_chunk_sequence(from._internal_chunk_sequence());
+  }
+  if (from._internal_checksum() != 0) {
+    _this->_internal_set_checksum(from._internal_checksum());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadRequest_FileInfo::CopyFrom(const UploadRequest_FileInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadRequest.FileInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadRequest_FileInfo::IsInitialized() const {
+  return true;
+}
+
+void UploadRequest_FileInfo::InternalSwap(UploadRequest_FileInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_path_, lhs_arena,
+      &other->_impl_.target_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.md5_, lhs_arena,
+      &other->_impl_.md5_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.upload_id_, lhs_arena,
+      &other->_impl_.upload_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UploadRequest_FileInfo, _impl_.status_)
+      + sizeof(UploadRequest_FileInfo::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(UploadRequest_FileInfo, _impl_.file_size_)>(
+          reinterpret_cast<char*>(&_impl_.file_size_),
+          reinterpret_cast<char*>(&other->_impl_.file_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadRequest_FileInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[18]);
+}
+
+// ===================================================================
+
+class UploadRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const UploadRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+UploadRequest::_Internal::header(const UploadRequest* msg) {
+  return *msg->_impl_.header_;
+}
+UploadRequest::UploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.UploadRequest)
+}
+UploadRequest::UploadRequest(const UploadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){from._impl_.files_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.UploadRequest)
+}
+
+inline void UploadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UploadRequest::~UploadRequest() {
+  // @@protoc_insertion_point(destructor:transfer.UploadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.files_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void UploadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.UploadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.files_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.UploadRequest.FileInfo files = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_files(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .transfer.UploadRequest.FileInfo files = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_files_size()); i < n; i++) {
+    const auto& repfield = this->_internal_files(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadRequest)
+  return target;
+}
+
+size_t UploadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.UploadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .transfer.UploadRequest.FileInfo files = 2;
+  total_size += 1UL * this->_internal_files_size();
+  for (const auto& msg : this->_impl_.files_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadRequest::GetClassData() const { return &_class_data_; }
+
+
+void UploadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadRequest*>(&to_msg);
+  auto& from = static_cast<const UploadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.files_.MergeFrom(from._impl_.files_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadRequest::CopyFrom(const UploadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadRequest::IsInitialized() const {
+  return true;
+}
+
+void UploadRequest::InternalSwap(UploadRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.files_.InternalSwap(&other->_impl_.files_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[19]);
+}
+
+// ===================================================================
+
+class UploadResponse_FileResult::_Internal {
+ public:
+};
+
+UploadResponse_FileResult::UploadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.UploadResponse.FileResult)
+}
+UploadResponse_FileResult::UploadResponse_FileResult(const UploadResponse_FileResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadResponse_FileResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.need_chunk_){}
+    , decltype(_impl_.next_sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_path().empty()) {
+    _this->_impl_.target_path_.Set(from._internal_target_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.next_sequence_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.next_sequence_));
+  // @@protoc_insertion_point(copy_constructor:transfer.UploadResponse.FileResult)
+}
+
+inline void UploadResponse_FileResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.need_chunk_){false}
+    , decltype(_impl_.next_sequence_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UploadResponse_FileResult::~UploadResponse_FileResult() {
+  // @@protoc_insertion_point(destructor:transfer.UploadResponse.FileResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadResponse_FileResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.target_path_.Destroy();
+  _impl_.error_message_.Destroy();
+}
+
+void UploadResponse_FileResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadResponse_FileResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.UploadResponse.FileResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.target_path_.ClearToEmpty();
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.next_sequence_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.next_sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadResponse_FileResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadResponse.FileResult.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadResponse.FileResult.target_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool need_chunk = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 next_sequence = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.next_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_message = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.UploadResponse.FileResult.error_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadResponse_FileResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadResponse.FileResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadResponse.FileResult.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_path().data(), static_cast<int>(this->_internal_target_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadResponse.FileResult.target_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_target_path(), target);
+  }
+
+  // bool success = 3;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_success(), target);
+  }
+
+  // bool need_chunk = 4;
+  if (this->_internal_need_chunk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_need_chunk(), target);
+  }
+
+  // int32 next_sequence = 5;
+  if (this->_internal_next_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_next_sequence(), target);
+  }
+
+  // string error_message = 6;
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.UploadResponse.FileResult.error_message");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_error_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadResponse.FileResult)
+  return target;
+}
+
+size_t UploadResponse_FileResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.UploadResponse.FileResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_path());
+  }
+
+  // string error_message = 6;
+  if (!this->_internal_error_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
+  }
+
+  // bool success = 3;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool need_chunk = 4;
+  if (this->_internal_need_chunk() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 next_sequence = 5;
+  if (this->_internal_next_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_next_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadResponse_FileResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadResponse_FileResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadResponse_FileResult::GetClassData() const { return &_class_data_; }
+
+
+void UploadResponse_FileResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadResponse_FileResult*>(&to_msg);
+  auto& from = static_cast<const UploadResponse_FileResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadResponse.FileResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_target_path().empty()) {
+    _this->_internal_set_target_path(from._internal_target_path());
+  }
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_need_chunk() != 0) {
+    _this->_internal_set_need_chunk(from._internal_need_chunk());
+  }
+  if (from._internal_next_sequence() != 0) {
+    _this->_internal_set_next_sequence(from._internal_next_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadResponse_FileResult::CopyFrom(const UploadResponse_FileResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadResponse.FileResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadResponse_FileResult::IsInitialized() const {
+  return true;
+}
+
+void UploadResponse_FileResult::InternalSwap(UploadResponse_FileResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_path_, lhs_arena,
+      &other->_impl_.target_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UploadResponse_FileResult, _impl_.next_sequence_)
+      + sizeof(UploadResponse_FileResult::_impl_.next_sequence_)
+      - PROTOBUF_FIELD_OFFSET(UploadResponse_FileResult, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadResponse_FileResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[20]);
+}
+
+// ===================================================================
+
+class UploadResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const UploadResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+UploadResponse::_Internal::header(const UploadResponse* msg) {
+  return *msg->_impl_.header_;
+}
+UploadResponse::UploadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.UploadResponse)
+}
+UploadResponse::UploadResponse(const UploadResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UploadResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.UploadResponse)
+}
+
+inline void UploadResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UploadResponse::~UploadResponse() {
+  // @@protoc_insertion_point(destructor:transfer.UploadResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UploadResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void UploadResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UploadResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.UploadResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UploadResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.UploadResponse.FileResult results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UploadResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.UploadResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .transfer.UploadResponse.FileResult results = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.UploadResponse)
+  return target;
+}
+
+size_t UploadResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.UploadResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .transfer.UploadResponse.FileResult results = 2;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UploadResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UploadResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UploadResponse::GetClassData() const { return &_class_data_; }
+
+
+void UploadResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UploadResponse*>(&to_msg);
+  auto& from = static_cast<const UploadResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.UploadResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UploadResponse::CopyFrom(const UploadResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.UploadResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UploadResponse::IsInitialized() const {
+  return true;
+}
+
+void UploadResponse::InternalSwap(UploadResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UploadResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[21]);
+}
+
+// ===================================================================
+
+class DownloadRequest_FileInfo::_Internal {
+ public:
+};
+
+DownloadRequest_FileInfo::DownloadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DownloadRequest.FileInfo)
+}
+DownloadRequest_FileInfo::DownloadRequest_FileInfo(const DownloadRequest_FileInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DownloadRequest_FileInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.download_id_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.chunk_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_path().empty()) {
+    _this->_impl_.target_path_.Set(from._internal_target_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.download_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.download_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_download_id().empty()) {
+    _this->_impl_.download_id_.Set(from._internal_download_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chunk_size_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.chunk_size_));
+  // @@protoc_insertion_point(copy_constructor:transfer.DownloadRequest.FileInfo)
+}
+
+inline void DownloadRequest_FileInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.download_id_){}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.chunk_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.download_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.download_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DownloadRequest_FileInfo::~DownloadRequest_FileInfo() {
+  // @@protoc_insertion_point(destructor:transfer.DownloadRequest.FileInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DownloadRequest_FileInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.target_path_.Destroy();
+  _impl_.download_id_.Destroy();
+}
+
+void DownloadRequest_FileInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DownloadRequest_FileInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.DownloadRequest.FileInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.target_path_.ClearToEmpty();
+  _impl_.download_id_.ClearToEmpty();
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.chunk_size_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.chunk_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DownloadRequest_FileInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadRequest.FileInfo.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadRequest.FileInfo.target_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offset = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string download_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_download_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadRequest.FileInfo.download_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DownloadRequest_FileInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadRequest.FileInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadRequest.FileInfo.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_path().data(), static_cast<int>(this->_internal_target_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadRequest.FileInfo.target_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_target_path(), target);
+  }
+
+  // uint32 chunk_size = 3;
+  if (this->_internal_chunk_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_chunk_size(), target);
+  }
+
+  // uint64 offset = 4;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_offset(), target);
+  }
+
+  // string download_id = 5;
+  if (!this->_internal_download_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_download_id().data(), static_cast<int>(this->_internal_download_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadRequest.FileInfo.download_id");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_download_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadRequest.FileInfo)
+  return target;
+}
+
+size_t DownloadRequest_FileInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadRequest.FileInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_path());
+  }
+
+  // string download_id = 5;
+  if (!this->_internal_download_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_download_id());
+  }
+
+  // uint64 offset = 4;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  // uint32 chunk_size = 3;
+  if (this->_internal_chunk_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DownloadRequest_FileInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DownloadRequest_FileInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DownloadRequest_FileInfo::GetClassData() const { return &_class_data_; }
+
+
+void DownloadRequest_FileInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DownloadRequest_FileInfo*>(&to_msg);
+  auto& from = static_cast<const DownloadRequest_FileInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadRequest.FileInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_target_path().empty()) {
+    _this->_internal_set_target_path(from._internal_target_path());
+  }
+  if (!from._internal_download_id().empty()) {
+    _this->_internal_set_download_id(from._internal_download_id());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_chunk_size() != 0) {
+    _this->_internal_set_chunk_size(from._internal_chunk_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DownloadRequest_FileInfo::CopyFrom(const DownloadRequest_FileInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadRequest.FileInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DownloadRequest_FileInfo::IsInitialized() const {
+  return true;
+}
+
+void DownloadRequest_FileInfo::InternalSwap(DownloadRequest_FileInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_path_, lhs_arena,
+      &other->_impl_.target_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.download_id_, lhs_arena,
+      &other->_impl_.download_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DownloadRequest_FileInfo, _impl_.chunk_size_)
+      + sizeof(DownloadRequest_FileInfo::_impl_.chunk_size_)
+      - PROTOBUF_FIELD_OFFSET(DownloadRequest_FileInfo, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DownloadRequest_FileInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[22]);
+}
+
+// ===================================================================
+
+class DownloadRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const DownloadRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+DownloadRequest::_Internal::header(const DownloadRequest* msg) {
+  return *msg->_impl_.header_;
+}
+DownloadRequest::DownloadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DownloadRequest)
+}
+DownloadRequest::DownloadRequest(const DownloadRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DownloadRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){from._impl_.files_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.DownloadRequest)
+}
+
+inline void DownloadRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.files_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DownloadRequest::~DownloadRequest() {
+  // @@protoc_insertion_point(destructor:transfer.DownloadRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DownloadRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.files_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void DownloadRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DownloadRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.DownloadRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.files_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DownloadRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.DownloadRequest.FileInfo files = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_files(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DownloadRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .transfer.DownloadRequest.FileInfo files = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_files_size()); i < n; i++) {
+    const auto& repfield = this->_internal_files(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadRequest)
+  return target;
+}
+
+size_t DownloadRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .transfer.DownloadRequest.FileInfo files = 2;
+  total_size += 1UL * this->_internal_files_size();
+  for (const auto& msg : this->_impl_.files_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DownloadRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DownloadRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DownloadRequest::GetClassData() const { return &_class_data_; }
+
+
+void DownloadRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DownloadRequest*>(&to_msg);
+  auto& from = static_cast<const DownloadRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.files_.MergeFrom(from._impl_.files_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DownloadRequest::CopyFrom(const DownloadRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DownloadRequest::IsInitialized() const {
+  return true;
+}
+
+void DownloadRequest::InternalSwap(DownloadRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.files_.InternalSwap(&other->_impl_.files_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DownloadRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[23]);
+}
+
+// ===================================================================
+
+class DownloadResponse_FileResult::_Internal {
+ public:
+};
+
+DownloadResponse_FileResult::DownloadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DownloadResponse.FileResult)
+}
+DownloadResponse_FileResult::DownloadResponse_FileResult(const DownloadResponse_FileResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DownloadResponse_FileResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.md5_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.file_size_){}
+    , decltype(_impl_.exists_){}
+    , decltype(_impl_.need_chunk_){}
+    , decltype(_impl_.is_last_){}
+    , decltype(_impl_.chunk_size_){}
+    , decltype(_impl_.chunk_sequence_){}
+    , decltype(_impl_.checksum_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_file_name().empty()) {
+    _this->_impl_.file_name_.Set(from._internal_file_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_target_path().empty()) {
+    _this->_impl_.target_path_.Set(from._internal_target_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.md5_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_md5().empty()) {
+    _this->_impl_.md5_.Set(from._internal_md5(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.file_size_, &from._impl_.file_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.checksum_) -
+    reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.checksum_));
+  // @@protoc_insertion_point(copy_constructor:transfer.DownloadResponse.FileResult)
+}
+
+inline void DownloadResponse_FileResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.file_name_){}
+    , decltype(_impl_.target_path_){}
+    , decltype(_impl_.md5_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.error_message_){}
+    , decltype(_impl_.file_size_){uint64_t{0u}}
+    , decltype(_impl_.exists_){false}
+    , decltype(_impl_.need_chunk_){false}
+    , decltype(_impl_.is_last_){false}
+    , decltype(_impl_.chunk_size_){0u}
+    , decltype(_impl_.chunk_sequence_){0u}
+    , decltype(_impl_.checksum_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.file_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.target_path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.md5_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DownloadResponse_FileResult::~DownloadResponse_FileResult() {
+  // @@protoc_insertion_point(destructor:transfer.DownloadResponse.FileResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DownloadResponse_FileResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.file_name_.Destroy();
+  _impl_.target_path_.Destroy();
+  _impl_.md5_.Destroy();
+  _impl_.data_.Destroy();
+  _impl_.error_message_.Destroy();
+}
+
+void DownloadResponse_FileResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DownloadResponse_FileResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.DownloadResponse.FileResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.file_name_.ClearToEmpty();
+  _impl_.target_path_.ClearToEmpty();
+  _impl_.md5_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  _impl_.error_message_.ClearToEmpty();
+  ::memset(&_impl_.file_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.checksum_) -
+      reinterpret_cast<char*>(&_impl_.file_size_)) + sizeof(_impl_.checksum_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DownloadResponse_FileResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string file_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_file_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadResponse.FileResult.file_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string target_path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_target_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadResponse.FileResult.target_path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool exists = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 file_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.file_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string md5 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_md5();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadResponse.FileResult.md5"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool need_chunk = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.need_chunk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.chunk_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 chunk_sequence = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.chunk_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 checksum = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_last = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.is_last_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_message = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.DownloadResponse.FileResult.error_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DownloadResponse_FileResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadResponse.FileResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_file_name().data(), static_cast<int>(this->_internal_file_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadResponse.FileResult.file_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_file_name(), target);
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_target_path().data(), static_cast<int>(this->_internal_target_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadResponse.FileResult.target_path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_target_path(), target);
+  }
+
+  // bool exists = 3;
+  if (this->_internal_exists() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_exists(), target);
+  }
+
+  // uint64 file_size = 4;
+  if (this->_internal_file_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_file_size(), target);
+  }
+
+  // string md5 = 5;
+  if (!this->_internal_md5().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_md5().data(), static_cast<int>(this->_internal_md5().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadResponse.FileResult.md5");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_md5(), target);
+  }
+
+  // bool need_chunk = 6;
+  if (this->_internal_need_chunk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_need_chunk(), target);
+  }
+
+  // uint32 chunk_size = 7;
+  if (this->_internal_chunk_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_chunk_size(), target);
+  }
+
+  // uint32 chunk_sequence = 8;
+  if (this->_internal_chunk_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_chunk_sequence(), target);
+  }
+
+  // bytes data = 9;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        9, this->_internal_data(), target);
+  }
+
+  // uint32 checksum = 10;
+  if (this->_internal_checksum() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_checksum(), target);
+  }
+
+  // bool is_last = 11;
+  if (this->_internal_is_last() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_is_last(), target);
+  }
+
+  // string error_message = 12;
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.DownloadResponse.FileResult.error_message");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_error_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadResponse.FileResult)
+  return target;
+}
+
+size_t DownloadResponse_FileResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadResponse.FileResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string file_name = 1;
+  if (!this->_internal_file_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_file_name());
+  }
+
+  // string target_path = 2;
+  if (!this->_internal_target_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_target_path());
+  }
+
+  // string md5 = 5;
+  if (!this->_internal_md5().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_md5());
+  }
+
+  // bytes data = 9;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // string error_message = 12;
+  if (!this->_internal_error_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
+  }
+
+  // uint64 file_size = 4;
+  if (this->_internal_file_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_file_size());
+  }
+
+  // bool exists = 3;
+  if (this->_internal_exists() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool need_chunk = 6;
+  if (this->_internal_need_chunk() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool is_last = 11;
+  if (this->_internal_is_last() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 chunk_size = 7;
+  if (this->_internal_chunk_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_size());
+  }
+
+  // uint32 chunk_sequence = 8;
+  if (this->_internal_chunk_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_sequence());
+  }
+
+  // uint32 checksum = 10;
+  if (this->_internal_checksum() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_checksum());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DownloadResponse_FileResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DownloadResponse_FileResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DownloadResponse_FileResult::GetClassData() const { return &_class_data_; }
+
+
+void DownloadResponse_FileResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DownloadResponse_FileResult*>(&to_msg);
+  auto& from = static_cast<const DownloadResponse_FileResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadResponse.FileResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_file_name().empty()) {
+    _this->_internal_set_file_name(from._internal_file_name());
+  }
+  if (!from._internal_target_path().empty()) {
+    _this->_internal_set_target_path(from._internal_target_path());
+  }
+  if (!from._internal_md5().empty()) {
+    _this->_internal_set_md5(from._internal_md5());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
+  }
+  if (from._internal_file_size() != 0) {
+    _this->_internal_set_file_size(from._internal_file_size());
+  }
+  if (from._internal_exists() != 0) {
+    _this->_internal_set_exists(from._internal_exists());
+  }
+  if (from._internal_need_chunk() != 0) {
+    _this->_internal_set_need_chunk(from._internal_need_chunk());
+  }
+  if (from._internal_is_last() != 0) {
+    _this->_internal_set_is_last(from._internal_is_last());
+  }
+  if (from._internal_chunk_size() != 0) {
+    _this->_internal_set_chunk_size(from._internal_chunk_size());
+  }
+  if (from._internal_chunk_sequence() != 0) {
+    _this->_internal_set_chunk_sequence(from._internal_chunk_sequence());
+  }
+  if (from._internal_checksum() != 0) {
+    _this->_internal_set_checksum(from._internal_checksum());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DownloadResponse_FileResult::CopyFrom(const DownloadResponse_FileResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadResponse.FileResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DownloadResponse_FileResult::IsInitialized() const {
+  return true;
+}
+
+void DownloadResponse_FileResult::InternalSwap(DownloadResponse_FileResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.file_name_, lhs_arena,
+      &other->_impl_.file_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.target_path_, lhs_arena,
+      &other->_impl_.target_path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.md5_, lhs_arena,
+      &other->_impl_.md5_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DownloadResponse_FileResult, _impl_.checksum_)
+      + sizeof(DownloadResponse_FileResult::_impl_.checksum_)
+      - PROTOBUF_FIELD_OFFSET(DownloadResponse_FileResult, _impl_.file_size_)>(
+          reinterpret_cast<char*>(&_impl_.file_size_),
+          reinterpret_cast<char*>(&other->_impl_.file_size_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DownloadResponse_FileResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[24]);
+}
+
+// ===================================================================
+
+class DownloadResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const DownloadResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+DownloadResponse::_Internal::header(const DownloadResponse* msg) {
+  return *msg->_impl_.header_;
+}
+DownloadResponse::DownloadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.DownloadResponse)
+}
+DownloadResponse::DownloadResponse(const DownloadResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DownloadResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.DownloadResponse)
+}
+
+inline void DownloadResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DownloadResponse::~DownloadResponse() {
+  // @@protoc_insertion_point(destructor:transfer.DownloadResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DownloadResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void DownloadResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DownloadResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.DownloadResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DownloadResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.DownloadResponse.FileResult results = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DownloadResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .transfer.DownloadResponse.FileResult results = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadResponse)
+  return target;
+}
+
+size_t DownloadResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .transfer.DownloadResponse.FileResult results = 2;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DownloadResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DownloadResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DownloadResponse::GetClassData() const { return &_class_data_; }
+
+
+void DownloadResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DownloadResponse*>(&to_msg);
+  auto& from = static_cast<const DownloadResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DownloadResponse::CopyFrom(const DownloadResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DownloadResponse::IsInitialized() const {
+  return true;
+}
+
+void DownloadResponse::InternalSwap(DownloadResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DownloadResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[25]);
+}
+
+// ===================================================================
+
+class TransferControlRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const TransferControlRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+TransferControlRequest::_Internal::header(const TransferControlRequest* msg) {
+  return *msg->_impl_.header_;
+}
+TransferControlRequest::TransferControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TransferControlRequest)
+}
+TransferControlRequest::TransferControlRequest(const TransferControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferControlRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.control_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.control_type_ = from._impl_.control_type_;
+  // @@protoc_insertion_point(copy_constructor:transfer.TransferControlRequest)
+}
+
+inline void TransferControlRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.control_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferControlRequest::~TransferControlRequest() {
+  // @@protoc_insertion_point(destructor:transfer.TransferControlRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferControlRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.task_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void TransferControlRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferControlRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TransferControlRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.task_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.control_type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferControlRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TransferControlRequest.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.TransferControlRequest.ControlType control_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_control_type(static_cast<::transfer::TransferControlRequest_ControlType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferControlRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferControlRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TransferControlRequest.task_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_task_id(), target);
+  }
+
+  // .transfer.TransferControlRequest.ControlType control_type = 3;
+  if (this->_internal_control_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_control_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferControlRequest)
+  return target;
+}
+
+size_t TransferControlRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TransferControlRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_task_id());
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // .transfer.TransferControlRequest.ControlType control_type = 3;
+  if (this->_internal_control_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_control_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferControlRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferControlRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferControlRequest::GetClassData() const { return &_class_data_; }
+
+
+void TransferControlRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferControlRequest*>(&to_msg);
+  auto& from = static_cast<const TransferControlRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferControlRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_control_type() != 0) {
+    _this->_internal_set_control_type(from._internal_control_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferControlRequest::CopyFrom(const TransferControlRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferControlRequest::IsInitialized() const {
+  return true;
+}
+
+void TransferControlRequest::InternalSwap(TransferControlRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferControlRequest, _impl_.control_type_)
+      + sizeof(TransferControlRequest::_impl_.control_type_)
+      - PROTOBUF_FIELD_OFFSET(TransferControlRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferControlRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[26]);
+}
+
+// ===================================================================
+
+class TransferControlResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const TransferControlResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+TransferControlResponse::_Internal::header(const TransferControlResponse* msg) {
+  return *msg->_impl_.header_;
+}
+TransferControlResponse::TransferControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TransferControlResponse)
+}
+TransferControlResponse::TransferControlResponse(const TransferControlResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferControlResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.new_status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.new_status_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.new_status_));
+  // @@protoc_insertion_point(copy_constructor:transfer.TransferControlResponse)
+}
+
+inline void TransferControlResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.new_status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferControlResponse::~TransferControlResponse() {
+  // @@protoc_insertion_point(destructor:transfer.TransferControlResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferControlResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.task_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void TransferControlResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferControlResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TransferControlResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.task_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.new_status_) -
+      reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.new_status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TransferControlResponse.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool success = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.TransferStatus new_status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_new_status(static_cast<::transfer::TransferStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferControlResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferControlResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TransferControlResponse.task_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_task_id(), target);
+  }
+
+  // bool success = 3;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_success(), target);
+  }
+
+  // .transfer.TransferStatus new_status = 4;
+  if (this->_internal_new_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_new_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferControlResponse)
+  return target;
+}
+
+size_t TransferControlResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TransferControlResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_task_id());
+  }
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // bool success = 3;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .transfer.TransferStatus new_status = 4;
+  if (this->_internal_new_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_new_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferControlResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferControlResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferControlResponse::GetClassData() const { return &_class_data_; }
+
+
+void TransferControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferControlResponse*>(&to_msg);
+  auto& from = static_cast<const TransferControlResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferControlResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_new_status() != 0) {
+    _this->_internal_set_new_status(from._internal_new_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferControlResponse::CopyFrom(const TransferControlResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferControlResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferControlResponse::IsInitialized() const {
+  return true;
+}
+
+void TransferControlResponse::InternalSwap(TransferControlResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferControlResponse, _impl_.new_status_)
+      + sizeof(TransferControlResponse::_impl_.new_status_)
+      - PROTOBUF_FIELD_OFFSET(TransferControlResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferControlResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[27]);
+}
+
+// ===================================================================
+
+class TransferProgressRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const TransferProgressRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+TransferProgressRequest::_Internal::header(const TransferProgressRequest* msg) {
+  return *msg->_impl_.header_;
+}
+TransferProgressRequest::TransferProgressRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TransferProgressRequest)
+}
+TransferProgressRequest::TransferProgressRequest(const TransferProgressRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferProgressRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.TransferProgressRequest)
+}
+
+inline void TransferProgressRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferProgressRequest::~TransferProgressRequest() {
+  // @@protoc_insertion_point(destructor:transfer.TransferProgressRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferProgressRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.task_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void TransferProgressRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferProgressRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TransferProgressRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.task_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferProgressRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TransferProgressRequest.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransferProgressRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferProgressRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TransferProgressRequest.task_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_task_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferProgressRequest)
+  return target;
+}
+
+size_t TransferProgressRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TransferProgressRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_task_id());
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferProgressRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferProgressRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferProgressRequest::GetClassData() const { return &_class_data_; }
+
+
+void TransferProgressRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferProgressRequest*>(&to_msg);
+  auto& from = static_cast<const TransferProgressRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferProgressRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransferProgressRequest::CopyFrom(const TransferProgressRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferProgressRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferProgressRequest::IsInitialized() const {
+  return true;
+}
+
+void TransferProgressRequest::InternalSwap(TransferProgressRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferProgressRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[28]);
+}
+
+// ===================================================================
+
+class TransferProgressResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const TransferProgressResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+TransferProgressResponse::_Internal::header(const TransferProgressResponse* msg) {
+  return *msg->_impl_.header_;
+}
+TransferProgressResponse::TransferProgressResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.TransferProgressResponse)
+}
+TransferProgressResponse::TransferProgressResponse(const TransferProgressResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransferProgressResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.task_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.transferred_size_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.speed_){}
+    , decltype(_impl_.total_size_){}
+    , decltype(_impl_.progress_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_id().empty()) {
+    _this->_impl_.task_id_.Set(from._internal_task_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.task_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_task_name().empty()) {
+    _this->_impl_.task_name_.Set(from._internal_task_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.transferred_size_, &from._impl_.transferred_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.progress_) -
+    reinterpret_cast<char*>(&_impl_.transferred_size_)) + sizeof(_impl_.progress_));
+  // @@protoc_insertion_point(copy_constructor:transfer.TransferProgressResponse)
+}
+
+inline void TransferProgressResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.task_id_){}
+    , decltype(_impl_.task_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.transferred_size_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.speed_){0u}
+    , decltype(_impl_.total_size_){uint64_t{0u}}
+    , decltype(_impl_.progress_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.task_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.task_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.task_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TransferProgressResponse::~TransferProgressResponse() {
+  // @@protoc_insertion_point(destructor:transfer.TransferProgressResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransferProgressResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.task_id_.Destroy();
+  _impl_.task_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void TransferProgressResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransferProgressResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.TransferProgressResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.task_id_.ClearToEmpty();
+  _impl_.task_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.transferred_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.progress_) -
+      reinterpret_cast<char*>(&_impl_.transferred_size_)) + sizeof(_impl_.progress_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransferProgressResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_task_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TransferProgressResponse.task_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string task_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_task_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.TransferProgressResponse.task_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .transfer.TransferStatus status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::transfer::TransferStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 transferred_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.transferred_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 speed = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 progress = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.progress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
 
-  // string error_message = 12;
-  if (this->error_message().size() > 0) {
+uint8_t* TransferProgressResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferProgressResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
+      this->_internal_task_id().data(), static_cast<int>(this->_internal_task_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.DownloadResponse.FileResult.error_message");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        12, this->error_message(), target);
+      "transfer.TransferProgressResponse.task_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_task_id(), target);
+  }
+
+  // string task_name = 3;
+  if (!this->_internal_task_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_task_name().data(), static_cast<int>(this->_internal_task_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.TransferProgressResponse.task_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_task_name(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  // .transfer.TransferStatus status = 4;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_status(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadResponse.FileResult)
+
+  // uint64 transferred_size = 5;
+  if (this->_internal_transferred_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_transferred_size(), target);
+  }
+
+  // uint64 total_size = 6;
+  if (this->_internal_total_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_total_size(), target);
+  }
+
+  // uint32 speed = 7;
+  if (this->_internal_speed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_speed(), target);
+  }
+
+  // uint32 progress = 8;
+  if (this->_internal_progress() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_progress(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferProgressResponse)
   return target;
 }
 
-size_t DownloadResponse_FileResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadResponse.FileResult)
+size_t TransferProgressResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.TransferProgressResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string file_name = 1;
-  if (this->file_name().size() > 0) {
+  // string task_id = 2;
+  if (!this->_internal_task_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->file_name());
+        this->_internal_task_id());
   }
 
-  // string target_path = 2;
-  if (this->target_path().size() > 0) {
+  // string task_name = 3;
+  if (!this->_internal_task_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->target_path());
+        this->_internal_task_name());
   }
 
-  // string md5 = 5;
-  if (this->md5().size() > 0) {
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->md5());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
   }
 
-  // bytes data = 9;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->data());
+  // uint64 transferred_size = 5;
+  if (this->_internal_transferred_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transferred_size());
   }
 
-  // string error_message = 12;
-  if (this->error_message().size() > 0) {
+  // .transfer.TransferStatus status = 4;
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  // uint64 file_size = 4;
-  if (this->file_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->file_size());
+  // uint32 speed = 7;
+  if (this->_internal_speed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_speed());
   }
 
-  // bool exists = 3;
-  if (this->exists() != 0) {
-    total_size += 1 + 1;
+  // uint64 total_size = 6;
+  if (this->_internal_total_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_size());
   }
 
-  // bool need_chunk = 6;
-  if (this->need_chunk() != 0) {
-    total_size += 1 + 1;
+  // uint32 progress = 8;
+  if (this->_internal_progress() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_progress());
   }
 
-  // bool is_last = 11;
-  if (this->is_last() != 0) {
-    total_size += 1 + 1;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransferProgressResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransferProgressResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransferProgressResponse::GetClassData() const { return &_class_data_; }
+
+
+void TransferProgressResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransferProgressResponse*>(&to_msg);
+  auto& from = static_cast<const TransferProgressResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferProgressResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_task_id().empty()) {
+    _this->_internal_set_task_id(from._internal_task_id());
+  }
+  if (!from._internal_task_name().empty()) {
+    _this->_internal_set_task_name(from._internal_task_name());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_transferred_size() != 0) {
+    _this->_internal_set_transferred_size(from._internal_transferred_size());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_speed() != 0) {
+    _this->_internal_set_speed(from._internal_speed());
+  }
+  if (from._internal_total_size() != 0) {
+    _this->_internal_set_total_size(from._internal_total_size());
   }
+  if (from._internal_progress() != 0) {
+    _this->_internal_set_progress(from._internal_progress());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // uint32 chunk_size = 7;
-  if (this->chunk_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->chunk_size());
+void TransferProgressResponse::CopyFrom(const TransferProgressResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferProgressResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransferProgressResponse::IsInitialized() const {
+  return true;
+}
+
+void TransferProgressResponse::InternalSwap(TransferProgressResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_id_, lhs_arena,
+      &other->_impl_.task_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.task_name_, lhs_arena,
+      &other->_impl_.task_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransferProgressResponse, _impl_.progress_)
+      + sizeof(TransferProgressResponse::_impl_.progress_)
+      - PROTOBUF_FIELD_OFFSET(TransferProgressResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransferProgressResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[29]);
+}
+
+// ===================================================================
+
+class WatchRequest::_Internal {
+ public:
+  static const ::transfer::RequestHeader& header(const WatchRequest* msg);
+};
+
+const ::transfer::RequestHeader&
+WatchRequest::_Internal::header(const WatchRequest* msg) {
+  return *msg->_impl_.header_;
+}
+WatchRequest::WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.WatchRequest)
+}
+WatchRequest::WatchRequest(const WatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paths_){from._impl_.paths_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.WatchRequest)
+}
+
+inline void WatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paths_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WatchRequest::~WatchRequest() {
+  // @@protoc_insertion_point(destructor:transfer.WatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // uint32 chunk_sequence = 8;
-  if (this->chunk_sequence() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->chunk_sequence());
+inline void WatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.paths_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.WatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.paths_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string paths = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_paths();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.WatchRequest.paths"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.WatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // uint32 checksum = 10;
-  if (this->checksum() != 0) {
+  // repeated string paths = 2;
+  for (int i = 0, n = this->_internal_paths_size(); i < n; i++) {
+    const auto& s = this->_internal_paths(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.WatchRequest.paths");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.WatchRequest)
+  return target;
+}
+
+size_t WatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.WatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string paths = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.paths_.size());
+  for (int i = 0, n = _impl_.paths_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.paths_.Get(i));
+  }
+
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->checksum());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void WatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchRequest*>(&to_msg);
+  auto& from = static_cast<const WatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.WatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.paths_.MergeFrom(from._impl_.paths_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchRequest::CopyFrom(const WatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.WatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchRequest::IsInitialized() const {
+  return true;
+}
+
+void WatchRequest::InternalSwap(WatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.paths_.InternalSwap(&other->_impl_.paths_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[30]);
+}
+
+// ===================================================================
+
+class WatchResponse::_Internal {
+ public:
+  static const ::transfer::ResponseHeader& header(const WatchResponse* msg);
+};
+
+const ::transfer::ResponseHeader&
+WatchResponse::_Internal::header(const WatchResponse* msg) {
+  return *msg->_impl_.header_;
+}
+WatchResponse::WatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.WatchResponse)
+}
+WatchResponse::WatchResponse(const WatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:transfer.WatchResponse)
+}
+
+inline void WatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WatchResponse::~WatchResponse() {
+  // @@protoc_insertion_point(destructor:transfer.WatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
+
+inline void WatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.WatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void DownloadResponse_FileResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DownloadResponse.FileResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DownloadResponse_FileResult* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DownloadResponse_FileResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DownloadResponse.FileResult)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DownloadResponse.FileResult)
-    MergeFrom(*source);
-  }
+const char* WatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .transfer.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void DownloadResponse_FileResult::MergeFrom(const DownloadResponse_FileResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadResponse.FileResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* WatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.WatchResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.file_name().size() > 0) {
-
-    file_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.file_name_);
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
-  if (from.target_path().size() > 0) {
 
-    target_path_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.target_path_);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  if (from.md5().size() > 0) {
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.WatchResponse)
+  return target;
+}
 
-    md5_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.md5_);
-  }
-  if (from.data().size() > 0) {
+size_t WatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.WatchResponse)
+  size_t total_size = 0;
 
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  if (from.error_message().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  if (from.file_size() != 0) {
-    set_file_size(from.file_size());
-  }
-  if (from.exists() != 0) {
-    set_exists(from.exists());
-  }
-  if (from.need_chunk() != 0) {
-    set_need_chunk(from.need_chunk());
-  }
-  if (from.is_last() != 0) {
-    set_is_last(from.is_last());
-  }
-  if (from.chunk_size() != 0) {
-    set_chunk_size(from.chunk_size());
-  }
-  if (from.chunk_sequence() != 0) {
-    set_chunk_sequence(from.chunk_sequence());
-  }
-  if (from.checksum() != 0) {
-    set_checksum(from.checksum());
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DownloadResponse_FileResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DownloadResponse.FileResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void WatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchResponse*>(&to_msg);
+  auto& from = static_cast<const WatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.WatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DownloadResponse_FileResult::CopyFrom(const DownloadResponse_FileResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadResponse.FileResult)
+void WatchResponse::CopyFrom(const WatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.WatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DownloadResponse_FileResult::IsInitialized() const {
+bool WatchResponse::IsInitialized() const {
   return true;
 }
 
-void DownloadResponse_FileResult::Swap(DownloadResponse_FileResult* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DownloadResponse_FileResult::InternalSwap(DownloadResponse_FileResult* other) {
+void WatchResponse::InternalSwap(WatchResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  file_name_.Swap(&other->file_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  target_path_.Swap(&other->target_path_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  md5_.Swap(&other->md5_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  error_message_.Swap(&other->error_message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(file_size_, other->file_size_);
-  swap(exists_, other->exists_);
-  swap(need_chunk_, other->need_chunk_);
-  swap(is_last_, other->is_last_);
-  swap(chunk_size_, other->chunk_size_);
-  swap(chunk_sequence_, other->chunk_sequence_);
-  swap(checksum_, other->checksum_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.header_, other->_impl_.header_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata DownloadResponse_FileResult::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata WatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[31]);
 }
 
-
 // ===================================================================
 
-void DownloadResponse::InitAsDefaultInstance() {
-  ::transfer::_DownloadResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::ResponseHeader*>(
-      ::transfer::ResponseHeader::internal_default_instance());
-}
-class DownloadResponse::HasBitSetters {
+class ChangeNotification::_Internal {
  public:
-  static const ::transfer::ResponseHeader& header(const DownloadResponse* msg);
+  static const ::transfer::ResponseHeader& header(const ChangeNotification* msg);
 };
 
 const ::transfer::ResponseHeader&
-DownloadResponse::HasBitSetters::header(const DownloadResponse* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int DownloadResponse::kHeaderFieldNumber;
-const int DownloadResponse::kResultsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-DownloadResponse::DownloadResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.DownloadResponse)
-}
-DownloadResponse::DownloadResponse(const DownloadResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      results_(from.results_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_header()) {
-    header_ = new ::transfer::ResponseHeader(*from.header_);
-  } else {
-    header_ = nullptr;
+ChangeNotification::_Internal::header(const ChangeNotification* msg) {
+  return *msg->_impl_.header_;
+}
+ChangeNotification::ChangeNotification(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.ChangeNotification)
+}
+ChangeNotification::ChangeNotification(const ChangeNotification& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangeNotification* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changed_){from._impl_.changed_}
+    , decltype(_impl_.removed_){from._impl_.removed_}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.base_version_){}
+    , decltype(_impl_.version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_path().empty()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.base_version_, &from._impl_.base_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.version_) -
+    reinterpret_cast<char*>(&_impl_.base_version_)) + sizeof(_impl_.version_));
+  // @@protoc_insertion_point(copy_constructor:transfer.ChangeNotification)
+}
+
+inline void ChangeNotification::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changed_){arena}
+    , decltype(_impl_.removed_){arena}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.base_version_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChangeNotification::~ChangeNotification() {
+  // @@protoc_insertion_point(destructor:transfer.ChangeNotification)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:transfer.DownloadResponse)
-}
-
-void DownloadResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DownloadResponse_transfer_2eproto.base);
-  header_ = nullptr;
-}
-
-DownloadResponse::~DownloadResponse() {
-  // @@protoc_insertion_point(destructor:transfer.DownloadResponse)
   SharedDtor();
 }
 
-void DownloadResponse::SharedDtor() {
-  if (this != internal_default_instance()) delete header_;
+inline void ChangeNotification::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.changed_.~RepeatedPtrField();
+  _impl_.removed_.~RepeatedPtrField();
+  _impl_.path_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void DownloadResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DownloadResponse& DownloadResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DownloadResponse_transfer_2eproto.base);
-  return *internal_default_instance();
+void ChangeNotification::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void DownloadResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.DownloadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ChangeNotification::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.ChangeNotification)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  results_.Clear();
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.changed_.Clear();
+  _impl_.removed_.Clear();
+  _impl_.path_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.base_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.base_version_)) + sizeof(_impl_.version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* DownloadResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ChangeNotification::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // repeated .transfer.DownloadResponse.FileResult results = 2;
+      // string path = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.ChangeNotification.path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .transfer.DirectoryResponse.FileInfo changed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(add_results(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_changed(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string removed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_removed();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.ChangeNotification.removed"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 base_version = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.base_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool DownloadResponse::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.DownloadResponse)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .transfer.DownloadResponse.FileResult results = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-                input, add_results()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.DownloadResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.DownloadResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void DownloadResponse::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.DownloadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ChangeNotification::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.ChangeNotification)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // repeated .transfer.DownloadResponse.FileResult results = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->results(static_cast<int>(i)),
-      output);
+  // string path = 2;
+  if (!this->_internal_path().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.ChangeNotification.path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // repeated .transfer.DirectoryResponse.FileInfo changed = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_changed_size()); i < n; i++) {
+    const auto& repfield = this->_internal_changed(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.DownloadResponse)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* DownloadResponse::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.DownloadResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // repeated string removed = 4;
+  for (int i = 0, n = this->_internal_removed_size(); i < n; i++) {
+    const auto& s = this->_internal_removed(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.ChangeNotification.removed");
+    target = stream->WriteString(4, s, target);
+  }
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // uint64 base_version = 5;
+  if (this->_internal_base_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_base_version(), target);
   }
 
-  // repeated .transfer.DownloadResponse.FileResult results = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->results_size()); i < n; i++) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->results(static_cast<int>(i)), target);
+  // uint64 version = 6;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_version(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.DownloadResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.ChangeNotification)
   return target;
 }
 
-size_t DownloadResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.DownloadResponse)
+size_t ChangeNotification::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.ChangeNotification)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .transfer.DownloadResponse.FileResult results = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->results_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          this->results(static_cast<int>(i)));
-    }
+  // repeated .transfer.DirectoryResponse.FileInfo changed = 3;
+  total_size += 1UL * this->_internal_changed_size();
+  for (const auto& msg : this->_impl_.changed_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string removed = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.removed_.size());
+  for (int i = 0, n = _impl_.removed_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.removed_.Get(i));
+  }
+
+  // string path = 2;
+  if (!this->_internal_path().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_path());
   }
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 base_version = 5;
+  if (this->_internal_base_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_base_version());
+  }
 
-void DownloadResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.DownloadResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DownloadResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DownloadResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.DownloadResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.DownloadResponse)
-    MergeFrom(*source);
+  // uint64 version = 6;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DownloadResponse::MergeFrom(const DownloadResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.DownloadResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangeNotification::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangeNotification::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangeNotification::GetClassData() const { return &_class_data_; }
+
+
+void ChangeNotification::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangeNotification*>(&to_msg);
+  auto& from = static_cast<const ChangeNotification&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.ChangeNotification)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  results_.MergeFrom(from.results_);
-  if (from.has_header()) {
-    mutable_header()->::transfer::ResponseHeader::MergeFrom(from.header());
+  _this->_impl_.changed_.MergeFrom(from._impl_.changed_);
+  _this->_impl_.removed_.MergeFrom(from._impl_.removed_);
+  if (!from._internal_path().empty()) {
+    _this->_internal_set_path(from._internal_path());
   }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_base_version() != 0) {
+    _this->_internal_set_base_version(from._internal_base_version());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DownloadResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.DownloadResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void DownloadResponse::CopyFrom(const DownloadResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.DownloadResponse)
+void ChangeNotification::CopyFrom(const ChangeNotification& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.ChangeNotification)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DownloadResponse::IsInitialized() const {
+bool ChangeNotification::IsInitialized() const {
   return true;
 }
 
-void DownloadResponse::Swap(DownloadResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void DownloadResponse::InternalSwap(DownloadResponse* other) {
+void ChangeNotification::InternalSwap(ChangeNotification* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  CastToBase(&results_)->InternalSwap(CastToBase(&other->results_));
-  swap(header_, other->header_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata DownloadResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.changed_.InternalSwap(&other->_impl_.changed_);
+  _impl_.removed_.InternalSwap(&other->_impl_.removed_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChangeNotification, _impl_.version_)
+      + sizeof(ChangeNotification::_impl_.version_)
+      - PROTOBUF_FIELD_OFFSET(ChangeNotification, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChangeNotification::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[32]);
 }
 
-
 // ===================================================================
 
-void TransferControlRequest::InitAsDefaultInstance() {
-  ::transfer::_TransferControlRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::RequestHeader*>(
-      ::transfer::RequestHeader::internal_default_instance());
-}
-class TransferControlRequest::HasBitSetters {
+class HelloRequest::_Internal {
  public:
-  static const ::transfer::RequestHeader& header(const TransferControlRequest* msg);
+  static const ::transfer::RequestHeader& header(const HelloRequest* msg);
 };
 
 const ::transfer::RequestHeader&
-TransferControlRequest::HasBitSetters::header(const TransferControlRequest* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TransferControlRequest::kHeaderFieldNumber;
-const int TransferControlRequest::kTaskIdFieldNumber;
-const int TransferControlRequest::kControlTypeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-TransferControlRequest::TransferControlRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.TransferControlRequest)
-}
-TransferControlRequest::TransferControlRequest(const TransferControlRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::RequestHeader(*from.header_);
-  } else {
-    header_ = nullptr;
-  }
-  control_type_ = from.control_type_;
-  // @@protoc_insertion_point(copy_constructor:transfer.TransferControlRequest)
-}
-
-void TransferControlRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransferControlRequest_transfer_2eproto.base);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&control_type_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(control_type_));
-}
-
-TransferControlRequest::~TransferControlRequest() {
-  // @@protoc_insertion_point(destructor:transfer.TransferControlRequest)
+HelloRequest::_Internal::header(const HelloRequest* msg) {
+  return *msg->_impl_.header_;
+}
+HelloRequest::HelloRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.HelloRequest)
+}
+HelloRequest::HelloRequest(const HelloRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HelloRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compressions_){from._impl_.compressions_}
+    , decltype(_impl_.hash_algorithms_){from._impl_.hash_algorithms_}
+    , decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.client_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.protocol_version_){}
+    , decltype(_impl_.min_protocol_version_){}
+    , decltype(_impl_.max_frame_size_){}
+    , decltype(_impl_.window_size_){}
+    , decltype(_impl_.raw_data_frames_){}
+    , decltype(_impl_.multiplexing_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.client_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.client_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_client_name().empty()) {
+    _this->_impl_.client_name_.Set(from._internal_client_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.protocol_version_, &from._impl_.protocol_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.multiplexing_) -
+    reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.multiplexing_));
+  // @@protoc_insertion_point(copy_constructor:transfer.HelloRequest)
+}
+
+inline void HelloRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.compressions_){arena}
+    , decltype(_impl_.hash_algorithms_){arena}
+    , decltype(_impl_.features_){arena}
+    , decltype(_impl_.client_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.protocol_version_){0u}
+    , decltype(_impl_.min_protocol_version_){0u}
+    , decltype(_impl_.max_frame_size_){uint64_t{0u}}
+    , decltype(_impl_.window_size_){0u}
+    , decltype(_impl_.raw_data_frames_){false}
+    , decltype(_impl_.multiplexing_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.client_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.client_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HelloRequest::~HelloRequest() {
+  // @@protoc_insertion_point(destructor:transfer.HelloRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TransferControlRequest::SharedDtor() {
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void HelloRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.compressions_.~RepeatedPtrField();
+  _impl_.hash_algorithms_.~RepeatedPtrField();
+  _impl_.features_.~RepeatedPtrField();
+  _impl_.client_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void TransferControlRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void HelloRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const TransferControlRequest& TransferControlRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransferControlRequest_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void TransferControlRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.TransferControlRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void HelloRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.HelloRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.compressions_.Clear();
+  _impl_.hash_algorithms_.Clear();
+  _impl_.features_.Clear();
+  _impl_.client_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  control_type_ = 0;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.protocol_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.multiplexing_) -
+      reinterpret_cast<char*>(&_impl_.protocol_version_)) + sizeof(_impl_.multiplexing_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* TransferControlRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* HelloRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string task_id = 2;
+      // uint32 protocol_version = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.TransferControlRequest.task_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .transfer.TransferControlRequest.ControlType control_type = 3;
+      // uint32 min_protocol_version = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-          set_control_type(static_cast<::transfer::TransferControlRequest_ControlType>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.min_protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_frame_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_frame_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string compressions = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_compressions();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloRequest.compressions"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string hash_algorithms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_hash_algorithms();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloRequest.hash_algorithms"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool raw_data_frames = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.raw_data_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 window_size = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.window_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiplexing = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.multiplexing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string features = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_features();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloRequest.features"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string client_name = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_client_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloRequest.client_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool TransferControlRequest::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.TransferControlRequest)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.RequestHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
 
-      // string task_id = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.TransferControlRequest.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* HelloRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.HelloRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // .transfer.TransferControlRequest.ControlType control_type = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_control_type(static_cast< ::transfer::TransferControlRequest_ControlType >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // .transfer.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.TransferControlRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.TransferControlRequest)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void TransferControlRequest::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.TransferControlRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 protocol_version = 2;
+  if (this->_internal_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_protocol_version(), target);
+  }
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
+  // uint32 min_protocol_version = 3;
+  if (this->_internal_min_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_min_protocol_version(), target);
   }
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // uint64 max_frame_size = 4;
+  if (this->_internal_max_frame_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_max_frame_size(), target);
+  }
+
+  // repeated string compressions = 5;
+  for (int i = 0, n = this->_internal_compressions_size(); i < n; i++) {
+    const auto& s = this->_internal_compressions(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferControlRequest.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->task_id(), output);
+      "transfer.HelloRequest.compressions");
+    target = stream->WriteString(5, s, target);
   }
 
-  // .transfer.TransferControlRequest.ControlType control_type = 3;
-  if (this->control_type() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      3, this->control_type(), output);
+  // repeated string hash_algorithms = 6;
+  for (int i = 0, n = this->_internal_hash_algorithms_size(); i < n; i++) {
+    const auto& s = this->_internal_hash_algorithms(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.HelloRequest.hash_algorithms");
+    target = stream->WriteString(6, s, target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // bool raw_data_frames = 7;
+  if (this->_internal_raw_data_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_raw_data_frames(), target);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.TransferControlRequest)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransferControlRequest::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferControlRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 window_size = 8;
+  if (this->_internal_window_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_window_size(), target);
+  }
 
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // bool multiplexing = 9;
+  if (this->_internal_multiplexing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_multiplexing(), target);
   }
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // repeated string features = 10;
+  for (int i = 0, n = this->_internal_features_size(); i < n; i++) {
+    const auto& s = this->_internal_features(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferControlRequest.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->task_id(), target);
+      "transfer.HelloRequest.features");
+    target = stream->WriteString(10, s, target);
   }
 
-  // .transfer.TransferControlRequest.ControlType control_type = 3;
-  if (this->control_type() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      3, this->control_type(), target);
+  // string client_name = 11;
+  if (!this->_internal_client_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_client_name().data(), static_cast<int>(this->_internal_client_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.HelloRequest.client_name");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_client_name(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferControlRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.HelloRequest)
   return target;
 }
 
-size_t TransferControlRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.TransferControlRequest)
+size_t HelloRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.HelloRequest)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // repeated string compressions = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.compressions_.size());
+  for (int i = 0, n = _impl_.compressions_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.compressions_.Get(i));
+  }
+
+  // repeated string hash_algorithms = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.hash_algorithms_.size());
+  for (int i = 0, n = _impl_.hash_algorithms_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.hash_algorithms_.Get(i));
+  }
+
+  // repeated string features = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.features_.size());
+  for (int i = 0, n = _impl_.features_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.features_.Get(i));
+  }
+
+  // string client_name = 11;
+  if (!this->_internal_client_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
+        this->_internal_client_name());
   }
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  // .transfer.TransferControlRequest.ControlType control_type = 3;
-  if (this->control_type() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->control_type());
+  // uint32 protocol_version = 2;
+  if (this->_internal_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol_version());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint32 min_protocol_version = 3;
+  if (this->_internal_min_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min_protocol_version());
+  }
+
+  // uint64 max_frame_size = 4;
+  if (this->_internal_max_frame_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_frame_size());
+  }
+
+  // uint32 window_size = 8;
+  if (this->_internal_window_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window_size());
+  }
+
+  // bool raw_data_frames = 7;
+  if (this->_internal_raw_data_frames() != 0) {
+    total_size += 1 + 1;
+  }
 
-void TransferControlRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.TransferControlRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransferControlRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransferControlRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.TransferControlRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.TransferControlRequest)
-    MergeFrom(*source);
+  // bool multiplexing = 9;
+  if (this->_internal_multiplexing() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransferControlRequest::MergeFrom(const TransferControlRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferControlRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HelloRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HelloRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HelloRequest::GetClassData() const { return &_class_data_; }
+
 
-  if (from.task_id().size() > 0) {
+void HelloRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HelloRequest*>(&to_msg);
+  auto& from = static_cast<const HelloRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.HelloRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
+  _this->_impl_.compressions_.MergeFrom(from._impl_.compressions_);
+  _this->_impl_.hash_algorithms_.MergeFrom(from._impl_.hash_algorithms_);
+  _this->_impl_.features_.MergeFrom(from._impl_.features_);
+  if (!from._internal_client_name().empty()) {
+    _this->_internal_set_client_name(from._internal_client_name());
   }
-  if (from.has_header()) {
-    mutable_header()->::transfer::RequestHeader::MergeFrom(from.header());
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
   }
-  if (from.control_type() != 0) {
-    set_control_type(from.control_type());
+  if (from._internal_protocol_version() != 0) {
+    _this->_internal_set_protocol_version(from._internal_protocol_version());
   }
+  if (from._internal_min_protocol_version() != 0) {
+    _this->_internal_set_min_protocol_version(from._internal_min_protocol_version());
+  }
+  if (from._internal_max_frame_size() != 0) {
+    _this->_internal_set_max_frame_size(from._internal_max_frame_size());
+  }
+  if (from._internal_window_size() != 0) {
+    _this->_internal_set_window_size(from._internal_window_size());
+  }
+  if (from._internal_raw_data_frames() != 0) {
+    _this->_internal_set_raw_data_frames(from._internal_raw_data_frames());
+  }
+  if (from._internal_multiplexing() != 0) {
+    _this->_internal_set_multiplexing(from._internal_multiplexing());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TransferControlRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.TransferControlRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void TransferControlRequest::CopyFrom(const TransferControlRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferControlRequest)
+void HelloRequest::CopyFrom(const HelloRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.HelloRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TransferControlRequest::IsInitialized() const {
+bool HelloRequest::IsInitialized() const {
   return true;
 }
 
-void TransferControlRequest::Swap(TransferControlRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void TransferControlRequest::InternalSwap(TransferControlRequest* other) {
+void HelloRequest::InternalSwap(HelloRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
-  swap(control_type_, other->control_type_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata TransferControlRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.compressions_.InternalSwap(&other->_impl_.compressions_);
+  _impl_.hash_algorithms_.InternalSwap(&other->_impl_.hash_algorithms_);
+  _impl_.features_.InternalSwap(&other->_impl_.features_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.client_name_, lhs_arena,
+      &other->_impl_.client_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HelloRequest, _impl_.multiplexing_)
+      + sizeof(HelloRequest::_impl_.multiplexing_)
+      - PROTOBUF_FIELD_OFFSET(HelloRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HelloRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[33]);
 }
 
-
 // ===================================================================
 
-void TransferControlResponse::InitAsDefaultInstance() {
-  ::transfer::_TransferControlResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::ResponseHeader*>(
-      ::transfer::ResponseHeader::internal_default_instance());
-}
-class TransferControlResponse::HasBitSetters {
+class HelloResponse::_Internal {
  public:
-  static const ::transfer::ResponseHeader& header(const TransferControlResponse* msg);
+  static const ::transfer::ResponseHeader& header(const HelloResponse* msg);
 };
 
 const ::transfer::ResponseHeader&
-TransferControlResponse::HasBitSetters::header(const TransferControlResponse* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TransferControlResponse::kHeaderFieldNumber;
-const int TransferControlResponse::kTaskIdFieldNumber;
-const int TransferControlResponse::kSuccessFieldNumber;
-const int TransferControlResponse::kNewStatusFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-TransferControlResponse::TransferControlResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.TransferControlResponse)
-}
-TransferControlResponse::TransferControlResponse(const TransferControlResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::ResponseHeader(*from.header_);
-  } else {
-    header_ = nullptr;
-  }
-  ::memcpy(&success_, &from.success_,
-    static_cast<size_t>(reinterpret_cast<char*>(&new_status_) -
-    reinterpret_cast<char*>(&success_)) + sizeof(new_status_));
-  // @@protoc_insertion_point(copy_constructor:transfer.TransferControlResponse)
-}
-
-void TransferControlResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransferControlResponse_transfer_2eproto.base);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&new_status_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(new_status_));
-}
-
-TransferControlResponse::~TransferControlResponse() {
-  // @@protoc_insertion_point(destructor:transfer.TransferControlResponse)
+HelloResponse::_Internal::header(const HelloResponse* msg) {
+  return *msg->_impl_.header_;
+}
+HelloResponse::HelloResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.HelloResponse)
+}
+HelloResponse::HelloResponse(const HelloResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HelloResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.hash_algorithm_){}
+    , decltype(_impl_.server_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.max_frame_size_){}
+    , decltype(_impl_.protocol_version_){}
+    , decltype(_impl_.window_size_){}
+    , decltype(_impl_.raw_data_frames_){}
+    , decltype(_impl_.multiplexing_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.compression_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_compression().empty()) {
+    _this->_impl_.compression_.Set(from._internal_compression(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hash_algorithm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_algorithm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hash_algorithm().empty()) {
+    _this->_impl_.hash_algorithm_.Set(from._internal_hash_algorithm(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.server_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_server_name().empty()) {
+    _this->_impl_.server_name_.Set(from._internal_server_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.max_frame_size_, &from._impl_.max_frame_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.multiplexing_) -
+    reinterpret_cast<char*>(&_impl_.max_frame_size_)) + sizeof(_impl_.multiplexing_));
+  // @@protoc_insertion_point(copy_constructor:transfer.HelloResponse)
+}
+
+inline void HelloResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.features_){arena}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.hash_algorithm_){}
+    , decltype(_impl_.server_name_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.max_frame_size_){uint64_t{0u}}
+    , decltype(_impl_.protocol_version_){0u}
+    , decltype(_impl_.window_size_){0u}
+    , decltype(_impl_.raw_data_frames_){false}
+    , decltype(_impl_.multiplexing_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.compression_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hash_algorithm_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hash_algorithm_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.server_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HelloResponse::~HelloResponse() {
+  // @@protoc_insertion_point(destructor:transfer.HelloResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TransferControlResponse::SharedDtor() {
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void HelloResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.features_.~RepeatedPtrField();
+  _impl_.compression_.Destroy();
+  _impl_.hash_algorithm_.Destroy();
+  _impl_.server_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void TransferControlResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const TransferControlResponse& TransferControlResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransferControlResponse_transfer_2eproto.base);
-  return *internal_default_instance();
+void HelloResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void TransferControlResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.TransferControlResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void HelloResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.HelloResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  _impl_.features_.Clear();
+  _impl_.compression_.ClearToEmpty();
+  _impl_.hash_algorithm_.ClearToEmpty();
+  _impl_.server_name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&new_status_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(new_status_));
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.max_frame_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.multiplexing_) -
+      reinterpret_cast<char*>(&_impl_.max_frame_size_)) + sizeof(_impl_.multiplexing_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* TransferControlResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* HelloResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string task_id = 2;
+      // uint32 protocol_version = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.TransferControlResponse.task_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.protocol_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool success = 3;
+      // uint64 max_frame_size = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.max_frame_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .transfer.TransferStatus new_status = 4;
+      // string compression = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-          set_new_status(static_cast<::transfer::TransferStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_compression();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloResponse.compression"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string hash_algorithm = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_hash_algorithm();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloResponse.hash_algorithm"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool raw_data_frames = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.raw_data_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 window_size = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.window_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiplexing = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.multiplexing_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string features = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_features();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloResponse.features"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string server_name = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_server_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "transfer.HelloResponse.server_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool TransferControlResponse::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.TransferControlResponse)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string task_id = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.TransferControlResponse.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // bool success = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
 
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+uint8_t* HelloResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.HelloResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-      // .transfer.TransferStatus new_status = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_new_status(static_cast< ::transfer::TransferStatus >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+  // .transfer.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.TransferControlResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.TransferControlResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
 
-void TransferControlResponse::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.TransferControlResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint32 protocol_version = 2;
+  if (this->_internal_protocol_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_protocol_version(), target);
+  }
 
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
+  // uint64 max_frame_size = 3;
+  if (this->_internal_max_frame_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_max_frame_size(), target);
   }
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // string compression = 4;
+  if (!this->_internal_compression().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      this->_internal_compression().data(), static_cast<int>(this->_internal_compression().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferControlResponse.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->task_id(), output);
+      "transfer.HelloResponse.compression");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_compression(), target);
   }
 
-  // bool success = 3;
-  if (this->success() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBool(3, this->success(), output);
+  // string hash_algorithm = 5;
+  if (!this->_internal_hash_algorithm().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hash_algorithm().data(), static_cast<int>(this->_internal_hash_algorithm().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.HelloResponse.hash_algorithm");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_hash_algorithm(), target);
   }
 
-  // .transfer.TransferStatus new_status = 4;
-  if (this->new_status() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      4, this->new_status(), output);
+  // bool raw_data_frames = 6;
+  if (this->_internal_raw_data_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_raw_data_frames(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
+  // uint32 window_size = 7;
+  if (this->_internal_window_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_window_size(), target);
   }
-  // @@protoc_insertion_point(serialize_end:transfer.TransferControlResponse)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransferControlResponse::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferControlResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+  // bool multiplexing = 8;
+  if (this->_internal_multiplexing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_multiplexing(), target);
   }
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // repeated string features = 9;
+  for (int i = 0, n = this->_internal_features_size(); i < n; i++) {
+    const auto& s = this->_internal_features(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferControlResponse.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->task_id(), target);
-  }
-
-  // bool success = 3;
-  if (this->success() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->success(), target);
+      "transfer.HelloResponse.features");
+    target = stream->WriteString(9, s, target);
   }
 
-  // .transfer.TransferStatus new_status = 4;
-  if (this->new_status() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      4, this->new_status(), target);
+  // string server_name = 10;
+  if (!this->_internal_server_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_server_name().data(), static_cast<int>(this->_internal_server_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "transfer.HelloResponse.server_name");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_server_name(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.HelloResponse)
   return target;
 }
 
-size_t TransferControlResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.TransferControlResponse)
+size_t HelloResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.HelloResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
+  // repeated string features = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.features_.size());
+  for (int i = 0, n = _impl_.features_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.features_.Get(i));
+  }
+
+  // string compression = 4;
+  if (!this->_internal_compression().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_compression());
+  }
+
+  // string hash_algorithm = 5;
+  if (!this->_internal_hash_algorithm().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hash_algorithm());
+  }
+
+  // string server_name = 10;
+  if (!this->_internal_server_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
+        this->_internal_server_name());
   }
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  // bool success = 3;
-  if (this->success() != 0) {
-    total_size += 1 + 1;
+  // uint64 max_frame_size = 3;
+  if (this->_internal_max_frame_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_frame_size());
   }
 
-  // .transfer.TransferStatus new_status = 4;
-  if (this->new_status() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->new_status());
+  // uint32 protocol_version = 2;
+  if (this->_internal_protocol_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_protocol_version());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint32 window_size = 7;
+  if (this->_internal_window_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window_size());
+  }
+
+  // bool raw_data_frames = 6;
+  if (this->_internal_raw_data_frames() != 0) {
+    total_size += 1 + 1;
+  }
 
-void TransferControlResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.TransferControlResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransferControlResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransferControlResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.TransferControlResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.TransferControlResponse)
-    MergeFrom(*source);
+  // bool multiplexing = 8;
+  if (this->_internal_multiplexing() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransferControlResponse::MergeFrom(const TransferControlResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferControlResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HelloResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HelloResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HelloResponse::GetClassData() const { return &_class_data_; }
 
-  if (from.task_id().size() > 0) {
 
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
+void HelloResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HelloResponse*>(&to_msg);
+  auto& from = static_cast<const HelloResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.HelloResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.features_.MergeFrom(from._impl_.features_);
+  if (!from._internal_compression().empty()) {
+    _this->_internal_set_compression(from._internal_compression());
   }
-  if (from.has_header()) {
-    mutable_header()->::transfer::ResponseHeader::MergeFrom(from.header());
+  if (!from._internal_hash_algorithm().empty()) {
+    _this->_internal_set_hash_algorithm(from._internal_hash_algorithm());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (!from._internal_server_name().empty()) {
+    _this->_internal_set_server_name(from._internal_server_name());
   }
-  if (from.new_status() != 0) {
-    set_new_status(from.new_status());
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
   }
+  if (from._internal_max_frame_size() != 0) {
+    _this->_internal_set_max_frame_size(from._internal_max_frame_size());
+  }
+  if (from._internal_protocol_version() != 0) {
+    _this->_internal_set_protocol_version(from._internal_protocol_version());
+  }
+  if (from._internal_window_size() != 0) {
+    _this->_internal_set_window_size(from._internal_window_size());
+  }
+  if (from._internal_raw_data_frames() != 0) {
+    _this->_internal_set_raw_data_frames(from._internal_raw_data_frames());
+  }
+  if (from._internal_multiplexing() != 0) {
+    _this->_internal_set_multiplexing(from._internal_multiplexing());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TransferControlResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.TransferControlResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void TransferControlResponse::CopyFrom(const TransferControlResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferControlResponse)
+void HelloResponse::CopyFrom(const HelloResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.HelloResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TransferControlResponse::IsInitialized() const {
+bool HelloResponse::IsInitialized() const {
   return true;
 }
 
-void TransferControlResponse::Swap(TransferControlResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void TransferControlResponse::InternalSwap(TransferControlResponse* other) {
+void HelloResponse::InternalSwap(HelloResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
-  swap(success_, other->success_);
-  swap(new_status_, other->new_status_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata TransferControlResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.features_.InternalSwap(&other->_impl_.features_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.compression_, lhs_arena,
+      &other->_impl_.compression_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hash_algorithm_, lhs_arena,
+      &other->_impl_.hash_algorithm_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.server_name_, lhs_arena,
+      &other->_impl_.server_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HelloResponse, _impl_.multiplexing_)
+      + sizeof(HelloResponse::_impl_.multiplexing_)
+      - PROTOBUF_FIELD_OFFSET(HelloResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HelloResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[34]);
 }
 
-
 // ===================================================================
 
-void TransferProgressRequest::InitAsDefaultInstance() {
-  ::transfer::_TransferProgressRequest_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::RequestHeader*>(
-      ::transfer::RequestHeader::internal_default_instance());
-}
-class TransferProgressRequest::HasBitSetters {
+class HeartbeatRequest::_Internal {
  public:
-  static const ::transfer::RequestHeader& header(const TransferProgressRequest* msg);
+  static const ::transfer::RequestHeader& header(const HeartbeatRequest* msg);
 };
 
 const ::transfer::RequestHeader&
-TransferProgressRequest::HasBitSetters::header(const TransferProgressRequest* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TransferProgressRequest::kHeaderFieldNumber;
-const int TransferProgressRequest::kTaskIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-TransferProgressRequest::TransferProgressRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.TransferProgressRequest)
-}
-TransferProgressRequest::TransferProgressRequest(const TransferProgressRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::RequestHeader(*from.header_);
-  } else {
-    header_ = nullptr;
+HeartbeatRequest::_Internal::header(const HeartbeatRequest* msg) {
+  return *msg->_impl_.header_;
+}
+HeartbeatRequest::HeartbeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.HeartbeatRequest)
+}
+HeartbeatRequest::HeartbeatRequest(const HeartbeatRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HeartbeatRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.timestamp_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::RequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.timestamp_ms_ = from._impl_.timestamp_ms_;
+  // @@protoc_insertion_point(copy_constructor:transfer.HeartbeatRequest)
+}
+
+inline void HeartbeatRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.timestamp_ms_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HeartbeatRequest::~HeartbeatRequest() {
+  // @@protoc_insertion_point(destructor:transfer.HeartbeatRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:transfer.TransferProgressRequest)
-}
-
-void TransferProgressRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransferProgressRequest_transfer_2eproto.base);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  header_ = nullptr;
-}
-
-TransferProgressRequest::~TransferProgressRequest() {
-  // @@protoc_insertion_point(destructor:transfer.TransferProgressRequest)
   SharedDtor();
 }
 
-void TransferProgressRequest::SharedDtor() {
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void HeartbeatRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void TransferProgressRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const TransferProgressRequest& TransferProgressRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransferProgressRequest_transfer_2eproto.base);
-  return *internal_default_instance();
+void HeartbeatRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void TransferProgressRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.TransferProgressRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void HeartbeatRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.HeartbeatRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  _impl_.timestamp_ms_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* TransferProgressRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* HeartbeatRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.RequestHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string task_id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.TransferProgressRequest.task_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool TransferProgressRequest::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.TransferProgressRequest)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.RequestHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // string task_id = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.TransferProgressRequest.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.TransferProgressRequest)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.TransferProgressRequest)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void TransferProgressRequest::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.TransferProgressRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
-  }
-
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressRequest.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->task_id(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.TransferProgressRequest)
+        continue;
+      // uint64 timestamp_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.timestamp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransferProgressRequest::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferProgressRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* HeartbeatRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.HeartbeatRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressRequest.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->task_id(), target);
+  // uint64 timestamp_ms = 2;
+  if (this->_internal_timestamp_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_timestamp_ms(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferProgressRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.HeartbeatRequest)
   return target;
 }
 
-size_t TransferProgressRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.TransferProgressRequest)
+size_t HeartbeatRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.HeartbeatRequest)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
-  }
-
   // .transfer.RequestHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
+        *_impl_.header_);
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void TransferProgressRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.TransferProgressRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransferProgressRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransferProgressRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.TransferProgressRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.TransferProgressRequest)
-    MergeFrom(*source);
+  // uint64 timestamp_ms = 2;
+  if (this->_internal_timestamp_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp_ms());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransferProgressRequest::MergeFrom(const TransferProgressRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferProgressRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartbeatRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HeartbeatRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartbeatRequest::GetClassData() const { return &_class_data_; }
+
 
-  if (from.task_id().size() > 0) {
+void HeartbeatRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HeartbeatRequest*>(&to_msg);
+  auto& from = static_cast<const HeartbeatRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.HeartbeatRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::RequestHeader::MergeFrom(
+        from._internal_header());
   }
-  if (from.has_header()) {
-    mutable_header()->::transfer::RequestHeader::MergeFrom(from.header());
+  if (from._internal_timestamp_ms() != 0) {
+    _this->_internal_set_timestamp_ms(from._internal_timestamp_ms());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TransferProgressRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.TransferProgressRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void TransferProgressRequest::CopyFrom(const TransferProgressRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferProgressRequest)
+void HeartbeatRequest::CopyFrom(const HeartbeatRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.HeartbeatRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TransferProgressRequest::IsInitialized() const {
+bool HeartbeatRequest::IsInitialized() const {
   return true;
 }
 
-void TransferProgressRequest::Swap(TransferProgressRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void TransferProgressRequest::InternalSwap(TransferProgressRequest* other) {
+void HeartbeatRequest::InternalSwap(HeartbeatRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HeartbeatRequest, _impl_.timestamp_ms_)
+      + sizeof(HeartbeatRequest::_impl_.timestamp_ms_)
+      - PROTOBUF_FIELD_OFFSET(HeartbeatRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TransferProgressRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata HeartbeatRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[35]);
 }
 
-
 // ===================================================================
 
-void TransferProgressResponse::InitAsDefaultInstance() {
-  ::transfer::_TransferProgressResponse_default_instance_._instance.get_mutable()->header_ = const_cast< ::transfer::ResponseHeader*>(
-      ::transfer::ResponseHeader::internal_default_instance());
-}
-class TransferProgressResponse::HasBitSetters {
+class HeartbeatResponse::_Internal {
  public:
-  static const ::transfer::ResponseHeader& header(const TransferProgressResponse* msg);
+  static const ::transfer::ResponseHeader& header(const HeartbeatResponse* msg);
 };
 
 const ::transfer::ResponseHeader&
-TransferProgressResponse::HasBitSetters::header(const TransferProgressResponse* msg) {
-  return *msg->header_;
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TransferProgressResponse::kHeaderFieldNumber;
-const int TransferProgressResponse::kTaskIdFieldNumber;
-const int TransferProgressResponse::kTaskNameFieldNumber;
-const int TransferProgressResponse::kStatusFieldNumber;
-const int TransferProgressResponse::kTransferredSizeFieldNumber;
-const int TransferProgressResponse::kTotalSizeFieldNumber;
-const int TransferProgressResponse::kSpeedFieldNumber;
-const int TransferProgressResponse::kProgressFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-TransferProgressResponse::TransferProgressResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:transfer.TransferProgressResponse)
-}
-TransferProgressResponse::TransferProgressResponse(const TransferProgressResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_id().size() > 0) {
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  task_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from.task_name().size() > 0) {
-    task_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_name_);
-  }
-  if (from.has_header()) {
-    header_ = new ::transfer::ResponseHeader(*from.header_);
-  } else {
-    header_ = nullptr;
-  }
-  ::memcpy(&transferred_size_, &from.transferred_size_,
-    static_cast<size_t>(reinterpret_cast<char*>(&progress_) -
-    reinterpret_cast<char*>(&transferred_size_)) + sizeof(progress_));
-  // @@protoc_insertion_point(copy_constructor:transfer.TransferProgressResponse)
-}
-
-void TransferProgressResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransferProgressResponse_transfer_2eproto.base);
-  task_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&header_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&progress_) -
-      reinterpret_cast<char*>(&header_)) + sizeof(progress_));
-}
-
-TransferProgressResponse::~TransferProgressResponse() {
-  // @@protoc_insertion_point(destructor:transfer.TransferProgressResponse)
+HeartbeatResponse::_Internal::header(const HeartbeatResponse* msg) {
+  return *msg->_impl_.header_;
+}
+HeartbeatResponse::HeartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:transfer.HeartbeatResponse)
+}
+HeartbeatResponse::HeartbeatResponse(const HeartbeatResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HeartbeatResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.timestamp_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::transfer::ResponseHeader(*from._impl_.header_);
+  }
+  _this->_impl_.timestamp_ms_ = from._impl_.timestamp_ms_;
+  // @@protoc_insertion_point(copy_constructor:transfer.HeartbeatResponse)
+}
+
+inline void HeartbeatResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.timestamp_ms_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HeartbeatResponse::~HeartbeatResponse() {
+  // @@protoc_insertion_point(destructor:transfer.HeartbeatResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TransferProgressResponse::SharedDtor() {
-  task_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete header_;
+inline void HeartbeatResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
 }
 
-void TransferProgressResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void HeartbeatResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const TransferProgressResponse& TransferProgressResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransferProgressResponse_transfer_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void TransferProgressResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:transfer.TransferProgressResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void HeartbeatResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:transfer.HeartbeatResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  task_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
-  ::memset(&transferred_size_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&progress_) -
-      reinterpret_cast<char*>(&transferred_size_)) + sizeof(progress_));
-  _internal_metadata_.Clear();
+  _impl_.header_ = nullptr;
+  _impl_.timestamp_ms_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-const char* TransferProgressResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* HeartbeatResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .transfer.ResponseHeader header = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(mutable_header(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string task_id = 2;
+      // uint64 timestamp_ms = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_id(), ptr, ctx, "transfer.TransferProgressResponse.task_id");
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.timestamp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string task_name = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_task_name(), ptr, ctx, "transfer.TransferProgressResponse.task_name");
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .transfer.TransferStatus status = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-          set_status(static_cast<::transfer::TransferStatus>(val));
-        } else goto handle_unusual;
-        continue;
-      // uint64 transferred_size = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          transferred_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint64 total_size = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          total_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 speed = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // uint32 progress = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          progress_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
-#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-bool TransferProgressResponse::MergePartialFromCodedStream(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-  // @@protoc_insertion_point(parse_start:transfer.TransferProgressResponse)
-  for (;;) {
-    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // .transfer.ResponseHeader header = 1;
-      case 1: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
-               input, mutable_header()));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string task_id = 2;
-      case 2: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_id()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_id().data(), static_cast<int>(this->task_id().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.TransferProgressResponse.task_id"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // string task_name = 3;
-      case 3: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
-                input, this->mutable_task_name()));
-          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-            this->task_name().data(), static_cast<int>(this->task_name().length()),
-            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
-            "transfer.TransferProgressResponse.task_name"));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // .transfer.TransferStatus status = 4;
-      case 4: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
-          int value = 0;
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::transfer::TransferStatus >(value));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 transferred_size = 5;
-      case 5: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &transferred_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint64 total_size = 6;
-      case 6: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &total_size_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 speed = 7;
-      case 7: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &speed_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // uint32 progress = 8;
-      case 8: {
-        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (64 & 0xFF)) {
-
-          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
-                   ::PROTOBUF_NAMESPACE_ID::uint32, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &progress_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:transfer.TransferProgressResponse)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:transfer.TransferProgressResponse)
-  return false;
-#undef DO_
-}
-#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-
-void TransferProgressResponse::SerializeWithCachedSizes(
-    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:transfer.TransferProgressResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, HasBitSetters::header(this), output);
-  }
-
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressResponse.task_id");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->task_id(), output);
-  }
-
-  // string task_name = 3;
-  if (this->task_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_name().data(), static_cast<int>(this->task_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressResponse.task_name");
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->task_name(), output);
-  }
-
-  // .transfer.TransferStatus status = 4;
-  if (this->status() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
-      4, this->status(), output);
-  }
-
-  // uint64 transferred_size = 5;
-  if (this->transferred_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(5, this->transferred_size(), output);
-  }
-
-  // uint64 total_size = 6;
-  if (this->total_size() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64(6, this->total_size(), output);
-  }
-
-  // uint32 speed = 7;
-  if (this->speed() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(7, this->speed(), output);
-  }
-
-  // uint32 progress = 8;
-  if (this->progress() != 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32(8, this->progress(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
-        _internal_metadata_.unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:transfer.TransferProgressResponse)
-}
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransferProgressResponse::InternalSerializeWithCachedSizesToArray(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:transfer.TransferProgressResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* HeartbeatResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:transfer.HeartbeatResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, HasBitSetters::header(this), target);
-  }
-
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_id().data(), static_cast<int>(this->task_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressResponse.task_id");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        2, this->task_id(), target);
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
   }
 
-  // string task_name = 3;
-  if (this->task_name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->task_name().data(), static_cast<int>(this->task_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "transfer.TransferProgressResponse.task_name");
-    target =
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
-        3, this->task_name(), target);
-  }
-
-  // .transfer.TransferStatus status = 4;
-  if (this->status() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      4, this->status(), target);
-  }
-
-  // uint64 transferred_size = 5;
-  if (this->transferred_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(5, this->transferred_size(), target);
-  }
-
-  // uint64 total_size = 6;
-  if (this->total_size() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(6, this->total_size(), target);
-  }
-
-  // uint32 speed = 7;
-  if (this->speed() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(7, this->speed(), target);
+  // uint64 timestamp_ms = 2;
+  if (this->_internal_timestamp_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_timestamp_ms(), target);
   }
 
-  // uint32 progress = 8;
-  if (this->progress() != 0) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(8, this->progress(), target);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:transfer.TransferProgressResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:transfer.HeartbeatResponse)
   return target;
 }
 
-size_t TransferProgressResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:transfer.TransferProgressResponse)
+size_t HeartbeatResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:transfer.HeartbeatResponse)
   size_t total_size = 0;
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
-        _internal_metadata_.unknown_fields());
-  }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string task_id = 2;
-  if (this->task_id().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_id());
-  }
-
-  // string task_name = 3;
-  if (this->task_name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->task_name());
-  }
-
   // .transfer.ResponseHeader header = 1;
-  if (this->has_header()) {
+  if (this->_internal_has_header()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *header_);
-  }
-
-  // uint64 transferred_size = 5;
-  if (this->transferred_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->transferred_size());
-  }
-
-  // .transfer.TransferStatus status = 4;
-  if (this->status() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->status());
-  }
-
-  // uint32 speed = 7;
-  if (this->speed() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->speed());
-  }
-
-  // uint64 total_size = 6;
-  if (this->total_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->total_size());
+        *_impl_.header_);
   }
 
-  // uint32 progress = 8;
-  if (this->progress() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->progress());
+  // uint64 timestamp_ms = 2;
+  if (this->_internal_timestamp_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp_ms());
   }
 
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransferProgressResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:transfer.TransferProgressResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransferProgressResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransferProgressResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:transfer.TransferProgressResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:transfer.TransferProgressResponse)
-    MergeFrom(*source);
-  }
-}
-
-void TransferProgressResponse::MergeFrom(const TransferProgressResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:transfer.TransferProgressResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HeartbeatResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HeartbeatResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HeartbeatResponse::GetClassData() const { return &_class_data_; }
 
-  if (from.task_id().size() > 0) {
 
-    task_id_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_id_);
-  }
-  if (from.task_name().size() > 0) {
+void HeartbeatResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HeartbeatResponse*>(&to_msg);
+  auto& from = static_cast<const HeartbeatResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:transfer.HeartbeatResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    task_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.task_name_);
-  }
-  if (from.has_header()) {
-    mutable_header()->::transfer::ResponseHeader::MergeFrom(from.header());
-  }
-  if (from.transferred_size() != 0) {
-    set_transferred_size(from.transferred_size());
-  }
-  if (from.status() != 0) {
-    set_status(from.status());
-  }
-  if (from.speed() != 0) {
-    set_speed(from.speed());
-  }
-  if (from.total_size() != 0) {
-    set_total_size(from.total_size());
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::transfer::ResponseHeader::MergeFrom(
+        from._internal_header());
   }
-  if (from.progress() != 0) {
-    set_progress(from.progress());
+  if (from._internal_timestamp_ms() != 0) {
+    _this->_internal_set_timestamp_ms(from._internal_timestamp_ms());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TransferProgressResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:transfer.TransferProgressResponse)
+void HeartbeatResponse::CopyFrom(const HeartbeatResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:transfer.HeartbeatResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TransferProgressResponse::CopyFrom(const TransferProgressResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:transfer.TransferProgressResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool TransferProgressResponse::IsInitialized() const {
+bool HeartbeatResponse::IsInitialized() const {
   return true;
 }
 
-void TransferProgressResponse::Swap(TransferProgressResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void TransferProgressResponse::InternalSwap(TransferProgressResponse* other) {
+void HeartbeatResponse::InternalSwap(HeartbeatResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  task_id_.Swap(&other->task_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  task_name_.Swap(&other->task_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(header_, other->header_);
-  swap(transferred_size_, other->transferred_size_);
-  swap(status_, other->status_);
-  swap(speed_, other->speed_);
-  swap(total_size_, other->total_size_);
-  swap(progress_, other->progress_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HeartbeatResponse, _impl_.timestamp_ms_)
+      + sizeof(HeartbeatResponse::_impl_.timestamp_ms_)
+      - PROTOBUF_FIELD_OFFSET(HeartbeatResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TransferProgressResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata HeartbeatResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transfer_2eproto_getter, &descriptor_table_transfer_2eproto_once,
+      file_level_metadata_transfer_2eproto[36]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace transfer
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::transfer::RequestHeader* Arena::CreateMaybeMessage< ::transfer::RequestHeader >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::RequestHeader >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::RequestHeader*
+Arena::CreateMaybeMessage< ::transfer::RequestHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::RequestHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ResponseHeader*
+Arena::CreateMaybeMessage< ::transfer::ResponseHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ResponseHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::DirectoryRequest*
+Arena::CreateMaybeMessage< ::transfer::DirectoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DirectoryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ListingColumns*
+Arena::CreateMaybeMessage< ::transfer::ListingColumns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ListingColumns >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::DirectoryResponse_FileInfo*
+Arena::CreateMaybeMessage< ::transfer::DirectoryResponse_FileInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DirectoryResponse_FileInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::DirectoryResponse*
+Arena::CreateMaybeMessage< ::transfer::DirectoryResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DirectoryResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ListingCacheFile_Listing*
+Arena::CreateMaybeMessage< ::transfer::ListingCacheFile_Listing >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ListingCacheFile_Listing >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ListingCacheFile*
+Arena::CreateMaybeMessage< ::transfer::ListingCacheFile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ListingCacheFile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::MakeDirectoryRequest*
+Arena::CreateMaybeMessage< ::transfer::MakeDirectoryRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::MakeDirectoryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::MakeDirectoryResponse*
+Arena::CreateMaybeMessage< ::transfer::MakeDirectoryResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::MakeDirectoryResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::TreeListRequest*
+Arena::CreateMaybeMessage< ::transfer::TreeListRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TreeListRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::TreeListResponse_Entry*
+Arena::CreateMaybeMessage< ::transfer::TreeListResponse_Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TreeListResponse_Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::TreeListResponse*
+Arena::CreateMaybeMessage< ::transfer::TreeListResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TreeListResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ArchiveRequest*
+Arena::CreateMaybeMessage< ::transfer::ArchiveRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ArchiveRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::ArchiveResponse*
+Arena::CreateMaybeMessage< ::transfer::ArchiveResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ArchiveResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::SearchRequest*
+Arena::CreateMaybeMessage< ::transfer::SearchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::SearchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::SearchResponse_Entry*
+Arena::CreateMaybeMessage< ::transfer::SearchResponse_Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::SearchResponse_Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::SearchResponse*
+Arena::CreateMaybeMessage< ::transfer::SearchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::SearchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::UploadRequest_FileInfo*
+Arena::CreateMaybeMessage< ::transfer::UploadRequest_FileInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::UploadRequest_FileInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::UploadRequest*
+Arena::CreateMaybeMessage< ::transfer::UploadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::UploadRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::transfer::UploadResponse_FileResult*
+Arena::CreateMaybeMessage< ::transfer::UploadResponse_FileResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::UploadResponse_FileResult >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::ResponseHeader* Arena::CreateMaybeMessage< ::transfer::ResponseHeader >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::ResponseHeader >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::UploadResponse*
+Arena::CreateMaybeMessage< ::transfer::UploadResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::UploadResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DirectoryRequest* Arena::CreateMaybeMessage< ::transfer::DirectoryRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DirectoryRequest >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::DownloadRequest_FileInfo*
+Arena::CreateMaybeMessage< ::transfer::DownloadRequest_FileInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DownloadRequest_FileInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DirectoryResponse_FileInfo* Arena::CreateMaybeMessage< ::transfer::DirectoryResponse_FileInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DirectoryResponse_FileInfo >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::DownloadRequest*
+Arena::CreateMaybeMessage< ::transfer::DownloadRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DownloadRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DirectoryResponse* Arena::CreateMaybeMessage< ::transfer::DirectoryResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DirectoryResponse >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::DownloadResponse_FileResult*
+Arena::CreateMaybeMessage< ::transfer::DownloadResponse_FileResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DownloadResponse_FileResult >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::UploadRequest_FileInfo* Arena::CreateMaybeMessage< ::transfer::UploadRequest_FileInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::UploadRequest_FileInfo >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::DownloadResponse*
+Arena::CreateMaybeMessage< ::transfer::DownloadResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::DownloadResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::UploadRequest* Arena::CreateMaybeMessage< ::transfer::UploadRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::UploadRequest >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::TransferControlRequest*
+Arena::CreateMaybeMessage< ::transfer::TransferControlRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TransferControlRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::UploadResponse_FileResult* Arena::CreateMaybeMessage< ::transfer::UploadResponse_FileResult >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::UploadResponse_FileResult >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::TransferControlResponse*
+Arena::CreateMaybeMessage< ::transfer::TransferControlResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TransferControlResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::UploadResponse* Arena::CreateMaybeMessage< ::transfer::UploadResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::UploadResponse >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::TransferProgressRequest*
+Arena::CreateMaybeMessage< ::transfer::TransferProgressRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TransferProgressRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DownloadRequest_FileInfo* Arena::CreateMaybeMessage< ::transfer::DownloadRequest_FileInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DownloadRequest_FileInfo >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::TransferProgressResponse*
+Arena::CreateMaybeMessage< ::transfer::TransferProgressResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::TransferProgressResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DownloadRequest* Arena::CreateMaybeMessage< ::transfer::DownloadRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DownloadRequest >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::WatchRequest*
+Arena::CreateMaybeMessage< ::transfer::WatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::WatchRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DownloadResponse_FileResult* Arena::CreateMaybeMessage< ::transfer::DownloadResponse_FileResult >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DownloadResponse_FileResult >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::WatchResponse*
+Arena::CreateMaybeMessage< ::transfer::WatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::WatchResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::DownloadResponse* Arena::CreateMaybeMessage< ::transfer::DownloadResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::DownloadResponse >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::ChangeNotification*
+Arena::CreateMaybeMessage< ::transfer::ChangeNotification >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::ChangeNotification >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::TransferControlRequest* Arena::CreateMaybeMessage< ::transfer::TransferControlRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::TransferControlRequest >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::HelloRequest*
+Arena::CreateMaybeMessage< ::transfer::HelloRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::HelloRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::TransferControlResponse* Arena::CreateMaybeMessage< ::transfer::TransferControlResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::TransferControlResponse >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::HelloResponse*
+Arena::CreateMaybeMessage< ::transfer::HelloResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::HelloResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::TransferProgressRequest* Arena::CreateMaybeMessage< ::transfer::TransferProgressRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::TransferProgressRequest >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::HeartbeatRequest*
+Arena::CreateMaybeMessage< ::transfer::HeartbeatRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::HeartbeatRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::transfer::TransferProgressResponse* Arena::CreateMaybeMessage< ::transfer::TransferProgressResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::transfer::TransferProgressResponse >(arena);
+template<> PROTOBUF_NOINLINE ::transfer::HeartbeatResponse*
+Arena::CreateMaybeMessage< ::transfer::HeartbeatResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::transfer::HeartbeatResponse >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
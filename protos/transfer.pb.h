@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3008000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3008000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -44,71 +42,126 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_transfer_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[17]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transfer_2eproto;
 namespace transfer {
+class ArchiveRequest;
+struct ArchiveRequestDefaultTypeInternal;
+extern ArchiveRequestDefaultTypeInternal _ArchiveRequest_default_instance_;
+class ArchiveResponse;
+struct ArchiveResponseDefaultTypeInternal;
+extern ArchiveResponseDefaultTypeInternal _ArchiveResponse_default_instance_;
+class ChangeNotification;
+struct ChangeNotificationDefaultTypeInternal;
+extern ChangeNotificationDefaultTypeInternal _ChangeNotification_default_instance_;
 class DirectoryRequest;
-class DirectoryRequestDefaultTypeInternal;
+struct DirectoryRequestDefaultTypeInternal;
 extern DirectoryRequestDefaultTypeInternal _DirectoryRequest_default_instance_;
 class DirectoryResponse;
-class DirectoryResponseDefaultTypeInternal;
+struct DirectoryResponseDefaultTypeInternal;
 extern DirectoryResponseDefaultTypeInternal _DirectoryResponse_default_instance_;
 class DirectoryResponse_FileInfo;
-class DirectoryResponse_FileInfoDefaultTypeInternal;
+struct DirectoryResponse_FileInfoDefaultTypeInternal;
 extern DirectoryResponse_FileInfoDefaultTypeInternal _DirectoryResponse_FileInfo_default_instance_;
 class DownloadRequest;
-class DownloadRequestDefaultTypeInternal;
+struct DownloadRequestDefaultTypeInternal;
 extern DownloadRequestDefaultTypeInternal _DownloadRequest_default_instance_;
 class DownloadRequest_FileInfo;
-class DownloadRequest_FileInfoDefaultTypeInternal;
+struct DownloadRequest_FileInfoDefaultTypeInternal;
 extern DownloadRequest_FileInfoDefaultTypeInternal _DownloadRequest_FileInfo_default_instance_;
 class DownloadResponse;
-class DownloadResponseDefaultTypeInternal;
+struct DownloadResponseDefaultTypeInternal;
 extern DownloadResponseDefaultTypeInternal _DownloadResponse_default_instance_;
 class DownloadResponse_FileResult;
-class DownloadResponse_FileResultDefaultTypeInternal;
+struct DownloadResponse_FileResultDefaultTypeInternal;
 extern DownloadResponse_FileResultDefaultTypeInternal _DownloadResponse_FileResult_default_instance_;
+class HeartbeatRequest;
+struct HeartbeatRequestDefaultTypeInternal;
+extern HeartbeatRequestDefaultTypeInternal _HeartbeatRequest_default_instance_;
+class HeartbeatResponse;
+struct HeartbeatResponseDefaultTypeInternal;
+extern HeartbeatResponseDefaultTypeInternal _HeartbeatResponse_default_instance_;
+class HelloRequest;
+struct HelloRequestDefaultTypeInternal;
+extern HelloRequestDefaultTypeInternal _HelloRequest_default_instance_;
+class HelloResponse;
+struct HelloResponseDefaultTypeInternal;
+extern HelloResponseDefaultTypeInternal _HelloResponse_default_instance_;
+class ListingCacheFile;
+struct ListingCacheFileDefaultTypeInternal;
+extern ListingCacheFileDefaultTypeInternal _ListingCacheFile_default_instance_;
+class ListingCacheFile_Listing;
+struct ListingCacheFile_ListingDefaultTypeInternal;
+extern ListingCacheFile_ListingDefaultTypeInternal _ListingCacheFile_Listing_default_instance_;
+class ListingColumns;
+struct ListingColumnsDefaultTypeInternal;
+extern ListingColumnsDefaultTypeInternal _ListingColumns_default_instance_;
+class MakeDirectoryRequest;
+struct MakeDirectoryRequestDefaultTypeInternal;
+extern MakeDirectoryRequestDefaultTypeInternal _MakeDirectoryRequest_default_instance_;
+class MakeDirectoryResponse;
+struct MakeDirectoryResponseDefaultTypeInternal;
+extern MakeDirectoryResponseDefaultTypeInternal _MakeDirectoryResponse_default_instance_;
 class RequestHeader;
-class RequestHeaderDefaultTypeInternal;
+struct RequestHeaderDefaultTypeInternal;
 extern RequestHeaderDefaultTypeInternal _RequestHeader_default_instance_;
 class ResponseHeader;
-class ResponseHeaderDefaultTypeInternal;
+struct ResponseHeaderDefaultTypeInternal;
 extern ResponseHeaderDefaultTypeInternal _ResponseHeader_default_instance_;
+class SearchRequest;
+struct SearchRequestDefaultTypeInternal;
+extern SearchRequestDefaultTypeInternal _SearchRequest_default_instance_;
+class SearchResponse;
+struct SearchResponseDefaultTypeInternal;
+extern SearchResponseDefaultTypeInternal _SearchResponse_default_instance_;
+class SearchResponse_Entry;
+struct SearchResponse_EntryDefaultTypeInternal;
+extern SearchResponse_EntryDefaultTypeInternal _SearchResponse_Entry_default_instance_;
 class TransferControlRequest;
-class TransferControlRequestDefaultTypeInternal;
+struct TransferControlRequestDefaultTypeInternal;
 extern TransferControlRequestDefaultTypeInternal _TransferControlRequest_default_instance_;
 class TransferControlResponse;
-class TransferControlResponseDefaultTypeInternal;
+struct TransferControlResponseDefaultTypeInternal;
 extern TransferControlResponseDefaultTypeInternal _TransferControlResponse_default_instance_;
 class TransferProgressRequest;
-class TransferProgressRequestDefaultTypeInternal;
+struct TransferProgressRequestDefaultTypeInternal;
 extern TransferProgressRequestDefaultTypeInternal _TransferProgressRequest_default_instance_;
 class TransferProgressResponse;
-class TransferProgressResponseDefaultTypeInternal;
+struct TransferProgressResponseDefaultTypeInternal;
 extern TransferProgressResponseDefaultTypeInternal _TransferProgressResponse_default_instance_;
+class TreeListRequest;
+struct TreeListRequestDefaultTypeInternal;
+extern TreeListRequestDefaultTypeInternal _TreeListRequest_default_instance_;
+class TreeListResponse;
+struct TreeListResponseDefaultTypeInternal;
+extern TreeListResponseDefaultTypeInternal _TreeListResponse_default_instance_;
+class TreeListResponse_Entry;
+struct TreeListResponse_EntryDefaultTypeInternal;
+extern TreeListResponse_EntryDefaultTypeInternal _TreeListResponse_Entry_default_instance_;
 class UploadRequest;
-class UploadRequestDefaultTypeInternal;
+struct UploadRequestDefaultTypeInternal;
 extern UploadRequestDefaultTypeInternal _UploadRequest_default_instance_;
 class UploadRequest_FileInfo;
-class UploadRequest_FileInfoDefaultTypeInternal;
+struct UploadRequest_FileInfoDefaultTypeInternal;
 extern UploadRequest_FileInfoDefaultTypeInternal _UploadRequest_FileInfo_default_instance_;
 class UploadResponse;
-class UploadResponseDefaultTypeInternal;
+struct UploadResponseDefaultTypeInternal;
 extern UploadResponseDefaultTypeInternal _UploadResponse_default_instance_;
 class UploadResponse_FileResult;
-class UploadResponse_FileResultDefaultTypeInternal;
+struct UploadResponse_FileResultDefaultTypeInternal;
 extern UploadResponse_FileResultDefaultTypeInternal _UploadResponse_FileResult_default_instance_;
+class WatchRequest;
+struct WatchRequestDefaultTypeInternal;
+extern WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
+class WatchResponse;
+struct WatchResponseDefaultTypeInternal;
+extern WatchResponseDefaultTypeInternal _WatchResponse_default_instance_;
 }  // namespace transfer
 PROTOBUF_NAMESPACE_OPEN
+template<> ::transfer::ArchiveRequest* Arena::CreateMaybeMessage<::transfer::ArchiveRequest>(Arena*);
+template<> ::transfer::ArchiveResponse* Arena::CreateMaybeMessage<::transfer::ArchiveResponse>(Arena*);
+template<> ::transfer::ChangeNotification* Arena::CreateMaybeMessage<::transfer::ChangeNotification>(Arena*);
 template<> ::transfer::DirectoryRequest* Arena::CreateMaybeMessage<::transfer::DirectoryRequest>(Arena*);
 template<> ::transfer::DirectoryResponse* Arena::CreateMaybeMessage<::transfer::DirectoryResponse>(Arena*);
 template<> ::transfer::DirectoryResponse_FileInfo* Arena::CreateMaybeMessage<::transfer::DirectoryResponse_FileInfo>(Arena*);
@@ -116,25 +169,92 @@ template<> ::transfer::DownloadRequest* Arena::CreateMaybeMessage<::transfer::Do
 template<> ::transfer::DownloadRequest_FileInfo* Arena::CreateMaybeMessage<::transfer::DownloadRequest_FileInfo>(Arena*);
 template<> ::transfer::DownloadResponse* Arena::CreateMaybeMessage<::transfer::DownloadResponse>(Arena*);
 template<> ::transfer::DownloadResponse_FileResult* Arena::CreateMaybeMessage<::transfer::DownloadResponse_FileResult>(Arena*);
+template<> ::transfer::HeartbeatRequest* Arena::CreateMaybeMessage<::transfer::HeartbeatRequest>(Arena*);
+template<> ::transfer::HeartbeatResponse* Arena::CreateMaybeMessage<::transfer::HeartbeatResponse>(Arena*);
+template<> ::transfer::HelloRequest* Arena::CreateMaybeMessage<::transfer::HelloRequest>(Arena*);
+template<> ::transfer::HelloResponse* Arena::CreateMaybeMessage<::transfer::HelloResponse>(Arena*);
+template<> ::transfer::ListingCacheFile* Arena::CreateMaybeMessage<::transfer::ListingCacheFile>(Arena*);
+template<> ::transfer::ListingCacheFile_Listing* Arena::CreateMaybeMessage<::transfer::ListingCacheFile_Listing>(Arena*);
+template<> ::transfer::ListingColumns* Arena::CreateMaybeMessage<::transfer::ListingColumns>(Arena*);
+template<> ::transfer::MakeDirectoryRequest* Arena::CreateMaybeMessage<::transfer::MakeDirectoryRequest>(Arena*);
+template<> ::transfer::MakeDirectoryResponse* Arena::CreateMaybeMessage<::transfer::MakeDirectoryResponse>(Arena*);
 template<> ::transfer::RequestHeader* Arena::CreateMaybeMessage<::transfer::RequestHeader>(Arena*);
 template<> ::transfer::ResponseHeader* Arena::CreateMaybeMessage<::transfer::ResponseHeader>(Arena*);
+template<> ::transfer::SearchRequest* Arena::CreateMaybeMessage<::transfer::SearchRequest>(Arena*);
+template<> ::transfer::SearchResponse* Arena::CreateMaybeMessage<::transfer::SearchResponse>(Arena*);
+template<> ::transfer::SearchResponse_Entry* Arena::CreateMaybeMessage<::transfer::SearchResponse_Entry>(Arena*);
 template<> ::transfer::TransferControlRequest* Arena::CreateMaybeMessage<::transfer::TransferControlRequest>(Arena*);
 template<> ::transfer::TransferControlResponse* Arena::CreateMaybeMessage<::transfer::TransferControlResponse>(Arena*);
 template<> ::transfer::TransferProgressRequest* Arena::CreateMaybeMessage<::transfer::TransferProgressRequest>(Arena*);
 template<> ::transfer::TransferProgressResponse* Arena::CreateMaybeMessage<::transfer::TransferProgressResponse>(Arena*);
+template<> ::transfer::TreeListRequest* Arena::CreateMaybeMessage<::transfer::TreeListRequest>(Arena*);
+template<> ::transfer::TreeListResponse* Arena::CreateMaybeMessage<::transfer::TreeListResponse>(Arena*);
+template<> ::transfer::TreeListResponse_Entry* Arena::CreateMaybeMessage<::transfer::TreeListResponse_Entry>(Arena*);
 template<> ::transfer::UploadRequest* Arena::CreateMaybeMessage<::transfer::UploadRequest>(Arena*);
 template<> ::transfer::UploadRequest_FileInfo* Arena::CreateMaybeMessage<::transfer::UploadRequest_FileInfo>(Arena*);
 template<> ::transfer::UploadResponse* Arena::CreateMaybeMessage<::transfer::UploadResponse>(Arena*);
 template<> ::transfer::UploadResponse_FileResult* Arena::CreateMaybeMessage<::transfer::UploadResponse_FileResult>(Arena*);
+template<> ::transfer::WatchRequest* Arena::CreateMaybeMessage<::transfer::WatchRequest>(Arena*);
+template<> ::transfer::WatchResponse* Arena::CreateMaybeMessage<::transfer::WatchResponse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace transfer {
 
+enum ArchiveRequest_Direction : int {
+  ArchiveRequest_Direction_PUSH = 0,
+  ArchiveRequest_Direction_PULL = 1,
+  ArchiveRequest_Direction_ArchiveRequest_Direction_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ArchiveRequest_Direction_ArchiveRequest_Direction_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ArchiveRequest_Direction_IsValid(int value);
+constexpr ArchiveRequest_Direction ArchiveRequest_Direction_Direction_MIN = ArchiveRequest_Direction_PUSH;
+constexpr ArchiveRequest_Direction ArchiveRequest_Direction_Direction_MAX = ArchiveRequest_Direction_PULL;
+constexpr int ArchiveRequest_Direction_Direction_ARRAYSIZE = ArchiveRequest_Direction_Direction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ArchiveRequest_Direction_descriptor();
+template<typename T>
+inline const std::string& ArchiveRequest_Direction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ArchiveRequest_Direction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ArchiveRequest_Direction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ArchiveRequest_Direction_descriptor(), enum_t_value);
+}
+inline bool ArchiveRequest_Direction_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ArchiveRequest_Direction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ArchiveRequest_Direction>(
+    ArchiveRequest_Direction_descriptor(), name, value);
+}
+enum SearchRequest_PatternType : int {
+  SearchRequest_PatternType_GLOB = 0,
+  SearchRequest_PatternType_REGEX = 1,
+  SearchRequest_PatternType_SearchRequest_PatternType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SearchRequest_PatternType_SearchRequest_PatternType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool SearchRequest_PatternType_IsValid(int value);
+constexpr SearchRequest_PatternType SearchRequest_PatternType_PatternType_MIN = SearchRequest_PatternType_GLOB;
+constexpr SearchRequest_PatternType SearchRequest_PatternType_PatternType_MAX = SearchRequest_PatternType_REGEX;
+constexpr int SearchRequest_PatternType_PatternType_ARRAYSIZE = SearchRequest_PatternType_PatternType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SearchRequest_PatternType_descriptor();
+template<typename T>
+inline const std::string& SearchRequest_PatternType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SearchRequest_PatternType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SearchRequest_PatternType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SearchRequest_PatternType_descriptor(), enum_t_value);
+}
+inline bool SearchRequest_PatternType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SearchRequest_PatternType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SearchRequest_PatternType>(
+    SearchRequest_PatternType_descriptor(), name, value);
+}
 enum TransferControlRequest_ControlType : int {
   TransferControlRequest_ControlType_PAUSE = 0,
   TransferControlRequest_ControlType_RESUME = 1,
   TransferControlRequest_ControlType_CANCEL = 2,
-  TransferControlRequest_ControlType_TransferControlRequest_ControlType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  TransferControlRequest_ControlType_TransferControlRequest_ControlType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  TransferControlRequest_ControlType_TransferControlRequest_ControlType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TransferControlRequest_ControlType_TransferControlRequest_ControlType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TransferControlRequest_ControlType_IsValid(int value);
 constexpr TransferControlRequest_ControlType TransferControlRequest_ControlType_ControlType_MIN = TransferControlRequest_ControlType_PAUSE;
@@ -151,7 +271,7 @@ inline const std::string& TransferControlRequest_ControlType_Name(T enum_t_value
     TransferControlRequest_ControlType_descriptor(), enum_t_value);
 }
 inline bool TransferControlRequest_ControlType_Parse(
-    const std::string& name, TransferControlRequest_ControlType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TransferControlRequest_ControlType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TransferControlRequest_ControlType>(
     TransferControlRequest_ControlType_descriptor(), name, value);
 }
@@ -162,12 +282,20 @@ enum MessageType : int {
   DOWNLOAD = 3,
   TRANSFER_CONTROL = 4,
   TRANSFER_PROGRESS = 5,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  MKDIR = 6,
+  TREE_LIST = 7,
+  ARCHIVE = 8,
+  SEARCH = 9,
+  WATCH = 10,
+  CHANGE_NOTIFY = 11,
+  HELLO = 12,
+  HEARTBEAT = 13,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
 constexpr MessageType MessageType_MIN = UNKNOWN;
-constexpr MessageType MessageType_MAX = TRANSFER_PROGRESS;
+constexpr MessageType MessageType_MAX = HEARTBEAT;
 constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
@@ -180,18 +308,44 @@ inline const std::string& MessageType_Name(T enum_t_value) {
     MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const std::string& name, MessageType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
+enum ListingEncoding : int {
+  LISTING_V1 = 0,
+  LISTING_V2 = 1,
+  LISTING_V2_COLUMNS = 2,
+  ListingEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ListingEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ListingEncoding_IsValid(int value);
+constexpr ListingEncoding ListingEncoding_MIN = LISTING_V1;
+constexpr ListingEncoding ListingEncoding_MAX = LISTING_V2_COLUMNS;
+constexpr int ListingEncoding_ARRAYSIZE = ListingEncoding_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ListingEncoding_descriptor();
+template<typename T>
+inline const std::string& ListingEncoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ListingEncoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ListingEncoding_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ListingEncoding_descriptor(), enum_t_value);
+}
+inline bool ListingEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ListingEncoding* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ListingEncoding>(
+    ListingEncoding_descriptor(), name, value);
+}
 enum TransferStatus : int {
   INIT = 0,
   TRANSFERRING = 1,
   PAUSED = 2,
   COMPLETED = 3,
   FAILED = 4,
-  TransferStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  TransferStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  TransferStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TransferStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool TransferStatus_IsValid(int value);
 constexpr TransferStatus TransferStatus_MIN = INIT;
@@ -208,17 +362,18 @@ inline const std::string& TransferStatus_Name(T enum_t_value) {
     TransferStatus_descriptor(), enum_t_value);
 }
 inline bool TransferStatus_Parse(
-    const std::string& name, TransferStatus* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TransferStatus* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TransferStatus>(
     TransferStatus_descriptor(), name, value);
 }
 // ===================================================================
 
-class RequestHeader :
+class RequestHeader final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.RequestHeader) */ {
  public:
-  RequestHeader();
-  virtual ~RequestHeader();
+  inline RequestHeader() : RequestHeader(nullptr) {}
+  ~RequestHeader() override;
+  explicit PROTOBUF_CONSTEXPR RequestHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RequestHeader(const RequestHeader& from);
   RequestHeader(RequestHeader&& from) noexcept
@@ -231,8 +386,13 @@ class RequestHeader :
     return *this;
   }
   inline RequestHeader& operator=(RequestHeader&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -243,14 +403,14 @@ class RequestHeader :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestHeader& default_instance() {
+    return *internal_default_instance();
   }
-  static const RequestHeader& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const RequestHeader* internal_default_instance() {
     return reinterpret_cast<const RequestHeader*>(
                &_RequestHeader_default_instance_);
@@ -258,120 +418,148 @@ class RequestHeader :
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(RequestHeader* other);
   friend void swap(RequestHeader& a, RequestHeader& b) {
     a.Swap(&b);
   }
+  inline void Swap(RequestHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RequestHeader* New() const final {
-    return CreateMaybeMessage<RequestHeader>(nullptr);
-  }
-
-  RequestHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RequestHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RequestHeader>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RequestHeader& from);
-  void MergeFrom(const RequestHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestHeader& from) {
+    RequestHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RequestHeader* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "transfer.RequestHeader";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit RequestHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSessionIdFieldNumber = 1,
+    kTimestampFieldNumber = 3,
+    kSequenceFieldNumber = 4,
+    kTypeFieldNumber = 2,
+  };
   // string session_id = 1;
   void clear_session_id();
-  static const int kSessionIdFieldNumber = 1;
   const std::string& session_id() const;
-  void set_session_id(const std::string& value);
-  void set_session_id(std::string&& value);
-  void set_session_id(const char* value);
-  void set_session_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_session_id();
-  std::string* release_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
   void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
 
   // uint64 timestamp = 3;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 3;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // uint64 sequence = 4;
   void clear_sequence();
-  static const int kSequenceFieldNumber = 4;
-  ::PROTOBUF_NAMESPACE_ID::uint64 sequence() const;
-  void set_sequence(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
 
   // .transfer.MessageType type = 2;
   void clear_type();
-  static const int kTypeFieldNumber = 2;
   ::transfer::MessageType type() const;
   void set_type(::transfer::MessageType value);
+  private:
+  ::transfer::MessageType _internal_type() const;
+  void _internal_set_type(::transfer::MessageType value);
+  public:
 
   // @@protoc_insertion_point(class_scope:transfer.RequestHeader)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 sequence_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    uint64_t timestamp_;
+    uint64_t sequence_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ResponseHeader :
+class ResponseHeader final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ResponseHeader) */ {
  public:
-  ResponseHeader();
-  virtual ~ResponseHeader();
+  inline ResponseHeader() : ResponseHeader(nullptr) {}
+  ~ResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR ResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResponseHeader(const ResponseHeader& from);
   ResponseHeader(ResponseHeader&& from) noexcept
@@ -384,8 +572,13 @@ class ResponseHeader :
     return *this;
   }
   inline ResponseHeader& operator=(ResponseHeader&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -396,14 +589,14 @@ class ResponseHeader :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponseHeader& default_instance() {
+    return *internal_default_instance();
   }
-  static const ResponseHeader& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ResponseHeader* internal_default_instance() {
     return reinterpret_cast<const ResponseHeader*>(
                &_ResponseHeader_default_instance_);
@@ -411,153 +604,191 @@ class ResponseHeader :
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(ResponseHeader* other);
   friend void swap(ResponseHeader& a, ResponseHeader& b) {
     a.Swap(&b);
   }
+  inline void Swap(ResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ResponseHeader* New() const final {
-    return CreateMaybeMessage<ResponseHeader>(nullptr);
-  }
-
-  ResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResponseHeader>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResponseHeader& from);
-  void MergeFrom(const ResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseHeader& from) {
+    ResponseHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResponseHeader* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "transfer.ResponseHeader";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSessionIdFieldNumber = 1,
+    kErrorCodeFieldNumber = 5,
+    kErrorMessageFieldNumber = 6,
+    kTimestampFieldNumber = 3,
+    kTypeFieldNumber = 2,
+    kSuccessFieldNumber = 4,
+    kSequenceFieldNumber = 7,
+  };
   // string session_id = 1;
   void clear_session_id();
-  static const int kSessionIdFieldNumber = 1;
   const std::string& session_id() const;
-  void set_session_id(const std::string& value);
-  void set_session_id(std::string&& value);
-  void set_session_id(const char* value);
-  void set_session_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_session_id();
-  std::string* release_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
   void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
 
   // string error_code = 5;
   void clear_error_code();
-  static const int kErrorCodeFieldNumber = 5;
   const std::string& error_code() const;
-  void set_error_code(const std::string& value);
-  void set_error_code(std::string&& value);
-  void set_error_code(const char* value);
-  void set_error_code(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_code();
-  std::string* release_error_code();
+  PROTOBUF_NODISCARD std::string* release_error_code();
   void set_allocated_error_code(std::string* error_code);
+  private:
+  const std::string& _internal_error_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_code(const std::string& value);
+  std::string* _internal_mutable_error_code();
+  public:
 
   // string error_message = 6;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 6;
   const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_error_message();
-  std::string* release_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
   void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // uint64 timestamp = 3;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 3;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // .transfer.MessageType type = 2;
   void clear_type();
-  static const int kTypeFieldNumber = 2;
   ::transfer::MessageType type() const;
   void set_type(::transfer::MessageType value);
+  private:
+  ::transfer::MessageType _internal_type() const;
+  void _internal_set_type(::transfer::MessageType value);
+  public:
 
   // bool success = 4;
   void clear_success();
-  static const int kSuccessFieldNumber = 4;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // uint64 sequence = 7;
   void clear_sequence();
-  static const int kSequenceFieldNumber = 7;
-  ::PROTOBUF_NAMESPACE_ID::uint64 sequence() const;
-  void set_sequence(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:transfer.ResponseHeader)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_code_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
-  int type_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 sequence_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    uint64_t timestamp_;
+    int type_;
+    bool success_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DirectoryRequest :
+class DirectoryRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DirectoryRequest) */ {
  public:
-  DirectoryRequest();
-  virtual ~DirectoryRequest();
+  inline DirectoryRequest() : DirectoryRequest(nullptr) {}
+  ~DirectoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR DirectoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DirectoryRequest(const DirectoryRequest& from);
   DirectoryRequest(DirectoryRequest&& from) noexcept
@@ -570,8 +801,13 @@ class DirectoryRequest :
     return *this;
   }
   inline DirectoryRequest& operator=(DirectoryRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -582,14 +818,14 @@ class DirectoryRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectoryRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const DirectoryRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DirectoryRequest* internal_default_instance() {
     return reinterpret_cast<const DirectoryRequest*>(
                &_DirectoryRequest_default_instance_);
@@ -597,129 +833,480 @@ class DirectoryRequest :
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(DirectoryRequest* other);
   friend void swap(DirectoryRequest& a, DirectoryRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(DirectoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DirectoryRequest* New() const final {
-    return CreateMaybeMessage<DirectoryRequest>(nullptr);
-  }
-
-  DirectoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DirectoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DirectoryRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DirectoryRequest& from);
-  void MergeFrom(const DirectoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectoryRequest& from) {
+    DirectoryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DirectoryRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "transfer.DirectoryRequest";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCurrentPathFieldNumber = 2,
+    kDirNameFieldNumber = 3,
+    kCursorFieldNumber = 5,
+    kIfNoneMatchFieldNumber = 7,
+    kHeaderFieldNumber = 1,
+    kIsParentFieldNumber = 4,
+    kPageSizeFieldNumber = 6,
+    kSinceVersionFieldNumber = 8,
+    kEncodingFieldNumber = 9,
+  };
   // string current_path = 2;
   void clear_current_path();
-  static const int kCurrentPathFieldNumber = 2;
   const std::string& current_path() const;
-  void set_current_path(const std::string& value);
-  void set_current_path(std::string&& value);
-  void set_current_path(const char* value);
-  void set_current_path(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_current_path(ArgT0&& arg0, ArgT... args);
   std::string* mutable_current_path();
-  std::string* release_current_path();
+  PROTOBUF_NODISCARD std::string* release_current_path();
   void set_allocated_current_path(std::string* current_path);
+  private:
+  const std::string& _internal_current_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_current_path(const std::string& value);
+  std::string* _internal_mutable_current_path();
+  public:
 
   // string dir_name = 3;
   void clear_dir_name();
-  static const int kDirNameFieldNumber = 3;
   const std::string& dir_name() const;
-  void set_dir_name(const std::string& value);
-  void set_dir_name(std::string&& value);
-  void set_dir_name(const char* value);
-  void set_dir_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dir_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_dir_name();
-  std::string* release_dir_name();
+  PROTOBUF_NODISCARD std::string* release_dir_name();
   void set_allocated_dir_name(std::string* dir_name);
+  private:
+  const std::string& _internal_dir_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dir_name(const std::string& value);
+  std::string* _internal_mutable_dir_name();
+  public:
+
+  // string cursor = 5;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // string if_none_match = 7;
+  void clear_if_none_match();
+  const std::string& if_none_match() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_if_none_match(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_if_none_match();
+  PROTOBUF_NODISCARD std::string* release_if_none_match();
+  void set_allocated_if_none_match(std::string* if_none_match);
+  private:
+  const std::string& _internal_if_none_match() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_if_none_match(const std::string& value);
+  std::string* _internal_mutable_if_none_match();
+  public:
 
   // .transfer.RequestHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
   const ::transfer::RequestHeader& header() const;
-  ::transfer::RequestHeader* release_header();
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
   ::transfer::RequestHeader* mutable_header();
   void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
 
   // bool is_parent = 4;
   void clear_is_parent();
-  static const int kIsParentFieldNumber = 4;
   bool is_parent() const;
   void set_is_parent(bool value);
+  private:
+  bool _internal_is_parent() const;
+  void _internal_set_is_parent(bool value);
+  public:
+
+  // uint32 page_size = 6;
+  void clear_page_size();
+  uint32_t page_size() const;
+  void set_page_size(uint32_t value);
+  private:
+  uint32_t _internal_page_size() const;
+  void _internal_set_page_size(uint32_t value);
+  public:
+
+  // uint64 since_version = 8;
+  void clear_since_version();
+  uint64_t since_version() const;
+  void set_since_version(uint64_t value);
+  private:
+  uint64_t _internal_since_version() const;
+  void _internal_set_since_version(uint64_t value);
+  public:
+
+  // .transfer.ListingEncoding encoding = 9;
+  void clear_encoding();
+  ::transfer::ListingEncoding encoding() const;
+  void set_encoding(::transfer::ListingEncoding value);
+  private:
+  ::transfer::ListingEncoding _internal_encoding() const;
+  void _internal_set_encoding(::transfer::ListingEncoding value);
+  public:
 
   // @@protoc_insertion_point(class_scope:transfer.DirectoryRequest)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dir_name_;
-  ::transfer::RequestHeader* header_;
-  bool is_parent_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr current_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dir_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr if_none_match_;
+    ::transfer::RequestHeader* header_;
+    bool is_parent_;
+    uint32_t page_size_;
+    uint64_t since_version_;
+    int encoding_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListingColumns final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ListingColumns) */ {
+ public:
+  inline ListingColumns() : ListingColumns(nullptr) {}
+  ~ListingColumns() override;
+  explicit PROTOBUF_CONSTEXPR ListingColumns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListingColumns(const ListingColumns& from);
+  ListingColumns(ListingColumns&& from) noexcept
+    : ListingColumns() {
+    *this = ::std::move(from);
+  }
+
+  inline ListingColumns& operator=(const ListingColumns& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListingColumns& operator=(ListingColumns&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListingColumns& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListingColumns* internal_default_instance() {
+    return reinterpret_cast<const ListingColumns*>(
+               &_ListingColumns_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ListingColumns& a, ListingColumns& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListingColumns* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListingColumns* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListingColumns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListingColumns>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListingColumns& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListingColumns& from) {
+    ListingColumns::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListingColumns* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.ListingColumns";
+  }
+  protected:
+  explicit ListingColumns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameLengthsFieldNumber = 2,
+    kSizesFieldNumber = 3,
+    kModifyTimesFieldNumber = 4,
+    kModesFieldNumber = 5,
+    kNamesFieldNumber = 1,
+  };
+  // repeated uint32 name_lengths = 2;
+  int name_lengths_size() const;
+  private:
+  int _internal_name_lengths_size() const;
+  public:
+  void clear_name_lengths();
+  private:
+  uint32_t _internal_name_lengths(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_name_lengths() const;
+  void _internal_add_name_lengths(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_name_lengths();
+  public:
+  uint32_t name_lengths(int index) const;
+  void set_name_lengths(int index, uint32_t value);
+  void add_name_lengths(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      name_lengths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_name_lengths();
+
+  // repeated uint64 sizes = 3;
+  int sizes_size() const;
+  private:
+  int _internal_sizes_size() const;
+  public:
+  void clear_sizes();
+  private:
+  uint64_t _internal_sizes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_sizes() const;
+  void _internal_add_sizes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_sizes();
+  public:
+  uint64_t sizes(int index) const;
+  void set_sizes(int index, uint64_t value);
+  void add_sizes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      sizes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_sizes();
+
+  // repeated uint64 modify_times = 4;
+  int modify_times_size() const;
+  private:
+  int _internal_modify_times_size() const;
+  public:
+  void clear_modify_times();
+  private:
+  uint64_t _internal_modify_times(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_modify_times() const;
+  void _internal_add_modify_times(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_modify_times();
+  public:
+  uint64_t modify_times(int index) const;
+  void set_modify_times(int index, uint64_t value);
+  void add_modify_times(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      modify_times() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_modify_times();
+
+  // repeated uint32 modes = 5;
+  int modes_size() const;
+  private:
+  int _internal_modes_size() const;
+  public:
+  void clear_modes();
+  private:
+  uint32_t _internal_modes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_modes() const;
+  void _internal_add_modes(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_modes();
+  public:
+  uint32_t modes(int index) const;
+  void set_modes(int index, uint32_t value);
+  void add_modes(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      modes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_modes();
+
+  // bytes names = 1;
+  void clear_names();
+  const std::string& names() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_names(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_names();
+  PROTOBUF_NODISCARD std::string* release_names();
+  void set_allocated_names(std::string* names);
+  private:
+  const std::string& _internal_names() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_names(const std::string& value);
+  std::string* _internal_mutable_names();
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.ListingColumns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > name_lengths_;
+    mutable std::atomic<int> _name_lengths_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > sizes_;
+    mutable std::atomic<int> _sizes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > modify_times_;
+    mutable std::atomic<int> _modify_times_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > modes_;
+    mutable std::atomic<int> _modes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr names_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DirectoryResponse_FileInfo :
+class DirectoryResponse_FileInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DirectoryResponse.FileInfo) */ {
  public:
-  DirectoryResponse_FileInfo();
-  virtual ~DirectoryResponse_FileInfo();
+  inline DirectoryResponse_FileInfo() : DirectoryResponse_FileInfo(nullptr) {}
+  ~DirectoryResponse_FileInfo() override;
+  explicit PROTOBUF_CONSTEXPR DirectoryResponse_FileInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DirectoryResponse_FileInfo(const DirectoryResponse_FileInfo& from);
   DirectoryResponse_FileInfo(DirectoryResponse_FileInfo&& from) noexcept
@@ -732,8 +1319,13 @@ class DirectoryResponse_FileInfo :
     return *this;
   }
   inline DirectoryResponse_FileInfo& operator=(DirectoryResponse_FileInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -744,174 +1336,233 @@ class DirectoryResponse_FileInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectoryResponse_FileInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const DirectoryResponse_FileInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DirectoryResponse_FileInfo* internal_default_instance() {
     return reinterpret_cast<const DirectoryResponse_FileInfo*>(
                &_DirectoryResponse_FileInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
-  void Swap(DirectoryResponse_FileInfo* other);
   friend void swap(DirectoryResponse_FileInfo& a, DirectoryResponse_FileInfo& b) {
     a.Swap(&b);
   }
+  inline void Swap(DirectoryResponse_FileInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectoryResponse_FileInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DirectoryResponse_FileInfo* New() const final {
-    return CreateMaybeMessage<DirectoryResponse_FileInfo>(nullptr);
-  }
-
-  DirectoryResponse_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DirectoryResponse_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DirectoryResponse_FileInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DirectoryResponse_FileInfo& from);
-  void MergeFrom(const DirectoryResponse_FileInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectoryResponse_FileInfo& from) {
+    DirectoryResponse_FileInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DirectoryResponse_FileInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "transfer.DirectoryResponse.FileInfo";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DirectoryResponse_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kModifyTimeFieldNumber = 4,
+    kPermissionsFieldNumber = 5,
+    kTaskIdFieldNumber = 6,
+    kSizeFieldNumber = 3,
+    kIsDirectoryFieldNumber = 2,
+    kStatusFieldNumber = 7,
+    kModifyTimeNsFieldNumber = 8,
+    kModeFieldNumber = 9,
+  };
   // string name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // string modify_time = 4;
   void clear_modify_time();
-  static const int kModifyTimeFieldNumber = 4;
   const std::string& modify_time() const;
-  void set_modify_time(const std::string& value);
-  void set_modify_time(std::string&& value);
-  void set_modify_time(const char* value);
-  void set_modify_time(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_modify_time(ArgT0&& arg0, ArgT... args);
   std::string* mutable_modify_time();
-  std::string* release_modify_time();
+  PROTOBUF_NODISCARD std::string* release_modify_time();
   void set_allocated_modify_time(std::string* modify_time);
+  private:
+  const std::string& _internal_modify_time() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_modify_time(const std::string& value);
+  std::string* _internal_mutable_modify_time();
+  public:
 
   // string permissions = 5;
   void clear_permissions();
-  static const int kPermissionsFieldNumber = 5;
   const std::string& permissions() const;
-  void set_permissions(const std::string& value);
-  void set_permissions(std::string&& value);
-  void set_permissions(const char* value);
-  void set_permissions(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_permissions(ArgT0&& arg0, ArgT... args);
   std::string* mutable_permissions();
-  std::string* release_permissions();
+  PROTOBUF_NODISCARD std::string* release_permissions();
   void set_allocated_permissions(std::string* permissions);
+  private:
+  const std::string& _internal_permissions() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_permissions(const std::string& value);
+  std::string* _internal_mutable_permissions();
+  public:
 
   // string task_id = 6;
   void clear_task_id();
-  static const int kTaskIdFieldNumber = 6;
   const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_task_id();
-  std::string* release_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
   void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
 
   // uint64 size = 3;
   void clear_size();
-  static const int kSizeFieldNumber = 3;
-  ::PROTOBUF_NAMESPACE_ID::uint64 size() const;
-  void set_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
 
   // bool is_directory = 2;
   void clear_is_directory();
-  static const int kIsDirectoryFieldNumber = 2;
   bool is_directory() const;
   void set_is_directory(bool value);
-
+  private:
+  bool _internal_is_directory() const;
+  void _internal_set_is_directory(bool value);
+  public:
+
   // .transfer.TransferStatus status = 7;
   void clear_status();
-  static const int kStatusFieldNumber = 7;
   ::transfer::TransferStatus status() const;
   void set_status(::transfer::TransferStatus value);
+  private:
+  ::transfer::TransferStatus _internal_status() const;
+  void _internal_set_status(::transfer::TransferStatus value);
+  public:
+
+  // uint64 modify_time_ns = 8;
+  void clear_modify_time_ns();
+  uint64_t modify_time_ns() const;
+  void set_modify_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_modify_time_ns() const;
+  void _internal_set_modify_time_ns(uint64_t value);
+  public:
+
+  // uint32 mode = 9;
+  void clear_mode();
+  uint32_t mode() const;
+  void set_mode(uint32_t value);
+  private:
+  uint32_t _internal_mode() const;
+  void _internal_set_mode(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:transfer.DirectoryResponse.FileInfo)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modify_time_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr permissions_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 size_;
-  bool is_directory_;
-  int status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modify_time_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr permissions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    uint64_t size_;
+    bool is_directory_;
+    int status_;
+    uint64_t modify_time_ns_;
+    uint32_t mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DirectoryResponse :
+class DirectoryResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DirectoryResponse) */ {
  public:
-  DirectoryResponse();
-  virtual ~DirectoryResponse();
+  inline DirectoryResponse() : DirectoryResponse(nullptr) {}
+  ~DirectoryResponse() override;
+  explicit PROTOBUF_CONSTEXPR DirectoryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DirectoryResponse(const DirectoryResponse& from);
   DirectoryResponse(DirectoryResponse&& from) noexcept
@@ -924,8 +1575,13 @@ class DirectoryResponse :
     return *this;
   }
   inline DirectoryResponse& operator=(DirectoryResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -936,81 +1592,86 @@ class DirectoryResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectoryResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const DirectoryResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const DirectoryResponse* internal_default_instance() {
     return reinterpret_cast<const DirectoryResponse*>(
                &_DirectoryResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  void Swap(DirectoryResponse* other);
   friend void swap(DirectoryResponse& a, DirectoryResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(DirectoryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DirectoryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DirectoryResponse* New() const final {
-    return CreateMaybeMessage<DirectoryResponse>(nullptr);
-  }
-
-  DirectoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DirectoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DirectoryResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DirectoryResponse& from);
-  void MergeFrom(const DirectoryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectoryResponse& from) {
+    DirectoryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DirectoryResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "transfer.DirectoryResponse";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit DirectoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1018,71 +1679,259 @@ class DirectoryResponse :
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFilesFieldNumber = 3,
+    kRemovedFieldNumber = 11,
+    kPathFieldNumber = 2,
+    kNextCursorFieldNumber = 4,
+    kEtagFieldNumber = 7,
+    kHeaderFieldNumber = 1,
+    kColumnsFieldNumber = 14,
+    kTotalCountFieldNumber = 6,
+    kVersionFieldNumber = 9,
+    kHasMoreFieldNumber = 5,
+    kNotModifiedFieldNumber = 8,
+    kIsDeltaFieldNumber = 10,
+    kEncodingFieldNumber = 13,
+    kBaseVersionFieldNumber = 12,
+  };
   // repeated .transfer.DirectoryResponse.FileInfo files = 3;
   int files_size() const;
+  private:
+  int _internal_files_size() const;
+  public:
   void clear_files();
-  static const int kFilesFieldNumber = 3;
   ::transfer::DirectoryResponse_FileInfo* mutable_files(int index);
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >*
       mutable_files();
+  private:
+  const ::transfer::DirectoryResponse_FileInfo& _internal_files(int index) const;
+  ::transfer::DirectoryResponse_FileInfo* _internal_add_files();
+  public:
   const ::transfer::DirectoryResponse_FileInfo& files(int index) const;
   ::transfer::DirectoryResponse_FileInfo* add_files();
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >&
       files() const;
 
+  // repeated string removed = 11;
+  int removed_size() const;
+  private:
+  int _internal_removed_size() const;
+  public:
+  void clear_removed();
+  const std::string& removed(int index) const;
+  std::string* mutable_removed(int index);
+  void set_removed(int index, const std::string& value);
+  void set_removed(int index, std::string&& value);
+  void set_removed(int index, const char* value);
+  void set_removed(int index, const char* value, size_t size);
+  std::string* add_removed();
+  void add_removed(const std::string& value);
+  void add_removed(std::string&& value);
+  void add_removed(const char* value);
+  void add_removed(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed();
+  private:
+  const std::string& _internal_removed(int index) const;
+  std::string* _internal_add_removed();
+  public:
+
   // string path = 2;
   void clear_path();
-  static const int kPathFieldNumber = 2;
   const std::string& path() const;
-  void set_path(const std::string& value);
-  void set_path(std::string&& value);
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
   std::string* mutable_path();
-  std::string* release_path();
+  PROTOBUF_NODISCARD std::string* release_path();
   void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // string next_cursor = 4;
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
+
+  // string etag = 7;
+  void clear_etag();
+  const std::string& etag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_etag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_etag();
+  PROTOBUF_NODISCARD std::string* release_etag();
+  void set_allocated_etag(std::string* etag);
+  private:
+  const std::string& _internal_etag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_etag(const std::string& value);
+  std::string* _internal_mutable_etag();
+  public:
 
   // .transfer.ResponseHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
   const ::transfer::ResponseHeader& header() const;
-  ::transfer::ResponseHeader* release_header();
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
   ::transfer::ResponseHeader* mutable_header();
   void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // .transfer.ListingColumns columns = 14;
+  bool has_columns() const;
+  private:
+  bool _internal_has_columns() const;
+  public:
+  void clear_columns();
+  const ::transfer::ListingColumns& columns() const;
+  PROTOBUF_NODISCARD ::transfer::ListingColumns* release_columns();
+  ::transfer::ListingColumns* mutable_columns();
+  void set_allocated_columns(::transfer::ListingColumns* columns);
+  private:
+  const ::transfer::ListingColumns& _internal_columns() const;
+  ::transfer::ListingColumns* _internal_mutable_columns();
+  public:
+  void unsafe_arena_set_allocated_columns(
+      ::transfer::ListingColumns* columns);
+  ::transfer::ListingColumns* unsafe_arena_release_columns();
+
+  // uint64 total_count = 6;
+  void clear_total_count();
+  uint64_t total_count() const;
+  void set_total_count(uint64_t value);
+  private:
+  uint64_t _internal_total_count() const;
+  void _internal_set_total_count(uint64_t value);
+  public:
+
+  // uint64 version = 9;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // bool has_more = 5;
+  void clear_has_more();
+  bool has_more() const;
+  void set_has_more(bool value);
+  private:
+  bool _internal_has_more() const;
+  void _internal_set_has_more(bool value);
+  public:
+
+  // bool not_modified = 8;
+  void clear_not_modified();
+  bool not_modified() const;
+  void set_not_modified(bool value);
+  private:
+  bool _internal_not_modified() const;
+  void _internal_set_not_modified(bool value);
+  public:
+
+  // bool is_delta = 10;
+  void clear_is_delta();
+  bool is_delta() const;
+  void set_is_delta(bool value);
+  private:
+  bool _internal_is_delta() const;
+  void _internal_set_is_delta(bool value);
+  public:
+
+  // .transfer.ListingEncoding encoding = 13;
+  void clear_encoding();
+  ::transfer::ListingEncoding encoding() const;
+  void set_encoding(::transfer::ListingEncoding value);
+  private:
+  ::transfer::ListingEncoding _internal_encoding() const;
+  void _internal_set_encoding(::transfer::ListingEncoding value);
+  public:
+
+  // uint64 base_version = 12;
+  void clear_base_version();
+  uint64_t base_version() const;
+  void set_base_version(uint64_t value);
+  private:
+  uint64_t _internal_base_version() const;
+  void _internal_set_base_version(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:transfer.DirectoryResponse)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo > files_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
-  ::transfer::ResponseHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo > files_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr etag_;
+    ::transfer::ResponseHeader* header_;
+    ::transfer::ListingColumns* columns_;
+    uint64_t total_count_;
+    uint64_t version_;
+    bool has_more_;
+    bool not_modified_;
+    bool is_delta_;
+    int encoding_;
+    uint64_t base_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UploadRequest_FileInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadRequest.FileInfo) */ {
+class ListingCacheFile_Listing final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ListingCacheFile.Listing) */ {
  public:
-  UploadRequest_FileInfo();
-  virtual ~UploadRequest_FileInfo();
+  inline ListingCacheFile_Listing() : ListingCacheFile_Listing(nullptr) {}
+  ~ListingCacheFile_Listing() override;
+  explicit PROTOBUF_CONSTEXPR ListingCacheFile_Listing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UploadRequest_FileInfo(const UploadRequest_FileInfo& from);
-  UploadRequest_FileInfo(UploadRequest_FileInfo&& from) noexcept
-    : UploadRequest_FileInfo() {
+  ListingCacheFile_Listing(const ListingCacheFile_Listing& from);
+  ListingCacheFile_Listing(ListingCacheFile_Listing&& from) noexcept
+    : ListingCacheFile_Listing() {
     *this = ::std::move(from);
   }
 
-  inline UploadRequest_FileInfo& operator=(const UploadRequest_FileInfo& from) {
+  inline ListingCacheFile_Listing& operator=(const ListingCacheFile_Listing& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UploadRequest_FileInfo& operator=(UploadRequest_FileInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ListingCacheFile_Listing& operator=(ListingCacheFile_Listing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1093,242 +1942,164 @@ class UploadRequest_FileInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UploadRequest_FileInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadRequest_FileInfo* internal_default_instance() {
-    return reinterpret_cast<const UploadRequest_FileInfo*>(
-               &_UploadRequest_FileInfo_default_instance_);
+  static const ListingCacheFile_Listing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListingCacheFile_Listing* internal_default_instance() {
+    return reinterpret_cast<const ListingCacheFile_Listing*>(
+               &_ListingCacheFile_Listing_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
-  void Swap(UploadRequest_FileInfo* other);
-  friend void swap(UploadRequest_FileInfo& a, UploadRequest_FileInfo& b) {
+  friend void swap(ListingCacheFile_Listing& a, ListingCacheFile_Listing& b) {
     a.Swap(&b);
   }
+  inline void Swap(ListingCacheFile_Listing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListingCacheFile_Listing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UploadRequest_FileInfo* New() const final {
-    return CreateMaybeMessage<UploadRequest_FileInfo>(nullptr);
+  ListingCacheFile_Listing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListingCacheFile_Listing>(arena);
   }
-
-  UploadRequest_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UploadRequest_FileInfo>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListingCacheFile_Listing& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListingCacheFile_Listing& from) {
+    ListingCacheFile_Listing::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UploadRequest_FileInfo& from);
-  void MergeFrom(const UploadRequest_FileInfo& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UploadRequest_FileInfo* other);
+  void InternalSwap(ListingCacheFile_Listing* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.UploadRequest.FileInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.ListingCacheFile.Listing";
   }
+  protected:
+  explicit ListingCacheFile_Listing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string file_name = 1;
-  void clear_file_name();
-  static const int kFileNameFieldNumber = 1;
-  const std::string& file_name() const;
-  void set_file_name(const std::string& value);
-  void set_file_name(std::string&& value);
-  void set_file_name(const char* value);
-  void set_file_name(const char* value, size_t size);
-  std::string* mutable_file_name();
-  std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
-
-  // string target_path = 2;
-  void clear_target_path();
-  static const int kTargetPathFieldNumber = 2;
-  const std::string& target_path() const;
-  void set_target_path(const std::string& value);
-  void set_target_path(std::string&& value);
-  void set_target_path(const char* value);
-  void set_target_path(const char* value, size_t size);
-  std::string* mutable_target_path();
-  std::string* release_target_path();
-  void set_allocated_target_path(std::string* target_path);
-
-  // string md5 = 4;
-  void clear_md5();
-  static const int kMd5FieldNumber = 4;
-  const std::string& md5() const;
-  void set_md5(const std::string& value);
-  void set_md5(std::string&& value);
-  void set_md5(const char* value);
-  void set_md5(const char* value, size_t size);
-  std::string* mutable_md5();
-  std::string* release_md5();
-  void set_allocated_md5(std::string* md5);
-
-  // bytes data = 8;
-  void clear_data();
-  static const int kDataFieldNumber = 8;
-  const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  std::string* mutable_data();
-  std::string* release_data();
-  void set_allocated_data(std::string* data);
-
-  // string task_id = 10;
-  void clear_task_id();
-  static const int kTaskIdFieldNumber = 10;
-  const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
-  std::string* mutable_task_id();
-  std::string* release_task_id();
-  void set_allocated_task_id(std::string* task_id);
-
-  // string upload_id = 13;
-  void clear_upload_id();
-  static const int kUploadIdFieldNumber = 13;
-  const std::string& upload_id() const;
-  void set_upload_id(const std::string& value);
-  void set_upload_id(std::string&& value);
-  void set_upload_id(const char* value);
-  void set_upload_id(const char* value, size_t size);
-  std::string* mutable_upload_id();
-  std::string* release_upload_id();
-  void set_allocated_upload_id(std::string* upload_id);
-
-  // uint64 file_size = 3;
-  void clear_file_size();
-  static const int kFileSizeFieldNumber = 3;
-  ::PROTOBUF_NAMESPACE_ID::uint64 file_size() const;
-  void set_file_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-  // bool need_chunk = 5;
-  void clear_need_chunk();
-  static const int kNeedChunkFieldNumber = 5;
-  bool need_chunk() const;
-  void set_need_chunk(bool value);
-
-  // uint32 chunk_size = 6;
-  void clear_chunk_size();
-  static const int kChunkSizeFieldNumber = 6;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size() const;
-  void set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
-
-  // uint32 chunk_sequence = 7;
-  void clear_chunk_sequence();
-  static const int kChunkSequenceFieldNumber = 7;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_sequence() const;
-  void set_chunk_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value);
-
-  // uint32 checksum = 9;
-  void clear_checksum();
-  static const int kChecksumFieldNumber = 9;
-  ::PROTOBUF_NAMESPACE_ID::uint32 checksum() const;
-  void set_checksum(::PROTOBUF_NAMESPACE_ID::uint32 value);
-
-  // uint64 offset = 12;
-  void clear_offset();
-  static const int kOffsetFieldNumber = 12;
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset() const;
-  void set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-  // .transfer.TransferStatus status = 11;
-  void clear_status();
-  static const int kStatusFieldNumber = 11;
-  ::transfer::TransferStatus status() const;
-  void set_status(::transfer::TransferStatus value);
+  enum : int {
+    kResponseFieldNumber = 1,
+    kStoredAtFieldNumber = 2,
+  };
+  // .transfer.DirectoryResponse response = 1;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::transfer::DirectoryResponse& response() const;
+  PROTOBUF_NODISCARD ::transfer::DirectoryResponse* release_response();
+  ::transfer::DirectoryResponse* mutable_response();
+  void set_allocated_response(::transfer::DirectoryResponse* response);
+  private:
+  const ::transfer::DirectoryResponse& _internal_response() const;
+  ::transfer::DirectoryResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::transfer::DirectoryResponse* response);
+  ::transfer::DirectoryResponse* unsafe_arena_release_response();
+
+  // uint64 stored_at = 2;
+  void clear_stored_at();
+  uint64_t stored_at() const;
+  void set_stored_at(uint64_t value);
+  private:
+  uint64_t _internal_stored_at() const;
+  void _internal_set_stored_at(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.UploadRequest.FileInfo)
+  // @@protoc_insertion_point(class_scope:transfer.ListingCacheFile.Listing)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr md5_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 file_size_;
-  bool need_chunk_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_sequence_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 checksum_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset_;
-  int status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::transfer::DirectoryResponse* response_;
+    uint64_t stored_at_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UploadRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadRequest) */ {
+class ListingCacheFile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ListingCacheFile) */ {
  public:
-  UploadRequest();
-  virtual ~UploadRequest();
+  inline ListingCacheFile() : ListingCacheFile(nullptr) {}
+  ~ListingCacheFile() override;
+  explicit PROTOBUF_CONSTEXPR ListingCacheFile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UploadRequest(const UploadRequest& from);
-  UploadRequest(UploadRequest&& from) noexcept
-    : UploadRequest() {
+  ListingCacheFile(const ListingCacheFile& from);
+  ListingCacheFile(ListingCacheFile&& from) noexcept
+    : ListingCacheFile() {
     *this = ::std::move(from);
   }
 
-  inline UploadRequest& operator=(const UploadRequest& from) {
+  inline ListingCacheFile& operator=(const ListingCacheFile& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ListingCacheFile& operator=(ListingCacheFile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1339,140 +2110,198 @@ class UploadRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UploadRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadRequest* internal_default_instance() {
-    return reinterpret_cast<const UploadRequest*>(
-               &_UploadRequest_default_instance_);
+  static const ListingCacheFile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListingCacheFile* internal_default_instance() {
+    return reinterpret_cast<const ListingCacheFile*>(
+               &_ListingCacheFile_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  void Swap(UploadRequest* other);
-  friend void swap(UploadRequest& a, UploadRequest& b) {
+  friend void swap(ListingCacheFile& a, ListingCacheFile& b) {
     a.Swap(&b);
   }
+  inline void Swap(ListingCacheFile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListingCacheFile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UploadRequest* New() const final {
-    return CreateMaybeMessage<UploadRequest>(nullptr);
+  ListingCacheFile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListingCacheFile>(arena);
   }
-
-  UploadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UploadRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListingCacheFile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListingCacheFile& from) {
+    ListingCacheFile::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UploadRequest& from);
-  void MergeFrom(const UploadRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UploadRequest* other);
+  void InternalSwap(ListingCacheFile* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.UploadRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.ListingCacheFile";
   }
+  protected:
+  explicit ListingCacheFile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef UploadRequest_FileInfo FileInfo;
+  typedef ListingCacheFile_Listing Listing;
 
   // accessors -------------------------------------------------------
 
-  // repeated .transfer.UploadRequest.FileInfo files = 2;
-  int files_size() const;
-  void clear_files();
-  static const int kFilesFieldNumber = 2;
-  ::transfer::UploadRequest_FileInfo* mutable_files(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >*
-      mutable_files();
-  const ::transfer::UploadRequest_FileInfo& files(int index) const;
-  ::transfer::UploadRequest_FileInfo* add_files();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >&
-      files() const;
+  enum : int {
+    kListingsFieldNumber = 4,
+    kServerFieldNumber = 2,
+    kHomePathFieldNumber = 3,
+    kVersionFieldNumber = 1,
+  };
+  // repeated .transfer.ListingCacheFile.Listing listings = 4;
+  int listings_size() const;
+  private:
+  int _internal_listings_size() const;
+  public:
+  void clear_listings();
+  ::transfer::ListingCacheFile_Listing* mutable_listings(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::ListingCacheFile_Listing >*
+      mutable_listings();
+  private:
+  const ::transfer::ListingCacheFile_Listing& _internal_listings(int index) const;
+  ::transfer::ListingCacheFile_Listing* _internal_add_listings();
+  public:
+  const ::transfer::ListingCacheFile_Listing& listings(int index) const;
+  ::transfer::ListingCacheFile_Listing* add_listings();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::ListingCacheFile_Listing >&
+      listings() const;
+
+  // string server = 2;
+  void clear_server();
+  const std::string& server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server();
+  PROTOBUF_NODISCARD std::string* release_server();
+  void set_allocated_server(std::string* server);
+  private:
+  const std::string& _internal_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server(const std::string& value);
+  std::string* _internal_mutable_server();
+  public:
 
-  // .transfer.RequestHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::RequestHeader& header() const;
-  ::transfer::RequestHeader* release_header();
-  ::transfer::RequestHeader* mutable_header();
-  void set_allocated_header(::transfer::RequestHeader* header);
+  // string home_path = 3;
+  void clear_home_path();
+  const std::string& home_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_home_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_home_path();
+  PROTOBUF_NODISCARD std::string* release_home_path();
+  void set_allocated_home_path(std::string* home_path);
+  private:
+  const std::string& _internal_home_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_home_path(const std::string& value);
+  std::string* _internal_mutable_home_path();
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.UploadRequest)
- private:
-  class HasBitSetters;
+  // uint32 version = 1;
+  void clear_version();
+  uint32_t version() const;
+  void set_version(uint32_t value);
+  private:
+  uint32_t _internal_version() const;
+  void _internal_set_version(uint32_t value);
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo > files_;
-  ::transfer::RequestHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  // @@protoc_insertion_point(class_scope:transfer.ListingCacheFile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::ListingCacheFile_Listing > listings_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr home_path_;
+    uint32_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UploadResponse_FileResult :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadResponse.FileResult) */ {
+class MakeDirectoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.MakeDirectoryRequest) */ {
  public:
-  UploadResponse_FileResult();
-  virtual ~UploadResponse_FileResult();
+  inline MakeDirectoryRequest() : MakeDirectoryRequest(nullptr) {}
+  ~MakeDirectoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR MakeDirectoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UploadResponse_FileResult(const UploadResponse_FileResult& from);
-  UploadResponse_FileResult(UploadResponse_FileResult&& from) noexcept
-    : UploadResponse_FileResult() {
+  MakeDirectoryRequest(const MakeDirectoryRequest& from);
+  MakeDirectoryRequest(MakeDirectoryRequest&& from) noexcept
+    : MakeDirectoryRequest() {
     *this = ::std::move(from);
   }
 
-  inline UploadResponse_FileResult& operator=(const UploadResponse_FileResult& from) {
+  inline MakeDirectoryRequest& operator=(const MakeDirectoryRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UploadResponse_FileResult& operator=(UploadResponse_FileResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline MakeDirectoryRequest& operator=(MakeDirectoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1483,175 +2312,195 @@ class UploadResponse_FileResult :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UploadResponse_FileResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadResponse_FileResult* internal_default_instance() {
-    return reinterpret_cast<const UploadResponse_FileResult*>(
-               &_UploadResponse_FileResult_default_instance_);
+  static const MakeDirectoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MakeDirectoryRequest* internal_default_instance() {
+    return reinterpret_cast<const MakeDirectoryRequest*>(
+               &_MakeDirectoryRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  void Swap(UploadResponse_FileResult* other);
-  friend void swap(UploadResponse_FileResult& a, UploadResponse_FileResult& b) {
+  friend void swap(MakeDirectoryRequest& a, MakeDirectoryRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(MakeDirectoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MakeDirectoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UploadResponse_FileResult* New() const final {
-    return CreateMaybeMessage<UploadResponse_FileResult>(nullptr);
+  MakeDirectoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MakeDirectoryRequest>(arena);
   }
-
-  UploadResponse_FileResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UploadResponse_FileResult>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MakeDirectoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MakeDirectoryRequest& from) {
+    MakeDirectoryRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UploadResponse_FileResult& from);
-  void MergeFrom(const UploadResponse_FileResult& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UploadResponse_FileResult* other);
+  void InternalSwap(MakeDirectoryRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.UploadResponse.FileResult";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.MakeDirectoryRequest";
   }
+  protected:
+  explicit MakeDirectoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string file_name = 1;
-  void clear_file_name();
-  static const int kFileNameFieldNumber = 1;
-  const std::string& file_name() const;
-  void set_file_name(const std::string& value);
-  void set_file_name(std::string&& value);
-  void set_file_name(const char* value);
-  void set_file_name(const char* value, size_t size);
-  std::string* mutable_file_name();
-  std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
-
-  // string target_path = 2;
-  void clear_target_path();
-  static const int kTargetPathFieldNumber = 2;
-  const std::string& target_path() const;
-  void set_target_path(const std::string& value);
-  void set_target_path(std::string&& value);
-  void set_target_path(const char* value);
-  void set_target_path(const char* value, size_t size);
-  std::string* mutable_target_path();
-  std::string* release_target_path();
-  void set_allocated_target_path(std::string* target_path);
-
-  // string error_message = 6;
-  void clear_error_message();
-  static const int kErrorMessageFieldNumber = 6;
-  const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  std::string* mutable_error_message();
-  std::string* release_error_message();
-  void set_allocated_error_message(std::string* error_message);
-
-  // bool success = 3;
-  void clear_success();
-  static const int kSuccessFieldNumber = 3;
-  bool success() const;
-  void set_success(bool value);
+  enum : int {
+    kPathsFieldNumber = 3,
+    kBasePathFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated string paths = 3;
+  int paths_size() const;
+  private:
+  int _internal_paths_size() const;
+  public:
+  void clear_paths();
+  const std::string& paths(int index) const;
+  std::string* mutable_paths(int index);
+  void set_paths(int index, const std::string& value);
+  void set_paths(int index, std::string&& value);
+  void set_paths(int index, const char* value);
+  void set_paths(int index, const char* value, size_t size);
+  std::string* add_paths();
+  void add_paths(const std::string& value);
+  void add_paths(std::string&& value);
+  void add_paths(const char* value);
+  void add_paths(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& paths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_paths();
+  private:
+  const std::string& _internal_paths(int index) const;
+  std::string* _internal_add_paths();
+  public:
 
-  // bool need_chunk = 4;
-  void clear_need_chunk();
-  static const int kNeedChunkFieldNumber = 4;
-  bool need_chunk() const;
-  void set_need_chunk(bool value);
+  // string base_path = 2;
+  void clear_base_path();
+  const std::string& base_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_base_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_base_path();
+  PROTOBUF_NODISCARD std::string* release_base_path();
+  void set_allocated_base_path(std::string* base_path);
+  private:
+  const std::string& _internal_base_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_base_path(const std::string& value);
+  std::string* _internal_mutable_base_path();
+  public:
 
-  // int32 next_sequence = 5;
-  void clear_next_sequence();
-  static const int kNextSequenceFieldNumber = 5;
-  ::PROTOBUF_NAMESPACE_ID::int32 next_sequence() const;
-  void set_next_sequence(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
 
-  // @@protoc_insertion_point(class_scope:transfer.UploadResponse.FileResult)
+  // @@protoc_insertion_point(class_scope:transfer.MakeDirectoryRequest)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  bool success_;
-  bool need_chunk_;
-  ::PROTOBUF_NAMESPACE_ID::int32 next_sequence_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> paths_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr base_path_;
+    ::transfer::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UploadResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadResponse) */ {
+class MakeDirectoryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.MakeDirectoryResponse) */ {
  public:
-  UploadResponse();
-  virtual ~UploadResponse();
+  inline MakeDirectoryResponse() : MakeDirectoryResponse(nullptr) {}
+  ~MakeDirectoryResponse() override;
+  explicit PROTOBUF_CONSTEXPR MakeDirectoryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UploadResponse(const UploadResponse& from);
-  UploadResponse(UploadResponse&& from) noexcept
-    : UploadResponse() {
+  MakeDirectoryResponse(const MakeDirectoryResponse& from);
+  MakeDirectoryResponse(MakeDirectoryResponse&& from) noexcept
+    : MakeDirectoryResponse() {
     *this = ::std::move(from);
   }
 
-  inline UploadResponse& operator=(const UploadResponse& from) {
+  inline MakeDirectoryResponse& operator=(const MakeDirectoryResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UploadResponse& operator=(UploadResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline MakeDirectoryResponse& operator=(MakeDirectoryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1662,140 +2511,205 @@ class UploadResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UploadResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UploadResponse* internal_default_instance() {
-    return reinterpret_cast<const UploadResponse*>(
-               &_UploadResponse_default_instance_);
+  static const MakeDirectoryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MakeDirectoryResponse* internal_default_instance() {
+    return reinterpret_cast<const MakeDirectoryResponse*>(
+               &_MakeDirectoryResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  void Swap(UploadResponse* other);
-  friend void swap(UploadResponse& a, UploadResponse& b) {
+  friend void swap(MakeDirectoryResponse& a, MakeDirectoryResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(MakeDirectoryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MakeDirectoryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline UploadResponse* New() const final {
-    return CreateMaybeMessage<UploadResponse>(nullptr);
+  MakeDirectoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MakeDirectoryResponse>(arena);
   }
-
-  UploadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UploadResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MakeDirectoryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MakeDirectoryResponse& from) {
+    MakeDirectoryResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UploadResponse& from);
-  void MergeFrom(const UploadResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UploadResponse* other);
+  void InternalSwap(MakeDirectoryResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.UploadResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.MakeDirectoryResponse";
   }
+  protected:
+  explicit MakeDirectoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef UploadResponse_FileResult FileResult;
-
   // accessors -------------------------------------------------------
 
-  // repeated .transfer.UploadResponse.FileResult results = 2;
-  int results_size() const;
-  void clear_results();
-  static const int kResultsFieldNumber = 2;
-  ::transfer::UploadResponse_FileResult* mutable_results(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >*
-      mutable_results();
-  const ::transfer::UploadResponse_FileResult& results(int index) const;
-  ::transfer::UploadResponse_FileResult* add_results();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >&
-      results() const;
+  enum : int {
+    kFailedPathsFieldNumber = 2,
+    kErrorsFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated string failed_paths = 2;
+  int failed_paths_size() const;
+  private:
+  int _internal_failed_paths_size() const;
+  public:
+  void clear_failed_paths();
+  const std::string& failed_paths(int index) const;
+  std::string* mutable_failed_paths(int index);
+  void set_failed_paths(int index, const std::string& value);
+  void set_failed_paths(int index, std::string&& value);
+  void set_failed_paths(int index, const char* value);
+  void set_failed_paths(int index, const char* value, size_t size);
+  std::string* add_failed_paths();
+  void add_failed_paths(const std::string& value);
+  void add_failed_paths(std::string&& value);
+  void add_failed_paths(const char* value);
+  void add_failed_paths(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& failed_paths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_failed_paths();
+  private:
+  const std::string& _internal_failed_paths(int index) const;
+  std::string* _internal_add_failed_paths();
+  public:
+
+  // repeated string errors = 3;
+  int errors_size() const;
+  private:
+  int _internal_errors_size() const;
+  public:
+  void clear_errors();
+  const std::string& errors(int index) const;
+  std::string* mutable_errors(int index);
+  void set_errors(int index, const std::string& value);
+  void set_errors(int index, std::string&& value);
+  void set_errors(int index, const char* value);
+  void set_errors(int index, const char* value, size_t size);
+  std::string* add_errors();
+  void add_errors(const std::string& value);
+  void add_errors(std::string&& value);
+  void add_errors(const char* value);
+  void add_errors(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& errors() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_errors();
+  private:
+  const std::string& _internal_errors(int index) const;
+  std::string* _internal_add_errors();
+  public:
 
   // .transfer.ResponseHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
   const ::transfer::ResponseHeader& header() const;
-  ::transfer::ResponseHeader* release_header();
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
   ::transfer::ResponseHeader* mutable_header();
   void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
 
-  // @@protoc_insertion_point(class_scope:transfer.UploadResponse)
+  // @@protoc_insertion_point(class_scope:transfer.MakeDirectoryResponse)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult > results_;
-  ::transfer::ResponseHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> failed_paths_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> errors_;
+    ::transfer::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DownloadRequest_FileInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadRequest.FileInfo) */ {
+class TreeListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TreeListRequest) */ {
  public:
-  DownloadRequest_FileInfo();
-  virtual ~DownloadRequest_FileInfo();
+  inline TreeListRequest() : TreeListRequest(nullptr) {}
+  ~TreeListRequest() override;
+  explicit PROTOBUF_CONSTEXPR TreeListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DownloadRequest_FileInfo(const DownloadRequest_FileInfo& from);
-  DownloadRequest_FileInfo(DownloadRequest_FileInfo&& from) noexcept
-    : DownloadRequest_FileInfo() {
+  TreeListRequest(const TreeListRequest& from);
+  TreeListRequest(TreeListRequest&& from) noexcept
+    : TreeListRequest() {
     *this = ::std::move(from);
   }
 
-  inline DownloadRequest_FileInfo& operator=(const DownloadRequest_FileInfo& from) {
+  inline TreeListRequest& operator=(const TreeListRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DownloadRequest_FileInfo& operator=(DownloadRequest_FileInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline TreeListRequest& operator=(TreeListRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1806,168 +2720,196 @@ class DownloadRequest_FileInfo :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const DownloadRequest_FileInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadRequest_FileInfo* internal_default_instance() {
-    return reinterpret_cast<const DownloadRequest_FileInfo*>(
-               &_DownloadRequest_FileInfo_default_instance_);
+  static const TreeListRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TreeListRequest* internal_default_instance() {
+    return reinterpret_cast<const TreeListRequest*>(
+               &_TreeListRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  void Swap(DownloadRequest_FileInfo* other);
-  friend void swap(DownloadRequest_FileInfo& a, DownloadRequest_FileInfo& b) {
+  friend void swap(TreeListRequest& a, TreeListRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(TreeListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TreeListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadRequest_FileInfo* New() const final {
-    return CreateMaybeMessage<DownloadRequest_FileInfo>(nullptr);
+  TreeListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TreeListRequest>(arena);
   }
-
-  DownloadRequest_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadRequest_FileInfo>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TreeListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TreeListRequest& from) {
+    TreeListRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const DownloadRequest_FileInfo& from);
-  void MergeFrom(const DownloadRequest_FileInfo& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DownloadRequest_FileInfo* other);
+  void InternalSwap(TreeListRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.DownloadRequest.FileInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.TreeListRequest";
   }
+  protected:
+  explicit TreeListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string file_name = 1;
-  void clear_file_name();
-  static const int kFileNameFieldNumber = 1;
-  const std::string& file_name() const;
-  void set_file_name(const std::string& value);
-  void set_file_name(std::string&& value);
-  void set_file_name(const char* value);
-  void set_file_name(const char* value, size_t size);
-  std::string* mutable_file_name();
-  std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
-
-  // string target_path = 2;
-  void clear_target_path();
-  static const int kTargetPathFieldNumber = 2;
-  const std::string& target_path() const;
-  void set_target_path(const std::string& value);
-  void set_target_path(std::string&& value);
-  void set_target_path(const char* value);
-  void set_target_path(const char* value, size_t size);
-  std::string* mutable_target_path();
-  std::string* release_target_path();
-  void set_allocated_target_path(std::string* target_path);
-
-  // string download_id = 5;
-  void clear_download_id();
-  static const int kDownloadIdFieldNumber = 5;
-  const std::string& download_id() const;
-  void set_download_id(const std::string& value);
-  void set_download_id(std::string&& value);
-  void set_download_id(const char* value);
-  void set_download_id(const char* value, size_t size);
-  std::string* mutable_download_id();
-  std::string* release_download_id();
-  void set_allocated_download_id(std::string* download_id);
+  enum : int {
+    kRootPathFieldNumber = 2,
+    kCursorFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kPageSizeFieldNumber = 4,
+  };
+  // string root_path = 2;
+  void clear_root_path();
+  const std::string& root_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_root_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_root_path();
+  PROTOBUF_NODISCARD std::string* release_root_path();
+  void set_allocated_root_path(std::string* root_path);
+  private:
+  const std::string& _internal_root_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_root_path(const std::string& value);
+  std::string* _internal_mutable_root_path();
+  public:
 
-  // uint64 offset = 4;
-  void clear_offset();
-  static const int kOffsetFieldNumber = 4;
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset() const;
-  void set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  // string cursor = 3;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
 
-  // uint32 chunk_size = 3;
-  void clear_chunk_size();
-  static const int kChunkSizeFieldNumber = 3;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size() const;
-  void set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 page_size = 4;
+  void clear_page_size();
+  uint32_t page_size() const;
+  void set_page_size(uint32_t value);
+  private:
+  uint32_t _internal_page_size() const;
+  void _internal_set_page_size(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.DownloadRequest.FileInfo)
+  // @@protoc_insertion_point(class_scope:transfer.TreeListRequest)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr download_id_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 offset_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr root_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::transfer::RequestHeader* header_;
+    uint32_t page_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DownloadRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadRequest) */ {
+class TreeListResponse_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TreeListResponse.Entry) */ {
  public:
-  DownloadRequest();
-  virtual ~DownloadRequest();
+  inline TreeListResponse_Entry() : TreeListResponse_Entry(nullptr) {}
+  ~TreeListResponse_Entry() override;
+  explicit PROTOBUF_CONSTEXPR TreeListResponse_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DownloadRequest(const DownloadRequest& from);
-  DownloadRequest(DownloadRequest&& from) noexcept
-    : DownloadRequest() {
+  TreeListResponse_Entry(const TreeListResponse_Entry& from);
+  TreeListResponse_Entry(TreeListResponse_Entry&& from) noexcept
+    : TreeListResponse_Entry() {
     *this = ::std::move(from);
   }
 
-  inline DownloadRequest& operator=(const DownloadRequest& from) {
+  inline TreeListResponse_Entry& operator=(const TreeListResponse_Entry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline TreeListResponse_Entry& operator=(TreeListResponse_Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1978,140 +2920,187 @@ class DownloadRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const DownloadRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadRequest* internal_default_instance() {
-    return reinterpret_cast<const DownloadRequest*>(
-               &_DownloadRequest_default_instance_);
+  static const TreeListResponse_Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TreeListResponse_Entry* internal_default_instance() {
+    return reinterpret_cast<const TreeListResponse_Entry*>(
+               &_TreeListResponse_Entry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
-  void Swap(DownloadRequest* other);
-  friend void swap(DownloadRequest& a, DownloadRequest& b) {
+  friend void swap(TreeListResponse_Entry& a, TreeListResponse_Entry& b) {
     a.Swap(&b);
   }
+  inline void Swap(TreeListResponse_Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TreeListResponse_Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadRequest* New() const final {
-    return CreateMaybeMessage<DownloadRequest>(nullptr);
+  TreeListResponse_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TreeListResponse_Entry>(arena);
   }
-
-  DownloadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TreeListResponse_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TreeListResponse_Entry& from) {
+    TreeListResponse_Entry::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const DownloadRequest& from);
-  void MergeFrom(const DownloadRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DownloadRequest* other);
+  void InternalSwap(TreeListResponse_Entry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.DownloadRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.TreeListResponse.Entry";
   }
+  protected:
+  explicit TreeListResponse_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef DownloadRequest_FileInfo FileInfo;
-
   // accessors -------------------------------------------------------
 
-  // repeated .transfer.DownloadRequest.FileInfo files = 2;
-  int files_size() const;
-  void clear_files();
-  static const int kFilesFieldNumber = 2;
-  ::transfer::DownloadRequest_FileInfo* mutable_files(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >*
-      mutable_files();
-  const ::transfer::DownloadRequest_FileInfo& files(int index) const;
-  ::transfer::DownloadRequest_FileInfo* add_files();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >&
-      files() const;
+  enum : int {
+    kRelativePathFieldNumber = 1,
+    kModifyTimeFieldNumber = 4,
+    kSizeFieldNumber = 3,
+    kIsDirectoryFieldNumber = 2,
+  };
+  // string relative_path = 1;
+  void clear_relative_path();
+  const std::string& relative_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_relative_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_relative_path();
+  PROTOBUF_NODISCARD std::string* release_relative_path();
+  void set_allocated_relative_path(std::string* relative_path);
+  private:
+  const std::string& _internal_relative_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_relative_path(const std::string& value);
+  std::string* _internal_mutable_relative_path();
+  public:
 
-  // .transfer.RequestHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::RequestHeader& header() const;
-  ::transfer::RequestHeader* release_header();
-  ::transfer::RequestHeader* mutable_header();
-  void set_allocated_header(::transfer::RequestHeader* header);
+  // string modify_time = 4;
+  void clear_modify_time();
+  const std::string& modify_time() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_modify_time(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_modify_time();
+  PROTOBUF_NODISCARD std::string* release_modify_time();
+  void set_allocated_modify_time(std::string* modify_time);
+  private:
+  const std::string& _internal_modify_time() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_modify_time(const std::string& value);
+  std::string* _internal_mutable_modify_time();
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.DownloadRequest)
- private:
-  class HasBitSetters;
+  // uint64 size = 3;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // bool is_directory = 2;
+  void clear_is_directory();
+  bool is_directory() const;
+  void set_is_directory(bool value);
+  private:
+  bool _internal_is_directory() const;
+  void _internal_set_is_directory(bool value);
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo > files_;
-  ::transfer::RequestHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  // @@protoc_insertion_point(class_scope:transfer.TreeListResponse.Entry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr relative_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modify_time_;
+    uint64_t size_;
+    bool is_directory_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DownloadResponse_FileResult :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadResponse.FileResult) */ {
+class TreeListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TreeListResponse) */ {
  public:
-  DownloadResponse_FileResult();
-  virtual ~DownloadResponse_FileResult();
+  inline TreeListResponse() : TreeListResponse(nullptr) {}
+  ~TreeListResponse() override;
+  explicit PROTOBUF_CONSTEXPR TreeListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DownloadResponse_FileResult(const DownloadResponse_FileResult& from);
-  DownloadResponse_FileResult(DownloadResponse_FileResult&& from) noexcept
-    : DownloadResponse_FileResult() {
+  TreeListResponse(const TreeListResponse& from);
+  TreeListResponse(TreeListResponse&& from) noexcept
+    : TreeListResponse() {
     *this = ::std::move(from);
   }
 
-  inline DownloadResponse_FileResult& operator=(const DownloadResponse_FileResult& from) {
+  inline TreeListResponse& operator=(const TreeListResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DownloadResponse_FileResult& operator=(DownloadResponse_FileResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline TreeListResponse& operator=(TreeListResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2122,229 +3111,202 @@ class DownloadResponse_FileResult :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const DownloadResponse_FileResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadResponse_FileResult* internal_default_instance() {
-    return reinterpret_cast<const DownloadResponse_FileResult*>(
-               &_DownloadResponse_FileResult_default_instance_);
+  static const TreeListResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TreeListResponse* internal_default_instance() {
+    return reinterpret_cast<const TreeListResponse*>(
+               &_TreeListResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  void Swap(DownloadResponse_FileResult* other);
-  friend void swap(DownloadResponse_FileResult& a, DownloadResponse_FileResult& b) {
+  friend void swap(TreeListResponse& a, TreeListResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(TreeListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TreeListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadResponse_FileResult* New() const final {
-    return CreateMaybeMessage<DownloadResponse_FileResult>(nullptr);
+  TreeListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TreeListResponse>(arena);
   }
-
-  DownloadResponse_FileResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadResponse_FileResult>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TreeListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TreeListResponse& from) {
+    TreeListResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const DownloadResponse_FileResult& from);
-  void MergeFrom(const DownloadResponse_FileResult& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DownloadResponse_FileResult* other);
+  void InternalSwap(TreeListResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.DownloadResponse.FileResult";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.TreeListResponse";
   }
+  protected:
+  explicit TreeListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  // accessors -------------------------------------------------------
-
-  // string file_name = 1;
-  void clear_file_name();
-  static const int kFileNameFieldNumber = 1;
-  const std::string& file_name() const;
-  void set_file_name(const std::string& value);
-  void set_file_name(std::string&& value);
-  void set_file_name(const char* value);
-  void set_file_name(const char* value, size_t size);
-  std::string* mutable_file_name();
-  std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
-
-  // string target_path = 2;
-  void clear_target_path();
-  static const int kTargetPathFieldNumber = 2;
-  const std::string& target_path() const;
-  void set_target_path(const std::string& value);
-  void set_target_path(std::string&& value);
-  void set_target_path(const char* value);
-  void set_target_path(const char* value, size_t size);
-  std::string* mutable_target_path();
-  std::string* release_target_path();
-  void set_allocated_target_path(std::string* target_path);
-
-  // string md5 = 5;
-  void clear_md5();
-  static const int kMd5FieldNumber = 5;
-  const std::string& md5() const;
-  void set_md5(const std::string& value);
-  void set_md5(std::string&& value);
-  void set_md5(const char* value);
-  void set_md5(const char* value, size_t size);
-  std::string* mutable_md5();
-  std::string* release_md5();
-  void set_allocated_md5(std::string* md5);
-
-  // bytes data = 9;
-  void clear_data();
-  static const int kDataFieldNumber = 9;
-  const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  std::string* mutable_data();
-  std::string* release_data();
-  void set_allocated_data(std::string* data);
-
-  // string error_message = 12;
-  void clear_error_message();
-  static const int kErrorMessageFieldNumber = 12;
-  const std::string& error_message() const;
-  void set_error_message(const std::string& value);
-  void set_error_message(std::string&& value);
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  std::string* mutable_error_message();
-  std::string* release_error_message();
-  void set_allocated_error_message(std::string* error_message);
-
-  // uint64 file_size = 4;
-  void clear_file_size();
-  static const int kFileSizeFieldNumber = 4;
-  ::PROTOBUF_NAMESPACE_ID::uint64 file_size() const;
-  void set_file_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-  // bool exists = 3;
-  void clear_exists();
-  static const int kExistsFieldNumber = 3;
-  bool exists() const;
-  void set_exists(bool value);
-
-  // bool need_chunk = 6;
-  void clear_need_chunk();
-  static const int kNeedChunkFieldNumber = 6;
-  bool need_chunk() const;
-  void set_need_chunk(bool value);
-
-  // bool is_last = 11;
-  void clear_is_last();
-  static const int kIsLastFieldNumber = 11;
-  bool is_last() const;
-  void set_is_last(bool value);
+  typedef TreeListResponse_Entry Entry;
 
-  // uint32 chunk_size = 7;
-  void clear_chunk_size();
-  static const int kChunkSizeFieldNumber = 7;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size() const;
-  void set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  // accessors -------------------------------------------------------
 
-  // uint32 chunk_sequence = 8;
-  void clear_chunk_sequence();
-  static const int kChunkSequenceFieldNumber = 8;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_sequence() const;
-  void set_chunk_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kNextCursorFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kHasMoreFieldNumber = 4,
+  };
+  // repeated .transfer.TreeListResponse.Entry entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::transfer::TreeListResponse_Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::TreeListResponse_Entry >*
+      mutable_entries();
+  private:
+  const ::transfer::TreeListResponse_Entry& _internal_entries(int index) const;
+  ::transfer::TreeListResponse_Entry* _internal_add_entries();
+  public:
+  const ::transfer::TreeListResponse_Entry& entries(int index) const;
+  ::transfer::TreeListResponse_Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::TreeListResponse_Entry >&
+      entries() const;
+
+  // string next_cursor = 3;
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
 
-  // uint32 checksum = 10;
-  void clear_checksum();
-  static const int kChecksumFieldNumber = 10;
-  ::PROTOBUF_NAMESPACE_ID::uint32 checksum() const;
-  void set_checksum(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // bool has_more = 4;
+  void clear_has_more();
+  bool has_more() const;
+  void set_has_more(bool value);
+  private:
+  bool _internal_has_more() const;
+  void _internal_set_has_more(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.DownloadResponse.FileResult)
+  // @@protoc_insertion_point(class_scope:transfer.TreeListResponse)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr md5_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 file_size_;
-  bool exists_;
-  bool need_chunk_;
-  bool is_last_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 chunk_sequence_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 checksum_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::TreeListResponse_Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
+    ::transfer::ResponseHeader* header_;
+    bool has_more_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DownloadResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadResponse) */ {
+class ArchiveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ArchiveRequest) */ {
  public:
-  DownloadResponse();
-  virtual ~DownloadResponse();
+  inline ArchiveRequest() : ArchiveRequest(nullptr) {}
+  ~ArchiveRequest() override;
+  explicit PROTOBUF_CONSTEXPR ArchiveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DownloadResponse(const DownloadResponse& from);
-  DownloadResponse(DownloadResponse&& from) noexcept
-    : DownloadResponse() {
+  ArchiveRequest(const ArchiveRequest& from);
+  ArchiveRequest(ArchiveRequest&& from) noexcept
+    : ArchiveRequest() {
     *this = ::std::move(from);
   }
 
-  inline DownloadResponse& operator=(const DownloadResponse& from) {
+  inline ArchiveRequest& operator=(const ArchiveRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DownloadResponse& operator=(DownloadResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ArchiveRequest& operator=(ArchiveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2355,140 +3317,275 @@ class DownloadResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const DownloadResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const DownloadResponse* internal_default_instance() {
-    return reinterpret_cast<const DownloadResponse*>(
-               &_DownloadResponse_default_instance_);
+  static const ArchiveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ArchiveRequest* internal_default_instance() {
+    return reinterpret_cast<const ArchiveRequest*>(
+               &_ArchiveRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  void Swap(DownloadResponse* other);
-  friend void swap(DownloadResponse& a, DownloadResponse& b) {
+  friend void swap(ArchiveRequest& a, ArchiveRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(ArchiveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArchiveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline DownloadResponse* New() const final {
-    return CreateMaybeMessage<DownloadResponse>(nullptr);
+  ArchiveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ArchiveRequest>(arena);
   }
-
-  DownloadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<DownloadResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ArchiveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ArchiveRequest& from) {
+    ArchiveRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const DownloadResponse& from);
-  void MergeFrom(const DownloadResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DownloadResponse* other);
+  void InternalSwap(ArchiveRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.DownloadResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.ArchiveRequest";
   }
+  protected:
+  explicit ArchiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef DownloadResponse_FileResult FileResult;
+  typedef ArchiveRequest_Direction Direction;
+  static constexpr Direction PUSH =
+    ArchiveRequest_Direction_PUSH;
+  static constexpr Direction PULL =
+    ArchiveRequest_Direction_PULL;
+  static inline bool Direction_IsValid(int value) {
+    return ArchiveRequest_Direction_IsValid(value);
+  }
+  static constexpr Direction Direction_MIN =
+    ArchiveRequest_Direction_Direction_MIN;
+  static constexpr Direction Direction_MAX =
+    ArchiveRequest_Direction_Direction_MAX;
+  static constexpr int Direction_ARRAYSIZE =
+    ArchiveRequest_Direction_Direction_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Direction_descriptor() {
+    return ArchiveRequest_Direction_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Direction_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Direction>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Direction_Name.");
+    return ArchiveRequest_Direction_Name(enum_t_value);
+  }
+  static inline bool Direction_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Direction* value) {
+    return ArchiveRequest_Direction_Parse(name, value);
+  }
 
   // accessors -------------------------------------------------------
 
-  // repeated .transfer.DownloadResponse.FileResult results = 2;
-  int results_size() const;
-  void clear_results();
-  static const int kResultsFieldNumber = 2;
-  ::transfer::DownloadResponse_FileResult* mutable_results(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >*
-      mutable_results();
-  const ::transfer::DownloadResponse_FileResult& results(int index) const;
-  ::transfer::DownloadResponse_FileResult* add_results();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >&
-      results() const;
+  enum : int {
+    kArchiveIdFieldNumber = 3,
+    kBasePathFieldNumber = 4,
+    kDataFieldNumber = 7,
+    kHeaderFieldNumber = 1,
+    kDirectionFieldNumber = 2,
+    kCompressionFieldNumber = 5,
+    kBlockSequenceFieldNumber = 6,
+    kIsLastFieldNumber = 8,
+  };
+  // string archive_id = 3;
+  void clear_archive_id();
+  const std::string& archive_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_archive_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_archive_id();
+  PROTOBUF_NODISCARD std::string* release_archive_id();
+  void set_allocated_archive_id(std::string* archive_id);
+  private:
+  const std::string& _internal_archive_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_archive_id(const std::string& value);
+  std::string* _internal_mutable_archive_id();
+  public:
 
-  // .transfer.ResponseHeader header = 1;
+  // string base_path = 4;
+  void clear_base_path();
+  const std::string& base_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_base_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_base_path();
+  PROTOBUF_NODISCARD std::string* release_base_path();
+  void set_allocated_base_path(std::string* base_path);
+  private:
+  const std::string& _internal_base_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_base_path(const std::string& value);
+  std::string* _internal_mutable_base_path();
+  public:
+
+  // bytes data = 7;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // .transfer.RequestHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::ResponseHeader& header() const;
-  ::transfer::ResponseHeader* release_header();
-  ::transfer::ResponseHeader* mutable_header();
-  void set_allocated_header(::transfer::ResponseHeader* header);
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // .transfer.ArchiveRequest.Direction direction = 2;
+  void clear_direction();
+  ::transfer::ArchiveRequest_Direction direction() const;
+  void set_direction(::transfer::ArchiveRequest_Direction value);
+  private:
+  ::transfer::ArchiveRequest_Direction _internal_direction() const;
+  void _internal_set_direction(::transfer::ArchiveRequest_Direction value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.DownloadResponse)
- private:
-  class HasBitSetters;
+  // uint32 compression = 5;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
+
+  // uint64 block_sequence = 6;
+  void clear_block_sequence();
+  uint64_t block_sequence() const;
+  void set_block_sequence(uint64_t value);
+  private:
+  uint64_t _internal_block_sequence() const;
+  void _internal_set_block_sequence(uint64_t value);
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult > results_;
-  ::transfer::ResponseHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  // bool is_last = 8;
+  void clear_is_last();
+  bool is_last() const;
+  void set_is_last(bool value);
+  private:
+  bool _internal_is_last() const;
+  void _internal_set_is_last(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.ArchiveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr archive_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr base_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::transfer::RequestHeader* header_;
+    int direction_;
+    uint32_t compression_;
+    uint64_t block_sequence_;
+    bool is_last_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransferControlRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferControlRequest) */ {
+class ArchiveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ArchiveResponse) */ {
  public:
-  TransferControlRequest();
-  virtual ~TransferControlRequest();
+  inline ArchiveResponse() : ArchiveResponse(nullptr) {}
+  ~ArchiveResponse() override;
+  explicit PROTOBUF_CONSTEXPR ArchiveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TransferControlRequest(const TransferControlRequest& from);
-  TransferControlRequest(TransferControlRequest&& from) noexcept
-    : TransferControlRequest() {
+  ArchiveResponse(const ArchiveResponse& from);
+  ArchiveResponse(ArchiveResponse&& from) noexcept
+    : ArchiveResponse() {
     *this = ::std::move(from);
   }
 
-  inline TransferControlRequest& operator=(const TransferControlRequest& from) {
+  inline ArchiveResponse& operator=(const ArchiveResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TransferControlRequest& operator=(TransferControlRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ArchiveResponse& operator=(ArchiveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2499,177 +3596,240 @@ class TransferControlRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TransferControlRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TransferControlRequest* internal_default_instance() {
-    return reinterpret_cast<const TransferControlRequest*>(
-               &_TransferControlRequest_default_instance_);
+  static const ArchiveResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ArchiveResponse* internal_default_instance() {
+    return reinterpret_cast<const ArchiveResponse*>(
+               &_ArchiveResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
-  void Swap(TransferControlRequest* other);
-  friend void swap(TransferControlRequest& a, TransferControlRequest& b) {
+  friend void swap(ArchiveResponse& a, ArchiveResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(ArchiveResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArchiveResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TransferControlRequest* New() const final {
-    return CreateMaybeMessage<TransferControlRequest>(nullptr);
+  ArchiveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ArchiveResponse>(arena);
   }
-
-  TransferControlRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TransferControlRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ArchiveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ArchiveResponse& from) {
+    ArchiveResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TransferControlRequest& from);
-  void MergeFrom(const TransferControlRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TransferControlRequest* other);
+  void InternalSwap(ArchiveResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.TransferControlRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.ArchiveResponse";
   }
+  protected:
+  explicit ArchiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef TransferControlRequest_ControlType ControlType;
-  static constexpr ControlType PAUSE =
-    TransferControlRequest_ControlType_PAUSE;
-  static constexpr ControlType RESUME =
-    TransferControlRequest_ControlType_RESUME;
-  static constexpr ControlType CANCEL =
-    TransferControlRequest_ControlType_CANCEL;
-  static inline bool ControlType_IsValid(int value) {
-    return TransferControlRequest_ControlType_IsValid(value);
-  }
-  static constexpr ControlType ControlType_MIN =
-    TransferControlRequest_ControlType_ControlType_MIN;
-  static constexpr ControlType ControlType_MAX =
-    TransferControlRequest_ControlType_ControlType_MAX;
-  static constexpr int ControlType_ARRAYSIZE =
-    TransferControlRequest_ControlType_ControlType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  ControlType_descriptor() {
-    return TransferControlRequest_ControlType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& ControlType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, ControlType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function ControlType_Name.");
-    return TransferControlRequest_ControlType_Name(enum_t_value);
-  }
-  static inline bool ControlType_Parse(const std::string& name,
-      ControlType* value) {
-    return TransferControlRequest_ControlType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  // string task_id = 2;
-  void clear_task_id();
-  static const int kTaskIdFieldNumber = 2;
-  const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
-  std::string* mutable_task_id();
-  std::string* release_task_id();
-  void set_allocated_task_id(std::string* task_id);
+  enum : int {
+    kArchiveIdFieldNumber = 2,
+    kDataFieldNumber = 5,
+    kHeaderFieldNumber = 1,
+    kBlockSequenceFieldNumber = 3,
+    kCompressionFieldNumber = 4,
+    kIsLastFieldNumber = 6,
+    kTotalSizeFieldNumber = 7,
+    kTotalFilesFieldNumber = 8,
+  };
+  // string archive_id = 2;
+  void clear_archive_id();
+  const std::string& archive_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_archive_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_archive_id();
+  PROTOBUF_NODISCARD std::string* release_archive_id();
+  void set_allocated_archive_id(std::string* archive_id);
+  private:
+  const std::string& _internal_archive_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_archive_id(const std::string& value);
+  std::string* _internal_mutable_archive_id();
+  public:
 
-  // .transfer.RequestHeader header = 1;
+  // bytes data = 5;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // .transfer.ResponseHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::RequestHeader& header() const;
-  ::transfer::RequestHeader* release_header();
-  ::transfer::RequestHeader* mutable_header();
-  void set_allocated_header(::transfer::RequestHeader* header);
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 block_sequence = 3;
+  void clear_block_sequence();
+  uint64_t block_sequence() const;
+  void set_block_sequence(uint64_t value);
+  private:
+  uint64_t _internal_block_sequence() const;
+  void _internal_set_block_sequence(uint64_t value);
+  public:
 
-  // .transfer.TransferControlRequest.ControlType control_type = 3;
-  void clear_control_type();
-  static const int kControlTypeFieldNumber = 3;
-  ::transfer::TransferControlRequest_ControlType control_type() const;
-  void set_control_type(::transfer::TransferControlRequest_ControlType value);
+  // uint32 compression = 4;
+  void clear_compression();
+  uint32_t compression() const;
+  void set_compression(uint32_t value);
+  private:
+  uint32_t _internal_compression() const;
+  void _internal_set_compression(uint32_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.TransferControlRequest)
- private:
-  class HasBitSetters;
+  // bool is_last = 6;
+  void clear_is_last();
+  bool is_last() const;
+  void set_is_last(bool value);
+  private:
+  bool _internal_is_last() const;
+  void _internal_set_is_last(bool value);
+  public:
+
+  // uint64 total_size = 7;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::transfer::RequestHeader* header_;
-  int control_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  // uint64 total_files = 8;
+  void clear_total_files();
+  uint64_t total_files() const;
+  void set_total_files(uint64_t value);
+  private:
+  uint64_t _internal_total_files() const;
+  void _internal_set_total_files(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.ArchiveResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr archive_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::transfer::ResponseHeader* header_;
+    uint64_t block_sequence_;
+    uint32_t compression_;
+    bool is_last_;
+    uint64_t total_size_;
+    uint64_t total_files_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransferControlResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferControlResponse) */ {
+class SearchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.SearchRequest) */ {
  public:
-  TransferControlResponse();
-  virtual ~TransferControlResponse();
+  inline SearchRequest() : SearchRequest(nullptr) {}
+  ~SearchRequest() override;
+  explicit PROTOBUF_CONSTEXPR SearchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TransferControlResponse(const TransferControlResponse& from);
-  TransferControlResponse(TransferControlResponse&& from) noexcept
-    : TransferControlResponse() {
+  SearchRequest(const SearchRequest& from);
+  SearchRequest(SearchRequest&& from) noexcept
+    : SearchRequest() {
     *this = ::std::move(from);
   }
 
-  inline TransferControlResponse& operator=(const TransferControlResponse& from) {
+  inline SearchRequest& operator=(const SearchRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TransferControlResponse& operator=(TransferControlResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline SearchRequest& operator=(SearchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2680,152 +3840,341 @@ class TransferControlResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TransferControlResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TransferControlResponse* internal_default_instance() {
-    return reinterpret_cast<const TransferControlResponse*>(
-               &_TransferControlResponse_default_instance_);
+  static const SearchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchRequest* internal_default_instance() {
+    return reinterpret_cast<const SearchRequest*>(
+               &_SearchRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
-  void Swap(TransferControlResponse* other);
-  friend void swap(TransferControlResponse& a, TransferControlResponse& b) {
+  friend void swap(SearchRequest& a, SearchRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TransferControlResponse* New() const final {
-    return CreateMaybeMessage<TransferControlResponse>(nullptr);
+  SearchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchRequest>(arena);
   }
-
-  TransferControlResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TransferControlResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchRequest& from) {
+    SearchRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TransferControlResponse& from);
-  void MergeFrom(const TransferControlResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TransferControlResponse* other);
+  void InternalSwap(SearchRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.TransferControlResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.SearchRequest";
   }
+  protected:
+  explicit SearchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef SearchRequest_PatternType PatternType;
+  static constexpr PatternType GLOB =
+    SearchRequest_PatternType_GLOB;
+  static constexpr PatternType REGEX =
+    SearchRequest_PatternType_REGEX;
+  static inline bool PatternType_IsValid(int value) {
+    return SearchRequest_PatternType_IsValid(value);
+  }
+  static constexpr PatternType PatternType_MIN =
+    SearchRequest_PatternType_PatternType_MIN;
+  static constexpr PatternType PatternType_MAX =
+    SearchRequest_PatternType_PatternType_MAX;
+  static constexpr int PatternType_ARRAYSIZE =
+    SearchRequest_PatternType_PatternType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  PatternType_descriptor() {
+    return SearchRequest_PatternType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& PatternType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PatternType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function PatternType_Name.");
+    return SearchRequest_PatternType_Name(enum_t_value);
+  }
+  static inline bool PatternType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PatternType* value) {
+    return SearchRequest_PatternType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
-  // string task_id = 2;
-  void clear_task_id();
-  static const int kTaskIdFieldNumber = 2;
-  const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
-  std::string* mutable_task_id();
-  std::string* release_task_id();
-  void set_allocated_task_id(std::string* task_id);
+  enum : int {
+    kRootPathFieldNumber = 2,
+    kNamePatternFieldNumber = 3,
+    kCursorFieldNumber = 13,
+    kHeaderFieldNumber = 1,
+    kMinSizeFieldNumber = 6,
+    kMaxSizeFieldNumber = 7,
+    kModifiedAfterFieldNumber = 8,
+    kPatternTypeFieldNumber = 4,
+    kCaseSensitiveFieldNumber = 5,
+    kIncludeDirectoriesFieldNumber = 10,
+    kCancelFieldNumber = 14,
+    kModifiedBeforeFieldNumber = 9,
+    kLimitFieldNumber = 11,
+    kPageSizeFieldNumber = 12,
+  };
+  // string root_path = 2;
+  void clear_root_path();
+  const std::string& root_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_root_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_root_path();
+  PROTOBUF_NODISCARD std::string* release_root_path();
+  void set_allocated_root_path(std::string* root_path);
+  private:
+  const std::string& _internal_root_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_root_path(const std::string& value);
+  std::string* _internal_mutable_root_path();
+  public:
 
-  // .transfer.ResponseHeader header = 1;
+  // string name_pattern = 3;
+  void clear_name_pattern();
+  const std::string& name_pattern() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name_pattern(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name_pattern();
+  PROTOBUF_NODISCARD std::string* release_name_pattern();
+  void set_allocated_name_pattern(std::string* name_pattern);
+  private:
+  const std::string& _internal_name_pattern() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name_pattern(const std::string& value);
+  std::string* _internal_mutable_name_pattern();
+  public:
+
+  // string cursor = 13;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // .transfer.RequestHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::ResponseHeader& header() const;
-  ::transfer::ResponseHeader* release_header();
-  ::transfer::ResponseHeader* mutable_header();
-  void set_allocated_header(::transfer::ResponseHeader* header);
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // uint64 min_size = 6;
+  void clear_min_size();
+  uint64_t min_size() const;
+  void set_min_size(uint64_t value);
+  private:
+  uint64_t _internal_min_size() const;
+  void _internal_set_min_size(uint64_t value);
+  public:
 
-  // bool success = 3;
-  void clear_success();
-  static const int kSuccessFieldNumber = 3;
-  bool success() const;
-  void set_success(bool value);
+  // uint64 max_size = 7;
+  void clear_max_size();
+  uint64_t max_size() const;
+  void set_max_size(uint64_t value);
+  private:
+  uint64_t _internal_max_size() const;
+  void _internal_set_max_size(uint64_t value);
+  public:
 
-  // .transfer.TransferStatus new_status = 4;
-  void clear_new_status();
-  static const int kNewStatusFieldNumber = 4;
-  ::transfer::TransferStatus new_status() const;
-  void set_new_status(::transfer::TransferStatus value);
+  // uint64 modified_after = 8;
+  void clear_modified_after();
+  uint64_t modified_after() const;
+  void set_modified_after(uint64_t value);
+  private:
+  uint64_t _internal_modified_after() const;
+  void _internal_set_modified_after(uint64_t value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.TransferControlResponse)
+  // .transfer.SearchRequest.PatternType pattern_type = 4;
+  void clear_pattern_type();
+  ::transfer::SearchRequest_PatternType pattern_type() const;
+  void set_pattern_type(::transfer::SearchRequest_PatternType value);
+  private:
+  ::transfer::SearchRequest_PatternType _internal_pattern_type() const;
+  void _internal_set_pattern_type(::transfer::SearchRequest_PatternType value);
+  public:
+
+  // bool case_sensitive = 5;
+  void clear_case_sensitive();
+  bool case_sensitive() const;
+  void set_case_sensitive(bool value);
+  private:
+  bool _internal_case_sensitive() const;
+  void _internal_set_case_sensitive(bool value);
+  public:
+
+  // bool include_directories = 10;
+  void clear_include_directories();
+  bool include_directories() const;
+  void set_include_directories(bool value);
+  private:
+  bool _internal_include_directories() const;
+  void _internal_set_include_directories(bool value);
+  public:
+
+  // bool cancel = 14;
+  void clear_cancel();
+  bool cancel() const;
+  void set_cancel(bool value);
+  private:
+  bool _internal_cancel() const;
+  void _internal_set_cancel(bool value);
+  public:
+
+  // uint64 modified_before = 9;
+  void clear_modified_before();
+  uint64_t modified_before() const;
+  void set_modified_before(uint64_t value);
+  private:
+  uint64_t _internal_modified_before() const;
+  void _internal_set_modified_before(uint64_t value);
+  public:
+
+  // uint32 limit = 11;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // uint32 page_size = 12;
+  void clear_page_size();
+  uint32_t page_size() const;
+  void set_page_size(uint32_t value);
+  private:
+  uint32_t _internal_page_size() const;
+  void _internal_set_page_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.SearchRequest)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::transfer::ResponseHeader* header_;
-  bool success_;
-  int new_status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr root_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_pattern_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::transfer::RequestHeader* header_;
+    uint64_t min_size_;
+    uint64_t max_size_;
+    uint64_t modified_after_;
+    int pattern_type_;
+    bool case_sensitive_;
+    bool include_directories_;
+    bool cancel_;
+    uint64_t modified_before_;
+    uint32_t limit_;
+    uint32_t page_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransferProgressRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferProgressRequest) */ {
+class SearchResponse_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.SearchResponse.Entry) */ {
  public:
-  TransferProgressRequest();
-  virtual ~TransferProgressRequest();
+  inline SearchResponse_Entry() : SearchResponse_Entry(nullptr) {}
+  ~SearchResponse_Entry() override;
+  explicit PROTOBUF_CONSTEXPR SearchResponse_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TransferProgressRequest(const TransferProgressRequest& from);
-  TransferProgressRequest(TransferProgressRequest&& from) noexcept
-    : TransferProgressRequest() {
+  SearchResponse_Entry(const SearchResponse_Entry& from);
+  SearchResponse_Entry(SearchResponse_Entry&& from) noexcept
+    : SearchResponse_Entry() {
     *this = ::std::move(from);
   }
 
-  inline TransferProgressRequest& operator=(const TransferProgressRequest& from) {
+  inline SearchResponse_Entry& operator=(const SearchResponse_Entry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TransferProgressRequest& operator=(TransferProgressRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline SearchResponse_Entry& operator=(SearchResponse_Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2836,138 +4185,187 @@ class TransferProgressRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TransferProgressRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TransferProgressRequest* internal_default_instance() {
-    return reinterpret_cast<const TransferProgressRequest*>(
-               &_TransferProgressRequest_default_instance_);
+  static const SearchResponse_Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchResponse_Entry* internal_default_instance() {
+    return reinterpret_cast<const SearchResponse_Entry*>(
+               &_SearchResponse_Entry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
-  void Swap(TransferProgressRequest* other);
-  friend void swap(TransferProgressRequest& a, TransferProgressRequest& b) {
+  friend void swap(SearchResponse_Entry& a, SearchResponse_Entry& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchResponse_Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchResponse_Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TransferProgressRequest* New() const final {
-    return CreateMaybeMessage<TransferProgressRequest>(nullptr);
+  SearchResponse_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchResponse_Entry>(arena);
   }
-
-  TransferProgressRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TransferProgressRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchResponse_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchResponse_Entry& from) {
+    SearchResponse_Entry::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TransferProgressRequest& from);
-  void MergeFrom(const TransferProgressRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TransferProgressRequest* other);
+  void InternalSwap(SearchResponse_Entry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.TransferProgressRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.SearchResponse.Entry";
   }
+  protected:
+  explicit SearchResponse_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // string task_id = 2;
-  void clear_task_id();
-  static const int kTaskIdFieldNumber = 2;
-  const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
-  std::string* mutable_task_id();
-  std::string* release_task_id();
-  void set_allocated_task_id(std::string* task_id);
-
-  // .transfer.RequestHeader header = 1;
-  bool has_header() const;
-  void clear_header();
-  static const int kHeaderFieldNumber = 1;
-  const ::transfer::RequestHeader& header() const;
-  ::transfer::RequestHeader* release_header();
-  ::transfer::RequestHeader* mutable_header();
-  void set_allocated_header(::transfer::RequestHeader* header);
+  enum : int {
+    kRelativePathFieldNumber = 1,
+    kModifyTimeFieldNumber = 4,
+    kSizeFieldNumber = 3,
+    kIsDirectoryFieldNumber = 2,
+  };
+  // string relative_path = 1;
+  void clear_relative_path();
+  const std::string& relative_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_relative_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_relative_path();
+  PROTOBUF_NODISCARD std::string* release_relative_path();
+  void set_allocated_relative_path(std::string* relative_path);
+  private:
+  const std::string& _internal_relative_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_relative_path(const std::string& value);
+  std::string* _internal_mutable_relative_path();
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.TransferProgressRequest)
- private:
-  class HasBitSetters;
+  // string modify_time = 4;
+  void clear_modify_time();
+  const std::string& modify_time() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_modify_time(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_modify_time();
+  PROTOBUF_NODISCARD std::string* release_modify_time();
+  void set_allocated_modify_time(std::string* modify_time);
+  private:
+  const std::string& _internal_modify_time() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_modify_time(const std::string& value);
+  std::string* _internal_mutable_modify_time();
+  public:
+
+  // uint64 size = 3;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // bool is_directory = 2;
+  void clear_is_directory();
+  bool is_directory() const;
+  void set_is_directory(bool value);
+  private:
+  bool _internal_is_directory() const;
+  void _internal_set_is_directory(bool value);
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::transfer::RequestHeader* header_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  // @@protoc_insertion_point(class_scope:transfer.SearchResponse.Entry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr relative_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr modify_time_;
+    uint64_t size_;
+    bool is_directory_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransferProgressResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferProgressResponse) */ {
+class SearchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.SearchResponse) */ {
  public:
-  TransferProgressResponse();
-  virtual ~TransferProgressResponse();
+  inline SearchResponse() : SearchResponse(nullptr) {}
+  ~SearchResponse() override;
+  explicit PROTOBUF_CONSTEXPR SearchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TransferProgressResponse(const TransferProgressResponse& from);
-  TransferProgressResponse(TransferProgressResponse&& from) noexcept
-    : TransferProgressResponse() {
+  SearchResponse(const SearchResponse& from);
+  SearchResponse(SearchResponse&& from) noexcept
+    : SearchResponse() {
     *this = ::std::move(from);
   }
 
-  inline TransferProgressResponse& operator=(const TransferProgressResponse& from) {
+  inline SearchResponse& operator=(const SearchResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TransferProgressResponse& operator=(TransferProgressResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline SearchResponse& operator=(SearchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2978,946 +4376,10935 @@ class TransferProgressResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TransferProgressResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TransferProgressResponse* internal_default_instance() {
-    return reinterpret_cast<const TransferProgressResponse*>(
-               &_TransferProgressResponse_default_instance_);
+  static const SearchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SearchResponse* internal_default_instance() {
+    return reinterpret_cast<const SearchResponse*>(
+               &_SearchResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    17;
 
-  void Swap(TransferProgressResponse* other);
-  friend void swap(TransferProgressResponse& a, TransferProgressResponse& b) {
+  friend void swap(SearchResponse& a, SearchResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(SearchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SearchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TransferProgressResponse* New() const final {
-    return CreateMaybeMessage<TransferProgressResponse>(nullptr);
+  SearchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SearchResponse>(arena);
   }
-
-  TransferProgressResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TransferProgressResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SearchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SearchResponse& from) {
+    SearchResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TransferProgressResponse& from);
-  void MergeFrom(const TransferProgressResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  #else
-  bool MergePartialFromCodedStream(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
-  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
-  void SerializeWithCachedSizes(
-      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TransferProgressResponse* other);
+  void InternalSwap(SearchResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "transfer.TransferProgressResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "transfer.SearchResponse";
   }
+  protected:
+  explicit SearchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transfer_2eproto);
-    return ::descriptor_table_transfer_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  // accessors -------------------------------------------------------
+  typedef SearchResponse_Entry Entry;
 
-  // string task_id = 2;
-  void clear_task_id();
-  static const int kTaskIdFieldNumber = 2;
-  const std::string& task_id() const;
-  void set_task_id(const std::string& value);
-  void set_task_id(std::string&& value);
-  void set_task_id(const char* value);
-  void set_task_id(const char* value, size_t size);
-  std::string* mutable_task_id();
-  std::string* release_task_id();
-  void set_allocated_task_id(std::string* task_id);
+  // accessors -------------------------------------------------------
 
-  // string task_name = 3;
-  void clear_task_name();
-  static const int kTaskNameFieldNumber = 3;
-  const std::string& task_name() const;
-  void set_task_name(const std::string& value);
-  void set_task_name(std::string&& value);
-  void set_task_name(const char* value);
-  void set_task_name(const char* value, size_t size);
-  std::string* mutable_task_name();
-  std::string* release_task_name();
-  void set_allocated_task_name(std::string* task_name);
+  enum : int {
+    kEntriesFieldNumber = 2,
+    kNextCursorFieldNumber = 6,
+    kHeaderFieldNumber = 1,
+    kScannedCountFieldNumber = 5,
+    kHasMoreFieldNumber = 3,
+    kTruncatedFieldNumber = 4,
+  };
+  // repeated .transfer.SearchResponse.Entry entries = 2;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::transfer::SearchResponse_Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::SearchResponse_Entry >*
+      mutable_entries();
+  private:
+  const ::transfer::SearchResponse_Entry& _internal_entries(int index) const;
+  ::transfer::SearchResponse_Entry* _internal_add_entries();
+  public:
+  const ::transfer::SearchResponse_Entry& entries(int index) const;
+  ::transfer::SearchResponse_Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::SearchResponse_Entry >&
+      entries() const;
+
+  // string next_cursor = 6;
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
 
   // .transfer.ResponseHeader header = 1;
   bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
   void clear_header();
-  static const int kHeaderFieldNumber = 1;
   const ::transfer::ResponseHeader& header() const;
-  ::transfer::ResponseHeader* release_header();
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
   ::transfer::ResponseHeader* mutable_header();
   void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 scanned_count = 5;
+  void clear_scanned_count();
+  uint64_t scanned_count() const;
+  void set_scanned_count(uint64_t value);
+  private:
+  uint64_t _internal_scanned_count() const;
+  void _internal_set_scanned_count(uint64_t value);
+  public:
 
-  // uint64 transferred_size = 5;
-  void clear_transferred_size();
-  static const int kTransferredSizeFieldNumber = 5;
-  ::PROTOBUF_NAMESPACE_ID::uint64 transferred_size() const;
-  void set_transferred_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
-
-  // .transfer.TransferStatus status = 4;
-  void clear_status();
-  static const int kStatusFieldNumber = 4;
-  ::transfer::TransferStatus status() const;
-  void set_status(::transfer::TransferStatus value);
-
-  // uint32 speed = 7;
-  void clear_speed();
-  static const int kSpeedFieldNumber = 7;
-  ::PROTOBUF_NAMESPACE_ID::uint32 speed() const;
-  void set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
-
-  // uint64 total_size = 6;
-  void clear_total_size();
-  static const int kTotalSizeFieldNumber = 6;
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_size() const;
-  void set_total_size(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  // bool has_more = 3;
+  void clear_has_more();
+  bool has_more() const;
+  void set_has_more(bool value);
+  private:
+  bool _internal_has_more() const;
+  void _internal_set_has_more(bool value);
+  public:
 
-  // uint32 progress = 8;
-  void clear_progress();
-  static const int kProgressFieldNumber = 8;
-  ::PROTOBUF_NAMESPACE_ID::uint32 progress() const;
-  void set_progress(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  // bool truncated = 4;
+  void clear_truncated();
+  bool truncated() const;
+  void set_truncated(bool value);
+  private:
+  bool _internal_truncated() const;
+  void _internal_set_truncated(bool value);
+  public:
 
-  // @@protoc_insertion_point(class_scope:transfer.TransferProgressResponse)
+  // @@protoc_insertion_point(class_scope:transfer.SearchResponse)
  private:
-  class HasBitSetters;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_name_;
-  ::transfer::ResponseHeader* header_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 transferred_size_;
-  int status_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 speed_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 total_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 progress_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::SearchResponse_Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
+    ::transfer::ResponseHeader* header_;
+    uint64_t scanned_count_;
+    bool has_more_;
+    bool truncated_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transfer_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class UploadRequest_FileInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadRequest.FileInfo) */ {
+ public:
+  inline UploadRequest_FileInfo() : UploadRequest_FileInfo(nullptr) {}
+  ~UploadRequest_FileInfo() override;
+  explicit PROTOBUF_CONSTEXPR UploadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  UploadRequest_FileInfo(const UploadRequest_FileInfo& from);
+  UploadRequest_FileInfo(UploadRequest_FileInfo&& from) noexcept
+    : UploadRequest_FileInfo() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// RequestHeader
+  inline UploadRequest_FileInfo& operator=(const UploadRequest_FileInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadRequest_FileInfo& operator=(UploadRequest_FileInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string session_id = 1;
-inline void RequestHeader::clear_session_id() {
-  session_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& RequestHeader::session_id() const {
-  // @@protoc_insertion_point(field_get:transfer.RequestHeader.session_id)
-  return session_id_.GetNoArena();
-}
-inline void RequestHeader::set_session_id(const std::string& value) {
-  
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.RequestHeader.session_id)
-}
-inline void RequestHeader::set_session_id(std::string&& value) {
-  
-  session_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.RequestHeader.session_id)
-}
-inline void RequestHeader::set_session_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.RequestHeader.session_id)
-}
-inline void RequestHeader::set_session_id(const char* value, size_t size) {
-  
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.RequestHeader.session_id)
-}
-inline std::string* RequestHeader::mutable_session_id() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.RequestHeader.session_id)
-  return session_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* RequestHeader::release_session_id() {
-  // @@protoc_insertion_point(field_release:transfer.RequestHeader.session_id)
-  
-  return session_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void RequestHeader::set_allocated_session_id(std::string* session_id) {
-  if (session_id != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  session_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), session_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.RequestHeader.session_id)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadRequest_FileInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadRequest_FileInfo* internal_default_instance() {
+    return reinterpret_cast<const UploadRequest_FileInfo*>(
+               &_UploadRequest_FileInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-// .transfer.MessageType type = 2;
-inline void RequestHeader::clear_type() {
-  type_ = 0;
-}
-inline ::transfer::MessageType RequestHeader::type() const {
-  // @@protoc_insertion_point(field_get:transfer.RequestHeader.type)
-  return static_cast< ::transfer::MessageType >(type_);
-}
-inline void RequestHeader::set_type(::transfer::MessageType value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:transfer.RequestHeader.type)
-}
+  friend void swap(UploadRequest_FileInfo& a, UploadRequest_FileInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadRequest_FileInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadRequest_FileInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-// uint64 timestamp = 3;
-inline void RequestHeader::clear_timestamp() {
-  timestamp_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestHeader::timestamp() const {
-  // @@protoc_insertion_point(field_get:transfer.RequestHeader.timestamp)
-  return timestamp_;
-}
-inline void RequestHeader::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:transfer.RequestHeader.timestamp)
-}
+  // implements Message ----------------------------------------------
 
-// uint64 sequence = 4;
-inline void RequestHeader::clear_sequence() {
-  sequence_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 RequestHeader::sequence() const {
-  // @@protoc_insertion_point(field_get:transfer.RequestHeader.sequence)
-  return sequence_;
+  UploadRequest_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadRequest_FileInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadRequest_FileInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadRequest_FileInfo& from) {
+    UploadRequest_FileInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadRequest_FileInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.UploadRequest.FileInfo";
+  }
+  protected:
+  explicit UploadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kTargetPathFieldNumber = 2,
+    kMd5FieldNumber = 4,
+    kDataFieldNumber = 8,
+    kTaskIdFieldNumber = 10,
+    kUploadIdFieldNumber = 13,
+    kFileSizeFieldNumber = 3,
+    kNeedChunkFieldNumber = 5,
+    kChunkSizeFieldNumber = 6,
+    kChunkSequenceFieldNumber = 7,
+    kChecksumFieldNumber = 9,
+    kOffsetFieldNumber = 12,
+    kStatusFieldNumber = 11,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string target_path = 2;
+  void clear_target_path();
+  const std::string& target_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_path();
+  PROTOBUF_NODISCARD std::string* release_target_path();
+  void set_allocated_target_path(std::string* target_path);
+  private:
+  const std::string& _internal_target_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_path(const std::string& value);
+  std::string* _internal_mutable_target_path();
+  public:
+
+  // string md5 = 4;
+  void clear_md5();
+  const std::string& md5() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_md5(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_md5();
+  PROTOBUF_NODISCARD std::string* release_md5();
+  void set_allocated_md5(std::string* md5);
+  private:
+  const std::string& _internal_md5() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_md5(const std::string& value);
+  std::string* _internal_mutable_md5();
+  public:
+
+  // bytes data = 8;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // string task_id = 10;
+  void clear_task_id();
+  const std::string& task_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
+  void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
+
+  // string upload_id = 13;
+  void clear_upload_id();
+  const std::string& upload_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_upload_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_upload_id();
+  PROTOBUF_NODISCARD std::string* release_upload_id();
+  void set_allocated_upload_id(std::string* upload_id);
+  private:
+  const std::string& _internal_upload_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_upload_id(const std::string& value);
+  std::string* _internal_mutable_upload_id();
+  public:
+
+  // uint64 file_size = 3;
+  void clear_file_size();
+  uint64_t file_size() const;
+  void set_file_size(uint64_t value);
+  private:
+  uint64_t _internal_file_size() const;
+  void _internal_set_file_size(uint64_t value);
+  public:
+
+  // bool need_chunk = 5;
+  void clear_need_chunk();
+  bool need_chunk() const;
+  void set_need_chunk(bool value);
+  private:
+  bool _internal_need_chunk() const;
+  void _internal_set_need_chunk(bool value);
+  public:
+
+  // uint32 chunk_size = 6;
+  void clear_chunk_size();
+  uint32_t chunk_size() const;
+  void set_chunk_size(uint32_t value);
+  private:
+  uint32_t _internal_chunk_size() const;
+  void _internal_set_chunk_size(uint32_t value);
+  public:
+
+  // uint32 chunk_sequence = 7;
+  void clear_chunk_sequence();
+  uint32_t chunk_sequence() const;
+  void set_chunk_sequence(uint32_t value);
+  private:
+  uint32_t _internal_chunk_sequence() const;
+  void _internal_set_chunk_sequence(uint32_t value);
+  public:
+
+  // uint32 checksum = 9;
+  void clear_checksum();
+  uint32_t checksum() const;
+  void set_checksum(uint32_t value);
+  private:
+  uint32_t _internal_checksum() const;
+  void _internal_set_checksum(uint32_t value);
+  public:
+
+  // uint64 offset = 12;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // .transfer.TransferStatus status = 11;
+  void clear_status();
+  ::transfer::TransferStatus status() const;
+  void set_status(::transfer::TransferStatus value);
+  private:
+  ::transfer::TransferStatus _internal_status() const;
+  void _internal_set_status(::transfer::TransferStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.UploadRequest.FileInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr md5_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr upload_id_;
+    uint64_t file_size_;
+    bool need_chunk_;
+    uint32_t chunk_size_;
+    uint32_t chunk_sequence_;
+    uint32_t checksum_;
+    uint64_t offset_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadRequest) */ {
+ public:
+  inline UploadRequest() : UploadRequest(nullptr) {}
+  ~UploadRequest() override;
+  explicit PROTOBUF_CONSTEXPR UploadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadRequest(const UploadRequest& from);
+  UploadRequest(UploadRequest&& from) noexcept
+    : UploadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadRequest& operator=(const UploadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadRequest& operator=(UploadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadRequest* internal_default_instance() {
+    return reinterpret_cast<const UploadRequest*>(
+               &_UploadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(UploadRequest& a, UploadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadRequest& from) {
+    UploadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.UploadRequest";
+  }
+  protected:
+  explicit UploadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef UploadRequest_FileInfo FileInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFilesFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .transfer.UploadRequest.FileInfo files = 2;
+  int files_size() const;
+  private:
+  int _internal_files_size() const;
+  public:
+  void clear_files();
+  ::transfer::UploadRequest_FileInfo* mutable_files(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >*
+      mutable_files();
+  private:
+  const ::transfer::UploadRequest_FileInfo& _internal_files(int index) const;
+  ::transfer::UploadRequest_FileInfo* _internal_add_files();
+  public:
+  const ::transfer::UploadRequest_FileInfo& files(int index) const;
+  ::transfer::UploadRequest_FileInfo* add_files();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >&
+      files() const;
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.UploadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo > files_;
+    ::transfer::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadResponse_FileResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadResponse.FileResult) */ {
+ public:
+  inline UploadResponse_FileResult() : UploadResponse_FileResult(nullptr) {}
+  ~UploadResponse_FileResult() override;
+  explicit PROTOBUF_CONSTEXPR UploadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadResponse_FileResult(const UploadResponse_FileResult& from);
+  UploadResponse_FileResult(UploadResponse_FileResult&& from) noexcept
+    : UploadResponse_FileResult() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadResponse_FileResult& operator=(const UploadResponse_FileResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadResponse_FileResult& operator=(UploadResponse_FileResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadResponse_FileResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadResponse_FileResult* internal_default_instance() {
+    return reinterpret_cast<const UploadResponse_FileResult*>(
+               &_UploadResponse_FileResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(UploadResponse_FileResult& a, UploadResponse_FileResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadResponse_FileResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadResponse_FileResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadResponse_FileResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadResponse_FileResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadResponse_FileResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadResponse_FileResult& from) {
+    UploadResponse_FileResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadResponse_FileResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.UploadResponse.FileResult";
+  }
+  protected:
+  explicit UploadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kTargetPathFieldNumber = 2,
+    kErrorMessageFieldNumber = 6,
+    kSuccessFieldNumber = 3,
+    kNeedChunkFieldNumber = 4,
+    kNextSequenceFieldNumber = 5,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string target_path = 2;
+  void clear_target_path();
+  const std::string& target_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_path();
+  PROTOBUF_NODISCARD std::string* release_target_path();
+  void set_allocated_target_path(std::string* target_path);
+  private:
+  const std::string& _internal_target_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_path(const std::string& value);
+  std::string* _internal_mutable_target_path();
+  public:
+
+  // string error_message = 6;
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // bool success = 3;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // bool need_chunk = 4;
+  void clear_need_chunk();
+  bool need_chunk() const;
+  void set_need_chunk(bool value);
+  private:
+  bool _internal_need_chunk() const;
+  void _internal_set_need_chunk(bool value);
+  public:
+
+  // int32 next_sequence = 5;
+  void clear_next_sequence();
+  int32_t next_sequence() const;
+  void set_next_sequence(int32_t value);
+  private:
+  int32_t _internal_next_sequence() const;
+  void _internal_set_next_sequence(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.UploadResponse.FileResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    bool success_;
+    bool need_chunk_;
+    int32_t next_sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UploadResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.UploadResponse) */ {
+ public:
+  inline UploadResponse() : UploadResponse(nullptr) {}
+  ~UploadResponse() override;
+  explicit PROTOBUF_CONSTEXPR UploadResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UploadResponse(const UploadResponse& from);
+  UploadResponse(UploadResponse&& from) noexcept
+    : UploadResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline UploadResponse& operator=(const UploadResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UploadResponse& operator=(UploadResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UploadResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UploadResponse* internal_default_instance() {
+    return reinterpret_cast<const UploadResponse*>(
+               &_UploadResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(UploadResponse& a, UploadResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UploadResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UploadResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UploadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UploadResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UploadResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UploadResponse& from) {
+    UploadResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UploadResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.UploadResponse";
+  }
+  protected:
+  explicit UploadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef UploadResponse_FileResult FileResult;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .transfer.UploadResponse.FileResult results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::transfer::UploadResponse_FileResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >*
+      mutable_results();
+  private:
+  const ::transfer::UploadResponse_FileResult& _internal_results(int index) const;
+  ::transfer::UploadResponse_FileResult* _internal_add_results();
+  public:
+  const ::transfer::UploadResponse_FileResult& results(int index) const;
+  ::transfer::UploadResponse_FileResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >&
+      results() const;
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.UploadResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult > results_;
+    ::transfer::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DownloadRequest_FileInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadRequest.FileInfo) */ {
+ public:
+  inline DownloadRequest_FileInfo() : DownloadRequest_FileInfo(nullptr) {}
+  ~DownloadRequest_FileInfo() override;
+  explicit PROTOBUF_CONSTEXPR DownloadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DownloadRequest_FileInfo(const DownloadRequest_FileInfo& from);
+  DownloadRequest_FileInfo(DownloadRequest_FileInfo&& from) noexcept
+    : DownloadRequest_FileInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline DownloadRequest_FileInfo& operator=(const DownloadRequest_FileInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DownloadRequest_FileInfo& operator=(DownloadRequest_FileInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DownloadRequest_FileInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DownloadRequest_FileInfo* internal_default_instance() {
+    return reinterpret_cast<const DownloadRequest_FileInfo*>(
+               &_DownloadRequest_FileInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(DownloadRequest_FileInfo& a, DownloadRequest_FileInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DownloadRequest_FileInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DownloadRequest_FileInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DownloadRequest_FileInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DownloadRequest_FileInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DownloadRequest_FileInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DownloadRequest_FileInfo& from) {
+    DownloadRequest_FileInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DownloadRequest_FileInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.DownloadRequest.FileInfo";
+  }
+  protected:
+  explicit DownloadRequest_FileInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kTargetPathFieldNumber = 2,
+    kDownloadIdFieldNumber = 5,
+    kOffsetFieldNumber = 4,
+    kChunkSizeFieldNumber = 3,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string target_path = 2;
+  void clear_target_path();
+  const std::string& target_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_path();
+  PROTOBUF_NODISCARD std::string* release_target_path();
+  void set_allocated_target_path(std::string* target_path);
+  private:
+  const std::string& _internal_target_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_path(const std::string& value);
+  std::string* _internal_mutable_target_path();
+  public:
+
+  // string download_id = 5;
+  void clear_download_id();
+  const std::string& download_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_download_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_download_id();
+  PROTOBUF_NODISCARD std::string* release_download_id();
+  void set_allocated_download_id(std::string* download_id);
+  private:
+  const std::string& _internal_download_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_download_id(const std::string& value);
+  std::string* _internal_mutable_download_id();
+  public:
+
+  // uint64 offset = 4;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // uint32 chunk_size = 3;
+  void clear_chunk_size();
+  uint32_t chunk_size() const;
+  void set_chunk_size(uint32_t value);
+  private:
+  uint32_t _internal_chunk_size() const;
+  void _internal_set_chunk_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.DownloadRequest.FileInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr download_id_;
+    uint64_t offset_;
+    uint32_t chunk_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DownloadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadRequest) */ {
+ public:
+  inline DownloadRequest() : DownloadRequest(nullptr) {}
+  ~DownloadRequest() override;
+  explicit PROTOBUF_CONSTEXPR DownloadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DownloadRequest(const DownloadRequest& from);
+  DownloadRequest(DownloadRequest&& from) noexcept
+    : DownloadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DownloadRequest& operator=(const DownloadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DownloadRequest& operator=(DownloadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DownloadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DownloadRequest* internal_default_instance() {
+    return reinterpret_cast<const DownloadRequest*>(
+               &_DownloadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(DownloadRequest& a, DownloadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DownloadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DownloadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DownloadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DownloadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DownloadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DownloadRequest& from) {
+    DownloadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DownloadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.DownloadRequest";
+  }
+  protected:
+  explicit DownloadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef DownloadRequest_FileInfo FileInfo;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFilesFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .transfer.DownloadRequest.FileInfo files = 2;
+  int files_size() const;
+  private:
+  int _internal_files_size() const;
+  public:
+  void clear_files();
+  ::transfer::DownloadRequest_FileInfo* mutable_files(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >*
+      mutable_files();
+  private:
+  const ::transfer::DownloadRequest_FileInfo& _internal_files(int index) const;
+  ::transfer::DownloadRequest_FileInfo* _internal_add_files();
+  public:
+  const ::transfer::DownloadRequest_FileInfo& files(int index) const;
+  ::transfer::DownloadRequest_FileInfo* add_files();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >&
+      files() const;
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.DownloadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo > files_;
+    ::transfer::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DownloadResponse_FileResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadResponse.FileResult) */ {
+ public:
+  inline DownloadResponse_FileResult() : DownloadResponse_FileResult(nullptr) {}
+  ~DownloadResponse_FileResult() override;
+  explicit PROTOBUF_CONSTEXPR DownloadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DownloadResponse_FileResult(const DownloadResponse_FileResult& from);
+  DownloadResponse_FileResult(DownloadResponse_FileResult&& from) noexcept
+    : DownloadResponse_FileResult() {
+    *this = ::std::move(from);
+  }
+
+  inline DownloadResponse_FileResult& operator=(const DownloadResponse_FileResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DownloadResponse_FileResult& operator=(DownloadResponse_FileResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DownloadResponse_FileResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DownloadResponse_FileResult* internal_default_instance() {
+    return reinterpret_cast<const DownloadResponse_FileResult*>(
+               &_DownloadResponse_FileResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(DownloadResponse_FileResult& a, DownloadResponse_FileResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DownloadResponse_FileResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DownloadResponse_FileResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DownloadResponse_FileResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DownloadResponse_FileResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DownloadResponse_FileResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DownloadResponse_FileResult& from) {
+    DownloadResponse_FileResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DownloadResponse_FileResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.DownloadResponse.FileResult";
+  }
+  protected:
+  explicit DownloadResponse_FileResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFileNameFieldNumber = 1,
+    kTargetPathFieldNumber = 2,
+    kMd5FieldNumber = 5,
+    kDataFieldNumber = 9,
+    kErrorMessageFieldNumber = 12,
+    kFileSizeFieldNumber = 4,
+    kExistsFieldNumber = 3,
+    kNeedChunkFieldNumber = 6,
+    kIsLastFieldNumber = 11,
+    kChunkSizeFieldNumber = 7,
+    kChunkSequenceFieldNumber = 8,
+    kChecksumFieldNumber = 10,
+  };
+  // string file_name = 1;
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
+  private:
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
+  public:
+
+  // string target_path = 2;
+  void clear_target_path();
+  const std::string& target_path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_target_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_target_path();
+  PROTOBUF_NODISCARD std::string* release_target_path();
+  void set_allocated_target_path(std::string* target_path);
+  private:
+  const std::string& _internal_target_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_target_path(const std::string& value);
+  std::string* _internal_mutable_target_path();
+  public:
+
+  // string md5 = 5;
+  void clear_md5();
+  const std::string& md5() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_md5(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_md5();
+  PROTOBUF_NODISCARD std::string* release_md5();
+  void set_allocated_md5(std::string* md5);
+  private:
+  const std::string& _internal_md5() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_md5(const std::string& value);
+  std::string* _internal_mutable_md5();
+  public:
+
+  // bytes data = 9;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // string error_message = 12;
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // uint64 file_size = 4;
+  void clear_file_size();
+  uint64_t file_size() const;
+  void set_file_size(uint64_t value);
+  private:
+  uint64_t _internal_file_size() const;
+  void _internal_set_file_size(uint64_t value);
+  public:
+
+  // bool exists = 3;
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // bool need_chunk = 6;
+  void clear_need_chunk();
+  bool need_chunk() const;
+  void set_need_chunk(bool value);
+  private:
+  bool _internal_need_chunk() const;
+  void _internal_set_need_chunk(bool value);
+  public:
+
+  // bool is_last = 11;
+  void clear_is_last();
+  bool is_last() const;
+  void set_is_last(bool value);
+  private:
+  bool _internal_is_last() const;
+  void _internal_set_is_last(bool value);
+  public:
+
+  // uint32 chunk_size = 7;
+  void clear_chunk_size();
+  uint32_t chunk_size() const;
+  void set_chunk_size(uint32_t value);
+  private:
+  uint32_t _internal_chunk_size() const;
+  void _internal_set_chunk_size(uint32_t value);
+  public:
+
+  // uint32 chunk_sequence = 8;
+  void clear_chunk_sequence();
+  uint32_t chunk_sequence() const;
+  void set_chunk_sequence(uint32_t value);
+  private:
+  uint32_t _internal_chunk_sequence() const;
+  void _internal_set_chunk_sequence(uint32_t value);
+  public:
+
+  // uint32 checksum = 10;
+  void clear_checksum();
+  uint32_t checksum() const;
+  void set_checksum(uint32_t value);
+  private:
+  uint32_t _internal_checksum() const;
+  void _internal_set_checksum(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.DownloadResponse.FileResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr target_path_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr md5_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    uint64_t file_size_;
+    bool exists_;
+    bool need_chunk_;
+    bool is_last_;
+    uint32_t chunk_size_;
+    uint32_t chunk_sequence_;
+    uint32_t checksum_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DownloadResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.DownloadResponse) */ {
+ public:
+  inline DownloadResponse() : DownloadResponse(nullptr) {}
+  ~DownloadResponse() override;
+  explicit PROTOBUF_CONSTEXPR DownloadResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DownloadResponse(const DownloadResponse& from);
+  DownloadResponse(DownloadResponse&& from) noexcept
+    : DownloadResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DownloadResponse& operator=(const DownloadResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DownloadResponse& operator=(DownloadResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DownloadResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DownloadResponse* internal_default_instance() {
+    return reinterpret_cast<const DownloadResponse*>(
+               &_DownloadResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(DownloadResponse& a, DownloadResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DownloadResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DownloadResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DownloadResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DownloadResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DownloadResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DownloadResponse& from) {
+    DownloadResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DownloadResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.DownloadResponse";
+  }
+  protected:
+  explicit DownloadResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef DownloadResponse_FileResult FileResult;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .transfer.DownloadResponse.FileResult results = 2;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::transfer::DownloadResponse_FileResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >*
+      mutable_results();
+  private:
+  const ::transfer::DownloadResponse_FileResult& _internal_results(int index) const;
+  ::transfer::DownloadResponse_FileResult* _internal_add_results();
+  public:
+  const ::transfer::DownloadResponse_FileResult& results(int index) const;
+  ::transfer::DownloadResponse_FileResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >&
+      results() const;
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.DownloadResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult > results_;
+    ::transfer::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferControlRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferControlRequest) */ {
+ public:
+  inline TransferControlRequest() : TransferControlRequest(nullptr) {}
+  ~TransferControlRequest() override;
+  explicit PROTOBUF_CONSTEXPR TransferControlRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferControlRequest(const TransferControlRequest& from);
+  TransferControlRequest(TransferControlRequest&& from) noexcept
+    : TransferControlRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferControlRequest& operator=(const TransferControlRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferControlRequest& operator=(TransferControlRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferControlRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferControlRequest* internal_default_instance() {
+    return reinterpret_cast<const TransferControlRequest*>(
+               &_TransferControlRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(TransferControlRequest& a, TransferControlRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferControlRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferControlRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferControlRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferControlRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferControlRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferControlRequest& from) {
+    TransferControlRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferControlRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.TransferControlRequest";
+  }
+  protected:
+  explicit TransferControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TransferControlRequest_ControlType ControlType;
+  static constexpr ControlType PAUSE =
+    TransferControlRequest_ControlType_PAUSE;
+  static constexpr ControlType RESUME =
+    TransferControlRequest_ControlType_RESUME;
+  static constexpr ControlType CANCEL =
+    TransferControlRequest_ControlType_CANCEL;
+  static inline bool ControlType_IsValid(int value) {
+    return TransferControlRequest_ControlType_IsValid(value);
+  }
+  static constexpr ControlType ControlType_MIN =
+    TransferControlRequest_ControlType_ControlType_MIN;
+  static constexpr ControlType ControlType_MAX =
+    TransferControlRequest_ControlType_ControlType_MAX;
+  static constexpr int ControlType_ARRAYSIZE =
+    TransferControlRequest_ControlType_ControlType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  ControlType_descriptor() {
+    return TransferControlRequest_ControlType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& ControlType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ControlType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ControlType_Name.");
+    return TransferControlRequest_ControlType_Name(enum_t_value);
+  }
+  static inline bool ControlType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ControlType* value) {
+    return TransferControlRequest_ControlType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTaskIdFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+    kControlTypeFieldNumber = 3,
+  };
+  // string task_id = 2;
+  void clear_task_id();
+  const std::string& task_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
+  void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // .transfer.TransferControlRequest.ControlType control_type = 3;
+  void clear_control_type();
+  ::transfer::TransferControlRequest_ControlType control_type() const;
+  void set_control_type(::transfer::TransferControlRequest_ControlType value);
+  private:
+  ::transfer::TransferControlRequest_ControlType _internal_control_type() const;
+  void _internal_set_control_type(::transfer::TransferControlRequest_ControlType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.TransferControlRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    ::transfer::RequestHeader* header_;
+    int control_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferControlResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferControlResponse) */ {
+ public:
+  inline TransferControlResponse() : TransferControlResponse(nullptr) {}
+  ~TransferControlResponse() override;
+  explicit PROTOBUF_CONSTEXPR TransferControlResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferControlResponse(const TransferControlResponse& from);
+  TransferControlResponse(TransferControlResponse&& from) noexcept
+    : TransferControlResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferControlResponse& operator=(const TransferControlResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferControlResponse& operator=(TransferControlResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferControlResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferControlResponse* internal_default_instance() {
+    return reinterpret_cast<const TransferControlResponse*>(
+               &_TransferControlResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(TransferControlResponse& a, TransferControlResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferControlResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferControlResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferControlResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferControlResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferControlResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferControlResponse& from) {
+    TransferControlResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferControlResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.TransferControlResponse";
+  }
+  protected:
+  explicit TransferControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTaskIdFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+    kSuccessFieldNumber = 3,
+    kNewStatusFieldNumber = 4,
+  };
+  // string task_id = 2;
+  void clear_task_id();
+  const std::string& task_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
+  void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // bool success = 3;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // .transfer.TransferStatus new_status = 4;
+  void clear_new_status();
+  ::transfer::TransferStatus new_status() const;
+  void set_new_status(::transfer::TransferStatus value);
+  private:
+  ::transfer::TransferStatus _internal_new_status() const;
+  void _internal_set_new_status(::transfer::TransferStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.TransferControlResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    ::transfer::ResponseHeader* header_;
+    bool success_;
+    int new_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferProgressRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferProgressRequest) */ {
+ public:
+  inline TransferProgressRequest() : TransferProgressRequest(nullptr) {}
+  ~TransferProgressRequest() override;
+  explicit PROTOBUF_CONSTEXPR TransferProgressRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferProgressRequest(const TransferProgressRequest& from);
+  TransferProgressRequest(TransferProgressRequest&& from) noexcept
+    : TransferProgressRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferProgressRequest& operator=(const TransferProgressRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferProgressRequest& operator=(TransferProgressRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferProgressRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferProgressRequest* internal_default_instance() {
+    return reinterpret_cast<const TransferProgressRequest*>(
+               &_TransferProgressRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(TransferProgressRequest& a, TransferProgressRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferProgressRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferProgressRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferProgressRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferProgressRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferProgressRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferProgressRequest& from) {
+    TransferProgressRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferProgressRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.TransferProgressRequest";
+  }
+  protected:
+  explicit TransferProgressRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTaskIdFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // string task_id = 2;
+  void clear_task_id();
+  const std::string& task_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
+  void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.TransferProgressRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    ::transfer::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransferProgressResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.TransferProgressResponse) */ {
+ public:
+  inline TransferProgressResponse() : TransferProgressResponse(nullptr) {}
+  ~TransferProgressResponse() override;
+  explicit PROTOBUF_CONSTEXPR TransferProgressResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransferProgressResponse(const TransferProgressResponse& from);
+  TransferProgressResponse(TransferProgressResponse&& from) noexcept
+    : TransferProgressResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TransferProgressResponse& operator=(const TransferProgressResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransferProgressResponse& operator=(TransferProgressResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransferProgressResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransferProgressResponse* internal_default_instance() {
+    return reinterpret_cast<const TransferProgressResponse*>(
+               &_TransferProgressResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(TransferProgressResponse& a, TransferProgressResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransferProgressResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransferProgressResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransferProgressResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransferProgressResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransferProgressResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransferProgressResponse& from) {
+    TransferProgressResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransferProgressResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.TransferProgressResponse";
+  }
+  protected:
+  explicit TransferProgressResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTaskIdFieldNumber = 2,
+    kTaskNameFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kTransferredSizeFieldNumber = 5,
+    kStatusFieldNumber = 4,
+    kSpeedFieldNumber = 7,
+    kTotalSizeFieldNumber = 6,
+    kProgressFieldNumber = 8,
+  };
+  // string task_id = 2;
+  void clear_task_id();
+  const std::string& task_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_id();
+  PROTOBUF_NODISCARD std::string* release_task_id();
+  void set_allocated_task_id(std::string* task_id);
+  private:
+  const std::string& _internal_task_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_id(const std::string& value);
+  std::string* _internal_mutable_task_id();
+  public:
+
+  // string task_name = 3;
+  void clear_task_name();
+  const std::string& task_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_task_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_task_name();
+  PROTOBUF_NODISCARD std::string* release_task_name();
+  void set_allocated_task_name(std::string* task_name);
+  private:
+  const std::string& _internal_task_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_task_name(const std::string& value);
+  std::string* _internal_mutable_task_name();
+  public:
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 transferred_size = 5;
+  void clear_transferred_size();
+  uint64_t transferred_size() const;
+  void set_transferred_size(uint64_t value);
+  private:
+  uint64_t _internal_transferred_size() const;
+  void _internal_set_transferred_size(uint64_t value);
+  public:
+
+  // .transfer.TransferStatus status = 4;
+  void clear_status();
+  ::transfer::TransferStatus status() const;
+  void set_status(::transfer::TransferStatus value);
+  private:
+  ::transfer::TransferStatus _internal_status() const;
+  void _internal_set_status(::transfer::TransferStatus value);
+  public:
+
+  // uint32 speed = 7;
+  void clear_speed();
+  uint32_t speed() const;
+  void set_speed(uint32_t value);
+  private:
+  uint32_t _internal_speed() const;
+  void _internal_set_speed(uint32_t value);
+  public:
+
+  // uint64 total_size = 6;
+  void clear_total_size();
+  uint64_t total_size() const;
+  void set_total_size(uint64_t value);
+  private:
+  uint64_t _internal_total_size() const;
+  void _internal_set_total_size(uint64_t value);
+  public:
+
+  // uint32 progress = 8;
+  void clear_progress();
+  uint32_t progress() const;
+  void set_progress(uint32_t value);
+  private:
+  uint32_t _internal_progress() const;
+  void _internal_set_progress(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.TransferProgressResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr task_name_;
+    ::transfer::ResponseHeader* header_;
+    uint64_t transferred_size_;
+    int status_;
+    uint32_t speed_;
+    uint64_t total_size_;
+    uint32_t progress_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.WatchRequest) */ {
+ public:
+  inline WatchRequest() : WatchRequest(nullptr) {}
+  ~WatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchRequest(const WatchRequest& from);
+  WatchRequest(WatchRequest&& from) noexcept
+    : WatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchRequest& operator=(const WatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchRequest& operator=(WatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WatchRequest*>(
+               &_WatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(WatchRequest& a, WatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchRequest& from) {
+    WatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.WatchRequest";
+  }
+  protected:
+  explicit WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPathsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated string paths = 2;
+  int paths_size() const;
+  private:
+  int _internal_paths_size() const;
+  public:
+  void clear_paths();
+  const std::string& paths(int index) const;
+  std::string* mutable_paths(int index);
+  void set_paths(int index, const std::string& value);
+  void set_paths(int index, std::string&& value);
+  void set_paths(int index, const char* value);
+  void set_paths(int index, const char* value, size_t size);
+  std::string* add_paths();
+  void add_paths(const std::string& value);
+  void add_paths(std::string&& value);
+  void add_paths(const char* value);
+  void add_paths(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& paths() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_paths();
+  private:
+  const std::string& _internal_paths(int index) const;
+  std::string* _internal_add_paths();
+  public:
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.WatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> paths_;
+    ::transfer::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.WatchResponse) */ {
+ public:
+  inline WatchResponse() : WatchResponse(nullptr) {}
+  ~WatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR WatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchResponse(const WatchResponse& from);
+  WatchResponse(WatchResponse&& from) noexcept
+    : WatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchResponse& operator=(const WatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchResponse& operator=(WatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchResponse* internal_default_instance() {
+    return reinterpret_cast<const WatchResponse*>(
+               &_WatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(WatchResponse& a, WatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchResponse& from) {
+    WatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.WatchResponse";
+  }
+  protected:
+  explicit WatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+  };
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:transfer.WatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::transfer::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangeNotification final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.ChangeNotification) */ {
+ public:
+  inline ChangeNotification() : ChangeNotification(nullptr) {}
+  ~ChangeNotification() override;
+  explicit PROTOBUF_CONSTEXPR ChangeNotification(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangeNotification(const ChangeNotification& from);
+  ChangeNotification(ChangeNotification&& from) noexcept
+    : ChangeNotification() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangeNotification& operator=(const ChangeNotification& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangeNotification& operator=(ChangeNotification&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangeNotification& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangeNotification* internal_default_instance() {
+    return reinterpret_cast<const ChangeNotification*>(
+               &_ChangeNotification_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(ChangeNotification& a, ChangeNotification& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangeNotification* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangeNotification* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangeNotification* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangeNotification>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangeNotification& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangeNotification& from) {
+    ChangeNotification::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangeNotification* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.ChangeNotification";
+  }
+  protected:
+  explicit ChangeNotification(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChangedFieldNumber = 3,
+    kRemovedFieldNumber = 4,
+    kPathFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+    kBaseVersionFieldNumber = 5,
+    kVersionFieldNumber = 6,
+  };
+  // repeated .transfer.DirectoryResponse.FileInfo changed = 3;
+  int changed_size() const;
+  private:
+  int _internal_changed_size() const;
+  public:
+  void clear_changed();
+  ::transfer::DirectoryResponse_FileInfo* mutable_changed(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >*
+      mutable_changed();
+  private:
+  const ::transfer::DirectoryResponse_FileInfo& _internal_changed(int index) const;
+  ::transfer::DirectoryResponse_FileInfo* _internal_add_changed();
+  public:
+  const ::transfer::DirectoryResponse_FileInfo& changed(int index) const;
+  ::transfer::DirectoryResponse_FileInfo* add_changed();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >&
+      changed() const;
+
+  // repeated string removed = 4;
+  int removed_size() const;
+  private:
+  int _internal_removed_size() const;
+  public:
+  void clear_removed();
+  const std::string& removed(int index) const;
+  std::string* mutable_removed(int index);
+  void set_removed(int index, const std::string& value);
+  void set_removed(int index, std::string&& value);
+  void set_removed(int index, const char* value);
+  void set_removed(int index, const char* value, size_t size);
+  std::string* add_removed();
+  void add_removed(const std::string& value);
+  void add_removed(std::string&& value);
+  void add_removed(const char* value);
+  void add_removed(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& removed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_removed();
+  private:
+  const std::string& _internal_removed(int index) const;
+  std::string* _internal_add_removed();
+  public:
+
+  // string path = 2;
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 base_version = 5;
+  void clear_base_version();
+  uint64_t base_version() const;
+  void set_base_version(uint64_t value);
+  private:
+  uint64_t _internal_base_version() const;
+  void _internal_set_base_version(uint64_t value);
+  public:
+
+  // uint64 version = 6;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.ChangeNotification)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo > changed_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> removed_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+    ::transfer::ResponseHeader* header_;
+    uint64_t base_version_;
+    uint64_t version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HelloRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.HelloRequest) */ {
+ public:
+  inline HelloRequest() : HelloRequest(nullptr) {}
+  ~HelloRequest() override;
+  explicit PROTOBUF_CONSTEXPR HelloRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HelloRequest(const HelloRequest& from);
+  HelloRequest(HelloRequest&& from) noexcept
+    : HelloRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HelloRequest& operator=(const HelloRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HelloRequest& operator=(HelloRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HelloRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HelloRequest* internal_default_instance() {
+    return reinterpret_cast<const HelloRequest*>(
+               &_HelloRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(HelloRequest& a, HelloRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HelloRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HelloRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HelloRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HelloRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HelloRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HelloRequest& from) {
+    HelloRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HelloRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.HelloRequest";
+  }
+  protected:
+  explicit HelloRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCompressionsFieldNumber = 5,
+    kHashAlgorithmsFieldNumber = 6,
+    kFeaturesFieldNumber = 10,
+    kClientNameFieldNumber = 11,
+    kHeaderFieldNumber = 1,
+    kProtocolVersionFieldNumber = 2,
+    kMinProtocolVersionFieldNumber = 3,
+    kMaxFrameSizeFieldNumber = 4,
+    kWindowSizeFieldNumber = 8,
+    kRawDataFramesFieldNumber = 7,
+    kMultiplexingFieldNumber = 9,
+  };
+  // repeated string compressions = 5;
+  int compressions_size() const;
+  private:
+  int _internal_compressions_size() const;
+  public:
+  void clear_compressions();
+  const std::string& compressions(int index) const;
+  std::string* mutable_compressions(int index);
+  void set_compressions(int index, const std::string& value);
+  void set_compressions(int index, std::string&& value);
+  void set_compressions(int index, const char* value);
+  void set_compressions(int index, const char* value, size_t size);
+  std::string* add_compressions();
+  void add_compressions(const std::string& value);
+  void add_compressions(std::string&& value);
+  void add_compressions(const char* value);
+  void add_compressions(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& compressions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_compressions();
+  private:
+  const std::string& _internal_compressions(int index) const;
+  std::string* _internal_add_compressions();
+  public:
+
+  // repeated string hash_algorithms = 6;
+  int hash_algorithms_size() const;
+  private:
+  int _internal_hash_algorithms_size() const;
+  public:
+  void clear_hash_algorithms();
+  const std::string& hash_algorithms(int index) const;
+  std::string* mutable_hash_algorithms(int index);
+  void set_hash_algorithms(int index, const std::string& value);
+  void set_hash_algorithms(int index, std::string&& value);
+  void set_hash_algorithms(int index, const char* value);
+  void set_hash_algorithms(int index, const char* value, size_t size);
+  std::string* add_hash_algorithms();
+  void add_hash_algorithms(const std::string& value);
+  void add_hash_algorithms(std::string&& value);
+  void add_hash_algorithms(const char* value);
+  void add_hash_algorithms(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& hash_algorithms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_hash_algorithms();
+  private:
+  const std::string& _internal_hash_algorithms(int index) const;
+  std::string* _internal_add_hash_algorithms();
+  public:
+
+  // repeated string features = 10;
+  int features_size() const;
+  private:
+  int _internal_features_size() const;
+  public:
+  void clear_features();
+  const std::string& features(int index) const;
+  std::string* mutable_features(int index);
+  void set_features(int index, const std::string& value);
+  void set_features(int index, std::string&& value);
+  void set_features(int index, const char* value);
+  void set_features(int index, const char* value, size_t size);
+  std::string* add_features();
+  void add_features(const std::string& value);
+  void add_features(std::string&& value);
+  void add_features(const char* value);
+  void add_features(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& features() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_features();
+  private:
+  const std::string& _internal_features(int index) const;
+  std::string* _internal_add_features();
+  public:
+
+  // string client_name = 11;
+  void clear_client_name();
+  const std::string& client_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_client_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_client_name();
+  PROTOBUF_NODISCARD std::string* release_client_name();
+  void set_allocated_client_name(std::string* client_name);
+  private:
+  const std::string& _internal_client_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_name(const std::string& value);
+  std::string* _internal_mutable_client_name();
+  public:
+
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // uint32 protocol_version = 2;
+  void clear_protocol_version();
+  uint32_t protocol_version() const;
+  void set_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_protocol_version() const;
+  void _internal_set_protocol_version(uint32_t value);
+  public:
+
+  // uint32 min_protocol_version = 3;
+  void clear_min_protocol_version();
+  uint32_t min_protocol_version() const;
+  void set_min_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_min_protocol_version() const;
+  void _internal_set_min_protocol_version(uint32_t value);
+  public:
+
+  // uint64 max_frame_size = 4;
+  void clear_max_frame_size();
+  uint64_t max_frame_size() const;
+  void set_max_frame_size(uint64_t value);
+  private:
+  uint64_t _internal_max_frame_size() const;
+  void _internal_set_max_frame_size(uint64_t value);
+  public:
+
+  // uint32 window_size = 8;
+  void clear_window_size();
+  uint32_t window_size() const;
+  void set_window_size(uint32_t value);
+  private:
+  uint32_t _internal_window_size() const;
+  void _internal_set_window_size(uint32_t value);
+  public:
+
+  // bool raw_data_frames = 7;
+  void clear_raw_data_frames();
+  bool raw_data_frames() const;
+  void set_raw_data_frames(bool value);
+  private:
+  bool _internal_raw_data_frames() const;
+  void _internal_set_raw_data_frames(bool value);
+  public:
+
+  // bool multiplexing = 9;
+  void clear_multiplexing();
+  bool multiplexing() const;
+  void set_multiplexing(bool value);
+  private:
+  bool _internal_multiplexing() const;
+  void _internal_set_multiplexing(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.HelloRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> compressions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> hash_algorithms_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> features_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_name_;
+    ::transfer::RequestHeader* header_;
+    uint32_t protocol_version_;
+    uint32_t min_protocol_version_;
+    uint64_t max_frame_size_;
+    uint32_t window_size_;
+    bool raw_data_frames_;
+    bool multiplexing_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HelloResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.HelloResponse) */ {
+ public:
+  inline HelloResponse() : HelloResponse(nullptr) {}
+  ~HelloResponse() override;
+  explicit PROTOBUF_CONSTEXPR HelloResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HelloResponse(const HelloResponse& from);
+  HelloResponse(HelloResponse&& from) noexcept
+    : HelloResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HelloResponse& operator=(const HelloResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HelloResponse& operator=(HelloResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HelloResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HelloResponse* internal_default_instance() {
+    return reinterpret_cast<const HelloResponse*>(
+               &_HelloResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(HelloResponse& a, HelloResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HelloResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HelloResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HelloResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HelloResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HelloResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HelloResponse& from) {
+    HelloResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HelloResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.HelloResponse";
+  }
+  protected:
+  explicit HelloResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFeaturesFieldNumber = 9,
+    kCompressionFieldNumber = 4,
+    kHashAlgorithmFieldNumber = 5,
+    kServerNameFieldNumber = 10,
+    kHeaderFieldNumber = 1,
+    kMaxFrameSizeFieldNumber = 3,
+    kProtocolVersionFieldNumber = 2,
+    kWindowSizeFieldNumber = 7,
+    kRawDataFramesFieldNumber = 6,
+    kMultiplexingFieldNumber = 8,
+  };
+  // repeated string features = 9;
+  int features_size() const;
+  private:
+  int _internal_features_size() const;
+  public:
+  void clear_features();
+  const std::string& features(int index) const;
+  std::string* mutable_features(int index);
+  void set_features(int index, const std::string& value);
+  void set_features(int index, std::string&& value);
+  void set_features(int index, const char* value);
+  void set_features(int index, const char* value, size_t size);
+  std::string* add_features();
+  void add_features(const std::string& value);
+  void add_features(std::string&& value);
+  void add_features(const char* value);
+  void add_features(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& features() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_features();
+  private:
+  const std::string& _internal_features(int index) const;
+  std::string* _internal_add_features();
+  public:
+
+  // string compression = 4;
+  void clear_compression();
+  const std::string& compression() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_compression(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_compression();
+  PROTOBUF_NODISCARD std::string* release_compression();
+  void set_allocated_compression(std::string* compression);
+  private:
+  const std::string& _internal_compression() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_compression(const std::string& value);
+  std::string* _internal_mutable_compression();
+  public:
+
+  // string hash_algorithm = 5;
+  void clear_hash_algorithm();
+  const std::string& hash_algorithm() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hash_algorithm(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hash_algorithm();
+  PROTOBUF_NODISCARD std::string* release_hash_algorithm();
+  void set_allocated_hash_algorithm(std::string* hash_algorithm);
+  private:
+  const std::string& _internal_hash_algorithm() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hash_algorithm(const std::string& value);
+  std::string* _internal_mutable_hash_algorithm();
+  public:
+
+  // string server_name = 10;
+  void clear_server_name();
+  const std::string& server_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_server_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_server_name();
+  PROTOBUF_NODISCARD std::string* release_server_name();
+  void set_allocated_server_name(std::string* server_name);
+  private:
+  const std::string& _internal_server_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_server_name(const std::string& value);
+  std::string* _internal_mutable_server_name();
+  public:
+
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 max_frame_size = 3;
+  void clear_max_frame_size();
+  uint64_t max_frame_size() const;
+  void set_max_frame_size(uint64_t value);
+  private:
+  uint64_t _internal_max_frame_size() const;
+  void _internal_set_max_frame_size(uint64_t value);
+  public:
+
+  // uint32 protocol_version = 2;
+  void clear_protocol_version();
+  uint32_t protocol_version() const;
+  void set_protocol_version(uint32_t value);
+  private:
+  uint32_t _internal_protocol_version() const;
+  void _internal_set_protocol_version(uint32_t value);
+  public:
+
+  // uint32 window_size = 7;
+  void clear_window_size();
+  uint32_t window_size() const;
+  void set_window_size(uint32_t value);
+  private:
+  uint32_t _internal_window_size() const;
+  void _internal_set_window_size(uint32_t value);
+  public:
+
+  // bool raw_data_frames = 6;
+  void clear_raw_data_frames();
+  bool raw_data_frames() const;
+  void set_raw_data_frames(bool value);
+  private:
+  bool _internal_raw_data_frames() const;
+  void _internal_set_raw_data_frames(bool value);
+  public:
+
+  // bool multiplexing = 8;
+  void clear_multiplexing();
+  bool multiplexing() const;
+  void set_multiplexing(bool value);
+  private:
+  bool _internal_multiplexing() const;
+  void _internal_set_multiplexing(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.HelloResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> features_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr compression_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hash_algorithm_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_name_;
+    ::transfer::ResponseHeader* header_;
+    uint64_t max_frame_size_;
+    uint32_t protocol_version_;
+    uint32_t window_size_;
+    bool raw_data_frames_;
+    bool multiplexing_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HeartbeatRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.HeartbeatRequest) */ {
+ public:
+  inline HeartbeatRequest() : HeartbeatRequest(nullptr) {}
+  ~HeartbeatRequest() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HeartbeatRequest(const HeartbeatRequest& from);
+  HeartbeatRequest(HeartbeatRequest&& from) noexcept
+    : HeartbeatRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HeartbeatRequest& operator=(const HeartbeatRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HeartbeatRequest& operator=(HeartbeatRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HeartbeatRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatRequest* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatRequest*>(
+               &_HeartbeatRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(HeartbeatRequest& a, HeartbeatRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HeartbeatRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartbeatRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HeartbeatRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatRequest& from) {
+    HeartbeatRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HeartbeatRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.HeartbeatRequest";
+  }
+  protected:
+  explicit HeartbeatRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kTimestampMsFieldNumber = 2,
+  };
+  // .transfer.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::RequestHeader* release_header();
+  ::transfer::RequestHeader* mutable_header();
+  void set_allocated_header(::transfer::RequestHeader* header);
+  private:
+  const ::transfer::RequestHeader& _internal_header() const;
+  ::transfer::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::RequestHeader* header);
+  ::transfer::RequestHeader* unsafe_arena_release_header();
+
+  // uint64 timestamp_ms = 2;
+  void clear_timestamp_ms();
+  uint64_t timestamp_ms() const;
+  void set_timestamp_ms(uint64_t value);
+  private:
+  uint64_t _internal_timestamp_ms() const;
+  void _internal_set_timestamp_ms(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.HeartbeatRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::transfer::RequestHeader* header_;
+    uint64_t timestamp_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HeartbeatResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:transfer.HeartbeatResponse) */ {
+ public:
+  inline HeartbeatResponse() : HeartbeatResponse(nullptr) {}
+  ~HeartbeatResponse() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HeartbeatResponse(const HeartbeatResponse& from);
+  HeartbeatResponse(HeartbeatResponse&& from) noexcept
+    : HeartbeatResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HeartbeatResponse& operator=(const HeartbeatResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HeartbeatResponse& operator=(HeartbeatResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HeartbeatResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatResponse* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatResponse*>(
+               &_HeartbeatResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(HeartbeatResponse& a, HeartbeatResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HeartbeatResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HeartbeatResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HeartbeatResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatResponse& from) {
+    HeartbeatResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HeartbeatResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "transfer.HeartbeatResponse";
+  }
+  protected:
+  explicit HeartbeatResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kTimestampMsFieldNumber = 2,
+  };
+  // .transfer.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::transfer::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::transfer::ResponseHeader* release_header();
+  ::transfer::ResponseHeader* mutable_header();
+  void set_allocated_header(::transfer::ResponseHeader* header);
+  private:
+  const ::transfer::ResponseHeader& _internal_header() const;
+  ::transfer::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::transfer::ResponseHeader* header);
+  ::transfer::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 timestamp_ms = 2;
+  void clear_timestamp_ms();
+  uint64_t timestamp_ms() const;
+  void set_timestamp_ms(uint64_t value);
+  private:
+  uint64_t _internal_timestamp_ms() const;
+  void _internal_set_timestamp_ms(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:transfer.HeartbeatResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::transfer::ResponseHeader* header_;
+    uint64_t timestamp_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transfer_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RequestHeader
+
+// string session_id = 1;
+inline void RequestHeader::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& RequestHeader::session_id() const {
+  // @@protoc_insertion_point(field_get:transfer.RequestHeader.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RequestHeader::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.RequestHeader.session_id)
+}
+inline std::string* RequestHeader::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:transfer.RequestHeader.session_id)
+  return _s;
+}
+inline const std::string& RequestHeader::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void RequestHeader::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RequestHeader::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RequestHeader::release_session_id() {
+  // @@protoc_insertion_point(field_release:transfer.RequestHeader.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void RequestHeader::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.RequestHeader.session_id)
+}
+
+// .transfer.MessageType type = 2;
+inline void RequestHeader::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::transfer::MessageType RequestHeader::_internal_type() const {
+  return static_cast< ::transfer::MessageType >(_impl_.type_);
+}
+inline ::transfer::MessageType RequestHeader::type() const {
+  // @@protoc_insertion_point(field_get:transfer.RequestHeader.type)
+  return _internal_type();
+}
+inline void RequestHeader::_internal_set_type(::transfer::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void RequestHeader::set_type(::transfer::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:transfer.RequestHeader.type)
+}
+
+// uint64 timestamp = 3;
+inline void RequestHeader::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t RequestHeader::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t RequestHeader::timestamp() const {
+  // @@protoc_insertion_point(field_get:transfer.RequestHeader.timestamp)
+  return _internal_timestamp();
+}
+inline void RequestHeader::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void RequestHeader::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:transfer.RequestHeader.timestamp)
+}
+
+// uint64 sequence = 4;
+inline void RequestHeader::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t RequestHeader::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t RequestHeader::sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.RequestHeader.sequence)
+  return _internal_sequence();
+}
+inline void RequestHeader::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void RequestHeader::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.RequestHeader.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// ResponseHeader
+
+// string session_id = 1;
+inline void ResponseHeader::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& ResponseHeader::session_id() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResponseHeader::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.session_id)
+}
+inline std::string* ResponseHeader::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.session_id)
+  return _s;
+}
+inline const std::string& ResponseHeader::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void ResponseHeader::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::release_session_id() {
+  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void ResponseHeader::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.session_id)
+}
+
+// .transfer.MessageType type = 2;
+inline void ResponseHeader::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::transfer::MessageType ResponseHeader::_internal_type() const {
+  return static_cast< ::transfer::MessageType >(_impl_.type_);
+}
+inline ::transfer::MessageType ResponseHeader::type() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.type)
+  return _internal_type();
+}
+inline void ResponseHeader::_internal_set_type(::transfer::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ResponseHeader::set_type(::transfer::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.type)
+}
+
+// uint64 timestamp = 3;
+inline void ResponseHeader::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t ResponseHeader::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t ResponseHeader::timestamp() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.timestamp)
+  return _internal_timestamp();
+}
+inline void ResponseHeader::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void ResponseHeader::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.timestamp)
+}
+
+// bool success = 4;
+inline void ResponseHeader::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool ResponseHeader::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool ResponseHeader::success() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.success)
+  return _internal_success();
+}
+inline void ResponseHeader::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void ResponseHeader::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.success)
+}
+
+// string error_code = 5;
+inline void ResponseHeader::clear_error_code() {
+  _impl_.error_code_.ClearToEmpty();
+}
+inline const std::string& ResponseHeader::error_code() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.error_code)
+  return _internal_error_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResponseHeader::set_error_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.error_code)
+}
+inline std::string* ResponseHeader::mutable_error_code() {
+  std::string* _s = _internal_mutable_error_code();
+  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.error_code)
+  return _s;
+}
+inline const std::string& ResponseHeader::_internal_error_code() const {
+  return _impl_.error_code_.Get();
+}
+inline void ResponseHeader::_internal_set_error_code(const std::string& value) {
+  
+  _impl_.error_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::_internal_mutable_error_code() {
+  
+  return _impl_.error_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::release_error_code() {
+  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.error_code)
+  return _impl_.error_code_.Release();
+}
+inline void ResponseHeader::set_allocated_error_code(std::string* error_code) {
+  if (error_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_code_.SetAllocated(error_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_code_.IsDefault()) {
+    _impl_.error_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.error_code)
+}
+
+// string error_message = 6;
+inline void ResponseHeader::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& ResponseHeader::error_message() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResponseHeader::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.error_message)
+}
+inline std::string* ResponseHeader::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.error_message)
+  return _s;
+}
+inline const std::string& ResponseHeader::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void ResponseHeader::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResponseHeader::release_error_message() {
+  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void ResponseHeader::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.error_message)
+}
+
+// uint64 sequence = 7;
+inline void ResponseHeader::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t ResponseHeader::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t ResponseHeader::sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.sequence)
+  return _internal_sequence();
+}
+inline void ResponseHeader::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void ResponseHeader::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.sequence)
+}
+
+// -------------------------------------------------------------------
+
+// DirectoryRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool DirectoryRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool DirectoryRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void DirectoryRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& DirectoryRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& DirectoryRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.header)
+  return _internal_header();
+}
+inline void DirectoryRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.DirectoryRequest.header)
+}
+inline ::transfer::RequestHeader* DirectoryRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* DirectoryRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* DirectoryRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* DirectoryRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.header)
+  return _msg;
+}
+inline void DirectoryRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.header)
+}
+
+// string current_path = 2;
+inline void DirectoryRequest::clear_current_path() {
+  _impl_.current_path_.ClearToEmpty();
+}
+inline const std::string& DirectoryRequest::current_path() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.current_path)
+  return _internal_current_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryRequest::set_current_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.current_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.current_path)
+}
+inline std::string* DirectoryRequest::mutable_current_path() {
+  std::string* _s = _internal_mutable_current_path();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.current_path)
+  return _s;
+}
+inline const std::string& DirectoryRequest::_internal_current_path() const {
+  return _impl_.current_path_.Get();
+}
+inline void DirectoryRequest::_internal_set_current_path(const std::string& value) {
+  
+  _impl_.current_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::_internal_mutable_current_path() {
+  
+  return _impl_.current_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::release_current_path() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.current_path)
+  return _impl_.current_path_.Release();
+}
+inline void DirectoryRequest::set_allocated_current_path(std::string* current_path) {
+  if (current_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.current_path_.SetAllocated(current_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.current_path_.IsDefault()) {
+    _impl_.current_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.current_path)
+}
+
+// string dir_name = 3;
+inline void DirectoryRequest::clear_dir_name() {
+  _impl_.dir_name_.ClearToEmpty();
+}
+inline const std::string& DirectoryRequest::dir_name() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.dir_name)
+  return _internal_dir_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryRequest::set_dir_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.dir_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.dir_name)
+}
+inline std::string* DirectoryRequest::mutable_dir_name() {
+  std::string* _s = _internal_mutable_dir_name();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.dir_name)
+  return _s;
+}
+inline const std::string& DirectoryRequest::_internal_dir_name() const {
+  return _impl_.dir_name_.Get();
+}
+inline void DirectoryRequest::_internal_set_dir_name(const std::string& value) {
+  
+  _impl_.dir_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::_internal_mutable_dir_name() {
+  
+  return _impl_.dir_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::release_dir_name() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.dir_name)
+  return _impl_.dir_name_.Release();
+}
+inline void DirectoryRequest::set_allocated_dir_name(std::string* dir_name) {
+  if (dir_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.dir_name_.SetAllocated(dir_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dir_name_.IsDefault()) {
+    _impl_.dir_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.dir_name)
+}
+
+// bool is_parent = 4;
+inline void DirectoryRequest::clear_is_parent() {
+  _impl_.is_parent_ = false;
+}
+inline bool DirectoryRequest::_internal_is_parent() const {
+  return _impl_.is_parent_;
+}
+inline bool DirectoryRequest::is_parent() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.is_parent)
+  return _internal_is_parent();
+}
+inline void DirectoryRequest::_internal_set_is_parent(bool value) {
+  
+  _impl_.is_parent_ = value;
+}
+inline void DirectoryRequest::set_is_parent(bool value) {
+  _internal_set_is_parent(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.is_parent)
+}
+
+// string cursor = 5;
+inline void DirectoryRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& DirectoryRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.cursor)
+}
+inline std::string* DirectoryRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.cursor)
+  return _s;
+}
+inline const std::string& DirectoryRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void DirectoryRequest::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void DirectoryRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.cursor)
+}
+
+// uint32 page_size = 6;
+inline void DirectoryRequest::clear_page_size() {
+  _impl_.page_size_ = 0u;
+}
+inline uint32_t DirectoryRequest::_internal_page_size() const {
+  return _impl_.page_size_;
+}
+inline uint32_t DirectoryRequest::page_size() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.page_size)
+  return _internal_page_size();
+}
+inline void DirectoryRequest::_internal_set_page_size(uint32_t value) {
+  
+  _impl_.page_size_ = value;
+}
+inline void DirectoryRequest::set_page_size(uint32_t value) {
+  _internal_set_page_size(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.page_size)
+}
+
+// string if_none_match = 7;
+inline void DirectoryRequest::clear_if_none_match() {
+  _impl_.if_none_match_.ClearToEmpty();
+}
+inline const std::string& DirectoryRequest::if_none_match() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.if_none_match)
+  return _internal_if_none_match();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryRequest::set_if_none_match(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.if_none_match_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.if_none_match)
+}
+inline std::string* DirectoryRequest::mutable_if_none_match() {
+  std::string* _s = _internal_mutable_if_none_match();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.if_none_match)
+  return _s;
+}
+inline const std::string& DirectoryRequest::_internal_if_none_match() const {
+  return _impl_.if_none_match_.Get();
+}
+inline void DirectoryRequest::_internal_set_if_none_match(const std::string& value) {
+  
+  _impl_.if_none_match_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::_internal_mutable_if_none_match() {
+  
+  return _impl_.if_none_match_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryRequest::release_if_none_match() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.if_none_match)
+  return _impl_.if_none_match_.Release();
+}
+inline void DirectoryRequest::set_allocated_if_none_match(std::string* if_none_match) {
+  if (if_none_match != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.if_none_match_.SetAllocated(if_none_match, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.if_none_match_.IsDefault()) {
+    _impl_.if_none_match_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.if_none_match)
+}
+
+// uint64 since_version = 8;
+inline void DirectoryRequest::clear_since_version() {
+  _impl_.since_version_ = uint64_t{0u};
+}
+inline uint64_t DirectoryRequest::_internal_since_version() const {
+  return _impl_.since_version_;
+}
+inline uint64_t DirectoryRequest::since_version() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.since_version)
+  return _internal_since_version();
+}
+inline void DirectoryRequest::_internal_set_since_version(uint64_t value) {
+  
+  _impl_.since_version_ = value;
+}
+inline void DirectoryRequest::set_since_version(uint64_t value) {
+  _internal_set_since_version(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.since_version)
+}
+
+// .transfer.ListingEncoding encoding = 9;
+inline void DirectoryRequest::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::transfer::ListingEncoding DirectoryRequest::_internal_encoding() const {
+  return static_cast< ::transfer::ListingEncoding >(_impl_.encoding_);
+}
+inline ::transfer::ListingEncoding DirectoryRequest::encoding() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.encoding)
+  return _internal_encoding();
+}
+inline void DirectoryRequest::_internal_set_encoding(::transfer::ListingEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void DirectoryRequest::set_encoding(::transfer::ListingEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.encoding)
+}
+
+// -------------------------------------------------------------------
+
+// ListingColumns
+
+// bytes names = 1;
+inline void ListingColumns::clear_names() {
+  _impl_.names_.ClearToEmpty();
+}
+inline const std::string& ListingColumns::names() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingColumns.names)
+  return _internal_names();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListingColumns::set_names(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.names_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ListingColumns.names)
+}
+inline std::string* ListingColumns::mutable_names() {
+  std::string* _s = _internal_mutable_names();
+  // @@protoc_insertion_point(field_mutable:transfer.ListingColumns.names)
+  return _s;
+}
+inline const std::string& ListingColumns::_internal_names() const {
+  return _impl_.names_.Get();
+}
+inline void ListingColumns::_internal_set_names(const std::string& value) {
+  
+  _impl_.names_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListingColumns::_internal_mutable_names() {
+  
+  return _impl_.names_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListingColumns::release_names() {
+  // @@protoc_insertion_point(field_release:transfer.ListingColumns.names)
+  return _impl_.names_.Release();
+}
+inline void ListingColumns::set_allocated_names(std::string* names) {
+  if (names != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.names_.SetAllocated(names, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.names_.IsDefault()) {
+    _impl_.names_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ListingColumns.names)
+}
+
+// repeated uint32 name_lengths = 2;
+inline int ListingColumns::_internal_name_lengths_size() const {
+  return _impl_.name_lengths_.size();
+}
+inline int ListingColumns::name_lengths_size() const {
+  return _internal_name_lengths_size();
+}
+inline void ListingColumns::clear_name_lengths() {
+  _impl_.name_lengths_.Clear();
+}
+inline uint32_t ListingColumns::_internal_name_lengths(int index) const {
+  return _impl_.name_lengths_.Get(index);
+}
+inline uint32_t ListingColumns::name_lengths(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ListingColumns.name_lengths)
+  return _internal_name_lengths(index);
+}
+inline void ListingColumns::set_name_lengths(int index, uint32_t value) {
+  _impl_.name_lengths_.Set(index, value);
+  // @@protoc_insertion_point(field_set:transfer.ListingColumns.name_lengths)
+}
+inline void ListingColumns::_internal_add_name_lengths(uint32_t value) {
+  _impl_.name_lengths_.Add(value);
+}
+inline void ListingColumns::add_name_lengths(uint32_t value) {
+  _internal_add_name_lengths(value);
+  // @@protoc_insertion_point(field_add:transfer.ListingColumns.name_lengths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ListingColumns::_internal_name_lengths() const {
+  return _impl_.name_lengths_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ListingColumns::name_lengths() const {
+  // @@protoc_insertion_point(field_list:transfer.ListingColumns.name_lengths)
+  return _internal_name_lengths();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ListingColumns::_internal_mutable_name_lengths() {
+  return &_impl_.name_lengths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ListingColumns::mutable_name_lengths() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ListingColumns.name_lengths)
+  return _internal_mutable_name_lengths();
+}
+
+// repeated uint64 sizes = 3;
+inline int ListingColumns::_internal_sizes_size() const {
+  return _impl_.sizes_.size();
+}
+inline int ListingColumns::sizes_size() const {
+  return _internal_sizes_size();
+}
+inline void ListingColumns::clear_sizes() {
+  _impl_.sizes_.Clear();
+}
+inline uint64_t ListingColumns::_internal_sizes(int index) const {
+  return _impl_.sizes_.Get(index);
+}
+inline uint64_t ListingColumns::sizes(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ListingColumns.sizes)
+  return _internal_sizes(index);
+}
+inline void ListingColumns::set_sizes(int index, uint64_t value) {
+  _impl_.sizes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:transfer.ListingColumns.sizes)
+}
+inline void ListingColumns::_internal_add_sizes(uint64_t value) {
+  _impl_.sizes_.Add(value);
+}
+inline void ListingColumns::add_sizes(uint64_t value) {
+  _internal_add_sizes(value);
+  // @@protoc_insertion_point(field_add:transfer.ListingColumns.sizes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ListingColumns::_internal_sizes() const {
+  return _impl_.sizes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ListingColumns::sizes() const {
+  // @@protoc_insertion_point(field_list:transfer.ListingColumns.sizes)
+  return _internal_sizes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ListingColumns::_internal_mutable_sizes() {
+  return &_impl_.sizes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ListingColumns::mutable_sizes() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ListingColumns.sizes)
+  return _internal_mutable_sizes();
+}
+
+// repeated uint64 modify_times = 4;
+inline int ListingColumns::_internal_modify_times_size() const {
+  return _impl_.modify_times_.size();
+}
+inline int ListingColumns::modify_times_size() const {
+  return _internal_modify_times_size();
+}
+inline void ListingColumns::clear_modify_times() {
+  _impl_.modify_times_.Clear();
+}
+inline uint64_t ListingColumns::_internal_modify_times(int index) const {
+  return _impl_.modify_times_.Get(index);
+}
+inline uint64_t ListingColumns::modify_times(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ListingColumns.modify_times)
+  return _internal_modify_times(index);
+}
+inline void ListingColumns::set_modify_times(int index, uint64_t value) {
+  _impl_.modify_times_.Set(index, value);
+  // @@protoc_insertion_point(field_set:transfer.ListingColumns.modify_times)
+}
+inline void ListingColumns::_internal_add_modify_times(uint64_t value) {
+  _impl_.modify_times_.Add(value);
+}
+inline void ListingColumns::add_modify_times(uint64_t value) {
+  _internal_add_modify_times(value);
+  // @@protoc_insertion_point(field_add:transfer.ListingColumns.modify_times)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ListingColumns::_internal_modify_times() const {
+  return _impl_.modify_times_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ListingColumns::modify_times() const {
+  // @@protoc_insertion_point(field_list:transfer.ListingColumns.modify_times)
+  return _internal_modify_times();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ListingColumns::_internal_mutable_modify_times() {
+  return &_impl_.modify_times_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ListingColumns::mutable_modify_times() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ListingColumns.modify_times)
+  return _internal_mutable_modify_times();
+}
+
+// repeated uint32 modes = 5;
+inline int ListingColumns::_internal_modes_size() const {
+  return _impl_.modes_.size();
+}
+inline int ListingColumns::modes_size() const {
+  return _internal_modes_size();
+}
+inline void ListingColumns::clear_modes() {
+  _impl_.modes_.Clear();
+}
+inline uint32_t ListingColumns::_internal_modes(int index) const {
+  return _impl_.modes_.Get(index);
+}
+inline uint32_t ListingColumns::modes(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ListingColumns.modes)
+  return _internal_modes(index);
+}
+inline void ListingColumns::set_modes(int index, uint32_t value) {
+  _impl_.modes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:transfer.ListingColumns.modes)
+}
+inline void ListingColumns::_internal_add_modes(uint32_t value) {
+  _impl_.modes_.Add(value);
+}
+inline void ListingColumns::add_modes(uint32_t value) {
+  _internal_add_modes(value);
+  // @@protoc_insertion_point(field_add:transfer.ListingColumns.modes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ListingColumns::_internal_modes() const {
+  return _impl_.modes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ListingColumns::modes() const {
+  // @@protoc_insertion_point(field_list:transfer.ListingColumns.modes)
+  return _internal_modes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ListingColumns::_internal_mutable_modes() {
+  return &_impl_.modes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ListingColumns::mutable_modes() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ListingColumns.modes)
+  return _internal_mutable_modes();
+}
+
+// -------------------------------------------------------------------
+
+// DirectoryResponse_FileInfo
+
+// string name = 1;
+inline void DirectoryResponse_FileInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse_FileInfo::name() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse_FileInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.name)
+}
+inline std::string* DirectoryResponse_FileInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.name)
+  return _s;
+}
+inline const std::string& DirectoryResponse_FileInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::release_name() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.name)
+  return _impl_.name_.Release();
+}
+inline void DirectoryResponse_FileInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.name)
+}
+
+// bool is_directory = 2;
+inline void DirectoryResponse_FileInfo::clear_is_directory() {
+  _impl_.is_directory_ = false;
+}
+inline bool DirectoryResponse_FileInfo::_internal_is_directory() const {
+  return _impl_.is_directory_;
+}
+inline bool DirectoryResponse_FileInfo::is_directory() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.is_directory)
+  return _internal_is_directory();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_is_directory(bool value) {
+  
+  _impl_.is_directory_ = value;
+}
+inline void DirectoryResponse_FileInfo::set_is_directory(bool value) {
+  _internal_set_is_directory(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.is_directory)
+}
+
+// uint64 size = 3;
+inline void DirectoryResponse_FileInfo::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t DirectoryResponse_FileInfo::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t DirectoryResponse_FileInfo::size() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.size)
+  return _internal_size();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void DirectoryResponse_FileInfo::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.size)
+}
+
+// string modify_time = 4;
+inline void DirectoryResponse_FileInfo::clear_modify_time() {
+  _impl_.modify_time_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse_FileInfo::modify_time() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.modify_time)
+  return _internal_modify_time();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse_FileInfo::set_modify_time(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.modify_time_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.modify_time)
+}
+inline std::string* DirectoryResponse_FileInfo::mutable_modify_time() {
+  std::string* _s = _internal_mutable_modify_time();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.modify_time)
+  return _s;
+}
+inline const std::string& DirectoryResponse_FileInfo::_internal_modify_time() const {
+  return _impl_.modify_time_.Get();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_modify_time(const std::string& value) {
+  
+  _impl_.modify_time_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::_internal_mutable_modify_time() {
+  
+  return _impl_.modify_time_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::release_modify_time() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.modify_time)
+  return _impl_.modify_time_.Release();
+}
+inline void DirectoryResponse_FileInfo::set_allocated_modify_time(std::string* modify_time) {
+  if (modify_time != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.modify_time_.SetAllocated(modify_time, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.modify_time_.IsDefault()) {
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.modify_time)
+}
+
+// string permissions = 5;
+inline void DirectoryResponse_FileInfo::clear_permissions() {
+  _impl_.permissions_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse_FileInfo::permissions() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.permissions)
+  return _internal_permissions();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse_FileInfo::set_permissions(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.permissions_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.permissions)
+}
+inline std::string* DirectoryResponse_FileInfo::mutable_permissions() {
+  std::string* _s = _internal_mutable_permissions();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.permissions)
+  return _s;
+}
+inline const std::string& DirectoryResponse_FileInfo::_internal_permissions() const {
+  return _impl_.permissions_.Get();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_permissions(const std::string& value) {
+  
+  _impl_.permissions_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::_internal_mutable_permissions() {
+  
+  return _impl_.permissions_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::release_permissions() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.permissions)
+  return _impl_.permissions_.Release();
+}
+inline void DirectoryResponse_FileInfo::set_allocated_permissions(std::string* permissions) {
+  if (permissions != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.permissions_.SetAllocated(permissions, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.permissions_.IsDefault()) {
+    _impl_.permissions_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.permissions)
+}
+
+// string task_id = 6;
+inline void DirectoryResponse_FileInfo::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse_FileInfo::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.task_id)
+  return _internal_task_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse_FileInfo::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.task_id)
+}
+inline std::string* DirectoryResponse_FileInfo::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.task_id)
+  return _s;
+}
+inline const std::string& DirectoryResponse_FileInfo::_internal_task_id() const {
+  return _impl_.task_id_.Get();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_task_id(const std::string& value) {
+  
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::_internal_mutable_task_id() {
+  
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse_FileInfo::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.task_id)
+  return _impl_.task_id_.Release();
+}
+inline void DirectoryResponse_FileInfo::set_allocated_task_id(std::string* task_id) {
+  if (task_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.task_id)
+}
+
+// .transfer.TransferStatus status = 7;
+inline void DirectoryResponse_FileInfo::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::transfer::TransferStatus DirectoryResponse_FileInfo::_internal_status() const {
+  return static_cast< ::transfer::TransferStatus >(_impl_.status_);
+}
+inline ::transfer::TransferStatus DirectoryResponse_FileInfo::status() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.status)
+  return _internal_status();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_status(::transfer::TransferStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void DirectoryResponse_FileInfo::set_status(::transfer::TransferStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.status)
+}
+
+// uint64 modify_time_ns = 8;
+inline void DirectoryResponse_FileInfo::clear_modify_time_ns() {
+  _impl_.modify_time_ns_ = uint64_t{0u};
+}
+inline uint64_t DirectoryResponse_FileInfo::_internal_modify_time_ns() const {
+  return _impl_.modify_time_ns_;
+}
+inline uint64_t DirectoryResponse_FileInfo::modify_time_ns() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.modify_time_ns)
+  return _internal_modify_time_ns();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_modify_time_ns(uint64_t value) {
+  
+  _impl_.modify_time_ns_ = value;
+}
+inline void DirectoryResponse_FileInfo::set_modify_time_ns(uint64_t value) {
+  _internal_set_modify_time_ns(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.modify_time_ns)
+}
+
+// uint32 mode = 9;
+inline void DirectoryResponse_FileInfo::clear_mode() {
+  _impl_.mode_ = 0u;
+}
+inline uint32_t DirectoryResponse_FileInfo::_internal_mode() const {
+  return _impl_.mode_;
+}
+inline uint32_t DirectoryResponse_FileInfo::mode() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.mode)
+  return _internal_mode();
+}
+inline void DirectoryResponse_FileInfo::_internal_set_mode(uint32_t value) {
+  
+  _impl_.mode_ = value;
+}
+inline void DirectoryResponse_FileInfo::set_mode(uint32_t value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.mode)
+}
+
+// -------------------------------------------------------------------
+
+// DirectoryResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool DirectoryResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool DirectoryResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void DirectoryResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& DirectoryResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& DirectoryResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.header)
+  return _internal_header();
+}
+inline void DirectoryResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.DirectoryResponse.header)
+}
+inline ::transfer::ResponseHeader* DirectoryResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* DirectoryResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* DirectoryResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* DirectoryResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.header)
+  return _msg;
+}
+inline void DirectoryResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.header)
+}
+
+// string path = 2;
+inline void DirectoryResponse::clear_path() {
+  _impl_.path_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse::path() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.path)
+  return _internal_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.path)
+}
+inline std::string* DirectoryResponse::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.path)
+  return _s;
+}
+inline const std::string& DirectoryResponse::_internal_path() const {
+  return _impl_.path_.Get();
+}
+inline void DirectoryResponse::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::release_path() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.path)
+  return _impl_.path_.Release();
+}
+inline void DirectoryResponse::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.path)
+}
+
+// repeated .transfer.DirectoryResponse.FileInfo files = 3;
+inline int DirectoryResponse::_internal_files_size() const {
+  return _impl_.files_.size();
+}
+inline int DirectoryResponse::files_size() const {
+  return _internal_files_size();
+}
+inline void DirectoryResponse::clear_files() {
+  _impl_.files_.Clear();
+}
+inline ::transfer::DirectoryResponse_FileInfo* DirectoryResponse::mutable_files(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.files)
+  return _impl_.files_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >*
+DirectoryResponse::mutable_files() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.DirectoryResponse.files)
+  return &_impl_.files_;
+}
+inline const ::transfer::DirectoryResponse_FileInfo& DirectoryResponse::_internal_files(int index) const {
+  return _impl_.files_.Get(index);
+}
+inline const ::transfer::DirectoryResponse_FileInfo& DirectoryResponse::files(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.files)
+  return _internal_files(index);
+}
+inline ::transfer::DirectoryResponse_FileInfo* DirectoryResponse::_internal_add_files() {
+  return _impl_.files_.Add();
+}
+inline ::transfer::DirectoryResponse_FileInfo* DirectoryResponse::add_files() {
+  ::transfer::DirectoryResponse_FileInfo* _add = _internal_add_files();
+  // @@protoc_insertion_point(field_add:transfer.DirectoryResponse.files)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >&
+DirectoryResponse::files() const {
+  // @@protoc_insertion_point(field_list:transfer.DirectoryResponse.files)
+  return _impl_.files_;
+}
+
+// string next_cursor = 4;
+inline void DirectoryResponse::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.next_cursor)
+}
+inline std::string* DirectoryResponse::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.next_cursor)
+  return _s;
+}
+inline const std::string& DirectoryResponse::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void DirectoryResponse::_internal_set_next_cursor(const std::string& value) {
+  
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::_internal_mutable_next_cursor() {
+  
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.next_cursor)
+  return _impl_.next_cursor_.Release();
+}
+inline void DirectoryResponse::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.next_cursor)
+}
+
+// bool has_more = 5;
+inline void DirectoryResponse::clear_has_more() {
+  _impl_.has_more_ = false;
+}
+inline bool DirectoryResponse::_internal_has_more() const {
+  return _impl_.has_more_;
+}
+inline bool DirectoryResponse::has_more() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.has_more)
+  return _internal_has_more();
+}
+inline void DirectoryResponse::_internal_set_has_more(bool value) {
+  
+  _impl_.has_more_ = value;
+}
+inline void DirectoryResponse::set_has_more(bool value) {
+  _internal_set_has_more(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.has_more)
+}
+
+// uint64 total_count = 6;
+inline void DirectoryResponse::clear_total_count() {
+  _impl_.total_count_ = uint64_t{0u};
+}
+inline uint64_t DirectoryResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline uint64_t DirectoryResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.total_count)
+  return _internal_total_count();
+}
+inline void DirectoryResponse::_internal_set_total_count(uint64_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void DirectoryResponse::set_total_count(uint64_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.total_count)
+}
+
+// string etag = 7;
+inline void DirectoryResponse::clear_etag() {
+  _impl_.etag_.ClearToEmpty();
+}
+inline const std::string& DirectoryResponse::etag() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.etag)
+  return _internal_etag();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DirectoryResponse::set_etag(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.etag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.etag)
+}
+inline std::string* DirectoryResponse::mutable_etag() {
+  std::string* _s = _internal_mutable_etag();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.etag)
+  return _s;
+}
+inline const std::string& DirectoryResponse::_internal_etag() const {
+  return _impl_.etag_.Get();
+}
+inline void DirectoryResponse::_internal_set_etag(const std::string& value) {
+  
+  _impl_.etag_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::_internal_mutable_etag() {
+  
+  return _impl_.etag_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DirectoryResponse::release_etag() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.etag)
+  return _impl_.etag_.Release();
+}
+inline void DirectoryResponse::set_allocated_etag(std::string* etag) {
+  if (etag != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.etag_.SetAllocated(etag, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.etag_.IsDefault()) {
+    _impl_.etag_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.etag)
+}
+
+// bool not_modified = 8;
+inline void DirectoryResponse::clear_not_modified() {
+  _impl_.not_modified_ = false;
+}
+inline bool DirectoryResponse::_internal_not_modified() const {
+  return _impl_.not_modified_;
+}
+inline bool DirectoryResponse::not_modified() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.not_modified)
+  return _internal_not_modified();
+}
+inline void DirectoryResponse::_internal_set_not_modified(bool value) {
+  
+  _impl_.not_modified_ = value;
+}
+inline void DirectoryResponse::set_not_modified(bool value) {
+  _internal_set_not_modified(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.not_modified)
+}
+
+// uint64 version = 9;
+inline void DirectoryResponse::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t DirectoryResponse::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t DirectoryResponse::version() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.version)
+  return _internal_version();
+}
+inline void DirectoryResponse::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void DirectoryResponse::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.version)
+}
+
+// bool is_delta = 10;
+inline void DirectoryResponse::clear_is_delta() {
+  _impl_.is_delta_ = false;
+}
+inline bool DirectoryResponse::_internal_is_delta() const {
+  return _impl_.is_delta_;
+}
+inline bool DirectoryResponse::is_delta() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.is_delta)
+  return _internal_is_delta();
+}
+inline void DirectoryResponse::_internal_set_is_delta(bool value) {
+  
+  _impl_.is_delta_ = value;
+}
+inline void DirectoryResponse::set_is_delta(bool value) {
+  _internal_set_is_delta(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.is_delta)
+}
+
+// repeated string removed = 11;
+inline int DirectoryResponse::_internal_removed_size() const {
+  return _impl_.removed_.size();
+}
+inline int DirectoryResponse::removed_size() const {
+  return _internal_removed_size();
+}
+inline void DirectoryResponse::clear_removed() {
+  _impl_.removed_.Clear();
+}
+inline std::string* DirectoryResponse::add_removed() {
+  std::string* _s = _internal_add_removed();
+  // @@protoc_insertion_point(field_add_mutable:transfer.DirectoryResponse.removed)
+  return _s;
+}
+inline const std::string& DirectoryResponse::_internal_removed(int index) const {
+  return _impl_.removed_.Get(index);
+}
+inline const std::string& DirectoryResponse::removed(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.removed)
+  return _internal_removed(index);
+}
+inline std::string* DirectoryResponse::mutable_removed(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.removed)
+  return _impl_.removed_.Mutable(index);
+}
+inline void DirectoryResponse::set_removed(int index, const std::string& value) {
+  _impl_.removed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::set_removed(int index, std::string&& value) {
+  _impl_.removed_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::set_removed(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::set_removed(int index, const char* value, size_t size) {
+  _impl_.removed_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.removed)
+}
+inline std::string* DirectoryResponse::_internal_add_removed() {
+  return _impl_.removed_.Add();
+}
+inline void DirectoryResponse::add_removed(const std::string& value) {
+  _impl_.removed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::add_removed(std::string&& value) {
+  _impl_.removed_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::add_removed(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.DirectoryResponse.removed)
+}
+inline void DirectoryResponse::add_removed(const char* value, size_t size) {
+  _impl_.removed_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.DirectoryResponse.removed)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+DirectoryResponse::removed() const {
+  // @@protoc_insertion_point(field_list:transfer.DirectoryResponse.removed)
+  return _impl_.removed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+DirectoryResponse::mutable_removed() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.DirectoryResponse.removed)
+  return &_impl_.removed_;
+}
+
+// uint64 base_version = 12;
+inline void DirectoryResponse::clear_base_version() {
+  _impl_.base_version_ = uint64_t{0u};
+}
+inline uint64_t DirectoryResponse::_internal_base_version() const {
+  return _impl_.base_version_;
+}
+inline uint64_t DirectoryResponse::base_version() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.base_version)
+  return _internal_base_version();
+}
+inline void DirectoryResponse::_internal_set_base_version(uint64_t value) {
+  
+  _impl_.base_version_ = value;
+}
+inline void DirectoryResponse::set_base_version(uint64_t value) {
+  _internal_set_base_version(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.base_version)
+}
+
+// .transfer.ListingEncoding encoding = 13;
+inline void DirectoryResponse::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::transfer::ListingEncoding DirectoryResponse::_internal_encoding() const {
+  return static_cast< ::transfer::ListingEncoding >(_impl_.encoding_);
+}
+inline ::transfer::ListingEncoding DirectoryResponse::encoding() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.encoding)
+  return _internal_encoding();
+}
+inline void DirectoryResponse::_internal_set_encoding(::transfer::ListingEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void DirectoryResponse::set_encoding(::transfer::ListingEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.encoding)
+}
+
+// .transfer.ListingColumns columns = 14;
+inline bool DirectoryResponse::_internal_has_columns() const {
+  return this != internal_default_instance() && _impl_.columns_ != nullptr;
+}
+inline bool DirectoryResponse::has_columns() const {
+  return _internal_has_columns();
+}
+inline void DirectoryResponse::clear_columns() {
+  if (GetArenaForAllocation() == nullptr && _impl_.columns_ != nullptr) {
+    delete _impl_.columns_;
+  }
+  _impl_.columns_ = nullptr;
+}
+inline const ::transfer::ListingColumns& DirectoryResponse::_internal_columns() const {
+  const ::transfer::ListingColumns* p = _impl_.columns_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ListingColumns&>(
+      ::transfer::_ListingColumns_default_instance_);
+}
+inline const ::transfer::ListingColumns& DirectoryResponse::columns() const {
+  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.columns)
+  return _internal_columns();
+}
+inline void DirectoryResponse::unsafe_arena_set_allocated_columns(
+    ::transfer::ListingColumns* columns) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.columns_);
+  }
+  _impl_.columns_ = columns;
+  if (columns) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.DirectoryResponse.columns)
+}
+inline ::transfer::ListingColumns* DirectoryResponse::release_columns() {
+  
+  ::transfer::ListingColumns* temp = _impl_.columns_;
+  _impl_.columns_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ListingColumns* DirectoryResponse::unsafe_arena_release_columns() {
+  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.columns)
+  
+  ::transfer::ListingColumns* temp = _impl_.columns_;
+  _impl_.columns_ = nullptr;
+  return temp;
+}
+inline ::transfer::ListingColumns* DirectoryResponse::_internal_mutable_columns() {
+  
+  if (_impl_.columns_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ListingColumns>(GetArenaForAllocation());
+    _impl_.columns_ = p;
+  }
+  return _impl_.columns_;
+}
+inline ::transfer::ListingColumns* DirectoryResponse::mutable_columns() {
+  ::transfer::ListingColumns* _msg = _internal_mutable_columns();
+  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.columns)
+  return _msg;
+}
+inline void DirectoryResponse::set_allocated_columns(::transfer::ListingColumns* columns) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.columns_;
+  }
+  if (columns) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(columns);
+    if (message_arena != submessage_arena) {
+      columns = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, columns, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.columns_ = columns;
+  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.columns)
+}
+
+// -------------------------------------------------------------------
+
+// ListingCacheFile_Listing
+
+// .transfer.DirectoryResponse response = 1;
+inline bool ListingCacheFile_Listing::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
+}
+inline bool ListingCacheFile_Listing::has_response() const {
+  return _internal_has_response();
+}
+inline void ListingCacheFile_Listing::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+}
+inline const ::transfer::DirectoryResponse& ListingCacheFile_Listing::_internal_response() const {
+  const ::transfer::DirectoryResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::DirectoryResponse&>(
+      ::transfer::_DirectoryResponse_default_instance_);
+}
+inline const ::transfer::DirectoryResponse& ListingCacheFile_Listing::response() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.Listing.response)
+  return _internal_response();
+}
+inline void ListingCacheFile_Listing::unsafe_arena_set_allocated_response(
+    ::transfer::DirectoryResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.ListingCacheFile.Listing.response)
+}
+inline ::transfer::DirectoryResponse* ListingCacheFile_Listing::release_response() {
+  
+  ::transfer::DirectoryResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::DirectoryResponse* ListingCacheFile_Listing::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:transfer.ListingCacheFile.Listing.response)
+  
+  ::transfer::DirectoryResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::transfer::DirectoryResponse* ListingCacheFile_Listing::_internal_mutable_response() {
+  
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::DirectoryResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::transfer::DirectoryResponse* ListingCacheFile_Listing::mutable_response() {
+  ::transfer::DirectoryResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:transfer.ListingCacheFile.Listing.response)
+  return _msg;
+}
+inline void ListingCacheFile_Listing::set_allocated_response(::transfer::DirectoryResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:transfer.ListingCacheFile.Listing.response)
+}
+
+// uint64 stored_at = 2;
+inline void ListingCacheFile_Listing::clear_stored_at() {
+  _impl_.stored_at_ = uint64_t{0u};
+}
+inline uint64_t ListingCacheFile_Listing::_internal_stored_at() const {
+  return _impl_.stored_at_;
+}
+inline uint64_t ListingCacheFile_Listing::stored_at() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.Listing.stored_at)
+  return _internal_stored_at();
+}
+inline void ListingCacheFile_Listing::_internal_set_stored_at(uint64_t value) {
+  
+  _impl_.stored_at_ = value;
+}
+inline void ListingCacheFile_Listing::set_stored_at(uint64_t value) {
+  _internal_set_stored_at(value);
+  // @@protoc_insertion_point(field_set:transfer.ListingCacheFile.Listing.stored_at)
+}
+
+// -------------------------------------------------------------------
+
+// ListingCacheFile
+
+// uint32 version = 1;
+inline void ListingCacheFile::clear_version() {
+  _impl_.version_ = 0u;
+}
+inline uint32_t ListingCacheFile::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint32_t ListingCacheFile::version() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.version)
+  return _internal_version();
+}
+inline void ListingCacheFile::_internal_set_version(uint32_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void ListingCacheFile::set_version(uint32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:transfer.ListingCacheFile.version)
+}
+
+// string server = 2;
+inline void ListingCacheFile::clear_server() {
+  _impl_.server_.ClearToEmpty();
+}
+inline const std::string& ListingCacheFile::server() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.server)
+  return _internal_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListingCacheFile::set_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ListingCacheFile.server)
+}
+inline std::string* ListingCacheFile::mutable_server() {
+  std::string* _s = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:transfer.ListingCacheFile.server)
+  return _s;
+}
+inline const std::string& ListingCacheFile::_internal_server() const {
+  return _impl_.server_.Get();
+}
+inline void ListingCacheFile::_internal_set_server(const std::string& value) {
+  
+  _impl_.server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListingCacheFile::_internal_mutable_server() {
+  
+  return _impl_.server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListingCacheFile::release_server() {
+  // @@protoc_insertion_point(field_release:transfer.ListingCacheFile.server)
+  return _impl_.server_.Release();
+}
+inline void ListingCacheFile::set_allocated_server(std::string* server) {
+  if (server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.server_.SetAllocated(server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_.IsDefault()) {
+    _impl_.server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ListingCacheFile.server)
+}
+
+// string home_path = 3;
+inline void ListingCacheFile::clear_home_path() {
+  _impl_.home_path_.ClearToEmpty();
+}
+inline const std::string& ListingCacheFile::home_path() const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.home_path)
+  return _internal_home_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListingCacheFile::set_home_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.home_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ListingCacheFile.home_path)
+}
+inline std::string* ListingCacheFile::mutable_home_path() {
+  std::string* _s = _internal_mutable_home_path();
+  // @@protoc_insertion_point(field_mutable:transfer.ListingCacheFile.home_path)
+  return _s;
+}
+inline const std::string& ListingCacheFile::_internal_home_path() const {
+  return _impl_.home_path_.Get();
+}
+inline void ListingCacheFile::_internal_set_home_path(const std::string& value) {
+  
+  _impl_.home_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListingCacheFile::_internal_mutable_home_path() {
+  
+  return _impl_.home_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListingCacheFile::release_home_path() {
+  // @@protoc_insertion_point(field_release:transfer.ListingCacheFile.home_path)
+  return _impl_.home_path_.Release();
+}
+inline void ListingCacheFile::set_allocated_home_path(std::string* home_path) {
+  if (home_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.home_path_.SetAllocated(home_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.home_path_.IsDefault()) {
+    _impl_.home_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ListingCacheFile.home_path)
+}
+
+// repeated .transfer.ListingCacheFile.Listing listings = 4;
+inline int ListingCacheFile::_internal_listings_size() const {
+  return _impl_.listings_.size();
+}
+inline int ListingCacheFile::listings_size() const {
+  return _internal_listings_size();
+}
+inline void ListingCacheFile::clear_listings() {
+  _impl_.listings_.Clear();
+}
+inline ::transfer::ListingCacheFile_Listing* ListingCacheFile::mutable_listings(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.ListingCacheFile.listings)
+  return _impl_.listings_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::ListingCacheFile_Listing >*
+ListingCacheFile::mutable_listings() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ListingCacheFile.listings)
+  return &_impl_.listings_;
+}
+inline const ::transfer::ListingCacheFile_Listing& ListingCacheFile::_internal_listings(int index) const {
+  return _impl_.listings_.Get(index);
+}
+inline const ::transfer::ListingCacheFile_Listing& ListingCacheFile::listings(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ListingCacheFile.listings)
+  return _internal_listings(index);
+}
+inline ::transfer::ListingCacheFile_Listing* ListingCacheFile::_internal_add_listings() {
+  return _impl_.listings_.Add();
+}
+inline ::transfer::ListingCacheFile_Listing* ListingCacheFile::add_listings() {
+  ::transfer::ListingCacheFile_Listing* _add = _internal_add_listings();
+  // @@protoc_insertion_point(field_add:transfer.ListingCacheFile.listings)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::ListingCacheFile_Listing >&
+ListingCacheFile::listings() const {
+  // @@protoc_insertion_point(field_list:transfer.ListingCacheFile.listings)
+  return _impl_.listings_;
+}
+
+// -------------------------------------------------------------------
+
+// MakeDirectoryRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool MakeDirectoryRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MakeDirectoryRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void MakeDirectoryRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& MakeDirectoryRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& MakeDirectoryRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryRequest.header)
+  return _internal_header();
+}
+inline void MakeDirectoryRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.MakeDirectoryRequest.header)
+}
+inline ::transfer::RequestHeader* MakeDirectoryRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* MakeDirectoryRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.MakeDirectoryRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* MakeDirectoryRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* MakeDirectoryRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryRequest.header)
+  return _msg;
+}
+inline void MakeDirectoryRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.MakeDirectoryRequest.header)
+}
+
+// string base_path = 2;
+inline void MakeDirectoryRequest::clear_base_path() {
+  _impl_.base_path_.ClearToEmpty();
+}
+inline const std::string& MakeDirectoryRequest::base_path() const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryRequest.base_path)
+  return _internal_base_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MakeDirectoryRequest::set_base_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.base_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryRequest.base_path)
+}
+inline std::string* MakeDirectoryRequest::mutable_base_path() {
+  std::string* _s = _internal_mutable_base_path();
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryRequest.base_path)
+  return _s;
+}
+inline const std::string& MakeDirectoryRequest::_internal_base_path() const {
+  return _impl_.base_path_.Get();
+}
+inline void MakeDirectoryRequest::_internal_set_base_path(const std::string& value) {
+  
+  _impl_.base_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MakeDirectoryRequest::_internal_mutable_base_path() {
+  
+  return _impl_.base_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MakeDirectoryRequest::release_base_path() {
+  // @@protoc_insertion_point(field_release:transfer.MakeDirectoryRequest.base_path)
+  return _impl_.base_path_.Release();
+}
+inline void MakeDirectoryRequest::set_allocated_base_path(std::string* base_path) {
+  if (base_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.base_path_.SetAllocated(base_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.base_path_.IsDefault()) {
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.MakeDirectoryRequest.base_path)
+}
+
+// repeated string paths = 3;
+inline int MakeDirectoryRequest::_internal_paths_size() const {
+  return _impl_.paths_.size();
+}
+inline int MakeDirectoryRequest::paths_size() const {
+  return _internal_paths_size();
+}
+inline void MakeDirectoryRequest::clear_paths() {
+  _impl_.paths_.Clear();
+}
+inline std::string* MakeDirectoryRequest::add_paths() {
+  std::string* _s = _internal_add_paths();
+  // @@protoc_insertion_point(field_add_mutable:transfer.MakeDirectoryRequest.paths)
+  return _s;
+}
+inline const std::string& MakeDirectoryRequest::_internal_paths(int index) const {
+  return _impl_.paths_.Get(index);
+}
+inline const std::string& MakeDirectoryRequest::paths(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryRequest.paths)
+  return _internal_paths(index);
+}
+inline std::string* MakeDirectoryRequest::mutable_paths(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryRequest.paths)
+  return _impl_.paths_.Mutable(index);
+}
+inline void MakeDirectoryRequest::set_paths(int index, const std::string& value) {
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::set_paths(int index, std::string&& value) {
+  _impl_.paths_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::set_paths(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::set_paths(int index, const char* value, size_t size) {
+  _impl_.paths_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.MakeDirectoryRequest.paths)
+}
+inline std::string* MakeDirectoryRequest::_internal_add_paths() {
+  return _impl_.paths_.Add();
+}
+inline void MakeDirectoryRequest::add_paths(const std::string& value) {
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::add_paths(std::string&& value) {
+  _impl_.paths_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::add_paths(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.MakeDirectoryRequest.paths)
+}
+inline void MakeDirectoryRequest::add_paths(const char* value, size_t size) {
+  _impl_.paths_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.MakeDirectoryRequest.paths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MakeDirectoryRequest::paths() const {
+  // @@protoc_insertion_point(field_list:transfer.MakeDirectoryRequest.paths)
+  return _impl_.paths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MakeDirectoryRequest::mutable_paths() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.MakeDirectoryRequest.paths)
+  return &_impl_.paths_;
+}
+
+// -------------------------------------------------------------------
+
+// MakeDirectoryResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool MakeDirectoryResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MakeDirectoryResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void MakeDirectoryResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& MakeDirectoryResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& MakeDirectoryResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryResponse.header)
+  return _internal_header();
+}
+inline void MakeDirectoryResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.MakeDirectoryResponse.header)
+}
+inline ::transfer::ResponseHeader* MakeDirectoryResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* MakeDirectoryResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.MakeDirectoryResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* MakeDirectoryResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* MakeDirectoryResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryResponse.header)
+  return _msg;
+}
+inline void MakeDirectoryResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.MakeDirectoryResponse.header)
+}
+
+// repeated string failed_paths = 2;
+inline int MakeDirectoryResponse::_internal_failed_paths_size() const {
+  return _impl_.failed_paths_.size();
+}
+inline int MakeDirectoryResponse::failed_paths_size() const {
+  return _internal_failed_paths_size();
+}
+inline void MakeDirectoryResponse::clear_failed_paths() {
+  _impl_.failed_paths_.Clear();
+}
+inline std::string* MakeDirectoryResponse::add_failed_paths() {
+  std::string* _s = _internal_add_failed_paths();
+  // @@protoc_insertion_point(field_add_mutable:transfer.MakeDirectoryResponse.failed_paths)
+  return _s;
+}
+inline const std::string& MakeDirectoryResponse::_internal_failed_paths(int index) const {
+  return _impl_.failed_paths_.Get(index);
+}
+inline const std::string& MakeDirectoryResponse::failed_paths(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryResponse.failed_paths)
+  return _internal_failed_paths(index);
+}
+inline std::string* MakeDirectoryResponse::mutable_failed_paths(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryResponse.failed_paths)
+  return _impl_.failed_paths_.Mutable(index);
+}
+inline void MakeDirectoryResponse::set_failed_paths(int index, const std::string& value) {
+  _impl_.failed_paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::set_failed_paths(int index, std::string&& value) {
+  _impl_.failed_paths_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::set_failed_paths(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::set_failed_paths(int index, const char* value, size_t size) {
+  _impl_.failed_paths_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline std::string* MakeDirectoryResponse::_internal_add_failed_paths() {
+  return _impl_.failed_paths_.Add();
+}
+inline void MakeDirectoryResponse::add_failed_paths(const std::string& value) {
+  _impl_.failed_paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::add_failed_paths(std::string&& value) {
+  _impl_.failed_paths_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::add_failed_paths(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.failed_paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline void MakeDirectoryResponse::add_failed_paths(const char* value, size_t size) {
+  _impl_.failed_paths_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.MakeDirectoryResponse.failed_paths)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MakeDirectoryResponse::failed_paths() const {
+  // @@protoc_insertion_point(field_list:transfer.MakeDirectoryResponse.failed_paths)
+  return _impl_.failed_paths_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MakeDirectoryResponse::mutable_failed_paths() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.MakeDirectoryResponse.failed_paths)
+  return &_impl_.failed_paths_;
+}
+
+// repeated string errors = 3;
+inline int MakeDirectoryResponse::_internal_errors_size() const {
+  return _impl_.errors_.size();
+}
+inline int MakeDirectoryResponse::errors_size() const {
+  return _internal_errors_size();
+}
+inline void MakeDirectoryResponse::clear_errors() {
+  _impl_.errors_.Clear();
+}
+inline std::string* MakeDirectoryResponse::add_errors() {
+  std::string* _s = _internal_add_errors();
+  // @@protoc_insertion_point(field_add_mutable:transfer.MakeDirectoryResponse.errors)
+  return _s;
+}
+inline const std::string& MakeDirectoryResponse::_internal_errors(int index) const {
+  return _impl_.errors_.Get(index);
+}
+inline const std::string& MakeDirectoryResponse::errors(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.MakeDirectoryResponse.errors)
+  return _internal_errors(index);
+}
+inline std::string* MakeDirectoryResponse::mutable_errors(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.MakeDirectoryResponse.errors)
+  return _impl_.errors_.Mutable(index);
+}
+inline void MakeDirectoryResponse::set_errors(int index, const std::string& value) {
+  _impl_.errors_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::set_errors(int index, std::string&& value) {
+  _impl_.errors_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::set_errors(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.errors_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::set_errors(int index, const char* value, size_t size) {
+  _impl_.errors_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.MakeDirectoryResponse.errors)
+}
+inline std::string* MakeDirectoryResponse::_internal_add_errors() {
+  return _impl_.errors_.Add();
+}
+inline void MakeDirectoryResponse::add_errors(const std::string& value) {
+  _impl_.errors_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::add_errors(std::string&& value) {
+  _impl_.errors_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::add_errors(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.errors_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.MakeDirectoryResponse.errors)
+}
+inline void MakeDirectoryResponse::add_errors(const char* value, size_t size) {
+  _impl_.errors_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.MakeDirectoryResponse.errors)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MakeDirectoryResponse::errors() const {
+  // @@protoc_insertion_point(field_list:transfer.MakeDirectoryResponse.errors)
+  return _impl_.errors_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MakeDirectoryResponse::mutable_errors() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.MakeDirectoryResponse.errors)
+  return &_impl_.errors_;
+}
+
+// -------------------------------------------------------------------
+
+// TreeListRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool TreeListRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool TreeListRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void TreeListRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& TreeListRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& TreeListRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListRequest.header)
+  return _internal_header();
+}
+inline void TreeListRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TreeListRequest.header)
+}
+inline ::transfer::RequestHeader* TreeListRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* TreeListRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* TreeListRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* TreeListRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListRequest.header)
+  return _msg;
+}
+inline void TreeListRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListRequest.header)
+}
+
+// string root_path = 2;
+inline void TreeListRequest::clear_root_path() {
+  _impl_.root_path_.ClearToEmpty();
+}
+inline const std::string& TreeListRequest::root_path() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListRequest.root_path)
+  return _internal_root_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeListRequest::set_root_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.root_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TreeListRequest.root_path)
+}
+inline std::string* TreeListRequest::mutable_root_path() {
+  std::string* _s = _internal_mutable_root_path();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListRequest.root_path)
+  return _s;
+}
+inline const std::string& TreeListRequest::_internal_root_path() const {
+  return _impl_.root_path_.Get();
+}
+inline void TreeListRequest::_internal_set_root_path(const std::string& value) {
+  
+  _impl_.root_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeListRequest::_internal_mutable_root_path() {
+  
+  return _impl_.root_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeListRequest::release_root_path() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListRequest.root_path)
+  return _impl_.root_path_.Release();
+}
+inline void TreeListRequest::set_allocated_root_path(std::string* root_path) {
+  if (root_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.root_path_.SetAllocated(root_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.root_path_.IsDefault()) {
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListRequest.root_path)
+}
+
+// string cursor = 3;
+inline void TreeListRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& TreeListRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeListRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TreeListRequest.cursor)
+}
+inline std::string* TreeListRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListRequest.cursor)
+  return _s;
+}
+inline const std::string& TreeListRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void TreeListRequest::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeListRequest::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeListRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListRequest.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void TreeListRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListRequest.cursor)
+}
+
+// uint32 page_size = 4;
+inline void TreeListRequest::clear_page_size() {
+  _impl_.page_size_ = 0u;
+}
+inline uint32_t TreeListRequest::_internal_page_size() const {
+  return _impl_.page_size_;
+}
+inline uint32_t TreeListRequest::page_size() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListRequest.page_size)
+  return _internal_page_size();
+}
+inline void TreeListRequest::_internal_set_page_size(uint32_t value) {
+  
+  _impl_.page_size_ = value;
+}
+inline void TreeListRequest::set_page_size(uint32_t value) {
+  _internal_set_page_size(value);
+  // @@protoc_insertion_point(field_set:transfer.TreeListRequest.page_size)
+}
+
+// -------------------------------------------------------------------
+
+// TreeListResponse_Entry
+
+// string relative_path = 1;
+inline void TreeListResponse_Entry::clear_relative_path() {
+  _impl_.relative_path_.ClearToEmpty();
+}
+inline const std::string& TreeListResponse_Entry::relative_path() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.Entry.relative_path)
+  return _internal_relative_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeListResponse_Entry::set_relative_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.relative_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.Entry.relative_path)
+}
+inline std::string* TreeListResponse_Entry::mutable_relative_path() {
+  std::string* _s = _internal_mutable_relative_path();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListResponse.Entry.relative_path)
+  return _s;
+}
+inline const std::string& TreeListResponse_Entry::_internal_relative_path() const {
+  return _impl_.relative_path_.Get();
+}
+inline void TreeListResponse_Entry::_internal_set_relative_path(const std::string& value) {
+  
+  _impl_.relative_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeListResponse_Entry::_internal_mutable_relative_path() {
+  
+  return _impl_.relative_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeListResponse_Entry::release_relative_path() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListResponse.Entry.relative_path)
+  return _impl_.relative_path_.Release();
+}
+inline void TreeListResponse_Entry::set_allocated_relative_path(std::string* relative_path) {
+  if (relative_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.relative_path_.SetAllocated(relative_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.relative_path_.IsDefault()) {
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListResponse.Entry.relative_path)
+}
+
+// bool is_directory = 2;
+inline void TreeListResponse_Entry::clear_is_directory() {
+  _impl_.is_directory_ = false;
+}
+inline bool TreeListResponse_Entry::_internal_is_directory() const {
+  return _impl_.is_directory_;
+}
+inline bool TreeListResponse_Entry::is_directory() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.Entry.is_directory)
+  return _internal_is_directory();
+}
+inline void TreeListResponse_Entry::_internal_set_is_directory(bool value) {
+  
+  _impl_.is_directory_ = value;
+}
+inline void TreeListResponse_Entry::set_is_directory(bool value) {
+  _internal_set_is_directory(value);
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.Entry.is_directory)
+}
+
+// uint64 size = 3;
+inline void TreeListResponse_Entry::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t TreeListResponse_Entry::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t TreeListResponse_Entry::size() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.Entry.size)
+  return _internal_size();
+}
+inline void TreeListResponse_Entry::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void TreeListResponse_Entry::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.Entry.size)
+}
+
+// string modify_time = 4;
+inline void TreeListResponse_Entry::clear_modify_time() {
+  _impl_.modify_time_.ClearToEmpty();
+}
+inline const std::string& TreeListResponse_Entry::modify_time() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.Entry.modify_time)
+  return _internal_modify_time();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeListResponse_Entry::set_modify_time(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.modify_time_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.Entry.modify_time)
+}
+inline std::string* TreeListResponse_Entry::mutable_modify_time() {
+  std::string* _s = _internal_mutable_modify_time();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListResponse.Entry.modify_time)
+  return _s;
+}
+inline const std::string& TreeListResponse_Entry::_internal_modify_time() const {
+  return _impl_.modify_time_.Get();
+}
+inline void TreeListResponse_Entry::_internal_set_modify_time(const std::string& value) {
+  
+  _impl_.modify_time_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeListResponse_Entry::_internal_mutable_modify_time() {
+  
+  return _impl_.modify_time_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeListResponse_Entry::release_modify_time() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListResponse.Entry.modify_time)
+  return _impl_.modify_time_.Release();
+}
+inline void TreeListResponse_Entry::set_allocated_modify_time(std::string* modify_time) {
+  if (modify_time != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.modify_time_.SetAllocated(modify_time, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.modify_time_.IsDefault()) {
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListResponse.Entry.modify_time)
+}
+
+// -------------------------------------------------------------------
+
+// TreeListResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool TreeListResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool TreeListResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void TreeListResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& TreeListResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& TreeListResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.header)
+  return _internal_header();
+}
+inline void TreeListResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TreeListResponse.header)
+}
+inline ::transfer::ResponseHeader* TreeListResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* TreeListResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* TreeListResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* TreeListResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListResponse.header)
+  return _msg;
+}
+inline void TreeListResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListResponse.header)
+}
+
+// repeated .transfer.TreeListResponse.Entry entries = 2;
+inline int TreeListResponse::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int TreeListResponse::entries_size() const {
+  return _internal_entries_size();
+}
+inline void TreeListResponse::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::transfer::TreeListResponse_Entry* TreeListResponse::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListResponse.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::TreeListResponse_Entry >*
+TreeListResponse::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.TreeListResponse.entries)
+  return &_impl_.entries_;
+}
+inline const ::transfer::TreeListResponse_Entry& TreeListResponse::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::transfer::TreeListResponse_Entry& TreeListResponse::entries(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.entries)
+  return _internal_entries(index);
+}
+inline ::transfer::TreeListResponse_Entry* TreeListResponse::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::transfer::TreeListResponse_Entry* TreeListResponse::add_entries() {
+  ::transfer::TreeListResponse_Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:transfer.TreeListResponse.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::TreeListResponse_Entry >&
+TreeListResponse::entries() const {
+  // @@protoc_insertion_point(field_list:transfer.TreeListResponse.entries)
+  return _impl_.entries_;
+}
+
+// string next_cursor = 3;
+inline void TreeListResponse::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+}
+inline const std::string& TreeListResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TreeListResponse::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.next_cursor)
+}
+inline std::string* TreeListResponse::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.TreeListResponse.next_cursor)
+  return _s;
+}
+inline const std::string& TreeListResponse::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void TreeListResponse::_internal_set_next_cursor(const std::string& value) {
+  
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TreeListResponse::_internal_mutable_next_cursor() {
+  
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TreeListResponse::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.TreeListResponse.next_cursor)
+  return _impl_.next_cursor_.Release();
+}
+inline void TreeListResponse::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TreeListResponse.next_cursor)
+}
+
+// bool has_more = 4;
+inline void TreeListResponse::clear_has_more() {
+  _impl_.has_more_ = false;
+}
+inline bool TreeListResponse::_internal_has_more() const {
+  return _impl_.has_more_;
+}
+inline bool TreeListResponse::has_more() const {
+  // @@protoc_insertion_point(field_get:transfer.TreeListResponse.has_more)
+  return _internal_has_more();
+}
+inline void TreeListResponse::_internal_set_has_more(bool value) {
+  
+  _impl_.has_more_ = value;
+}
+inline void TreeListResponse::set_has_more(bool value) {
+  _internal_set_has_more(value);
+  // @@protoc_insertion_point(field_set:transfer.TreeListResponse.has_more)
+}
+
+// -------------------------------------------------------------------
+
+// ArchiveRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool ArchiveRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool ArchiveRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void ArchiveRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& ArchiveRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& ArchiveRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.header)
+  return _internal_header();
+}
+inline void ArchiveRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.ArchiveRequest.header)
+}
+inline ::transfer::RequestHeader* ArchiveRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* ArchiveRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* ArchiveRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* ArchiveRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveRequest.header)
+  return _msg;
+}
+inline void ArchiveRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveRequest.header)
+}
+
+// .transfer.ArchiveRequest.Direction direction = 2;
+inline void ArchiveRequest::clear_direction() {
+  _impl_.direction_ = 0;
+}
+inline ::transfer::ArchiveRequest_Direction ArchiveRequest::_internal_direction() const {
+  return static_cast< ::transfer::ArchiveRequest_Direction >(_impl_.direction_);
+}
+inline ::transfer::ArchiveRequest_Direction ArchiveRequest::direction() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.direction)
+  return _internal_direction();
+}
+inline void ArchiveRequest::_internal_set_direction(::transfer::ArchiveRequest_Direction value) {
+  
+  _impl_.direction_ = value;
+}
+inline void ArchiveRequest::set_direction(::transfer::ArchiveRequest_Direction value) {
+  _internal_set_direction(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.direction)
+}
+
+// string archive_id = 3;
+inline void ArchiveRequest::clear_archive_id() {
+  _impl_.archive_id_.ClearToEmpty();
+}
+inline const std::string& ArchiveRequest::archive_id() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.archive_id)
+  return _internal_archive_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ArchiveRequest::set_archive_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.archive_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.archive_id)
+}
+inline std::string* ArchiveRequest::mutable_archive_id() {
+  std::string* _s = _internal_mutable_archive_id();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveRequest.archive_id)
+  return _s;
+}
+inline const std::string& ArchiveRequest::_internal_archive_id() const {
+  return _impl_.archive_id_.Get();
+}
+inline void ArchiveRequest::_internal_set_archive_id(const std::string& value) {
+  
+  _impl_.archive_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::_internal_mutable_archive_id() {
+  
+  return _impl_.archive_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::release_archive_id() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveRequest.archive_id)
+  return _impl_.archive_id_.Release();
+}
+inline void ArchiveRequest::set_allocated_archive_id(std::string* archive_id) {
+  if (archive_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.archive_id_.SetAllocated(archive_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.archive_id_.IsDefault()) {
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveRequest.archive_id)
+}
+
+// string base_path = 4;
+inline void ArchiveRequest::clear_base_path() {
+  _impl_.base_path_.ClearToEmpty();
+}
+inline const std::string& ArchiveRequest::base_path() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.base_path)
+  return _internal_base_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ArchiveRequest::set_base_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.base_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.base_path)
+}
+inline std::string* ArchiveRequest::mutable_base_path() {
+  std::string* _s = _internal_mutable_base_path();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveRequest.base_path)
+  return _s;
+}
+inline const std::string& ArchiveRequest::_internal_base_path() const {
+  return _impl_.base_path_.Get();
+}
+inline void ArchiveRequest::_internal_set_base_path(const std::string& value) {
+  
+  _impl_.base_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::_internal_mutable_base_path() {
+  
+  return _impl_.base_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::release_base_path() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveRequest.base_path)
+  return _impl_.base_path_.Release();
+}
+inline void ArchiveRequest::set_allocated_base_path(std::string* base_path) {
+  if (base_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.base_path_.SetAllocated(base_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.base_path_.IsDefault()) {
+    _impl_.base_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveRequest.base_path)
+}
+
+// uint32 compression = 5;
+inline void ArchiveRequest::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t ArchiveRequest::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t ArchiveRequest::compression() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.compression)
+  return _internal_compression();
+}
+inline void ArchiveRequest::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void ArchiveRequest::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.compression)
+}
+
+// uint64 block_sequence = 6;
+inline void ArchiveRequest::clear_block_sequence() {
+  _impl_.block_sequence_ = uint64_t{0u};
+}
+inline uint64_t ArchiveRequest::_internal_block_sequence() const {
+  return _impl_.block_sequence_;
+}
+inline uint64_t ArchiveRequest::block_sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.block_sequence)
+  return _internal_block_sequence();
+}
+inline void ArchiveRequest::_internal_set_block_sequence(uint64_t value) {
+  
+  _impl_.block_sequence_ = value;
+}
+inline void ArchiveRequest::set_block_sequence(uint64_t value) {
+  _internal_set_block_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.block_sequence)
+}
+
+// bytes data = 7;
+inline void ArchiveRequest::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ArchiveRequest::data() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ArchiveRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.data)
+}
+inline std::string* ArchiveRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveRequest.data)
+  return _s;
+}
+inline const std::string& ArchiveRequest::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ArchiveRequest::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ArchiveRequest::release_data() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveRequest.data)
+  return _impl_.data_.Release();
+}
+inline void ArchiveRequest::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveRequest.data)
+}
+
+// bool is_last = 8;
+inline void ArchiveRequest::clear_is_last() {
+  _impl_.is_last_ = false;
+}
+inline bool ArchiveRequest::_internal_is_last() const {
+  return _impl_.is_last_;
+}
+inline bool ArchiveRequest::is_last() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveRequest.is_last)
+  return _internal_is_last();
+}
+inline void ArchiveRequest::_internal_set_is_last(bool value) {
+  
+  _impl_.is_last_ = value;
+}
+inline void ArchiveRequest::set_is_last(bool value) {
+  _internal_set_is_last(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveRequest.is_last)
+}
+
+// -------------------------------------------------------------------
+
+// ArchiveResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool ArchiveResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool ArchiveResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void ArchiveResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& ArchiveResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& ArchiveResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.header)
+  return _internal_header();
+}
+inline void ArchiveResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.ArchiveResponse.header)
+}
+inline ::transfer::ResponseHeader* ArchiveResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* ArchiveResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* ArchiveResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* ArchiveResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveResponse.header)
+  return _msg;
+}
+inline void ArchiveResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveResponse.header)
+}
+
+// string archive_id = 2;
+inline void ArchiveResponse::clear_archive_id() {
+  _impl_.archive_id_.ClearToEmpty();
+}
+inline const std::string& ArchiveResponse::archive_id() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.archive_id)
+  return _internal_archive_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ArchiveResponse::set_archive_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.archive_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.archive_id)
+}
+inline std::string* ArchiveResponse::mutable_archive_id() {
+  std::string* _s = _internal_mutable_archive_id();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveResponse.archive_id)
+  return _s;
+}
+inline const std::string& ArchiveResponse::_internal_archive_id() const {
+  return _impl_.archive_id_.Get();
+}
+inline void ArchiveResponse::_internal_set_archive_id(const std::string& value) {
+  
+  _impl_.archive_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ArchiveResponse::_internal_mutable_archive_id() {
+  
+  return _impl_.archive_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ArchiveResponse::release_archive_id() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveResponse.archive_id)
+  return _impl_.archive_id_.Release();
+}
+inline void ArchiveResponse::set_allocated_archive_id(std::string* archive_id) {
+  if (archive_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.archive_id_.SetAllocated(archive_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.archive_id_.IsDefault()) {
+    _impl_.archive_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveResponse.archive_id)
+}
+
+// uint64 block_sequence = 3;
+inline void ArchiveResponse::clear_block_sequence() {
+  _impl_.block_sequence_ = uint64_t{0u};
+}
+inline uint64_t ArchiveResponse::_internal_block_sequence() const {
+  return _impl_.block_sequence_;
+}
+inline uint64_t ArchiveResponse::block_sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.block_sequence)
+  return _internal_block_sequence();
+}
+inline void ArchiveResponse::_internal_set_block_sequence(uint64_t value) {
+  
+  _impl_.block_sequence_ = value;
+}
+inline void ArchiveResponse::set_block_sequence(uint64_t value) {
+  _internal_set_block_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.block_sequence)
+}
+
+// uint32 compression = 4;
+inline void ArchiveResponse::clear_compression() {
+  _impl_.compression_ = 0u;
+}
+inline uint32_t ArchiveResponse::_internal_compression() const {
+  return _impl_.compression_;
+}
+inline uint32_t ArchiveResponse::compression() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.compression)
+  return _internal_compression();
+}
+inline void ArchiveResponse::_internal_set_compression(uint32_t value) {
+  
+  _impl_.compression_ = value;
+}
+inline void ArchiveResponse::set_compression(uint32_t value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.compression)
+}
+
+// bytes data = 5;
+inline void ArchiveResponse::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& ArchiveResponse::data() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ArchiveResponse::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.data)
+}
+inline std::string* ArchiveResponse::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:transfer.ArchiveResponse.data)
+  return _s;
+}
+inline const std::string& ArchiveResponse::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void ArchiveResponse::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ArchiveResponse::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ArchiveResponse::release_data() {
+  // @@protoc_insertion_point(field_release:transfer.ArchiveResponse.data)
+  return _impl_.data_.Release();
+}
+inline void ArchiveResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ArchiveResponse.data)
+}
+
+// bool is_last = 6;
+inline void ArchiveResponse::clear_is_last() {
+  _impl_.is_last_ = false;
+}
+inline bool ArchiveResponse::_internal_is_last() const {
+  return _impl_.is_last_;
+}
+inline bool ArchiveResponse::is_last() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.is_last)
+  return _internal_is_last();
+}
+inline void ArchiveResponse::_internal_set_is_last(bool value) {
+  
+  _impl_.is_last_ = value;
+}
+inline void ArchiveResponse::set_is_last(bool value) {
+  _internal_set_is_last(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.is_last)
+}
+
+// uint64 total_size = 7;
+inline void ArchiveResponse::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
+}
+inline uint64_t ArchiveResponse::_internal_total_size() const {
+  return _impl_.total_size_;
+}
+inline uint64_t ArchiveResponse::total_size() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.total_size)
+  return _internal_total_size();
+}
+inline void ArchiveResponse::_internal_set_total_size(uint64_t value) {
+  
+  _impl_.total_size_ = value;
+}
+inline void ArchiveResponse::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.total_size)
+}
+
+// uint64 total_files = 8;
+inline void ArchiveResponse::clear_total_files() {
+  _impl_.total_files_ = uint64_t{0u};
+}
+inline uint64_t ArchiveResponse::_internal_total_files() const {
+  return _impl_.total_files_;
+}
+inline uint64_t ArchiveResponse::total_files() const {
+  // @@protoc_insertion_point(field_get:transfer.ArchiveResponse.total_files)
+  return _internal_total_files();
+}
+inline void ArchiveResponse::_internal_set_total_files(uint64_t value) {
+  
+  _impl_.total_files_ = value;
+}
+inline void ArchiveResponse::set_total_files(uint64_t value) {
+  _internal_set_total_files(value);
+  // @@protoc_insertion_point(field_set:transfer.ArchiveResponse.total_files)
+}
+
+// -------------------------------------------------------------------
+
+// SearchRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool SearchRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool SearchRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void SearchRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& SearchRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& SearchRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.header)
+  return _internal_header();
+}
+inline void SearchRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.SearchRequest.header)
+}
+inline ::transfer::RequestHeader* SearchRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* SearchRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.SearchRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* SearchRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* SearchRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchRequest.header)
+  return _msg;
+}
+inline void SearchRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchRequest.header)
+}
+
+// string root_path = 2;
+inline void SearchRequest::clear_root_path() {
+  _impl_.root_path_.ClearToEmpty();
+}
+inline const std::string& SearchRequest::root_path() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.root_path)
+  return _internal_root_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_root_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.root_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.root_path)
+}
+inline std::string* SearchRequest::mutable_root_path() {
+  std::string* _s = _internal_mutable_root_path();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchRequest.root_path)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_root_path() const {
+  return _impl_.root_path_.Get();
+}
+inline void SearchRequest::_internal_set_root_path(const std::string& value) {
+  
+  _impl_.root_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchRequest::_internal_mutable_root_path() {
+  
+  return _impl_.root_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchRequest::release_root_path() {
+  // @@protoc_insertion_point(field_release:transfer.SearchRequest.root_path)
+  return _impl_.root_path_.Release();
+}
+inline void SearchRequest::set_allocated_root_path(std::string* root_path) {
+  if (root_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.root_path_.SetAllocated(root_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.root_path_.IsDefault()) {
+    _impl_.root_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchRequest.root_path)
+}
+
+// string name_pattern = 3;
+inline void SearchRequest::clear_name_pattern() {
+  _impl_.name_pattern_.ClearToEmpty();
+}
+inline const std::string& SearchRequest::name_pattern() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.name_pattern)
+  return _internal_name_pattern();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_name_pattern(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_pattern_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.name_pattern)
+}
+inline std::string* SearchRequest::mutable_name_pattern() {
+  std::string* _s = _internal_mutable_name_pattern();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchRequest.name_pattern)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_name_pattern() const {
+  return _impl_.name_pattern_.Get();
+}
+inline void SearchRequest::_internal_set_name_pattern(const std::string& value) {
+  
+  _impl_.name_pattern_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchRequest::_internal_mutable_name_pattern() {
+  
+  return _impl_.name_pattern_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchRequest::release_name_pattern() {
+  // @@protoc_insertion_point(field_release:transfer.SearchRequest.name_pattern)
+  return _impl_.name_pattern_.Release();
+}
+inline void SearchRequest::set_allocated_name_pattern(std::string* name_pattern) {
+  if (name_pattern != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_pattern_.SetAllocated(name_pattern, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_pattern_.IsDefault()) {
+    _impl_.name_pattern_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchRequest.name_pattern)
+}
+
+// .transfer.SearchRequest.PatternType pattern_type = 4;
+inline void SearchRequest::clear_pattern_type() {
+  _impl_.pattern_type_ = 0;
+}
+inline ::transfer::SearchRequest_PatternType SearchRequest::_internal_pattern_type() const {
+  return static_cast< ::transfer::SearchRequest_PatternType >(_impl_.pattern_type_);
+}
+inline ::transfer::SearchRequest_PatternType SearchRequest::pattern_type() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.pattern_type)
+  return _internal_pattern_type();
+}
+inline void SearchRequest::_internal_set_pattern_type(::transfer::SearchRequest_PatternType value) {
+  
+  _impl_.pattern_type_ = value;
+}
+inline void SearchRequest::set_pattern_type(::transfer::SearchRequest_PatternType value) {
+  _internal_set_pattern_type(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.pattern_type)
+}
+
+// bool case_sensitive = 5;
+inline void SearchRequest::clear_case_sensitive() {
+  _impl_.case_sensitive_ = false;
+}
+inline bool SearchRequest::_internal_case_sensitive() const {
+  return _impl_.case_sensitive_;
+}
+inline bool SearchRequest::case_sensitive() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.case_sensitive)
+  return _internal_case_sensitive();
+}
+inline void SearchRequest::_internal_set_case_sensitive(bool value) {
+  
+  _impl_.case_sensitive_ = value;
+}
+inline void SearchRequest::set_case_sensitive(bool value) {
+  _internal_set_case_sensitive(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.case_sensitive)
+}
+
+// uint64 min_size = 6;
+inline void SearchRequest::clear_min_size() {
+  _impl_.min_size_ = uint64_t{0u};
+}
+inline uint64_t SearchRequest::_internal_min_size() const {
+  return _impl_.min_size_;
+}
+inline uint64_t SearchRequest::min_size() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.min_size)
+  return _internal_min_size();
+}
+inline void SearchRequest::_internal_set_min_size(uint64_t value) {
+  
+  _impl_.min_size_ = value;
+}
+inline void SearchRequest::set_min_size(uint64_t value) {
+  _internal_set_min_size(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.min_size)
+}
+
+// uint64 max_size = 7;
+inline void SearchRequest::clear_max_size() {
+  _impl_.max_size_ = uint64_t{0u};
+}
+inline uint64_t SearchRequest::_internal_max_size() const {
+  return _impl_.max_size_;
+}
+inline uint64_t SearchRequest::max_size() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.max_size)
+  return _internal_max_size();
+}
+inline void SearchRequest::_internal_set_max_size(uint64_t value) {
+  
+  _impl_.max_size_ = value;
+}
+inline void SearchRequest::set_max_size(uint64_t value) {
+  _internal_set_max_size(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.max_size)
+}
+
+// uint64 modified_after = 8;
+inline void SearchRequest::clear_modified_after() {
+  _impl_.modified_after_ = uint64_t{0u};
+}
+inline uint64_t SearchRequest::_internal_modified_after() const {
+  return _impl_.modified_after_;
+}
+inline uint64_t SearchRequest::modified_after() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.modified_after)
+  return _internal_modified_after();
+}
+inline void SearchRequest::_internal_set_modified_after(uint64_t value) {
+  
+  _impl_.modified_after_ = value;
+}
+inline void SearchRequest::set_modified_after(uint64_t value) {
+  _internal_set_modified_after(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.modified_after)
+}
+
+// uint64 modified_before = 9;
+inline void SearchRequest::clear_modified_before() {
+  _impl_.modified_before_ = uint64_t{0u};
+}
+inline uint64_t SearchRequest::_internal_modified_before() const {
+  return _impl_.modified_before_;
+}
+inline uint64_t SearchRequest::modified_before() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.modified_before)
+  return _internal_modified_before();
+}
+inline void SearchRequest::_internal_set_modified_before(uint64_t value) {
+  
+  _impl_.modified_before_ = value;
+}
+inline void SearchRequest::set_modified_before(uint64_t value) {
+  _internal_set_modified_before(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.modified_before)
+}
+
+// bool include_directories = 10;
+inline void SearchRequest::clear_include_directories() {
+  _impl_.include_directories_ = false;
+}
+inline bool SearchRequest::_internal_include_directories() const {
+  return _impl_.include_directories_;
+}
+inline bool SearchRequest::include_directories() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.include_directories)
+  return _internal_include_directories();
+}
+inline void SearchRequest::_internal_set_include_directories(bool value) {
+  
+  _impl_.include_directories_ = value;
+}
+inline void SearchRequest::set_include_directories(bool value) {
+  _internal_set_include_directories(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.include_directories)
+}
+
+// uint32 limit = 11;
+inline void SearchRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t SearchRequest::limit() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.limit)
+  return _internal_limit();
+}
+inline void SearchRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void SearchRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.limit)
+}
+
+// uint32 page_size = 12;
+inline void SearchRequest::clear_page_size() {
+  _impl_.page_size_ = 0u;
+}
+inline uint32_t SearchRequest::_internal_page_size() const {
+  return _impl_.page_size_;
+}
+inline uint32_t SearchRequest::page_size() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.page_size)
+  return _internal_page_size();
+}
+inline void SearchRequest::_internal_set_page_size(uint32_t value) {
+  
+  _impl_.page_size_ = value;
+}
+inline void SearchRequest::set_page_size(uint32_t value) {
+  _internal_set_page_size(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.page_size)
+}
+
+// string cursor = 13;
+inline void SearchRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& SearchRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.cursor)
+}
+inline std::string* SearchRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchRequest.cursor)
+  return _s;
+}
+inline const std::string& SearchRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void SearchRequest::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchRequest::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.SearchRequest.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void SearchRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchRequest.cursor)
+}
+
+// bool cancel = 14;
+inline void SearchRequest::clear_cancel() {
+  _impl_.cancel_ = false;
+}
+inline bool SearchRequest::_internal_cancel() const {
+  return _impl_.cancel_;
+}
+inline bool SearchRequest::cancel() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchRequest.cancel)
+  return _internal_cancel();
+}
+inline void SearchRequest::_internal_set_cancel(bool value) {
+  
+  _impl_.cancel_ = value;
+}
+inline void SearchRequest::set_cancel(bool value) {
+  _internal_set_cancel(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchRequest.cancel)
+}
+
+// -------------------------------------------------------------------
+
+// SearchResponse_Entry
+
+// string relative_path = 1;
+inline void SearchResponse_Entry::clear_relative_path() {
+  _impl_.relative_path_.ClearToEmpty();
+}
+inline const std::string& SearchResponse_Entry::relative_path() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.Entry.relative_path)
+  return _internal_relative_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchResponse_Entry::set_relative_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.relative_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.Entry.relative_path)
+}
+inline std::string* SearchResponse_Entry::mutable_relative_path() {
+  std::string* _s = _internal_mutable_relative_path();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchResponse.Entry.relative_path)
+  return _s;
+}
+inline const std::string& SearchResponse_Entry::_internal_relative_path() const {
+  return _impl_.relative_path_.Get();
+}
+inline void SearchResponse_Entry::_internal_set_relative_path(const std::string& value) {
+  
+  _impl_.relative_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResponse_Entry::_internal_mutable_relative_path() {
+  
+  return _impl_.relative_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResponse_Entry::release_relative_path() {
+  // @@protoc_insertion_point(field_release:transfer.SearchResponse.Entry.relative_path)
+  return _impl_.relative_path_.Release();
+}
+inline void SearchResponse_Entry::set_allocated_relative_path(std::string* relative_path) {
+  if (relative_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.relative_path_.SetAllocated(relative_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.relative_path_.IsDefault()) {
+    _impl_.relative_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchResponse.Entry.relative_path)
+}
+
+// bool is_directory = 2;
+inline void SearchResponse_Entry::clear_is_directory() {
+  _impl_.is_directory_ = false;
+}
+inline bool SearchResponse_Entry::_internal_is_directory() const {
+  return _impl_.is_directory_;
+}
+inline bool SearchResponse_Entry::is_directory() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.Entry.is_directory)
+  return _internal_is_directory();
+}
+inline void SearchResponse_Entry::_internal_set_is_directory(bool value) {
+  
+  _impl_.is_directory_ = value;
+}
+inline void SearchResponse_Entry::set_is_directory(bool value) {
+  _internal_set_is_directory(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.Entry.is_directory)
+}
+
+// uint64 size = 3;
+inline void SearchResponse_Entry::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t SearchResponse_Entry::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t SearchResponse_Entry::size() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.Entry.size)
+  return _internal_size();
+}
+inline void SearchResponse_Entry::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void SearchResponse_Entry::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.Entry.size)
+}
+
+// string modify_time = 4;
+inline void SearchResponse_Entry::clear_modify_time() {
+  _impl_.modify_time_.ClearToEmpty();
+}
+inline const std::string& SearchResponse_Entry::modify_time() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.Entry.modify_time)
+  return _internal_modify_time();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchResponse_Entry::set_modify_time(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.modify_time_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.Entry.modify_time)
+}
+inline std::string* SearchResponse_Entry::mutable_modify_time() {
+  std::string* _s = _internal_mutable_modify_time();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchResponse.Entry.modify_time)
+  return _s;
+}
+inline const std::string& SearchResponse_Entry::_internal_modify_time() const {
+  return _impl_.modify_time_.Get();
+}
+inline void SearchResponse_Entry::_internal_set_modify_time(const std::string& value) {
+  
+  _impl_.modify_time_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResponse_Entry::_internal_mutable_modify_time() {
+  
+  return _impl_.modify_time_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResponse_Entry::release_modify_time() {
+  // @@protoc_insertion_point(field_release:transfer.SearchResponse.Entry.modify_time)
+  return _impl_.modify_time_.Release();
+}
+inline void SearchResponse_Entry::set_allocated_modify_time(std::string* modify_time) {
+  if (modify_time != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.modify_time_.SetAllocated(modify_time, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.modify_time_.IsDefault()) {
+    _impl_.modify_time_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchResponse.Entry.modify_time)
+}
+
+// -------------------------------------------------------------------
+
+// SearchResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool SearchResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool SearchResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void SearchResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& SearchResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& SearchResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.header)
+  return _internal_header();
+}
+inline void SearchResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.SearchResponse.header)
+}
+inline ::transfer::ResponseHeader* SearchResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* SearchResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.SearchResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* SearchResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* SearchResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchResponse.header)
+  return _msg;
+}
+inline void SearchResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchResponse.header)
+}
+
+// repeated .transfer.SearchResponse.Entry entries = 2;
+inline int SearchResponse::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int SearchResponse::entries_size() const {
+  return _internal_entries_size();
+}
+inline void SearchResponse::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::transfer::SearchResponse_Entry* SearchResponse::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.SearchResponse.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::SearchResponse_Entry >*
+SearchResponse::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.SearchResponse.entries)
+  return &_impl_.entries_;
+}
+inline const ::transfer::SearchResponse_Entry& SearchResponse::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::transfer::SearchResponse_Entry& SearchResponse::entries(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.entries)
+  return _internal_entries(index);
+}
+inline ::transfer::SearchResponse_Entry* SearchResponse::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::transfer::SearchResponse_Entry* SearchResponse::add_entries() {
+  ::transfer::SearchResponse_Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:transfer.SearchResponse.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::SearchResponse_Entry >&
+SearchResponse::entries() const {
+  // @@protoc_insertion_point(field_list:transfer.SearchResponse.entries)
+  return _impl_.entries_;
+}
+
+// bool has_more = 3;
+inline void SearchResponse::clear_has_more() {
+  _impl_.has_more_ = false;
+}
+inline bool SearchResponse::_internal_has_more() const {
+  return _impl_.has_more_;
+}
+inline bool SearchResponse::has_more() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.has_more)
+  return _internal_has_more();
+}
+inline void SearchResponse::_internal_set_has_more(bool value) {
+  
+  _impl_.has_more_ = value;
+}
+inline void SearchResponse::set_has_more(bool value) {
+  _internal_set_has_more(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.has_more)
+}
+
+// bool truncated = 4;
+inline void SearchResponse::clear_truncated() {
+  _impl_.truncated_ = false;
+}
+inline bool SearchResponse::_internal_truncated() const {
+  return _impl_.truncated_;
+}
+inline bool SearchResponse::truncated() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.truncated)
+  return _internal_truncated();
+}
+inline void SearchResponse::_internal_set_truncated(bool value) {
+  
+  _impl_.truncated_ = value;
+}
+inline void SearchResponse::set_truncated(bool value) {
+  _internal_set_truncated(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.truncated)
+}
+
+// uint64 scanned_count = 5;
+inline void SearchResponse::clear_scanned_count() {
+  _impl_.scanned_count_ = uint64_t{0u};
+}
+inline uint64_t SearchResponse::_internal_scanned_count() const {
+  return _impl_.scanned_count_;
+}
+inline uint64_t SearchResponse::scanned_count() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.scanned_count)
+  return _internal_scanned_count();
+}
+inline void SearchResponse::_internal_set_scanned_count(uint64_t value) {
+  
+  _impl_.scanned_count_ = value;
+}
+inline void SearchResponse::set_scanned_count(uint64_t value) {
+  _internal_set_scanned_count(value);
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.scanned_count)
+}
+
+// string next_cursor = 6;
+inline void SearchResponse::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+}
+inline const std::string& SearchResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:transfer.SearchResponse.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SearchResponse::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.SearchResponse.next_cursor)
+}
+inline std::string* SearchResponse::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:transfer.SearchResponse.next_cursor)
+  return _s;
+}
+inline const std::string& SearchResponse::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void SearchResponse::_internal_set_next_cursor(const std::string& value) {
+  
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SearchResponse::_internal_mutable_next_cursor() {
+  
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SearchResponse::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:transfer.SearchResponse.next_cursor)
+  return _impl_.next_cursor_.Release();
+}
+inline void SearchResponse::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.SearchResponse.next_cursor)
+}
+
+// -------------------------------------------------------------------
+
+// UploadRequest_FileInfo
+
+// string file_name = 1;
+inline void UploadRequest_FileInfo::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::file_name() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.file_name)
+}
+inline std::string* UploadRequest_FileInfo::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.file_name)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_file_name() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.file_name)
+}
+
+// string target_path = 2;
+inline void UploadRequest_FileInfo::clear_target_path() {
+  _impl_.target_path_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::target_path() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.target_path)
+  return _internal_target_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_target_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.target_path)
+}
+inline std::string* UploadRequest_FileInfo::mutable_target_path() {
+  std::string* _s = _internal_mutable_target_path();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.target_path)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_target_path() const {
+  return _impl_.target_path_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_target_path(const std::string& value) {
+  
+  _impl_.target_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_target_path() {
+  
+  return _impl_.target_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_target_path() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.target_path)
+  return _impl_.target_path_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_target_path(std::string* target_path) {
+  if (target_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.target_path_.SetAllocated(target_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_path_.IsDefault()) {
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.target_path)
+}
+
+// uint64 file_size = 3;
+inline void UploadRequest_FileInfo::clear_file_size() {
+  _impl_.file_size_ = uint64_t{0u};
+}
+inline uint64_t UploadRequest_FileInfo::_internal_file_size() const {
+  return _impl_.file_size_;
+}
+inline uint64_t UploadRequest_FileInfo::file_size() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.file_size)
+  return _internal_file_size();
+}
+inline void UploadRequest_FileInfo::_internal_set_file_size(uint64_t value) {
+  
+  _impl_.file_size_ = value;
+}
+inline void UploadRequest_FileInfo::set_file_size(uint64_t value) {
+  _internal_set_file_size(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.file_size)
+}
+
+// string md5 = 4;
+inline void UploadRequest_FileInfo::clear_md5() {
+  _impl_.md5_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::md5() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.md5)
+  return _internal_md5();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_md5(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.md5_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.md5)
+}
+inline std::string* UploadRequest_FileInfo::mutable_md5() {
+  std::string* _s = _internal_mutable_md5();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.md5)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_md5() const {
+  return _impl_.md5_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_md5(const std::string& value) {
+  
+  _impl_.md5_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_md5() {
+  
+  return _impl_.md5_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_md5() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.md5)
+  return _impl_.md5_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_md5(std::string* md5) {
+  if (md5 != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.md5_.SetAllocated(md5, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.md5_.IsDefault()) {
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.md5)
+}
+
+// bool need_chunk = 5;
+inline void UploadRequest_FileInfo::clear_need_chunk() {
+  _impl_.need_chunk_ = false;
+}
+inline bool UploadRequest_FileInfo::_internal_need_chunk() const {
+  return _impl_.need_chunk_;
+}
+inline bool UploadRequest_FileInfo::need_chunk() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.need_chunk)
+  return _internal_need_chunk();
+}
+inline void UploadRequest_FileInfo::_internal_set_need_chunk(bool value) {
+  
+  _impl_.need_chunk_ = value;
+}
+inline void UploadRequest_FileInfo::set_need_chunk(bool value) {
+  _internal_set_need_chunk(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.need_chunk)
+}
+
+// uint32 chunk_size = 6;
+inline void UploadRequest_FileInfo::clear_chunk_size() {
+  _impl_.chunk_size_ = 0u;
+}
+inline uint32_t UploadRequest_FileInfo::_internal_chunk_size() const {
+  return _impl_.chunk_size_;
+}
+inline uint32_t UploadRequest_FileInfo::chunk_size() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.chunk_size)
+  return _internal_chunk_size();
+}
+inline void UploadRequest_FileInfo::_internal_set_chunk_size(uint32_t value) {
+  
+  _impl_.chunk_size_ = value;
+}
+inline void UploadRequest_FileInfo::set_chunk_size(uint32_t value) {
+  _internal_set_chunk_size(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.chunk_size)
+}
+
+// uint32 chunk_sequence = 7;
+inline void UploadRequest_FileInfo::clear_chunk_sequence() {
+  _impl_.chunk_sequence_ = 0u;
+}
+inline uint32_t UploadRequest_FileInfo::_internal_chunk_sequence() const {
+  return _impl_.chunk_sequence_;
+}
+inline uint32_t UploadRequest_FileInfo::chunk_sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.chunk_sequence)
+  return _internal_chunk_sequence();
+}
+inline void UploadRequest_FileInfo::_internal_set_chunk_sequence(uint32_t value) {
+  
+  _impl_.chunk_sequence_ = value;
+}
+inline void UploadRequest_FileInfo::set_chunk_sequence(uint32_t value) {
+  _internal_set_chunk_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.chunk_sequence)
+}
+
+// bytes data = 8;
+inline void UploadRequest_FileInfo::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::data() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.data)
+}
+inline std::string* UploadRequest_FileInfo::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.data)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_data() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.data)
+  return _impl_.data_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.data)
+}
+
+// uint32 checksum = 9;
+inline void UploadRequest_FileInfo::clear_checksum() {
+  _impl_.checksum_ = 0u;
+}
+inline uint32_t UploadRequest_FileInfo::_internal_checksum() const {
+  return _impl_.checksum_;
+}
+inline uint32_t UploadRequest_FileInfo::checksum() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.checksum)
+  return _internal_checksum();
+}
+inline void UploadRequest_FileInfo::_internal_set_checksum(uint32_t value) {
+  
+  _impl_.checksum_ = value;
+}
+inline void UploadRequest_FileInfo::set_checksum(uint32_t value) {
+  _internal_set_checksum(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.checksum)
+}
+
+// string task_id = 10;
+inline void UploadRequest_FileInfo::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.task_id)
+  return _internal_task_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.task_id)
+}
+inline std::string* UploadRequest_FileInfo::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.task_id)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_task_id() const {
+  return _impl_.task_id_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_task_id(const std::string& value) {
+  
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_task_id() {
+  
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.task_id)
+  return _impl_.task_id_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_task_id(std::string* task_id) {
+  if (task_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.task_id)
+}
+
+// .transfer.TransferStatus status = 11;
+inline void UploadRequest_FileInfo::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::transfer::TransferStatus UploadRequest_FileInfo::_internal_status() const {
+  return static_cast< ::transfer::TransferStatus >(_impl_.status_);
+}
+inline ::transfer::TransferStatus UploadRequest_FileInfo::status() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.status)
+  return _internal_status();
+}
+inline void UploadRequest_FileInfo::_internal_set_status(::transfer::TransferStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void UploadRequest_FileInfo::set_status(::transfer::TransferStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.status)
+}
+
+// uint64 offset = 12;
+inline void UploadRequest_FileInfo::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t UploadRequest_FileInfo::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t UploadRequest_FileInfo::offset() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.offset)
+  return _internal_offset();
+}
+inline void UploadRequest_FileInfo::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void UploadRequest_FileInfo::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.offset)
+}
+
+// string upload_id = 13;
+inline void UploadRequest_FileInfo::clear_upload_id() {
+  _impl_.upload_id_.ClearToEmpty();
+}
+inline const std::string& UploadRequest_FileInfo::upload_id() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.upload_id)
+  return _internal_upload_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadRequest_FileInfo::set_upload_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.upload_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.upload_id)
+}
+inline std::string* UploadRequest_FileInfo::mutable_upload_id() {
+  std::string* _s = _internal_mutable_upload_id();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.upload_id)
+  return _s;
+}
+inline const std::string& UploadRequest_FileInfo::_internal_upload_id() const {
+  return _impl_.upload_id_.Get();
+}
+inline void UploadRequest_FileInfo::_internal_set_upload_id(const std::string& value) {
+  
+  _impl_.upload_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::_internal_mutable_upload_id() {
+  
+  return _impl_.upload_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadRequest_FileInfo::release_upload_id() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.upload_id)
+  return _impl_.upload_id_.Release();
+}
+inline void UploadRequest_FileInfo::set_allocated_upload_id(std::string* upload_id) {
+  if (upload_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.upload_id_.SetAllocated(upload_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.upload_id_.IsDefault()) {
+    _impl_.upload_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.upload_id)
+}
+
+// -------------------------------------------------------------------
+
+// UploadRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool UploadRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool UploadRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void UploadRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& UploadRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& UploadRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.header)
+  return _internal_header();
+}
+inline void UploadRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.UploadRequest.header)
+}
+inline ::transfer::RequestHeader* UploadRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* UploadRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.UploadRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* UploadRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* UploadRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.header)
+  return _msg;
+}
+inline void UploadRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.header)
+}
+
+// repeated .transfer.UploadRequest.FileInfo files = 2;
+inline int UploadRequest::_internal_files_size() const {
+  return _impl_.files_.size();
+}
+inline int UploadRequest::files_size() const {
+  return _internal_files_size();
+}
+inline void UploadRequest::clear_files() {
+  _impl_.files_.Clear();
+}
+inline ::transfer::UploadRequest_FileInfo* UploadRequest::mutable_files(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.files)
+  return _impl_.files_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >*
+UploadRequest::mutable_files() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.UploadRequest.files)
+  return &_impl_.files_;
+}
+inline const ::transfer::UploadRequest_FileInfo& UploadRequest::_internal_files(int index) const {
+  return _impl_.files_.Get(index);
+}
+inline const ::transfer::UploadRequest_FileInfo& UploadRequest::files(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.UploadRequest.files)
+  return _internal_files(index);
+}
+inline ::transfer::UploadRequest_FileInfo* UploadRequest::_internal_add_files() {
+  return _impl_.files_.Add();
+}
+inline ::transfer::UploadRequest_FileInfo* UploadRequest::add_files() {
+  ::transfer::UploadRequest_FileInfo* _add = _internal_add_files();
+  // @@protoc_insertion_point(field_add:transfer.UploadRequest.files)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >&
+UploadRequest::files() const {
+  // @@protoc_insertion_point(field_list:transfer.UploadRequest.files)
+  return _impl_.files_;
+}
+
+// -------------------------------------------------------------------
+
+// UploadResponse_FileResult
+
+// string file_name = 1;
+inline void UploadResponse_FileResult::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& UploadResponse_FileResult::file_name() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadResponse_FileResult::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.file_name)
+}
+inline std::string* UploadResponse_FileResult::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.file_name)
+  return _s;
+}
+inline const std::string& UploadResponse_FileResult::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void UploadResponse_FileResult::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::release_file_name() {
+  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void UploadResponse_FileResult::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.file_name)
+}
+
+// string target_path = 2;
+inline void UploadResponse_FileResult::clear_target_path() {
+  _impl_.target_path_.ClearToEmpty();
+}
+inline const std::string& UploadResponse_FileResult::target_path() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.target_path)
+  return _internal_target_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadResponse_FileResult::set_target_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.target_path)
+}
+inline std::string* UploadResponse_FileResult::mutable_target_path() {
+  std::string* _s = _internal_mutable_target_path();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.target_path)
+  return _s;
+}
+inline const std::string& UploadResponse_FileResult::_internal_target_path() const {
+  return _impl_.target_path_.Get();
+}
+inline void UploadResponse_FileResult::_internal_set_target_path(const std::string& value) {
+  
+  _impl_.target_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::_internal_mutable_target_path() {
+  
+  return _impl_.target_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::release_target_path() {
+  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.target_path)
+  return _impl_.target_path_.Release();
+}
+inline void UploadResponse_FileResult::set_allocated_target_path(std::string* target_path) {
+  if (target_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.target_path_.SetAllocated(target_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_path_.IsDefault()) {
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.target_path)
+}
+
+// bool success = 3;
+inline void UploadResponse_FileResult::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool UploadResponse_FileResult::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool UploadResponse_FileResult::success() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.success)
+  return _internal_success();
+}
+inline void UploadResponse_FileResult::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void UploadResponse_FileResult::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.success)
+}
+
+// bool need_chunk = 4;
+inline void UploadResponse_FileResult::clear_need_chunk() {
+  _impl_.need_chunk_ = false;
+}
+inline bool UploadResponse_FileResult::_internal_need_chunk() const {
+  return _impl_.need_chunk_;
+}
+inline bool UploadResponse_FileResult::need_chunk() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.need_chunk)
+  return _internal_need_chunk();
+}
+inline void UploadResponse_FileResult::_internal_set_need_chunk(bool value) {
+  
+  _impl_.need_chunk_ = value;
+}
+inline void UploadResponse_FileResult::set_need_chunk(bool value) {
+  _internal_set_need_chunk(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.need_chunk)
+}
+
+// int32 next_sequence = 5;
+inline void UploadResponse_FileResult::clear_next_sequence() {
+  _impl_.next_sequence_ = 0;
+}
+inline int32_t UploadResponse_FileResult::_internal_next_sequence() const {
+  return _impl_.next_sequence_;
+}
+inline int32_t UploadResponse_FileResult::next_sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.next_sequence)
+  return _internal_next_sequence();
+}
+inline void UploadResponse_FileResult::_internal_set_next_sequence(int32_t value) {
+  
+  _impl_.next_sequence_ = value;
+}
+inline void UploadResponse_FileResult::set_next_sequence(int32_t value) {
+  _internal_set_next_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.next_sequence)
+}
+
+// string error_message = 6;
+inline void UploadResponse_FileResult::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& UploadResponse_FileResult::error_message() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UploadResponse_FileResult::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.error_message)
+}
+inline std::string* UploadResponse_FileResult::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.error_message)
+  return _s;
+}
+inline const std::string& UploadResponse_FileResult::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void UploadResponse_FileResult::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UploadResponse_FileResult::release_error_message() {
+  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void UploadResponse_FileResult::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.error_message)
+}
+
+// -------------------------------------------------------------------
+
+// UploadResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool UploadResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool UploadResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void UploadResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::ResponseHeader& UploadResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& UploadResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.header)
+  return _internal_header();
+}
+inline void UploadResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.UploadResponse.header)
+}
+inline ::transfer::ResponseHeader* UploadResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::ResponseHeader* UploadResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.UploadResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* UploadResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::ResponseHeader* UploadResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.header)
+  return _msg;
+}
+inline void UploadResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.header)
+}
+
+// repeated .transfer.UploadResponse.FileResult results = 2;
+inline int UploadResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int UploadResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void UploadResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::transfer::UploadResponse_FileResult* UploadResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >*
+UploadResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.UploadResponse.results)
+  return &_impl_.results_;
+}
+inline const ::transfer::UploadResponse_FileResult& UploadResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::transfer::UploadResponse_FileResult& UploadResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.UploadResponse.results)
+  return _internal_results(index);
+}
+inline ::transfer::UploadResponse_FileResult* UploadResponse::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::transfer::UploadResponse_FileResult* UploadResponse::add_results() {
+  ::transfer::UploadResponse_FileResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:transfer.UploadResponse.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >&
+UploadResponse::results() const {
+  // @@protoc_insertion_point(field_list:transfer.UploadResponse.results)
+  return _impl_.results_;
+}
+
+// -------------------------------------------------------------------
+
+// DownloadRequest_FileInfo
+
+// string file_name = 1;
+inline void DownloadRequest_FileInfo::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
+}
+inline const std::string& DownloadRequest_FileInfo::file_name() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.file_name)
+  return _internal_file_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadRequest_FileInfo::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.file_name)
+}
+inline std::string* DownloadRequest_FileInfo::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.file_name)
+  return _s;
+}
+inline const std::string& DownloadRequest_FileInfo::_internal_file_name() const {
+  return _impl_.file_name_.Get();
+}
+inline void DownloadRequest_FileInfo::_internal_set_file_name(const std::string& value) {
+  
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::_internal_mutable_file_name() {
+  
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::release_file_name() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.file_name)
+  return _impl_.file_name_.Release();
+}
+inline void DownloadRequest_FileInfo::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.file_name)
+}
+
+// string target_path = 2;
+inline void DownloadRequest_FileInfo::clear_target_path() {
+  _impl_.target_path_.ClearToEmpty();
+}
+inline const std::string& DownloadRequest_FileInfo::target_path() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.target_path)
+  return _internal_target_path();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadRequest_FileInfo::set_target_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.target_path)
+}
+inline std::string* DownloadRequest_FileInfo::mutable_target_path() {
+  std::string* _s = _internal_mutable_target_path();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.target_path)
+  return _s;
+}
+inline const std::string& DownloadRequest_FileInfo::_internal_target_path() const {
+  return _impl_.target_path_.Get();
+}
+inline void DownloadRequest_FileInfo::_internal_set_target_path(const std::string& value) {
+  
+  _impl_.target_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::_internal_mutable_target_path() {
+  
+  return _impl_.target_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::release_target_path() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.target_path)
+  return _impl_.target_path_.Release();
+}
+inline void DownloadRequest_FileInfo::set_allocated_target_path(std::string* target_path) {
+  if (target_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.target_path_.SetAllocated(target_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_path_.IsDefault()) {
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.target_path)
+}
+
+// uint32 chunk_size = 3;
+inline void DownloadRequest_FileInfo::clear_chunk_size() {
+  _impl_.chunk_size_ = 0u;
+}
+inline uint32_t DownloadRequest_FileInfo::_internal_chunk_size() const {
+  return _impl_.chunk_size_;
+}
+inline uint32_t DownloadRequest_FileInfo::chunk_size() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.chunk_size)
+  return _internal_chunk_size();
+}
+inline void DownloadRequest_FileInfo::_internal_set_chunk_size(uint32_t value) {
+  
+  _impl_.chunk_size_ = value;
+}
+inline void DownloadRequest_FileInfo::set_chunk_size(uint32_t value) {
+  _internal_set_chunk_size(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.chunk_size)
+}
+
+// uint64 offset = 4;
+inline void DownloadRequest_FileInfo::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t DownloadRequest_FileInfo::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t DownloadRequest_FileInfo::offset() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.offset)
+  return _internal_offset();
+}
+inline void DownloadRequest_FileInfo::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void DownloadRequest_FileInfo::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.offset)
+}
+
+// string download_id = 5;
+inline void DownloadRequest_FileInfo::clear_download_id() {
+  _impl_.download_id_.ClearToEmpty();
+}
+inline const std::string& DownloadRequest_FileInfo::download_id() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.download_id)
+  return _internal_download_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadRequest_FileInfo::set_download_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.download_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.download_id)
+}
+inline std::string* DownloadRequest_FileInfo::mutable_download_id() {
+  std::string* _s = _internal_mutable_download_id();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.download_id)
+  return _s;
+}
+inline const std::string& DownloadRequest_FileInfo::_internal_download_id() const {
+  return _impl_.download_id_.Get();
+}
+inline void DownloadRequest_FileInfo::_internal_set_download_id(const std::string& value) {
+  
+  _impl_.download_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::_internal_mutable_download_id() {
+  
+  return _impl_.download_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DownloadRequest_FileInfo::release_download_id() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.download_id)
+  return _impl_.download_id_.Release();
+}
+inline void DownloadRequest_FileInfo::set_allocated_download_id(std::string* download_id) {
+  if (download_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.download_id_.SetAllocated(download_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.download_id_.IsDefault()) {
+    _impl_.download_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.download_id)
+}
+
+// -------------------------------------------------------------------
+
+// DownloadRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool DownloadRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool DownloadRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void DownloadRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+inline const ::transfer::RequestHeader& DownloadRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
+}
+inline const ::transfer::RequestHeader& DownloadRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.header)
+  return _internal_header();
+}
+inline void DownloadRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.DownloadRequest.header)
+}
+inline ::transfer::RequestHeader* DownloadRequest::release_header() {
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::transfer::RequestHeader* DownloadRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* DownloadRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::transfer::RequestHeader* DownloadRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.header)
+  return _msg;
+}
+inline void DownloadRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.header)
+}
+
+// repeated .transfer.DownloadRequest.FileInfo files = 2;
+inline int DownloadRequest::_internal_files_size() const {
+  return _impl_.files_.size();
+}
+inline int DownloadRequest::files_size() const {
+  return _internal_files_size();
+}
+inline void DownloadRequest::clear_files() {
+  _impl_.files_.Clear();
+}
+inline ::transfer::DownloadRequest_FileInfo* DownloadRequest::mutable_files(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.files)
+  return _impl_.files_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >*
+DownloadRequest::mutable_files() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.DownloadRequest.files)
+  return &_impl_.files_;
+}
+inline const ::transfer::DownloadRequest_FileInfo& DownloadRequest::_internal_files(int index) const {
+  return _impl_.files_.Get(index);
+}
+inline const ::transfer::DownloadRequest_FileInfo& DownloadRequest::files(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.files)
+  return _internal_files(index);
+}
+inline ::transfer::DownloadRequest_FileInfo* DownloadRequest::_internal_add_files() {
+  return _impl_.files_.Add();
+}
+inline ::transfer::DownloadRequest_FileInfo* DownloadRequest::add_files() {
+  ::transfer::DownloadRequest_FileInfo* _add = _internal_add_files();
+  // @@protoc_insertion_point(field_add:transfer.DownloadRequest.files)
+  return _add;
 }
-inline void RequestHeader::set_sequence(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  sequence_ = value;
-  // @@protoc_insertion_point(field_set:transfer.RequestHeader.sequence)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >&
+DownloadRequest::files() const {
+  // @@protoc_insertion_point(field_list:transfer.DownloadRequest.files)
+  return _impl_.files_;
 }
 
 // -------------------------------------------------------------------
 
-// ResponseHeader
+// DownloadResponse_FileResult
 
-// string session_id = 1;
-inline void ResponseHeader::clear_session_id() {
-  session_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string file_name = 1;
+inline void DownloadResponse_FileResult::clear_file_name() {
+  _impl_.file_name_.ClearToEmpty();
 }
-inline const std::string& ResponseHeader::session_id() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.session_id)
-  return session_id_.GetNoArena();
+inline const std::string& DownloadResponse_FileResult::file_name() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.file_name)
+  return _internal_file_name();
 }
-inline void ResponseHeader::set_session_id(const std::string& value) {
-  
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.session_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadResponse_FileResult::set_file_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.file_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.file_name)
 }
-inline void ResponseHeader::set_session_id(std::string&& value) {
-  
-  session_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.ResponseHeader.session_id)
+inline std::string* DownloadResponse_FileResult::mutable_file_name() {
+  std::string* _s = _internal_mutable_file_name();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.file_name)
+  return _s;
 }
-inline void ResponseHeader::set_session_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.ResponseHeader.session_id)
+inline const std::string& DownloadResponse_FileResult::_internal_file_name() const {
+  return _impl_.file_name_.Get();
 }
-inline void ResponseHeader::set_session_id(const char* value, size_t size) {
+inline void DownloadResponse_FileResult::_internal_set_file_name(const std::string& value) {
   
-  session_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.ResponseHeader.session_id)
+  _impl_.file_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResponseHeader::mutable_session_id() {
+inline std::string* DownloadResponse_FileResult::_internal_mutable_file_name() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.session_id)
-  return session_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.file_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResponseHeader::release_session_id() {
-  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.session_id)
-  
-  return session_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DownloadResponse_FileResult::release_file_name() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.file_name)
+  return _impl_.file_name_.Release();
 }
-inline void ResponseHeader::set_allocated_session_id(std::string* session_id) {
-  if (session_id != nullptr) {
+inline void DownloadResponse_FileResult::set_allocated_file_name(std::string* file_name) {
+  if (file_name != nullptr) {
     
   } else {
     
   }
-  session_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), session_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.session_id)
+  _impl_.file_name_.SetAllocated(file_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.file_name_.IsDefault()) {
+    _impl_.file_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.file_name)
 }
 
-// .transfer.MessageType type = 2;
-inline void ResponseHeader::clear_type() {
-  type_ = 0;
+// string target_path = 2;
+inline void DownloadResponse_FileResult::clear_target_path() {
+  _impl_.target_path_.ClearToEmpty();
 }
-inline ::transfer::MessageType ResponseHeader::type() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.type)
-  return static_cast< ::transfer::MessageType >(type_);
+inline const std::string& DownloadResponse_FileResult::target_path() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.target_path)
+  return _internal_target_path();
 }
-inline void ResponseHeader::set_type(::transfer::MessageType value) {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadResponse_FileResult::set_target_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.target_path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.target_path)
+}
+inline std::string* DownloadResponse_FileResult::mutable_target_path() {
+  std::string* _s = _internal_mutable_target_path();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.target_path)
+  return _s;
+}
+inline const std::string& DownloadResponse_FileResult::_internal_target_path() const {
+  return _impl_.target_path_.Get();
+}
+inline void DownloadResponse_FileResult::_internal_set_target_path(const std::string& value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.type)
+  _impl_.target_path_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DownloadResponse_FileResult::_internal_mutable_target_path() {
+  
+  return _impl_.target_path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DownloadResponse_FileResult::release_target_path() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.target_path)
+  return _impl_.target_path_.Release();
+}
+inline void DownloadResponse_FileResult::set_allocated_target_path(std::string* target_path) {
+  if (target_path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.target_path_.SetAllocated(target_path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.target_path_.IsDefault()) {
+    _impl_.target_path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.target_path)
 }
 
-// uint64 timestamp = 3;
-inline void ResponseHeader::clear_timestamp() {
-  timestamp_ = PROTOBUF_ULONGLONG(0);
+// bool exists = 3;
+inline void DownloadResponse_FileResult::clear_exists() {
+  _impl_.exists_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ResponseHeader::timestamp() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.timestamp)
-  return timestamp_;
+inline bool DownloadResponse_FileResult::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool DownloadResponse_FileResult::exists() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.exists)
+  return _internal_exists();
 }
-inline void ResponseHeader::set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void DownloadResponse_FileResult::_internal_set_exists(bool value) {
   
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.timestamp)
+  _impl_.exists_ = value;
+}
+inline void DownloadResponse_FileResult::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.exists)
 }
 
-// bool success = 4;
-inline void ResponseHeader::clear_success() {
-  success_ = false;
+// uint64 file_size = 4;
+inline void DownloadResponse_FileResult::clear_file_size() {
+  _impl_.file_size_ = uint64_t{0u};
 }
-inline bool ResponseHeader::success() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.success)
-  return success_;
+inline uint64_t DownloadResponse_FileResult::_internal_file_size() const {
+  return _impl_.file_size_;
 }
-inline void ResponseHeader::set_success(bool value) {
+inline uint64_t DownloadResponse_FileResult::file_size() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.file_size)
+  return _internal_file_size();
+}
+inline void DownloadResponse_FileResult::_internal_set_file_size(uint64_t value) {
   
-  success_ = value;
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.success)
+  _impl_.file_size_ = value;
+}
+inline void DownloadResponse_FileResult::set_file_size(uint64_t value) {
+  _internal_set_file_size(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.file_size)
 }
 
-// string error_code = 5;
-inline void ResponseHeader::clear_error_code() {
-  error_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string md5 = 5;
+inline void DownloadResponse_FileResult::clear_md5() {
+  _impl_.md5_.ClearToEmpty();
 }
-inline const std::string& ResponseHeader::error_code() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.error_code)
-  return error_code_.GetNoArena();
+inline const std::string& DownloadResponse_FileResult::md5() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.md5)
+  return _internal_md5();
 }
-inline void ResponseHeader::set_error_code(const std::string& value) {
-  
-  error_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.error_code)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadResponse_FileResult::set_md5(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.md5_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.md5)
 }
-inline void ResponseHeader::set_error_code(std::string&& value) {
-  
-  error_code_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.ResponseHeader.error_code)
+inline std::string* DownloadResponse_FileResult::mutable_md5() {
+  std::string* _s = _internal_mutable_md5();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.md5)
+  return _s;
 }
-inline void ResponseHeader::set_error_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.ResponseHeader.error_code)
+inline const std::string& DownloadResponse_FileResult::_internal_md5() const {
+  return _impl_.md5_.Get();
 }
-inline void ResponseHeader::set_error_code(const char* value, size_t size) {
+inline void DownloadResponse_FileResult::_internal_set_md5(const std::string& value) {
   
-  error_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.ResponseHeader.error_code)
+  _impl_.md5_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResponseHeader::mutable_error_code() {
+inline std::string* DownloadResponse_FileResult::_internal_mutable_md5() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.error_code)
-  return error_code_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.md5_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResponseHeader::release_error_code() {
-  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.error_code)
-  
-  return error_code_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* DownloadResponse_FileResult::release_md5() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.md5)
+  return _impl_.md5_.Release();
 }
-inline void ResponseHeader::set_allocated_error_code(std::string* error_code) {
-  if (error_code != nullptr) {
+inline void DownloadResponse_FileResult::set_allocated_md5(std::string* md5) {
+  if (md5 != nullptr) {
     
   } else {
     
   }
-  error_code_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_code);
-  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.error_code)
+  _impl_.md5_.SetAllocated(md5, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.md5_.IsDefault()) {
+    _impl_.md5_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.md5)
 }
 
-// string error_message = 6;
-inline void ResponseHeader::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// bool need_chunk = 6;
+inline void DownloadResponse_FileResult::clear_need_chunk() {
+  _impl_.need_chunk_ = false;
 }
-inline const std::string& ResponseHeader::error_message() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.error_message)
-  return error_message_.GetNoArena();
+inline bool DownloadResponse_FileResult::_internal_need_chunk() const {
+  return _impl_.need_chunk_;
 }
-inline void ResponseHeader::set_error_message(const std::string& value) {
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.error_message)
+inline bool DownloadResponse_FileResult::need_chunk() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.need_chunk)
+  return _internal_need_chunk();
 }
-inline void ResponseHeader::set_error_message(std::string&& value) {
+inline void DownloadResponse_FileResult::_internal_set_need_chunk(bool value) {
   
-  error_message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.ResponseHeader.error_message)
+  _impl_.need_chunk_ = value;
 }
-inline void ResponseHeader::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.ResponseHeader.error_message)
+inline void DownloadResponse_FileResult::set_need_chunk(bool value) {
+  _internal_set_need_chunk(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.need_chunk)
 }
-inline void ResponseHeader::set_error_message(const char* value, size_t size) {
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.ResponseHeader.error_message)
+
+// uint32 chunk_size = 7;
+inline void DownloadResponse_FileResult::clear_chunk_size() {
+  _impl_.chunk_size_ = 0u;
 }
-inline std::string* ResponseHeader::mutable_error_message() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.ResponseHeader.error_message)
-  return error_message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline uint32_t DownloadResponse_FileResult::_internal_chunk_size() const {
+  return _impl_.chunk_size_;
 }
-inline std::string* ResponseHeader::release_error_message() {
-  // @@protoc_insertion_point(field_release:transfer.ResponseHeader.error_message)
+inline uint32_t DownloadResponse_FileResult::chunk_size() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.chunk_size)
+  return _internal_chunk_size();
+}
+inline void DownloadResponse_FileResult::_internal_set_chunk_size(uint32_t value) {
   
-  return error_message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.chunk_size_ = value;
 }
-inline void ResponseHeader::set_allocated_error_message(std::string* error_message) {
-  if (error_message != nullptr) {
-    
-  } else {
-    
-  }
-  error_message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message);
-  // @@protoc_insertion_point(field_set_allocated:transfer.ResponseHeader.error_message)
+inline void DownloadResponse_FileResult::set_chunk_size(uint32_t value) {
+  _internal_set_chunk_size(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.chunk_size)
 }
 
-// uint64 sequence = 7;
-inline void ResponseHeader::clear_sequence() {
-  sequence_ = PROTOBUF_ULONGLONG(0);
+// uint32 chunk_sequence = 8;
+inline void DownloadResponse_FileResult::clear_chunk_sequence() {
+  _impl_.chunk_sequence_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ResponseHeader::sequence() const {
-  // @@protoc_insertion_point(field_get:transfer.ResponseHeader.sequence)
-  return sequence_;
+inline uint32_t DownloadResponse_FileResult::_internal_chunk_sequence() const {
+  return _impl_.chunk_sequence_;
 }
-inline void ResponseHeader::set_sequence(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline uint32_t DownloadResponse_FileResult::chunk_sequence() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.chunk_sequence)
+  return _internal_chunk_sequence();
+}
+inline void DownloadResponse_FileResult::_internal_set_chunk_sequence(uint32_t value) {
   
-  sequence_ = value;
-  // @@protoc_insertion_point(field_set:transfer.ResponseHeader.sequence)
+  _impl_.chunk_sequence_ = value;
+}
+inline void DownloadResponse_FileResult::set_chunk_sequence(uint32_t value) {
+  _internal_set_chunk_sequence(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.chunk_sequence)
 }
 
-// -------------------------------------------------------------------
-
-// DirectoryRequest
-
-// .transfer.RequestHeader header = 1;
-inline bool DirectoryRequest::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+// bytes data = 9;
+inline void DownloadResponse_FileResult::clear_data() {
+  _impl_.data_.ClearToEmpty();
 }
-inline void DirectoryRequest::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
-  }
-  header_ = nullptr;
+inline const std::string& DownloadResponse_FileResult::data() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.data)
+  return _internal_data();
 }
-inline const ::transfer::RequestHeader& DirectoryRequest::header() const {
-  const ::transfer::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::RequestHeader*>(
-      &::transfer::_RequestHeader_default_instance_);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadResponse_FileResult::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.data)
 }
-inline ::transfer::RequestHeader* DirectoryRequest::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.header)
+inline std::string* DownloadResponse_FileResult::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.data)
+  return _s;
+}
+inline const std::string& DownloadResponse_FileResult::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void DownloadResponse_FileResult::_internal_set_data(const std::string& value) {
   
-  ::transfer::RequestHeader* temp = header_;
-  header_ = nullptr;
-  return temp;
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::transfer::RequestHeader* DirectoryRequest::mutable_header() {
+inline std::string* DownloadResponse_FileResult::_internal_mutable_data() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaNoVirtual());
-    header_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.header)
-  return header_;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
-inline void DirectoryRequest::set_allocated_header(::transfer::RequestHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete header_;
-  }
-  if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, header, submessage_arena);
-    }
+inline std::string* DownloadResponse_FileResult::release_data() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.data)
+  return _impl_.data_.Release();
+}
+inline void DownloadResponse_FileResult::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
     
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.header)
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.data)
 }
 
-// string current_path = 2;
-inline void DirectoryRequest::clear_current_path() {
-  current_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint32 checksum = 10;
+inline void DownloadResponse_FileResult::clear_checksum() {
+  _impl_.checksum_ = 0u;
 }
-inline const std::string& DirectoryRequest::current_path() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.current_path)
-  return current_path_.GetNoArena();
+inline uint32_t DownloadResponse_FileResult::_internal_checksum() const {
+  return _impl_.checksum_;
 }
-inline void DirectoryRequest::set_current_path(const std::string& value) {
-  
-  current_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.current_path)
+inline uint32_t DownloadResponse_FileResult::checksum() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.checksum)
+  return _internal_checksum();
 }
-inline void DirectoryRequest::set_current_path(std::string&& value) {
+inline void DownloadResponse_FileResult::_internal_set_checksum(uint32_t value) {
   
-  current_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryRequest.current_path)
+  _impl_.checksum_ = value;
 }
-inline void DirectoryRequest::set_current_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  current_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryRequest.current_path)
+inline void DownloadResponse_FileResult::set_checksum(uint32_t value) {
+  _internal_set_checksum(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.checksum)
 }
-inline void DirectoryRequest::set_current_path(const char* value, size_t size) {
-  
-  current_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryRequest.current_path)
+
+// bool is_last = 11;
+inline void DownloadResponse_FileResult::clear_is_last() {
+  _impl_.is_last_ = false;
 }
-inline std::string* DirectoryRequest::mutable_current_path() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.current_path)
-  return current_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline bool DownloadResponse_FileResult::_internal_is_last() const {
+  return _impl_.is_last_;
 }
-inline std::string* DirectoryRequest::release_current_path() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.current_path)
+inline bool DownloadResponse_FileResult::is_last() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.is_last)
+  return _internal_is_last();
+}
+inline void DownloadResponse_FileResult::_internal_set_is_last(bool value) {
   
-  return current_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.is_last_ = value;
 }
-inline void DirectoryRequest::set_allocated_current_path(std::string* current_path) {
-  if (current_path != nullptr) {
-    
-  } else {
-    
-  }
-  current_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), current_path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.current_path)
+inline void DownloadResponse_FileResult::set_is_last(bool value) {
+  _internal_set_is_last(value);
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.is_last)
 }
 
-// string dir_name = 3;
-inline void DirectoryRequest::clear_dir_name() {
-  dir_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& DirectoryRequest::dir_name() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.dir_name)
-  return dir_name_.GetNoArena();
+// string error_message = 12;
+inline void DownloadResponse_FileResult::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
 }
-inline void DirectoryRequest::set_dir_name(const std::string& value) {
-  
-  dir_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.dir_name)
+inline const std::string& DownloadResponse_FileResult::error_message() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.error_message)
+  return _internal_error_message();
 }
-inline void DirectoryRequest::set_dir_name(std::string&& value) {
-  
-  dir_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryRequest.dir_name)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DownloadResponse_FileResult::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.error_message)
 }
-inline void DirectoryRequest::set_dir_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  dir_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryRequest.dir_name)
+inline std::string* DownloadResponse_FileResult::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.error_message)
+  return _s;
 }
-inline void DirectoryRequest::set_dir_name(const char* value, size_t size) {
-  
-  dir_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryRequest.dir_name)
+inline const std::string& DownloadResponse_FileResult::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline std::string* DirectoryRequest::mutable_dir_name() {
+inline void DownloadResponse_FileResult::_internal_set_error_message(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryRequest.dir_name)
-  return dir_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DirectoryRequest::release_dir_name() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryRequest.dir_name)
+inline std::string* DownloadResponse_FileResult::_internal_mutable_error_message() {
   
-  return dir_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline void DirectoryRequest::set_allocated_dir_name(std::string* dir_name) {
-  if (dir_name != nullptr) {
+inline std::string* DownloadResponse_FileResult::release_error_message() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void DownloadResponse_FileResult::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  dir_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), dir_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryRequest.dir_name)
-}
-
-// bool is_parent = 4;
-inline void DirectoryRequest::clear_is_parent() {
-  is_parent_ = false;
-}
-inline bool DirectoryRequest::is_parent() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryRequest.is_parent)
-  return is_parent_;
-}
-inline void DirectoryRequest::set_is_parent(bool value) {
-  
-  is_parent_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DirectoryRequest.is_parent)
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.error_message)
 }
 
 // -------------------------------------------------------------------
 
-// DirectoryResponse_FileInfo
+// DownloadResponse
 
-// string name = 1;
-inline void DirectoryResponse_FileInfo::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// .transfer.ResponseHeader header = 1;
+inline bool DownloadResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline const std::string& DirectoryResponse_FileInfo::name() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.name)
-  return name_.GetNoArena();
+inline bool DownloadResponse::has_header() const {
+  return _internal_has_header();
 }
-inline void DirectoryResponse_FileInfo::set_name(const std::string& value) {
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.name)
+inline void DownloadResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline void DirectoryResponse_FileInfo::set_name(std::string&& value) {
-  
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryResponse.FileInfo.name)
+inline const ::transfer::ResponseHeader& DownloadResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline void DirectoryResponse_FileInfo::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.FileInfo.name)
+inline const ::transfer::ResponseHeader& DownloadResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.header)
+  return _internal_header();
+}
+inline void DownloadResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.DownloadResponse.header)
 }
-inline void DirectoryResponse_FileInfo::set_name(const char* value, size_t size) {
+inline ::transfer::ResponseHeader* DownloadResponse::release_header() {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.FileInfo.name)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* DirectoryResponse_FileInfo::mutable_name() {
+inline ::transfer::ResponseHeader* DownloadResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.header)
   
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.name)
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* DirectoryResponse_FileInfo::release_name() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.name)
+inline ::transfer::ResponseHeader* DownloadResponse::_internal_mutable_header() {
   
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline void DirectoryResponse_FileInfo::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline ::transfer::ResponseHeader* DownloadResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.header)
+  return _msg;
+}
+inline void DownloadResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.name)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.header)
 }
 
-// bool is_directory = 2;
-inline void DirectoryResponse_FileInfo::clear_is_directory() {
-  is_directory_ = false;
+// repeated .transfer.DownloadResponse.FileResult results = 2;
+inline int DownloadResponse::_internal_results_size() const {
+  return _impl_.results_.size();
 }
-inline bool DirectoryResponse_FileInfo::is_directory() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.is_directory)
-  return is_directory_;
+inline int DownloadResponse::results_size() const {
+  return _internal_results_size();
 }
-inline void DirectoryResponse_FileInfo::set_is_directory(bool value) {
-  
-  is_directory_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.is_directory)
+inline void DownloadResponse::clear_results() {
+  _impl_.results_.Clear();
 }
-
-// uint64 size = 3;
-inline void DirectoryResponse_FileInfo::clear_size() {
-  size_ = PROTOBUF_ULONGLONG(0);
+inline ::transfer::DownloadResponse_FileResult* DownloadResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.results)
+  return _impl_.results_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 DirectoryResponse_FileInfo::size() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.size)
-  return size_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >*
+DownloadResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.DownloadResponse.results)
+  return &_impl_.results_;
 }
-inline void DirectoryResponse_FileInfo::set_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.size)
+inline const ::transfer::DownloadResponse_FileResult& DownloadResponse::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
 }
-
-// string modify_time = 4;
-inline void DirectoryResponse_FileInfo::clear_modify_time() {
-  modify_time_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::transfer::DownloadResponse_FileResult& DownloadResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.results)
+  return _internal_results(index);
 }
-inline const std::string& DirectoryResponse_FileInfo::modify_time() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.modify_time)
-  return modify_time_.GetNoArena();
+inline ::transfer::DownloadResponse_FileResult* DownloadResponse::_internal_add_results() {
+  return _impl_.results_.Add();
 }
-inline void DirectoryResponse_FileInfo::set_modify_time(const std::string& value) {
-  
-  modify_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.modify_time)
+inline ::transfer::DownloadResponse_FileResult* DownloadResponse::add_results() {
+  ::transfer::DownloadResponse_FileResult* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:transfer.DownloadResponse.results)
+  return _add;
 }
-inline void DirectoryResponse_FileInfo::set_modify_time(std::string&& value) {
-  
-  modify_time_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryResponse.FileInfo.modify_time)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >&
+DownloadResponse::results() const {
+  // @@protoc_insertion_point(field_list:transfer.DownloadResponse.results)
+  return _impl_.results_;
 }
-inline void DirectoryResponse_FileInfo::set_modify_time(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  modify_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.FileInfo.modify_time)
+
+// -------------------------------------------------------------------
+
+// TransferControlRequest
+
+// .transfer.RequestHeader header = 1;
+inline bool TransferControlRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void DirectoryResponse_FileInfo::set_modify_time(const char* value, size_t size) {
-  
-  modify_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.FileInfo.modify_time)
+inline bool TransferControlRequest::has_header() const {
+  return _internal_has_header();
 }
-inline std::string* DirectoryResponse_FileInfo::mutable_modify_time() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.modify_time)
-  return modify_time_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void TransferControlRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline std::string* DirectoryResponse_FileInfo::release_modify_time() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.modify_time)
-  
-  return modify_time_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::transfer::RequestHeader& TransferControlRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
 }
-inline void DirectoryResponse_FileInfo::set_allocated_modify_time(std::string* modify_time) {
-  if (modify_time != nullptr) {
+inline const ::transfer::RequestHeader& TransferControlRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.header)
+  return _internal_header();
+}
+inline void TransferControlRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
     
   } else {
     
   }
-  modify_time_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), modify_time);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.modify_time)
-}
-
-// string permissions = 5;
-inline void DirectoryResponse_FileInfo::clear_permissions() {
-  permissions_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& DirectoryResponse_FileInfo::permissions() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.permissions)
-  return permissions_.GetNoArena();
-}
-inline void DirectoryResponse_FileInfo::set_permissions(const std::string& value) {
-  
-  permissions_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.permissions)
-}
-inline void DirectoryResponse_FileInfo::set_permissions(std::string&& value) {
-  
-  permissions_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryResponse.FileInfo.permissions)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TransferControlRequest.header)
 }
-inline void DirectoryResponse_FileInfo::set_permissions(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::transfer::RequestHeader* TransferControlRequest::release_header() {
   
-  permissions_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.FileInfo.permissions)
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void DirectoryResponse_FileInfo::set_permissions(const char* value, size_t size) {
+inline ::transfer::RequestHeader* TransferControlRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TransferControlRequest.header)
   
-  permissions_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.FileInfo.permissions)
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* DirectoryResponse_FileInfo::mutable_permissions() {
+inline ::transfer::RequestHeader* TransferControlRequest::_internal_mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.permissions)
-  return permissions_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline std::string* DirectoryResponse_FileInfo::release_permissions() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.permissions)
-  
-  return permissions_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::transfer::RequestHeader* TransferControlRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferControlRequest.header)
+  return _msg;
 }
-inline void DirectoryResponse_FileInfo::set_allocated_permissions(std::string* permissions) {
-  if (permissions != nullptr) {
+inline void TransferControlRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  permissions_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), permissions);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.permissions)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlRequest.header)
 }
 
-// string task_id = 6;
-inline void DirectoryResponse_FileInfo::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string task_id = 2;
+inline void TransferControlRequest::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
 }
-inline const std::string& DirectoryResponse_FileInfo::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.task_id)
-  return task_id_.GetNoArena();
+inline const std::string& TransferControlRequest::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.task_id)
+  return _internal_task_id();
 }
-inline void DirectoryResponse_FileInfo::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.task_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferControlRequest::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TransferControlRequest.task_id)
 }
-inline void DirectoryResponse_FileInfo::set_task_id(std::string&& value) {
-  
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryResponse.FileInfo.task_id)
+inline std::string* TransferControlRequest::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferControlRequest.task_id)
+  return _s;
 }
-inline void DirectoryResponse_FileInfo::set_task_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.FileInfo.task_id)
+inline const std::string& TransferControlRequest::_internal_task_id() const {
+  return _impl_.task_id_.Get();
 }
-inline void DirectoryResponse_FileInfo::set_task_id(const char* value, size_t size) {
+inline void TransferControlRequest::_internal_set_task_id(const std::string& value) {
   
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.FileInfo.task_id)
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DirectoryResponse_FileInfo::mutable_task_id() {
+inline std::string* TransferControlRequest::_internal_mutable_task_id() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.FileInfo.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* DirectoryResponse_FileInfo::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.FileInfo.task_id)
-  
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransferControlRequest::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.TransferControlRequest.task_id)
+  return _impl_.task_id_.Release();
 }
-inline void DirectoryResponse_FileInfo::set_allocated_task_id(std::string* task_id) {
+inline void TransferControlRequest::set_allocated_task_id(std::string* task_id) {
   if (task_id != nullptr) {
     
   } else {
     
   }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.FileInfo.task_id)
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlRequest.task_id)
 }
 
-// .transfer.TransferStatus status = 7;
-inline void DirectoryResponse_FileInfo::clear_status() {
-  status_ = 0;
+// .transfer.TransferControlRequest.ControlType control_type = 3;
+inline void TransferControlRequest::clear_control_type() {
+  _impl_.control_type_ = 0;
 }
-inline ::transfer::TransferStatus DirectoryResponse_FileInfo::status() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.FileInfo.status)
-  return static_cast< ::transfer::TransferStatus >(status_);
+inline ::transfer::TransferControlRequest_ControlType TransferControlRequest::_internal_control_type() const {
+  return static_cast< ::transfer::TransferControlRequest_ControlType >(_impl_.control_type_);
 }
-inline void DirectoryResponse_FileInfo::set_status(::transfer::TransferStatus value) {
+inline ::transfer::TransferControlRequest_ControlType TransferControlRequest::control_type() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.control_type)
+  return _internal_control_type();
+}
+inline void TransferControlRequest::_internal_set_control_type(::transfer::TransferControlRequest_ControlType value) {
   
-  status_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.FileInfo.status)
+  _impl_.control_type_ = value;
+}
+inline void TransferControlRequest::set_control_type(::transfer::TransferControlRequest_ControlType value) {
+  _internal_set_control_type(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferControlRequest.control_type)
 }
 
 // -------------------------------------------------------------------
 
-// DirectoryResponse
+// TransferControlResponse
 
 // .transfer.ResponseHeader header = 1;
-inline bool DirectoryResponse::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+inline bool TransferControlResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void DirectoryResponse::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline bool TransferControlResponse::has_header() const {
+  return _internal_has_header();
+}
+inline void TransferControlResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
-inline const ::transfer::ResponseHeader& DirectoryResponse::header() const {
-  const ::transfer::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::ResponseHeader*>(
-      &::transfer::_ResponseHeader_default_instance_);
+inline const ::transfer::ResponseHeader& TransferControlResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline ::transfer::ResponseHeader* DirectoryResponse::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.header)
+inline const ::transfer::ResponseHeader& TransferControlResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.header)
+  return _internal_header();
+}
+inline void TransferControlResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TransferControlResponse.header)
+}
+inline ::transfer::ResponseHeader* TransferControlResponse::release_header() {
   
-  ::transfer::ResponseHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::transfer::ResponseHeader* DirectoryResponse::mutable_header() {
+inline ::transfer::ResponseHeader* TransferControlResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TransferControlResponse.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* TransferControlResponse::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void DirectoryResponse::set_allocated_header(::transfer::ResponseHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::ResponseHeader* TransferControlResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferControlResponse.header)
+  return _msg;
+}
+inline void TransferControlResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -3926,542 +15313,620 @@ inline void DirectoryResponse::set_allocated_header(::transfer::ResponseHeader*
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlResponse.header)
 }
 
-// string path = 2;
-inline void DirectoryResponse::clear_path() {
-  path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string task_id = 2;
+inline void TransferControlResponse::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
 }
-inline const std::string& DirectoryResponse::path() const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.path)
-  return path_.GetNoArena();
+inline const std::string& TransferControlResponse::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.task_id)
+  return _internal_task_id();
 }
-inline void DirectoryResponse::set_path(const std::string& value) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DirectoryResponse.path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferControlResponse::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.task_id)
 }
-inline void DirectoryResponse::set_path(std::string&& value) {
-  
-  path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DirectoryResponse.path)
+inline std::string* TransferControlResponse::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferControlResponse.task_id)
+  return _s;
 }
-inline void DirectoryResponse::set_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DirectoryResponse.path)
+inline const std::string& TransferControlResponse::_internal_task_id() const {
+  return _impl_.task_id_.Get();
 }
-inline void DirectoryResponse::set_path(const char* value, size_t size) {
+inline void TransferControlResponse::_internal_set_task_id(const std::string& value) {
   
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DirectoryResponse.path)
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DirectoryResponse::mutable_path() {
+inline std::string* TransferControlResponse::_internal_mutable_task_id() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.path)
-  return path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* DirectoryResponse::release_path() {
-  // @@protoc_insertion_point(field_release:transfer.DirectoryResponse.path)
-  
-  return path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransferControlResponse::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.TransferControlResponse.task_id)
+  return _impl_.task_id_.Release();
 }
-inline void DirectoryResponse::set_allocated_path(std::string* path) {
-  if (path != nullptr) {
+inline void TransferControlResponse::set_allocated_task_id(std::string* task_id) {
+  if (task_id != nullptr) {
     
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DirectoryResponse.path)
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlResponse.task_id)
 }
 
-// repeated .transfer.DirectoryResponse.FileInfo files = 3;
-inline int DirectoryResponse::files_size() const {
-  return files_.size();
+// bool success = 3;
+inline void TransferControlResponse::clear_success() {
+  _impl_.success_ = false;
 }
-inline void DirectoryResponse::clear_files() {
-  files_.Clear();
+inline bool TransferControlResponse::_internal_success() const {
+  return _impl_.success_;
 }
-inline ::transfer::DirectoryResponse_FileInfo* DirectoryResponse::mutable_files(int index) {
-  // @@protoc_insertion_point(field_mutable:transfer.DirectoryResponse.files)
-  return files_.Mutable(index);
+inline bool TransferControlResponse::success() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.success)
+  return _internal_success();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >*
-DirectoryResponse::mutable_files() {
-  // @@protoc_insertion_point(field_mutable_list:transfer.DirectoryResponse.files)
-  return &files_;
+inline void TransferControlResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline const ::transfer::DirectoryResponse_FileInfo& DirectoryResponse::files(int index) const {
-  // @@protoc_insertion_point(field_get:transfer.DirectoryResponse.files)
-  return files_.Get(index);
+inline void TransferControlResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.success)
 }
-inline ::transfer::DirectoryResponse_FileInfo* DirectoryResponse::add_files() {
-  // @@protoc_insertion_point(field_add:transfer.DirectoryResponse.files)
-  return files_.Add();
+
+// .transfer.TransferStatus new_status = 4;
+inline void TransferControlResponse::clear_new_status() {
+  _impl_.new_status_ = 0;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >&
-DirectoryResponse::files() const {
-  // @@protoc_insertion_point(field_list:transfer.DirectoryResponse.files)
-  return files_;
+inline ::transfer::TransferStatus TransferControlResponse::_internal_new_status() const {
+  return static_cast< ::transfer::TransferStatus >(_impl_.new_status_);
+}
+inline ::transfer::TransferStatus TransferControlResponse::new_status() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.new_status)
+  return _internal_new_status();
+}
+inline void TransferControlResponse::_internal_set_new_status(::transfer::TransferStatus value) {
+  
+  _impl_.new_status_ = value;
+}
+inline void TransferControlResponse::set_new_status(::transfer::TransferStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.new_status)
 }
 
 // -------------------------------------------------------------------
 
-// UploadRequest_FileInfo
+// TransferProgressRequest
 
-// string file_name = 1;
-inline void UploadRequest_FileInfo::clear_file_name() {
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// .transfer.RequestHeader header = 1;
+inline bool TransferProgressRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline const std::string& UploadRequest_FileInfo::file_name() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.file_name)
-  return file_name_.GetNoArena();
+inline bool TransferProgressRequest::has_header() const {
+  return _internal_has_header();
 }
-inline void UploadRequest_FileInfo::set_file_name(const std::string& value) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.file_name)
+inline void TransferProgressRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline void UploadRequest_FileInfo::set_file_name(std::string&& value) {
-  
-  file_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.file_name)
+inline const ::transfer::RequestHeader& TransferProgressRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
 }
-inline void UploadRequest_FileInfo::set_file_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.file_name)
+inline const ::transfer::RequestHeader& TransferProgressRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressRequest.header)
+  return _internal_header();
+}
+inline void TransferProgressRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TransferProgressRequest.header)
 }
-inline void UploadRequest_FileInfo::set_file_name(const char* value, size_t size) {
+inline ::transfer::RequestHeader* TransferProgressRequest::release_header() {
   
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.file_name)
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* UploadRequest_FileInfo::mutable_file_name() {
+inline ::transfer::RequestHeader* TransferProgressRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TransferProgressRequest.header)
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.file_name)
-  return file_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* UploadRequest_FileInfo::release_file_name() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.file_name)
+inline ::transfer::RequestHeader* TransferProgressRequest::_internal_mutable_header() {
   
-  return file_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline void UploadRequest_FileInfo::set_allocated_file_name(std::string* file_name) {
-  if (file_name != nullptr) {
+inline ::transfer::RequestHeader* TransferProgressRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressRequest.header)
+  return _msg;
+}
+inline void TransferProgressRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  file_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.file_name)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressRequest.header)
 }
 
-// string target_path = 2;
-inline void UploadRequest_FileInfo::clear_target_path() {
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string task_id = 2;
+inline void TransferProgressRequest::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
 }
-inline const std::string& UploadRequest_FileInfo::target_path() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.target_path)
-  return target_path_.GetNoArena();
+inline const std::string& TransferProgressRequest::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressRequest.task_id)
+  return _internal_task_id();
 }
-inline void UploadRequest_FileInfo::set_target_path(const std::string& value) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.target_path)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferProgressRequest::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressRequest.task_id)
 }
-inline void UploadRequest_FileInfo::set_target_path(std::string&& value) {
-  
-  target_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.target_path)
+inline std::string* TransferProgressRequest::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressRequest.task_id)
+  return _s;
 }
-inline void UploadRequest_FileInfo::set_target_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.target_path)
+inline const std::string& TransferProgressRequest::_internal_task_id() const {
+  return _impl_.task_id_.Get();
 }
-inline void UploadRequest_FileInfo::set_target_path(const char* value, size_t size) {
+inline void TransferProgressRequest::_internal_set_task_id(const std::string& value) {
   
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.target_path)
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::mutable_target_path() {
+inline std::string* TransferProgressRequest::_internal_mutable_task_id() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.target_path)
-  return target_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::release_target_path() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.target_path)
-  
-  return target_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransferProgressRequest::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.TransferProgressRequest.task_id)
+  return _impl_.task_id_.Release();
 }
-inline void UploadRequest_FileInfo::set_allocated_target_path(std::string* target_path) {
-  if (target_path != nullptr) {
+inline void TransferProgressRequest::set_allocated_task_id(std::string* task_id) {
+  if (task_id != nullptr) {
     
   } else {
     
   }
-  target_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), target_path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.target_path)
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressRequest.task_id)
 }
 
-// uint64 file_size = 3;
-inline void UploadRequest_FileInfo::clear_file_size() {
-  file_size_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 UploadRequest_FileInfo::file_size() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.file_size)
-  return file_size_;
-}
-inline void UploadRequest_FileInfo::set_file_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  file_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.file_size)
-}
+// -------------------------------------------------------------------
 
-// string md5 = 4;
-inline void UploadRequest_FileInfo::clear_md5() {
-  md5_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& UploadRequest_FileInfo::md5() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.md5)
-  return md5_.GetNoArena();
-}
-inline void UploadRequest_FileInfo::set_md5(const std::string& value) {
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.md5)
-}
-inline void UploadRequest_FileInfo::set_md5(std::string&& value) {
-  
-  md5_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.md5)
+// TransferProgressResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool TransferProgressResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void UploadRequest_FileInfo::set_md5(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.md5)
+inline bool TransferProgressResponse::has_header() const {
+  return _internal_has_header();
 }
-inline void UploadRequest_FileInfo::set_md5(const char* value, size_t size) {
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.md5)
+inline void TransferProgressResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline std::string* UploadRequest_FileInfo::mutable_md5() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.md5)
-  return md5_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::transfer::ResponseHeader& TransferProgressResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline std::string* UploadRequest_FileInfo::release_md5() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.md5)
-  
-  return md5_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::transfer::ResponseHeader& TransferProgressResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.header)
+  return _internal_header();
 }
-inline void UploadRequest_FileInfo::set_allocated_md5(std::string* md5) {
-  if (md5 != nullptr) {
+inline void TransferProgressResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
     
   } else {
     
   }
-  md5_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), md5);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.md5)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.TransferProgressResponse.header)
 }
-
-// bool need_chunk = 5;
-inline void UploadRequest_FileInfo::clear_need_chunk() {
-  need_chunk_ = false;
-}
-inline bool UploadRequest_FileInfo::need_chunk() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.need_chunk)
-  return need_chunk_;
-}
-inline void UploadRequest_FileInfo::set_need_chunk(bool value) {
+inline ::transfer::ResponseHeader* TransferProgressResponse::release_header() {
   
-  need_chunk_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.need_chunk)
-}
-
-// uint32 chunk_size = 6;
-inline void UploadRequest_FileInfo::clear_chunk_size() {
-  chunk_size_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 UploadRequest_FileInfo::chunk_size() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.chunk_size)
-  return chunk_size_;
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void UploadRequest_FileInfo::set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline ::transfer::ResponseHeader* TransferProgressResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.header)
   
-  chunk_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.chunk_size)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-
-// uint32 chunk_sequence = 7;
-inline void UploadRequest_FileInfo::clear_chunk_sequence() {
-  chunk_sequence_ = 0u;
+inline ::transfer::ResponseHeader* TransferProgressResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 UploadRequest_FileInfo::chunk_sequence() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.chunk_sequence)
-  return chunk_sequence_;
+inline ::transfer::ResponseHeader* TransferProgressResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.header)
+  return _msg;
 }
-inline void UploadRequest_FileInfo::set_chunk_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  chunk_sequence_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.chunk_sequence)
+inline void TransferProgressResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.header)
 }
 
-// bytes data = 8;
-inline void UploadRequest_FileInfo::clear_data() {
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string task_id = 2;
+inline void TransferProgressResponse::clear_task_id() {
+  _impl_.task_id_.ClearToEmpty();
 }
-inline const std::string& UploadRequest_FileInfo::data() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.data)
-  return data_.GetNoArena();
+inline const std::string& TransferProgressResponse::task_id() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.task_id)
+  return _internal_task_id();
 }
-inline void UploadRequest_FileInfo::set_data(const std::string& value) {
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.data)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferProgressResponse::set_task_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.task_id)
 }
-inline void UploadRequest_FileInfo::set_data(std::string&& value) {
-  
-  data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.data)
+inline std::string* TransferProgressResponse::mutable_task_id() {
+  std::string* _s = _internal_mutable_task_id();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.task_id)
+  return _s;
 }
-inline void UploadRequest_FileInfo::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.data)
+inline const std::string& TransferProgressResponse::_internal_task_id() const {
+  return _impl_.task_id_.Get();
 }
-inline void UploadRequest_FileInfo::set_data(const void* value, size_t size) {
+inline void TransferProgressResponse::_internal_set_task_id(const std::string& value) {
   
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.data)
+  _impl_.task_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::mutable_data() {
+inline std::string* TransferProgressResponse::_internal_mutable_task_id() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.data)
-  return data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.task_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::release_data() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.data)
-  
-  return data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransferProgressResponse::release_task_id() {
+  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.task_id)
+  return _impl_.task_id_.Release();
 }
-inline void UploadRequest_FileInfo::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
+inline void TransferProgressResponse::set_allocated_task_id(std::string* task_id) {
+  if (task_id != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.data)
-}
-
-// uint32 checksum = 9;
-inline void UploadRequest_FileInfo::clear_checksum() {
-  checksum_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 UploadRequest_FileInfo::checksum() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.checksum)
-  return checksum_;
-}
-inline void UploadRequest_FileInfo::set_checksum(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  checksum_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.checksum)
+  _impl_.task_id_.SetAllocated(task_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_id_.IsDefault()) {
+    _impl_.task_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.task_id)
 }
 
-// string task_id = 10;
-inline void UploadRequest_FileInfo::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string task_name = 3;
+inline void TransferProgressResponse::clear_task_name() {
+  _impl_.task_name_.ClearToEmpty();
 }
-inline const std::string& UploadRequest_FileInfo::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.task_id)
-  return task_id_.GetNoArena();
+inline const std::string& TransferProgressResponse::task_name() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.task_name)
+  return _internal_task_name();
 }
-inline void UploadRequest_FileInfo::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.task_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TransferProgressResponse::set_task_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.task_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.task_name)
 }
-inline void UploadRequest_FileInfo::set_task_id(std::string&& value) {
-  
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.task_id)
+inline std::string* TransferProgressResponse::mutable_task_name() {
+  std::string* _s = _internal_mutable_task_name();
+  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.task_name)
+  return _s;
 }
-inline void UploadRequest_FileInfo::set_task_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.task_id)
+inline const std::string& TransferProgressResponse::_internal_task_name() const {
+  return _impl_.task_name_.Get();
 }
-inline void UploadRequest_FileInfo::set_task_id(const char* value, size_t size) {
+inline void TransferProgressResponse::_internal_set_task_name(const std::string& value) {
   
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.task_id)
+  _impl_.task_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::mutable_task_id() {
+inline std::string* TransferProgressResponse::_internal_mutable_task_name() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.task_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* UploadRequest_FileInfo::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.task_id)
-  
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* TransferProgressResponse::release_task_name() {
+  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.task_name)
+  return _impl_.task_name_.Release();
 }
-inline void UploadRequest_FileInfo::set_allocated_task_id(std::string* task_id) {
-  if (task_id != nullptr) {
+inline void TransferProgressResponse::set_allocated_task_name(std::string* task_name) {
+  if (task_name != nullptr) {
     
   } else {
     
   }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.task_id)
+  _impl_.task_name_.SetAllocated(task_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.task_name_.IsDefault()) {
+    _impl_.task_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.task_name)
 }
 
-// .transfer.TransferStatus status = 11;
-inline void UploadRequest_FileInfo::clear_status() {
-  status_ = 0;
+// .transfer.TransferStatus status = 4;
+inline void TransferProgressResponse::clear_status() {
+  _impl_.status_ = 0;
 }
-inline ::transfer::TransferStatus UploadRequest_FileInfo::status() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.status)
-  return static_cast< ::transfer::TransferStatus >(status_);
+inline ::transfer::TransferStatus TransferProgressResponse::_internal_status() const {
+  return static_cast< ::transfer::TransferStatus >(_impl_.status_);
 }
-inline void UploadRequest_FileInfo::set_status(::transfer::TransferStatus value) {
+inline ::transfer::TransferStatus TransferProgressResponse::status() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.status)
+  return _internal_status();
+}
+inline void TransferProgressResponse::_internal_set_status(::transfer::TransferStatus value) {
   
-  status_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.status)
+  _impl_.status_ = value;
+}
+inline void TransferProgressResponse::set_status(::transfer::TransferStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.status)
 }
 
-// uint64 offset = 12;
-inline void UploadRequest_FileInfo::clear_offset() {
-  offset_ = PROTOBUF_ULONGLONG(0);
+// uint64 transferred_size = 5;
+inline void TransferProgressResponse::clear_transferred_size() {
+  _impl_.transferred_size_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 UploadRequest_FileInfo::offset() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.offset)
-  return offset_;
+inline uint64_t TransferProgressResponse::_internal_transferred_size() const {
+  return _impl_.transferred_size_;
+}
+inline uint64_t TransferProgressResponse::transferred_size() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.transferred_size)
+  return _internal_transferred_size();
 }
-inline void UploadRequest_FileInfo::set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void TransferProgressResponse::_internal_set_transferred_size(uint64_t value) {
   
-  offset_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.offset)
+  _impl_.transferred_size_ = value;
+}
+inline void TransferProgressResponse::set_transferred_size(uint64_t value) {
+  _internal_set_transferred_size(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.transferred_size)
 }
 
-// string upload_id = 13;
-inline void UploadRequest_FileInfo::clear_upload_id() {
-  upload_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint64 total_size = 6;
+inline void TransferProgressResponse::clear_total_size() {
+  _impl_.total_size_ = uint64_t{0u};
 }
-inline const std::string& UploadRequest_FileInfo::upload_id() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.FileInfo.upload_id)
-  return upload_id_.GetNoArena();
+inline uint64_t TransferProgressResponse::_internal_total_size() const {
+  return _impl_.total_size_;
 }
-inline void UploadRequest_FileInfo::set_upload_id(const std::string& value) {
-  
-  upload_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadRequest.FileInfo.upload_id)
+inline uint64_t TransferProgressResponse::total_size() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.total_size)
+  return _internal_total_size();
 }
-inline void UploadRequest_FileInfo::set_upload_id(std::string&& value) {
+inline void TransferProgressResponse::_internal_set_total_size(uint64_t value) {
   
-  upload_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadRequest.FileInfo.upload_id)
+  _impl_.total_size_ = value;
 }
-inline void UploadRequest_FileInfo::set_upload_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  upload_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadRequest.FileInfo.upload_id)
+inline void TransferProgressResponse::set_total_size(uint64_t value) {
+  _internal_set_total_size(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.total_size)
 }
-inline void UploadRequest_FileInfo::set_upload_id(const char* value, size_t size) {
-  
-  upload_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadRequest.FileInfo.upload_id)
+
+// uint32 speed = 7;
+inline void TransferProgressResponse::clear_speed() {
+  _impl_.speed_ = 0u;
 }
-inline std::string* UploadRequest_FileInfo::mutable_upload_id() {
+inline uint32_t TransferProgressResponse::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline uint32_t TransferProgressResponse::speed() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.speed)
+  return _internal_speed();
+}
+inline void TransferProgressResponse::_internal_set_speed(uint32_t value) {
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.FileInfo.upload_id)
-  return upload_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.speed_ = value;
 }
-inline std::string* UploadRequest_FileInfo::release_upload_id() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.FileInfo.upload_id)
+inline void TransferProgressResponse::set_speed(uint32_t value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.speed)
+}
+
+// uint32 progress = 8;
+inline void TransferProgressResponse::clear_progress() {
+  _impl_.progress_ = 0u;
+}
+inline uint32_t TransferProgressResponse::_internal_progress() const {
+  return _impl_.progress_;
+}
+inline uint32_t TransferProgressResponse::progress() const {
+  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.progress)
+  return _internal_progress();
+}
+inline void TransferProgressResponse::_internal_set_progress(uint32_t value) {
   
-  return upload_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.progress_ = value;
 }
-inline void UploadRequest_FileInfo::set_allocated_upload_id(std::string* upload_id) {
-  if (upload_id != nullptr) {
-    
-  } else {
-    
-  }
-  upload_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), upload_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.FileInfo.upload_id)
+inline void TransferProgressResponse::set_progress(uint32_t value) {
+  _internal_set_progress(value);
+  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.progress)
 }
 
 // -------------------------------------------------------------------
 
-// UploadRequest
+// WatchRequest
 
 // .transfer.RequestHeader header = 1;
-inline bool UploadRequest::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+inline bool WatchRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void UploadRequest::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline bool WatchRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void WatchRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
-inline const ::transfer::RequestHeader& UploadRequest::header() const {
-  const ::transfer::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::RequestHeader*>(
-      &::transfer::_RequestHeader_default_instance_);
+inline const ::transfer::RequestHeader& WatchRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
 }
-inline ::transfer::RequestHeader* UploadRequest::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.UploadRequest.header)
+inline const ::transfer::RequestHeader& WatchRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.WatchRequest.header)
+  return _internal_header();
+}
+inline void WatchRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.WatchRequest.header)
+}
+inline ::transfer::RequestHeader* WatchRequest::release_header() {
   
-  ::transfer::RequestHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::transfer::RequestHeader* UploadRequest::mutable_header() {
+inline ::transfer::RequestHeader* WatchRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.WatchRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* WatchRequest::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void UploadRequest::set_allocated_header(::transfer::RequestHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::RequestHeader* WatchRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.WatchRequest.header)
+  return _msg;
+}
+inline void WatchRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -4470,282 +15935,261 @@ inline void UploadRequest::set_allocated_header(::transfer::RequestHeader* heade
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadRequest.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.WatchRequest.header)
 }
 
-// repeated .transfer.UploadRequest.FileInfo files = 2;
-inline int UploadRequest::files_size() const {
-  return files_.size();
-}
-inline void UploadRequest::clear_files() {
-  files_.Clear();
-}
-inline ::transfer::UploadRequest_FileInfo* UploadRequest::mutable_files(int index) {
-  // @@protoc_insertion_point(field_mutable:transfer.UploadRequest.files)
-  return files_.Mutable(index);
+// repeated string paths = 2;
+inline int WatchRequest::_internal_paths_size() const {
+  return _impl_.paths_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >*
-UploadRequest::mutable_files() {
-  // @@protoc_insertion_point(field_mutable_list:transfer.UploadRequest.files)
-  return &files_;
+inline int WatchRequest::paths_size() const {
+  return _internal_paths_size();
 }
-inline const ::transfer::UploadRequest_FileInfo& UploadRequest::files(int index) const {
-  // @@protoc_insertion_point(field_get:transfer.UploadRequest.files)
-  return files_.Get(index);
+inline void WatchRequest::clear_paths() {
+  _impl_.paths_.Clear();
 }
-inline ::transfer::UploadRequest_FileInfo* UploadRequest::add_files() {
-  // @@protoc_insertion_point(field_add:transfer.UploadRequest.files)
-  return files_.Add();
+inline std::string* WatchRequest::add_paths() {
+  std::string* _s = _internal_add_paths();
+  // @@protoc_insertion_point(field_add_mutable:transfer.WatchRequest.paths)
+  return _s;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadRequest_FileInfo >&
-UploadRequest::files() const {
-  // @@protoc_insertion_point(field_list:transfer.UploadRequest.files)
-  return files_;
+inline const std::string& WatchRequest::_internal_paths(int index) const {
+  return _impl_.paths_.Get(index);
 }
-
-// -------------------------------------------------------------------
-
-// UploadResponse_FileResult
-
-// string file_name = 1;
-inline void UploadResponse_FileResult::clear_file_name() {
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const std::string& WatchRequest::paths(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.WatchRequest.paths)
+  return _internal_paths(index);
 }
-inline const std::string& UploadResponse_FileResult::file_name() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.file_name)
-  return file_name_.GetNoArena();
+inline std::string* WatchRequest::mutable_paths(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.WatchRequest.paths)
+  return _impl_.paths_.Mutable(index);
 }
-inline void UploadResponse_FileResult::set_file_name(const std::string& value) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.file_name)
+inline void WatchRequest::set_paths(int index, const std::string& value) {
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.WatchRequest.paths)
 }
-inline void UploadResponse_FileResult::set_file_name(std::string&& value) {
-  
-  file_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadResponse.FileResult.file_name)
+inline void WatchRequest::set_paths(int index, std::string&& value) {
+  _impl_.paths_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.WatchRequest.paths)
 }
-inline void UploadResponse_FileResult::set_file_name(const char* value) {
+inline void WatchRequest::set_paths(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadResponse.FileResult.file_name)
-}
-inline void UploadResponse_FileResult::set_file_name(const char* value, size_t size) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadResponse.FileResult.file_name)
-}
-inline std::string* UploadResponse_FileResult::mutable_file_name() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.file_name)
-  return file_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* UploadResponse_FileResult::release_file_name() {
-  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.file_name)
-  
-  return file_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void UploadResponse_FileResult::set_allocated_file_name(std::string* file_name) {
-  if (file_name != nullptr) {
-    
-  } else {
-    
-  }
-  file_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.file_name)
+  _impl_.paths_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.WatchRequest.paths)
 }
-
-// string target_path = 2;
-inline void UploadResponse_FileResult::clear_target_path() {
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void WatchRequest::set_paths(int index, const char* value, size_t size) {
+  _impl_.paths_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.WatchRequest.paths)
 }
-inline const std::string& UploadResponse_FileResult::target_path() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.target_path)
-  return target_path_.GetNoArena();
+inline std::string* WatchRequest::_internal_add_paths() {
+  return _impl_.paths_.Add();
 }
-inline void UploadResponse_FileResult::set_target_path(const std::string& value) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.target_path)
+inline void WatchRequest::add_paths(const std::string& value) {
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.WatchRequest.paths)
 }
-inline void UploadResponse_FileResult::set_target_path(std::string&& value) {
-  
-  target_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadResponse.FileResult.target_path)
+inline void WatchRequest::add_paths(std::string&& value) {
+  _impl_.paths_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.WatchRequest.paths)
 }
-inline void UploadResponse_FileResult::set_target_path(const char* value) {
+inline void WatchRequest::add_paths(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadResponse.FileResult.target_path)
-}
-inline void UploadResponse_FileResult::set_target_path(const char* value, size_t size) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadResponse.FileResult.target_path)
+  _impl_.paths_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.WatchRequest.paths)
 }
-inline std::string* UploadResponse_FileResult::mutable_target_path() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.target_path)
-  return target_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void WatchRequest::add_paths(const char* value, size_t size) {
+  _impl_.paths_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.WatchRequest.paths)
 }
-inline std::string* UploadResponse_FileResult::release_target_path() {
-  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.target_path)
-  
-  return target_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WatchRequest::paths() const {
+  // @@protoc_insertion_point(field_list:transfer.WatchRequest.paths)
+  return _impl_.paths_;
 }
-inline void UploadResponse_FileResult::set_allocated_target_path(std::string* target_path) {
-  if (target_path != nullptr) {
-    
-  } else {
-    
-  }
-  target_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), target_path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.target_path)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WatchRequest::mutable_paths() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.WatchRequest.paths)
+  return &_impl_.paths_;
 }
 
-// bool success = 3;
-inline void UploadResponse_FileResult::clear_success() {
-  success_ = false;
-}
-inline bool UploadResponse_FileResult::success() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.success)
-  return success_;
-}
-inline void UploadResponse_FileResult::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.success)
-}
+// -------------------------------------------------------------------
 
-// bool need_chunk = 4;
-inline void UploadResponse_FileResult::clear_need_chunk() {
-  need_chunk_ = false;
-}
-inline bool UploadResponse_FileResult::need_chunk() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.need_chunk)
-  return need_chunk_;
-}
-inline void UploadResponse_FileResult::set_need_chunk(bool value) {
-  
-  need_chunk_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.need_chunk)
-}
+// WatchResponse
 
-// int32 next_sequence = 5;
-inline void UploadResponse_FileResult::clear_next_sequence() {
-  next_sequence_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 UploadResponse_FileResult::next_sequence() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.next_sequence)
-  return next_sequence_;
+// .transfer.ResponseHeader header = 1;
+inline bool WatchResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void UploadResponse_FileResult::set_next_sequence(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  next_sequence_ = value;
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.next_sequence)
+inline bool WatchResponse::has_header() const {
+  return _internal_has_header();
 }
-
-// string error_message = 6;
-inline void UploadResponse_FileResult::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void WatchResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline const std::string& UploadResponse_FileResult::error_message() const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.FileResult.error_message)
-  return error_message_.GetNoArena();
+inline const ::transfer::ResponseHeader& WatchResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline void UploadResponse_FileResult::set_error_message(const std::string& value) {
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.UploadResponse.FileResult.error_message)
+inline const ::transfer::ResponseHeader& WatchResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.WatchResponse.header)
+  return _internal_header();
 }
-inline void UploadResponse_FileResult::set_error_message(std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.UploadResponse.FileResult.error_message)
+inline void WatchResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.WatchResponse.header)
 }
-inline void UploadResponse_FileResult::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::transfer::ResponseHeader* WatchResponse::release_header() {
   
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.UploadResponse.FileResult.error_message)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void UploadResponse_FileResult::set_error_message(const char* value, size_t size) {
+inline ::transfer::ResponseHeader* WatchResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.WatchResponse.header)
   
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.UploadResponse.FileResult.error_message)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* UploadResponse_FileResult::mutable_error_message() {
+inline ::transfer::ResponseHeader* WatchResponse::_internal_mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.FileResult.error_message)
-  return error_message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline std::string* UploadResponse_FileResult::release_error_message() {
-  // @@protoc_insertion_point(field_release:transfer.UploadResponse.FileResult.error_message)
-  
-  return error_message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::transfer::ResponseHeader* WatchResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.WatchResponse.header)
+  return _msg;
 }
-inline void UploadResponse_FileResult::set_allocated_error_message(std::string* error_message) {
-  if (error_message != nullptr) {
+inline void WatchResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message);
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.FileResult.error_message)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.WatchResponse.header)
 }
 
 // -------------------------------------------------------------------
 
-// UploadResponse
+// ChangeNotification
 
 // .transfer.ResponseHeader header = 1;
-inline bool UploadResponse::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+inline bool ChangeNotification::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void UploadResponse::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline bool ChangeNotification::has_header() const {
+  return _internal_has_header();
+}
+inline void ChangeNotification::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
-inline const ::transfer::ResponseHeader& UploadResponse::header() const {
-  const ::transfer::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::ResponseHeader*>(
-      &::transfer::_ResponseHeader_default_instance_);
+inline const ::transfer::ResponseHeader& ChangeNotification::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline ::transfer::ResponseHeader* UploadResponse::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.UploadResponse.header)
+inline const ::transfer::ResponseHeader& ChangeNotification::header() const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.header)
+  return _internal_header();
+}
+inline void ChangeNotification::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.ChangeNotification.header)
+}
+inline ::transfer::ResponseHeader* ChangeNotification::release_header() {
   
-  ::transfer::ResponseHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::transfer::ResponseHeader* UploadResponse::mutable_header() {
+inline ::transfer::ResponseHeader* ChangeNotification::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.ChangeNotification.header)
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::ResponseHeader* ChangeNotification::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void UploadResponse::set_allocated_header(::transfer::ResponseHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::ResponseHeader* ChangeNotification::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.ChangeNotification.header)
+  return _msg;
+}
+inline void ChangeNotification::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -4754,268 +16198,297 @@ inline void UploadResponse::set_allocated_header(::transfer::ResponseHeader* hea
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.UploadResponse.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.ChangeNotification.header)
 }
 
-// repeated .transfer.UploadResponse.FileResult results = 2;
-inline int UploadResponse::results_size() const {
-  return results_.size();
+// string path = 2;
+inline void ChangeNotification::clear_path() {
+  _impl_.path_.ClearToEmpty();
 }
-inline void UploadResponse::clear_results() {
-  results_.Clear();
+inline const std::string& ChangeNotification::path() const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.path)
+  return _internal_path();
 }
-inline ::transfer::UploadResponse_FileResult* UploadResponse::mutable_results(int index) {
-  // @@protoc_insertion_point(field_mutable:transfer.UploadResponse.results)
-  return results_.Mutable(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangeNotification::set_path(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.path_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.ChangeNotification.path)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >*
-UploadResponse::mutable_results() {
-  // @@protoc_insertion_point(field_mutable_list:transfer.UploadResponse.results)
-  return &results_;
+inline std::string* ChangeNotification::mutable_path() {
+  std::string* _s = _internal_mutable_path();
+  // @@protoc_insertion_point(field_mutable:transfer.ChangeNotification.path)
+  return _s;
 }
-inline const ::transfer::UploadResponse_FileResult& UploadResponse::results(int index) const {
-  // @@protoc_insertion_point(field_get:transfer.UploadResponse.results)
-  return results_.Get(index);
+inline const std::string& ChangeNotification::_internal_path() const {
+  return _impl_.path_.Get();
 }
-inline ::transfer::UploadResponse_FileResult* UploadResponse::add_results() {
-  // @@protoc_insertion_point(field_add:transfer.UploadResponse.results)
-  return results_.Add();
+inline void ChangeNotification::_internal_set_path(const std::string& value) {
+  
+  _impl_.path_.Set(value, GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::UploadResponse_FileResult >&
-UploadResponse::results() const {
-  // @@protoc_insertion_point(field_list:transfer.UploadResponse.results)
-  return results_;
+inline std::string* ChangeNotification::_internal_mutable_path() {
+  
+  return _impl_.path_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangeNotification::release_path() {
+  // @@protoc_insertion_point(field_release:transfer.ChangeNotification.path)
+  return _impl_.path_.Release();
+}
+inline void ChangeNotification::set_allocated_path(std::string* path) {
+  if (path != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.path_.SetAllocated(path, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.path_.IsDefault()) {
+    _impl_.path_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.ChangeNotification.path)
 }
 
-// -------------------------------------------------------------------
-
-// DownloadRequest_FileInfo
-
-// string file_name = 1;
-inline void DownloadRequest_FileInfo::clear_file_name() {
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated .transfer.DirectoryResponse.FileInfo changed = 3;
+inline int ChangeNotification::_internal_changed_size() const {
+  return _impl_.changed_.size();
 }
-inline const std::string& DownloadRequest_FileInfo::file_name() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.file_name)
-  return file_name_.GetNoArena();
+inline int ChangeNotification::changed_size() const {
+  return _internal_changed_size();
 }
-inline void DownloadRequest_FileInfo::set_file_name(const std::string& value) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.file_name)
+inline void ChangeNotification::clear_changed() {
+  _impl_.changed_.Clear();
 }
-inline void DownloadRequest_FileInfo::set_file_name(std::string&& value) {
-  
-  file_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadRequest.FileInfo.file_name)
+inline ::transfer::DirectoryResponse_FileInfo* ChangeNotification::mutable_changed(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.ChangeNotification.changed)
+  return _impl_.changed_.Mutable(index);
 }
-inline void DownloadRequest_FileInfo::set_file_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadRequest.FileInfo.file_name)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >*
+ChangeNotification::mutable_changed() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ChangeNotification.changed)
+  return &_impl_.changed_;
 }
-inline void DownloadRequest_FileInfo::set_file_name(const char* value, size_t size) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadRequest.FileInfo.file_name)
+inline const ::transfer::DirectoryResponse_FileInfo& ChangeNotification::_internal_changed(int index) const {
+  return _impl_.changed_.Get(index);
 }
-inline std::string* DownloadRequest_FileInfo::mutable_file_name() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.file_name)
-  return file_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const ::transfer::DirectoryResponse_FileInfo& ChangeNotification::changed(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.changed)
+  return _internal_changed(index);
 }
-inline std::string* DownloadRequest_FileInfo::release_file_name() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.file_name)
-  
-  return file_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::transfer::DirectoryResponse_FileInfo* ChangeNotification::_internal_add_changed() {
+  return _impl_.changed_.Add();
 }
-inline void DownloadRequest_FileInfo::set_allocated_file_name(std::string* file_name) {
-  if (file_name != nullptr) {
-    
-  } else {
-    
-  }
-  file_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.file_name)
+inline ::transfer::DirectoryResponse_FileInfo* ChangeNotification::add_changed() {
+  ::transfer::DirectoryResponse_FileInfo* _add = _internal_add_changed();
+  // @@protoc_insertion_point(field_add:transfer.ChangeNotification.changed)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DirectoryResponse_FileInfo >&
+ChangeNotification::changed() const {
+  // @@protoc_insertion_point(field_list:transfer.ChangeNotification.changed)
+  return _impl_.changed_;
 }
 
-// string target_path = 2;
-inline void DownloadRequest_FileInfo::clear_target_path() {
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated string removed = 4;
+inline int ChangeNotification::_internal_removed_size() const {
+  return _impl_.removed_.size();
 }
-inline const std::string& DownloadRequest_FileInfo::target_path() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.target_path)
-  return target_path_.GetNoArena();
+inline int ChangeNotification::removed_size() const {
+  return _internal_removed_size();
 }
-inline void DownloadRequest_FileInfo::set_target_path(const std::string& value) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.target_path)
+inline void ChangeNotification::clear_removed() {
+  _impl_.removed_.Clear();
 }
-inline void DownloadRequest_FileInfo::set_target_path(std::string&& value) {
-  
-  target_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadRequest.FileInfo.target_path)
+inline std::string* ChangeNotification::add_removed() {
+  std::string* _s = _internal_add_removed();
+  // @@protoc_insertion_point(field_add_mutable:transfer.ChangeNotification.removed)
+  return _s;
 }
-inline void DownloadRequest_FileInfo::set_target_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadRequest.FileInfo.target_path)
+inline const std::string& ChangeNotification::_internal_removed(int index) const {
+  return _impl_.removed_.Get(index);
 }
-inline void DownloadRequest_FileInfo::set_target_path(const char* value, size_t size) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadRequest.FileInfo.target_path)
+inline const std::string& ChangeNotification::removed(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.removed)
+  return _internal_removed(index);
 }
-inline std::string* DownloadRequest_FileInfo::mutable_target_path() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.target_path)
-  return target_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* ChangeNotification::mutable_removed(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.ChangeNotification.removed)
+  return _impl_.removed_.Mutable(index);
 }
-inline std::string* DownloadRequest_FileInfo::release_target_path() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.target_path)
-  
-  return target_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ChangeNotification::set_removed(int index, const std::string& value) {
+  _impl_.removed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.ChangeNotification.removed)
 }
-inline void DownloadRequest_FileInfo::set_allocated_target_path(std::string* target_path) {
-  if (target_path != nullptr) {
-    
-  } else {
-    
-  }
-  target_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), target_path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.target_path)
+inline void ChangeNotification::set_removed(int index, std::string&& value) {
+  _impl_.removed_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.ChangeNotification.removed)
 }
-
-// uint32 chunk_size = 3;
-inline void DownloadRequest_FileInfo::clear_chunk_size() {
-  chunk_size_ = 0u;
+inline void ChangeNotification::set_removed(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.ChangeNotification.removed)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DownloadRequest_FileInfo::chunk_size() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.chunk_size)
-  return chunk_size_;
+inline void ChangeNotification::set_removed(int index, const char* value, size_t size) {
+  _impl_.removed_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.ChangeNotification.removed)
 }
-inline void DownloadRequest_FileInfo::set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  chunk_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.chunk_size)
+inline std::string* ChangeNotification::_internal_add_removed() {
+  return _impl_.removed_.Add();
 }
-
-// uint64 offset = 4;
-inline void DownloadRequest_FileInfo::clear_offset() {
-  offset_ = PROTOBUF_ULONGLONG(0);
+inline void ChangeNotification::add_removed(const std::string& value) {
+  _impl_.removed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.ChangeNotification.removed)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 DownloadRequest_FileInfo::offset() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.offset)
-  return offset_;
+inline void ChangeNotification::add_removed(std::string&& value) {
+  _impl_.removed_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.ChangeNotification.removed)
 }
-inline void DownloadRequest_FileInfo::set_offset(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  offset_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.offset)
+inline void ChangeNotification::add_removed(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.removed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.ChangeNotification.removed)
+}
+inline void ChangeNotification::add_removed(const char* value, size_t size) {
+  _impl_.removed_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.ChangeNotification.removed)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ChangeNotification::removed() const {
+  // @@protoc_insertion_point(field_list:transfer.ChangeNotification.removed)
+  return _impl_.removed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ChangeNotification::mutable_removed() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.ChangeNotification.removed)
+  return &_impl_.removed_;
 }
 
-// string download_id = 5;
-inline void DownloadRequest_FileInfo::clear_download_id() {
-  download_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint64 base_version = 5;
+inline void ChangeNotification::clear_base_version() {
+  _impl_.base_version_ = uint64_t{0u};
 }
-inline const std::string& DownloadRequest_FileInfo::download_id() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.FileInfo.download_id)
-  return download_id_.GetNoArena();
+inline uint64_t ChangeNotification::_internal_base_version() const {
+  return _impl_.base_version_;
 }
-inline void DownloadRequest_FileInfo::set_download_id(const std::string& value) {
-  
-  download_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadRequest.FileInfo.download_id)
+inline uint64_t ChangeNotification::base_version() const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.base_version)
+  return _internal_base_version();
 }
-inline void DownloadRequest_FileInfo::set_download_id(std::string&& value) {
+inline void ChangeNotification::_internal_set_base_version(uint64_t value) {
   
-  download_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadRequest.FileInfo.download_id)
+  _impl_.base_version_ = value;
 }
-inline void DownloadRequest_FileInfo::set_download_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  download_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadRequest.FileInfo.download_id)
+inline void ChangeNotification::set_base_version(uint64_t value) {
+  _internal_set_base_version(value);
+  // @@protoc_insertion_point(field_set:transfer.ChangeNotification.base_version)
 }
-inline void DownloadRequest_FileInfo::set_download_id(const char* value, size_t size) {
-  
-  download_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadRequest.FileInfo.download_id)
+
+// uint64 version = 6;
+inline void ChangeNotification::clear_version() {
+  _impl_.version_ = uint64_t{0u};
 }
-inline std::string* DownloadRequest_FileInfo::mutable_download_id() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.FileInfo.download_id)
-  return download_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline uint64_t ChangeNotification::_internal_version() const {
+  return _impl_.version_;
 }
-inline std::string* DownloadRequest_FileInfo::release_download_id() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.FileInfo.download_id)
+inline uint64_t ChangeNotification::version() const {
+  // @@protoc_insertion_point(field_get:transfer.ChangeNotification.version)
+  return _internal_version();
+}
+inline void ChangeNotification::_internal_set_version(uint64_t value) {
   
-  return download_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.version_ = value;
 }
-inline void DownloadRequest_FileInfo::set_allocated_download_id(std::string* download_id) {
-  if (download_id != nullptr) {
-    
-  } else {
-    
-  }
-  download_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), download_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.FileInfo.download_id)
+inline void ChangeNotification::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:transfer.ChangeNotification.version)
 }
 
 // -------------------------------------------------------------------
 
-// DownloadRequest
+// HelloRequest
 
 // .transfer.RequestHeader header = 1;
-inline bool DownloadRequest::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+inline bool HelloRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void DownloadRequest::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline bool HelloRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void HelloRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
-inline const ::transfer::RequestHeader& DownloadRequest::header() const {
-  const ::transfer::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::RequestHeader*>(
-      &::transfer::_RequestHeader_default_instance_);
+inline const ::transfer::RequestHeader& HelloRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
 }
-inline ::transfer::RequestHeader* DownloadRequest::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadRequest.header)
+inline const ::transfer::RequestHeader& HelloRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.header)
+  return _internal_header();
+}
+inline void HelloRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.HelloRequest.header)
+}
+inline ::transfer::RequestHeader* HelloRequest::release_header() {
   
-  ::transfer::RequestHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::transfer::RequestHeader* DownloadRequest::mutable_header() {
+inline ::transfer::RequestHeader* HelloRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.HelloRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* HelloRequest::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void DownloadRequest::set_allocated_header(::transfer::RequestHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::RequestHeader* HelloRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloRequest.header)
+  return _msg;
+}
+inline void HelloRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -5024,525 +16497,487 @@ inline void DownloadRequest::set_allocated_header(::transfer::RequestHeader* hea
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadRequest.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloRequest.header)
 }
 
-// repeated .transfer.DownloadRequest.FileInfo files = 2;
-inline int DownloadRequest::files_size() const {
-  return files_.size();
-}
-inline void DownloadRequest::clear_files() {
-  files_.Clear();
-}
-inline ::transfer::DownloadRequest_FileInfo* DownloadRequest::mutable_files(int index) {
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadRequest.files)
-  return files_.Mutable(index);
+// uint32 protocol_version = 2;
+inline void HelloRequest::clear_protocol_version() {
+  _impl_.protocol_version_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >*
-DownloadRequest::mutable_files() {
-  // @@protoc_insertion_point(field_mutable_list:transfer.DownloadRequest.files)
-  return &files_;
+inline uint32_t HelloRequest::_internal_protocol_version() const {
+  return _impl_.protocol_version_;
 }
-inline const ::transfer::DownloadRequest_FileInfo& DownloadRequest::files(int index) const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadRequest.files)
-  return files_.Get(index);
+inline uint32_t HelloRequest::protocol_version() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.protocol_version)
+  return _internal_protocol_version();
 }
-inline ::transfer::DownloadRequest_FileInfo* DownloadRequest::add_files() {
-  // @@protoc_insertion_point(field_add:transfer.DownloadRequest.files)
-  return files_.Add();
+inline void HelloRequest::_internal_set_protocol_version(uint32_t value) {
+  
+  _impl_.protocol_version_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadRequest_FileInfo >&
-DownloadRequest::files() const {
-  // @@protoc_insertion_point(field_list:transfer.DownloadRequest.files)
-  return files_;
+inline void HelloRequest::set_protocol_version(uint32_t value) {
+  _internal_set_protocol_version(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.protocol_version)
 }
 
-// -------------------------------------------------------------------
-
-// DownloadResponse_FileResult
-
-// string file_name = 1;
-inline void DownloadResponse_FileResult::clear_file_name() {
-  file_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint32 min_protocol_version = 3;
+inline void HelloRequest::clear_min_protocol_version() {
+  _impl_.min_protocol_version_ = 0u;
 }
-inline const std::string& DownloadResponse_FileResult::file_name() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.file_name)
-  return file_name_.GetNoArena();
+inline uint32_t HelloRequest::_internal_min_protocol_version() const {
+  return _impl_.min_protocol_version_;
 }
-inline void DownloadResponse_FileResult::set_file_name(const std::string& value) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.file_name)
+inline uint32_t HelloRequest::min_protocol_version() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.min_protocol_version)
+  return _internal_min_protocol_version();
 }
-inline void DownloadResponse_FileResult::set_file_name(std::string&& value) {
+inline void HelloRequest::_internal_set_min_protocol_version(uint32_t value) {
   
-  file_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadResponse.FileResult.file_name)
+  _impl_.min_protocol_version_ = value;
 }
-inline void DownloadResponse_FileResult::set_file_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadResponse.FileResult.file_name)
+inline void HelloRequest::set_min_protocol_version(uint32_t value) {
+  _internal_set_min_protocol_version(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.min_protocol_version)
 }
-inline void DownloadResponse_FileResult::set_file_name(const char* value, size_t size) {
-  
-  file_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadResponse.FileResult.file_name)
+
+// uint64 max_frame_size = 4;
+inline void HelloRequest::clear_max_frame_size() {
+  _impl_.max_frame_size_ = uint64_t{0u};
 }
-inline std::string* DownloadResponse_FileResult::mutable_file_name() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.file_name)
-  return file_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline uint64_t HelloRequest::_internal_max_frame_size() const {
+  return _impl_.max_frame_size_;
 }
-inline std::string* DownloadResponse_FileResult::release_file_name() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.file_name)
+inline uint64_t HelloRequest::max_frame_size() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.max_frame_size)
+  return _internal_max_frame_size();
+}
+inline void HelloRequest::_internal_set_max_frame_size(uint64_t value) {
   
-  return file_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.max_frame_size_ = value;
 }
-inline void DownloadResponse_FileResult::set_allocated_file_name(std::string* file_name) {
-  if (file_name != nullptr) {
-    
-  } else {
-    
-  }
-  file_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), file_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.file_name)
+inline void HelloRequest::set_max_frame_size(uint64_t value) {
+  _internal_set_max_frame_size(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.max_frame_size)
 }
 
-// string target_path = 2;
-inline void DownloadResponse_FileResult::clear_target_path() {
-  target_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated string compressions = 5;
+inline int HelloRequest::_internal_compressions_size() const {
+  return _impl_.compressions_.size();
 }
-inline const std::string& DownloadResponse_FileResult::target_path() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.target_path)
-  return target_path_.GetNoArena();
+inline int HelloRequest::compressions_size() const {
+  return _internal_compressions_size();
 }
-inline void DownloadResponse_FileResult::set_target_path(const std::string& value) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.target_path)
+inline void HelloRequest::clear_compressions() {
+  _impl_.compressions_.Clear();
 }
-inline void DownloadResponse_FileResult::set_target_path(std::string&& value) {
-  
-  target_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadResponse.FileResult.target_path)
+inline std::string* HelloRequest::add_compressions() {
+  std::string* _s = _internal_add_compressions();
+  // @@protoc_insertion_point(field_add_mutable:transfer.HelloRequest.compressions)
+  return _s;
+}
+inline const std::string& HelloRequest::_internal_compressions(int index) const {
+  return _impl_.compressions_.Get(index);
+}
+inline const std::string& HelloRequest::compressions(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.compressions)
+  return _internal_compressions(index);
+}
+inline std::string* HelloRequest::mutable_compressions(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.HelloRequest.compressions)
+  return _impl_.compressions_.Mutable(index);
 }
-inline void DownloadResponse_FileResult::set_target_path(const char* value) {
+inline void HelloRequest::set_compressions(int index, const std::string& value) {
+  _impl_.compressions_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.compressions)
+}
+inline void HelloRequest::set_compressions(int index, std::string&& value) {
+  _impl_.compressions_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.compressions)
+}
+inline void HelloRequest::set_compressions(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadResponse.FileResult.target_path)
+  _impl_.compressions_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.HelloRequest.compressions)
 }
-inline void DownloadResponse_FileResult::set_target_path(const char* value, size_t size) {
-  
-  target_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadResponse.FileResult.target_path)
+inline void HelloRequest::set_compressions(int index, const char* value, size_t size) {
+  _impl_.compressions_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.HelloRequest.compressions)
 }
-inline std::string* DownloadResponse_FileResult::mutable_target_path() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.target_path)
-  return target_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloRequest::_internal_add_compressions() {
+  return _impl_.compressions_.Add();
 }
-inline std::string* DownloadResponse_FileResult::release_target_path() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.target_path)
-  
-  return target_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void HelloRequest::add_compressions(const std::string& value) {
+  _impl_.compressions_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.compressions)
 }
-inline void DownloadResponse_FileResult::set_allocated_target_path(std::string* target_path) {
-  if (target_path != nullptr) {
-    
-  } else {
-    
-  }
-  target_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), target_path);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.target_path)
+inline void HelloRequest::add_compressions(std::string&& value) {
+  _impl_.compressions_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.compressions)
 }
-
-// bool exists = 3;
-inline void DownloadResponse_FileResult::clear_exists() {
-  exists_ = false;
+inline void HelloRequest::add_compressions(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.compressions_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.HelloRequest.compressions)
 }
-inline bool DownloadResponse_FileResult::exists() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.exists)
-  return exists_;
+inline void HelloRequest::add_compressions(const char* value, size_t size) {
+  _impl_.compressions_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.HelloRequest.compressions)
 }
-inline void DownloadResponse_FileResult::set_exists(bool value) {
-  
-  exists_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.exists)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HelloRequest::compressions() const {
+  // @@protoc_insertion_point(field_list:transfer.HelloRequest.compressions)
+  return _impl_.compressions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HelloRequest::mutable_compressions() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.HelloRequest.compressions)
+  return &_impl_.compressions_;
 }
 
-// uint64 file_size = 4;
-inline void DownloadResponse_FileResult::clear_file_size() {
-  file_size_ = PROTOBUF_ULONGLONG(0);
+// repeated string hash_algorithms = 6;
+inline int HelloRequest::_internal_hash_algorithms_size() const {
+  return _impl_.hash_algorithms_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 DownloadResponse_FileResult::file_size() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.file_size)
-  return file_size_;
+inline int HelloRequest::hash_algorithms_size() const {
+  return _internal_hash_algorithms_size();
+}
+inline void HelloRequest::clear_hash_algorithms() {
+  _impl_.hash_algorithms_.Clear();
+}
+inline std::string* HelloRequest::add_hash_algorithms() {
+  std::string* _s = _internal_add_hash_algorithms();
+  // @@protoc_insertion_point(field_add_mutable:transfer.HelloRequest.hash_algorithms)
+  return _s;
 }
-inline void DownloadResponse_FileResult::set_file_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  file_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.file_size)
+inline const std::string& HelloRequest::_internal_hash_algorithms(int index) const {
+  return _impl_.hash_algorithms_.Get(index);
 }
-
-// string md5 = 5;
-inline void DownloadResponse_FileResult::clear_md5() {
-  md5_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline const std::string& HelloRequest::hash_algorithms(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.hash_algorithms)
+  return _internal_hash_algorithms(index);
 }
-inline const std::string& DownloadResponse_FileResult::md5() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.md5)
-  return md5_.GetNoArena();
+inline std::string* HelloRequest::mutable_hash_algorithms(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.HelloRequest.hash_algorithms)
+  return _impl_.hash_algorithms_.Mutable(index);
 }
-inline void DownloadResponse_FileResult::set_md5(const std::string& value) {
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.md5)
+inline void HelloRequest::set_hash_algorithms(int index, const std::string& value) {
+  _impl_.hash_algorithms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.hash_algorithms)
 }
-inline void DownloadResponse_FileResult::set_md5(std::string&& value) {
-  
-  md5_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadResponse.FileResult.md5)
+inline void HelloRequest::set_hash_algorithms(int index, std::string&& value) {
+  _impl_.hash_algorithms_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.hash_algorithms)
 }
-inline void DownloadResponse_FileResult::set_md5(const char* value) {
+inline void HelloRequest::set_hash_algorithms(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadResponse.FileResult.md5)
+  _impl_.hash_algorithms_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.HelloRequest.hash_algorithms)
 }
-inline void DownloadResponse_FileResult::set_md5(const char* value, size_t size) {
-  
-  md5_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadResponse.FileResult.md5)
+inline void HelloRequest::set_hash_algorithms(int index, const char* value, size_t size) {
+  _impl_.hash_algorithms_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.HelloRequest.hash_algorithms)
 }
-inline std::string* DownloadResponse_FileResult::mutable_md5() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.md5)
-  return md5_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloRequest::_internal_add_hash_algorithms() {
+  return _impl_.hash_algorithms_.Add();
 }
-inline std::string* DownloadResponse_FileResult::release_md5() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.md5)
-  
-  return md5_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void HelloRequest::add_hash_algorithms(const std::string& value) {
+  _impl_.hash_algorithms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.hash_algorithms)
 }
-inline void DownloadResponse_FileResult::set_allocated_md5(std::string* md5) {
-  if (md5 != nullptr) {
-    
-  } else {
-    
-  }
-  md5_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), md5);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.md5)
+inline void HelloRequest::add_hash_algorithms(std::string&& value) {
+  _impl_.hash_algorithms_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.hash_algorithms)
+}
+inline void HelloRequest::add_hash_algorithms(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.hash_algorithms_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.HelloRequest.hash_algorithms)
+}
+inline void HelloRequest::add_hash_algorithms(const char* value, size_t size) {
+  _impl_.hash_algorithms_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.HelloRequest.hash_algorithms)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HelloRequest::hash_algorithms() const {
+  // @@protoc_insertion_point(field_list:transfer.HelloRequest.hash_algorithms)
+  return _impl_.hash_algorithms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HelloRequest::mutable_hash_algorithms() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.HelloRequest.hash_algorithms)
+  return &_impl_.hash_algorithms_;
 }
 
-// bool need_chunk = 6;
-inline void DownloadResponse_FileResult::clear_need_chunk() {
-  need_chunk_ = false;
+// bool raw_data_frames = 7;
+inline void HelloRequest::clear_raw_data_frames() {
+  _impl_.raw_data_frames_ = false;
 }
-inline bool DownloadResponse_FileResult::need_chunk() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.need_chunk)
-  return need_chunk_;
+inline bool HelloRequest::_internal_raw_data_frames() const {
+  return _impl_.raw_data_frames_;
 }
-inline void DownloadResponse_FileResult::set_need_chunk(bool value) {
+inline bool HelloRequest::raw_data_frames() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.raw_data_frames)
+  return _internal_raw_data_frames();
+}
+inline void HelloRequest::_internal_set_raw_data_frames(bool value) {
   
-  need_chunk_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.need_chunk)
+  _impl_.raw_data_frames_ = value;
+}
+inline void HelloRequest::set_raw_data_frames(bool value) {
+  _internal_set_raw_data_frames(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.raw_data_frames)
 }
 
-// uint32 chunk_size = 7;
-inline void DownloadResponse_FileResult::clear_chunk_size() {
-  chunk_size_ = 0u;
+// uint32 window_size = 8;
+inline void HelloRequest::clear_window_size() {
+  _impl_.window_size_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DownloadResponse_FileResult::chunk_size() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.chunk_size)
-  return chunk_size_;
+inline uint32_t HelloRequest::_internal_window_size() const {
+  return _impl_.window_size_;
+}
+inline uint32_t HelloRequest::window_size() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.window_size)
+  return _internal_window_size();
 }
-inline void DownloadResponse_FileResult::set_chunk_size(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void HelloRequest::_internal_set_window_size(uint32_t value) {
   
-  chunk_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.chunk_size)
+  _impl_.window_size_ = value;
+}
+inline void HelloRequest::set_window_size(uint32_t value) {
+  _internal_set_window_size(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.window_size)
 }
 
-// uint32 chunk_sequence = 8;
-inline void DownloadResponse_FileResult::clear_chunk_sequence() {
-  chunk_sequence_ = 0u;
+// bool multiplexing = 9;
+inline void HelloRequest::clear_multiplexing() {
+  _impl_.multiplexing_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DownloadResponse_FileResult::chunk_sequence() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.chunk_sequence)
-  return chunk_sequence_;
+inline bool HelloRequest::_internal_multiplexing() const {
+  return _impl_.multiplexing_;
+}
+inline bool HelloRequest::multiplexing() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.multiplexing)
+  return _internal_multiplexing();
 }
-inline void DownloadResponse_FileResult::set_chunk_sequence(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void HelloRequest::_internal_set_multiplexing(bool value) {
   
-  chunk_sequence_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.chunk_sequence)
+  _impl_.multiplexing_ = value;
+}
+inline void HelloRequest::set_multiplexing(bool value) {
+  _internal_set_multiplexing(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.multiplexing)
 }
 
-// bytes data = 9;
-inline void DownloadResponse_FileResult::clear_data() {
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated string features = 10;
+inline int HelloRequest::_internal_features_size() const {
+  return _impl_.features_.size();
 }
-inline const std::string& DownloadResponse_FileResult::data() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.data)
-  return data_.GetNoArena();
+inline int HelloRequest::features_size() const {
+  return _internal_features_size();
 }
-inline void DownloadResponse_FileResult::set_data(const std::string& value) {
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.data)
+inline void HelloRequest::clear_features() {
+  _impl_.features_.Clear();
 }
-inline void DownloadResponse_FileResult::set_data(std::string&& value) {
-  
-  data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadResponse.FileResult.data)
+inline std::string* HelloRequest::add_features() {
+  std::string* _s = _internal_add_features();
+  // @@protoc_insertion_point(field_add_mutable:transfer.HelloRequest.features)
+  return _s;
 }
-inline void DownloadResponse_FileResult::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadResponse.FileResult.data)
+inline const std::string& HelloRequest::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
 }
-inline void DownloadResponse_FileResult::set_data(const void* value, size_t size) {
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadResponse.FileResult.data)
+inline const std::string& HelloRequest::features(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.features)
+  return _internal_features(index);
 }
-inline std::string* DownloadResponse_FileResult::mutable_data() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.data)
-  return data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloRequest::mutable_features(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.HelloRequest.features)
+  return _impl_.features_.Mutable(index);
 }
-inline std::string* DownloadResponse_FileResult::release_data() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.data)
-  
-  return data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void HelloRequest::set_features(int index, const std::string& value) {
+  _impl_.features_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.features)
 }
-inline void DownloadResponse_FileResult::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-    
-  } else {
-    
-  }
-  data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.data)
+inline void HelloRequest::set_features(int index, std::string&& value) {
+  _impl_.features_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.features)
 }
-
-// uint32 checksum = 10;
-inline void DownloadResponse_FileResult::clear_checksum() {
-  checksum_ = 0u;
+inline void HelloRequest::set_features(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.features_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.HelloRequest.features)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 DownloadResponse_FileResult::checksum() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.checksum)
-  return checksum_;
+inline void HelloRequest::set_features(int index, const char* value, size_t size) {
+  _impl_.features_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.HelloRequest.features)
 }
-inline void DownloadResponse_FileResult::set_checksum(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  checksum_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.checksum)
+inline std::string* HelloRequest::_internal_add_features() {
+  return _impl_.features_.Add();
 }
-
-// bool is_last = 11;
-inline void DownloadResponse_FileResult::clear_is_last() {
-  is_last_ = false;
+inline void HelloRequest::add_features(const std::string& value) {
+  _impl_.features_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.features)
 }
-inline bool DownloadResponse_FileResult::is_last() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.is_last)
-  return is_last_;
+inline void HelloRequest::add_features(std::string&& value) {
+  _impl_.features_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.HelloRequest.features)
 }
-inline void DownloadResponse_FileResult::set_is_last(bool value) {
-  
-  is_last_ = value;
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.is_last)
+inline void HelloRequest::add_features(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.features_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.HelloRequest.features)
+}
+inline void HelloRequest::add_features(const char* value, size_t size) {
+  _impl_.features_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.HelloRequest.features)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HelloRequest::features() const {
+  // @@protoc_insertion_point(field_list:transfer.HelloRequest.features)
+  return _impl_.features_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HelloRequest::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.HelloRequest.features)
+  return &_impl_.features_;
 }
 
-// string error_message = 12;
-inline void DownloadResponse_FileResult::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string client_name = 11;
+inline void HelloRequest::clear_client_name() {
+  _impl_.client_name_.ClearToEmpty();
 }
-inline const std::string& DownloadResponse_FileResult::error_message() const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.FileResult.error_message)
-  return error_message_.GetNoArena();
+inline const std::string& HelloRequest::client_name() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloRequest.client_name)
+  return _internal_client_name();
 }
-inline void DownloadResponse_FileResult::set_error_message(const std::string& value) {
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.DownloadResponse.FileResult.error_message)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloRequest::set_client_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.client_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.HelloRequest.client_name)
 }
-inline void DownloadResponse_FileResult::set_error_message(std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.DownloadResponse.FileResult.error_message)
+inline std::string* HelloRequest::mutable_client_name() {
+  std::string* _s = _internal_mutable_client_name();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloRequest.client_name)
+  return _s;
 }
-inline void DownloadResponse_FileResult::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.DownloadResponse.FileResult.error_message)
+inline const std::string& HelloRequest::_internal_client_name() const {
+  return _impl_.client_name_.Get();
 }
-inline void DownloadResponse_FileResult::set_error_message(const char* value, size_t size) {
+inline void HelloRequest::_internal_set_client_name(const std::string& value) {
   
-  error_message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.DownloadResponse.FileResult.error_message)
+  _impl_.client_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* DownloadResponse_FileResult::mutable_error_message() {
+inline std::string* HelloRequest::_internal_mutable_client_name() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.FileResult.error_message)
-  return error_message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.client_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* DownloadResponse_FileResult::release_error_message() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.FileResult.error_message)
-  
-  return error_message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloRequest::release_client_name() {
+  // @@protoc_insertion_point(field_release:transfer.HelloRequest.client_name)
+  return _impl_.client_name_.Release();
 }
-inline void DownloadResponse_FileResult::set_allocated_error_message(std::string* error_message) {
-  if (error_message != nullptr) {
+inline void HelloRequest::set_allocated_client_name(std::string* client_name) {
+  if (client_name != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), error_message);
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.FileResult.error_message)
+  _impl_.client_name_.SetAllocated(client_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.client_name_.IsDefault()) {
+    _impl_.client_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloRequest.client_name)
 }
 
 // -------------------------------------------------------------------
 
-// DownloadResponse
+// HelloResponse
 
 // .transfer.ResponseHeader header = 1;
-inline bool DownloadResponse::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+inline bool HelloResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void DownloadResponse::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
-  }
-  header_ = nullptr;
+inline bool HelloResponse::has_header() const {
+  return _internal_has_header();
 }
-inline const ::transfer::ResponseHeader& DownloadResponse::header() const {
-  const ::transfer::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::ResponseHeader*>(
-      &::transfer::_ResponseHeader_default_instance_);
+inline void HelloResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline ::transfer::ResponseHeader* DownloadResponse::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.DownloadResponse.header)
-  
-  ::transfer::ResponseHeader* temp = header_;
-  header_ = nullptr;
-  return temp;
+inline const ::transfer::ResponseHeader& HelloResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
 }
-inline ::transfer::ResponseHeader* DownloadResponse::mutable_header() {
-  
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaNoVirtual());
-    header_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.header)
-  return header_;
+inline const ::transfer::ResponseHeader& HelloResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.header)
+  return _internal_header();
 }
-inline void DownloadResponse::set_allocated_header(::transfer::ResponseHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete header_;
+inline void HelloResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
   }
+  _impl_.header_ = header;
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, header, submessage_arena);
-    }
     
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.DownloadResponse.header)
-}
-
-// repeated .transfer.DownloadResponse.FileResult results = 2;
-inline int DownloadResponse::results_size() const {
-  return results_.size();
-}
-inline void DownloadResponse::clear_results() {
-  results_.Clear();
-}
-inline ::transfer::DownloadResponse_FileResult* DownloadResponse::mutable_results(int index) {
-  // @@protoc_insertion_point(field_mutable:transfer.DownloadResponse.results)
-  return results_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >*
-DownloadResponse::mutable_results() {
-  // @@protoc_insertion_point(field_mutable_list:transfer.DownloadResponse.results)
-  return &results_;
-}
-inline const ::transfer::DownloadResponse_FileResult& DownloadResponse::results(int index) const {
-  // @@protoc_insertion_point(field_get:transfer.DownloadResponse.results)
-  return results_.Get(index);
-}
-inline ::transfer::DownloadResponse_FileResult* DownloadResponse::add_results() {
-  // @@protoc_insertion_point(field_add:transfer.DownloadResponse.results)
-  return results_.Add();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::transfer::DownloadResponse_FileResult >&
-DownloadResponse::results() const {
-  // @@protoc_insertion_point(field_list:transfer.DownloadResponse.results)
-  return results_;
-}
-
-// -------------------------------------------------------------------
-
-// TransferControlRequest
-
-// .transfer.RequestHeader header = 1;
-inline bool TransferControlRequest::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.HelloResponse.header)
 }
-inline void TransferControlRequest::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline ::transfer::ResponseHeader* HelloResponse::release_header() {
+  
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  header_ = nullptr;
-}
-inline const ::transfer::RequestHeader& TransferControlRequest::header() const {
-  const ::transfer::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::RequestHeader*>(
-      &::transfer::_RequestHeader_default_instance_);
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::transfer::RequestHeader* TransferControlRequest::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.TransferControlRequest.header)
+inline ::transfer::ResponseHeader* HelloResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.HelloResponse.header)
   
-  ::transfer::RequestHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
   return temp;
 }
-inline ::transfer::RequestHeader* TransferControlRequest::mutable_header() {
+inline ::transfer::ResponseHeader* HelloResponse::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.TransferControlRequest.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void TransferControlRequest::set_allocated_header(::transfer::RequestHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::ResponseHeader* HelloResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloResponse.header)
+  return _msg;
+}
+inline void HelloResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -5551,358 +16986,417 @@ inline void TransferControlRequest::set_allocated_header(::transfer::RequestHead
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlRequest.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloResponse.header)
 }
 
-// string task_id = 2;
-inline void TransferControlRequest::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint32 protocol_version = 2;
+inline void HelloResponse::clear_protocol_version() {
+  _impl_.protocol_version_ = 0u;
 }
-inline const std::string& TransferControlRequest::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.task_id)
-  return task_id_.GetNoArena();
+inline uint32_t HelloResponse::_internal_protocol_version() const {
+  return _impl_.protocol_version_;
 }
-inline void TransferControlRequest::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.TransferControlRequest.task_id)
+inline uint32_t HelloResponse::protocol_version() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.protocol_version)
+  return _internal_protocol_version();
 }
-inline void TransferControlRequest::set_task_id(std::string&& value) {
+inline void HelloResponse::_internal_set_protocol_version(uint32_t value) {
   
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.TransferControlRequest.task_id)
+  _impl_.protocol_version_ = value;
 }
-inline void TransferControlRequest::set_task_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.TransferControlRequest.task_id)
+inline void HelloResponse::set_protocol_version(uint32_t value) {
+  _internal_set_protocol_version(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.protocol_version)
 }
-inline void TransferControlRequest::set_task_id(const char* value, size_t size) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.TransferControlRequest.task_id)
+
+// uint64 max_frame_size = 3;
+inline void HelloResponse::clear_max_frame_size() {
+  _impl_.max_frame_size_ = uint64_t{0u};
 }
-inline std::string* TransferControlRequest::mutable_task_id() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.TransferControlRequest.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline uint64_t HelloResponse::_internal_max_frame_size() const {
+  return _impl_.max_frame_size_;
 }
-inline std::string* TransferControlRequest::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.TransferControlRequest.task_id)
+inline uint64_t HelloResponse::max_frame_size() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.max_frame_size)
+  return _internal_max_frame_size();
+}
+inline void HelloResponse::_internal_set_max_frame_size(uint64_t value) {
   
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.max_frame_size_ = value;
 }
-inline void TransferControlRequest::set_allocated_task_id(std::string* task_id) {
-  if (task_id != nullptr) {
-    
-  } else {
-    
-  }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlRequest.task_id)
+inline void HelloResponse::set_max_frame_size(uint64_t value) {
+  _internal_set_max_frame_size(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.max_frame_size)
 }
 
-// .transfer.TransferControlRequest.ControlType control_type = 3;
-inline void TransferControlRequest::clear_control_type() {
-  control_type_ = 0;
-}
-inline ::transfer::TransferControlRequest_ControlType TransferControlRequest::control_type() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferControlRequest.control_type)
-  return static_cast< ::transfer::TransferControlRequest_ControlType >(control_type_);
+// string compression = 4;
+inline void HelloResponse::clear_compression() {
+  _impl_.compression_.ClearToEmpty();
 }
-inline void TransferControlRequest::set_control_type(::transfer::TransferControlRequest_ControlType value) {
-  
-  control_type_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferControlRequest.control_type)
+inline const std::string& HelloResponse::compression() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.compression)
+  return _internal_compression();
 }
-
-// -------------------------------------------------------------------
-
-// TransferControlResponse
-
-// .transfer.ResponseHeader header = 1;
-inline bool TransferControlResponse::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloResponse::set_compression(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.compression_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.compression)
 }
-inline void TransferControlResponse::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
-  }
-  header_ = nullptr;
+inline std::string* HelloResponse::mutable_compression() {
+  std::string* _s = _internal_mutable_compression();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloResponse.compression)
+  return _s;
 }
-inline const ::transfer::ResponseHeader& TransferControlResponse::header() const {
-  const ::transfer::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::ResponseHeader*>(
-      &::transfer::_ResponseHeader_default_instance_);
+inline const std::string& HelloResponse::_internal_compression() const {
+  return _impl_.compression_.Get();
 }
-inline ::transfer::ResponseHeader* TransferControlResponse::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.TransferControlResponse.header)
+inline void HelloResponse::_internal_set_compression(const std::string& value) {
   
-  ::transfer::ResponseHeader* temp = header_;
-  header_ = nullptr;
-  return temp;
+  _impl_.compression_.Set(value, GetArenaForAllocation());
 }
-inline ::transfer::ResponseHeader* TransferControlResponse::mutable_header() {
+inline std::string* HelloResponse::_internal_mutable_compression() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaNoVirtual());
-    header_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:transfer.TransferControlResponse.header)
-  return header_;
+  return _impl_.compression_.Mutable(GetArenaForAllocation());
 }
-inline void TransferControlResponse::set_allocated_header(::transfer::ResponseHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete header_;
-  }
-  if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, header, submessage_arena);
-    }
+inline std::string* HelloResponse::release_compression() {
+  // @@protoc_insertion_point(field_release:transfer.HelloResponse.compression)
+  return _impl_.compression_.Release();
+}
+inline void HelloResponse::set_allocated_compression(std::string* compression) {
+  if (compression != nullptr) {
     
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlResponse.header)
+  _impl_.compression_.SetAllocated(compression, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.compression_.IsDefault()) {
+    _impl_.compression_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloResponse.compression)
 }
 
-// string task_id = 2;
-inline void TransferControlResponse::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string hash_algorithm = 5;
+inline void HelloResponse::clear_hash_algorithm() {
+  _impl_.hash_algorithm_.ClearToEmpty();
 }
-inline const std::string& TransferControlResponse::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.task_id)
-  return task_id_.GetNoArena();
+inline const std::string& HelloResponse::hash_algorithm() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.hash_algorithm)
+  return _internal_hash_algorithm();
 }
-inline void TransferControlResponse::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.task_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloResponse::set_hash_algorithm(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hash_algorithm_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.hash_algorithm)
 }
-inline void TransferControlResponse::set_task_id(std::string&& value) {
-  
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.TransferControlResponse.task_id)
+inline std::string* HelloResponse::mutable_hash_algorithm() {
+  std::string* _s = _internal_mutable_hash_algorithm();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloResponse.hash_algorithm)
+  return _s;
 }
-inline void TransferControlResponse::set_task_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.TransferControlResponse.task_id)
+inline const std::string& HelloResponse::_internal_hash_algorithm() const {
+  return _impl_.hash_algorithm_.Get();
 }
-inline void TransferControlResponse::set_task_id(const char* value, size_t size) {
+inline void HelloResponse::_internal_set_hash_algorithm(const std::string& value) {
   
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.TransferControlResponse.task_id)
+  _impl_.hash_algorithm_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransferControlResponse::mutable_task_id() {
+inline std::string* HelloResponse::_internal_mutable_hash_algorithm() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.TransferControlResponse.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.hash_algorithm_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TransferControlResponse::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.TransferControlResponse.task_id)
-  
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloResponse::release_hash_algorithm() {
+  // @@protoc_insertion_point(field_release:transfer.HelloResponse.hash_algorithm)
+  return _impl_.hash_algorithm_.Release();
 }
-inline void TransferControlResponse::set_allocated_task_id(std::string* task_id) {
-  if (task_id != nullptr) {
+inline void HelloResponse::set_allocated_hash_algorithm(std::string* hash_algorithm) {
+  if (hash_algorithm != nullptr) {
     
   } else {
     
   }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferControlResponse.task_id)
+  _impl_.hash_algorithm_.SetAllocated(hash_algorithm, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hash_algorithm_.IsDefault()) {
+    _impl_.hash_algorithm_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloResponse.hash_algorithm)
+}
+
+// bool raw_data_frames = 6;
+inline void HelloResponse::clear_raw_data_frames() {
+  _impl_.raw_data_frames_ = false;
+}
+inline bool HelloResponse::_internal_raw_data_frames() const {
+  return _impl_.raw_data_frames_;
+}
+inline bool HelloResponse::raw_data_frames() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.raw_data_frames)
+  return _internal_raw_data_frames();
+}
+inline void HelloResponse::_internal_set_raw_data_frames(bool value) {
+  
+  _impl_.raw_data_frames_ = value;
+}
+inline void HelloResponse::set_raw_data_frames(bool value) {
+  _internal_set_raw_data_frames(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.raw_data_frames)
 }
 
-// bool success = 3;
-inline void TransferControlResponse::clear_success() {
-  success_ = false;
+// uint32 window_size = 7;
+inline void HelloResponse::clear_window_size() {
+  _impl_.window_size_ = 0u;
 }
-inline bool TransferControlResponse::success() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.success)
-  return success_;
+inline uint32_t HelloResponse::_internal_window_size() const {
+  return _impl_.window_size_;
 }
-inline void TransferControlResponse::set_success(bool value) {
+inline uint32_t HelloResponse::window_size() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.window_size)
+  return _internal_window_size();
+}
+inline void HelloResponse::_internal_set_window_size(uint32_t value) {
   
-  success_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.success)
+  _impl_.window_size_ = value;
+}
+inline void HelloResponse::set_window_size(uint32_t value) {
+  _internal_set_window_size(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.window_size)
 }
 
-// .transfer.TransferStatus new_status = 4;
-inline void TransferControlResponse::clear_new_status() {
-  new_status_ = 0;
+// bool multiplexing = 8;
+inline void HelloResponse::clear_multiplexing() {
+  _impl_.multiplexing_ = false;
 }
-inline ::transfer::TransferStatus TransferControlResponse::new_status() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferControlResponse.new_status)
-  return static_cast< ::transfer::TransferStatus >(new_status_);
+inline bool HelloResponse::_internal_multiplexing() const {
+  return _impl_.multiplexing_;
 }
-inline void TransferControlResponse::set_new_status(::transfer::TransferStatus value) {
+inline bool HelloResponse::multiplexing() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.multiplexing)
+  return _internal_multiplexing();
+}
+inline void HelloResponse::_internal_set_multiplexing(bool value) {
   
-  new_status_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferControlResponse.new_status)
+  _impl_.multiplexing_ = value;
+}
+inline void HelloResponse::set_multiplexing(bool value) {
+  _internal_set_multiplexing(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.multiplexing)
 }
 
-// -------------------------------------------------------------------
-
-// TransferProgressRequest
-
-// .transfer.RequestHeader header = 1;
-inline bool TransferProgressRequest::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+// repeated string features = 9;
+inline int HelloResponse::_internal_features_size() const {
+  return _impl_.features_.size();
 }
-inline void TransferProgressRequest::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
-  }
-  header_ = nullptr;
+inline int HelloResponse::features_size() const {
+  return _internal_features_size();
 }
-inline const ::transfer::RequestHeader& TransferProgressRequest::header() const {
-  const ::transfer::RequestHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressRequest.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::RequestHeader*>(
-      &::transfer::_RequestHeader_default_instance_);
+inline void HelloResponse::clear_features() {
+  _impl_.features_.Clear();
 }
-inline ::transfer::RequestHeader* TransferProgressRequest::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.TransferProgressRequest.header)
-  
-  ::transfer::RequestHeader* temp = header_;
-  header_ = nullptr;
-  return temp;
+inline std::string* HelloResponse::add_features() {
+  std::string* _s = _internal_add_features();
+  // @@protoc_insertion_point(field_add_mutable:transfer.HelloResponse.features)
+  return _s;
 }
-inline ::transfer::RequestHeader* TransferProgressRequest::mutable_header() {
-  
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaNoVirtual());
-    header_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressRequest.header)
-  return header_;
+inline const std::string& HelloResponse::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
 }
-inline void TransferProgressRequest::set_allocated_header(::transfer::RequestHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete header_;
-  }
-  if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, header, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressRequest.header)
+inline const std::string& HelloResponse::features(int index) const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.features)
+  return _internal_features(index);
 }
-
-// string task_id = 2;
-inline void TransferProgressRequest::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline std::string* HelloResponse::mutable_features(int index) {
+  // @@protoc_insertion_point(field_mutable:transfer.HelloResponse.features)
+  return _impl_.features_.Mutable(index);
 }
-inline const std::string& TransferProgressRequest::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressRequest.task_id)
-  return task_id_.GetNoArena();
+inline void HelloResponse::set_features(int index, const std::string& value) {
+  _impl_.features_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.features)
 }
-inline void TransferProgressRequest::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressRequest.task_id)
+inline void HelloResponse::set_features(int index, std::string&& value) {
+  _impl_.features_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.features)
 }
-inline void TransferProgressRequest::set_task_id(std::string&& value) {
-  
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.TransferProgressRequest.task_id)
+inline void HelloResponse::set_features(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.features_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:transfer.HelloResponse.features)
+}
+inline void HelloResponse::set_features(int index, const char* value, size_t size) {
+  _impl_.features_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:transfer.HelloResponse.features)
+}
+inline std::string* HelloResponse::_internal_add_features() {
+  return _impl_.features_.Add();
+}
+inline void HelloResponse::add_features(const std::string& value) {
+  _impl_.features_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:transfer.HelloResponse.features)
+}
+inline void HelloResponse::add_features(std::string&& value) {
+  _impl_.features_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:transfer.HelloResponse.features)
 }
-inline void TransferProgressRequest::set_task_id(const char* value) {
+inline void HelloResponse::add_features(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.TransferProgressRequest.task_id)
+  _impl_.features_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:transfer.HelloResponse.features)
 }
-inline void TransferProgressRequest::set_task_id(const char* value, size_t size) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.TransferProgressRequest.task_id)
+inline void HelloResponse::add_features(const char* value, size_t size) {
+  _impl_.features_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:transfer.HelloResponse.features)
 }
-inline std::string* TransferProgressRequest::mutable_task_id() {
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HelloResponse::features() const {
+  // @@protoc_insertion_point(field_list:transfer.HelloResponse.features)
+  return _impl_.features_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HelloResponse::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:transfer.HelloResponse.features)
+  return &_impl_.features_;
+}
+
+// string server_name = 10;
+inline void HelloResponse::clear_server_name() {
+  _impl_.server_name_.ClearToEmpty();
+}
+inline const std::string& HelloResponse::server_name() const {
+  // @@protoc_insertion_point(field_get:transfer.HelloResponse.server_name)
+  return _internal_server_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HelloResponse::set_server_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.server_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:transfer.HelloResponse.server_name)
+}
+inline std::string* HelloResponse::mutable_server_name() {
+  std::string* _s = _internal_mutable_server_name();
+  // @@protoc_insertion_point(field_mutable:transfer.HelloResponse.server_name)
+  return _s;
+}
+inline const std::string& HelloResponse::_internal_server_name() const {
+  return _impl_.server_name_.Get();
+}
+inline void HelloResponse::_internal_set_server_name(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressRequest.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.server_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TransferProgressRequest::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.TransferProgressRequest.task_id)
+inline std::string* HelloResponse::_internal_mutable_server_name() {
   
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.server_name_.Mutable(GetArenaForAllocation());
 }
-inline void TransferProgressRequest::set_allocated_task_id(std::string* task_id) {
-  if (task_id != nullptr) {
+inline std::string* HelloResponse::release_server_name() {
+  // @@protoc_insertion_point(field_release:transfer.HelloResponse.server_name)
+  return _impl_.server_name_.Release();
+}
+inline void HelloResponse::set_allocated_server_name(std::string* server_name) {
+  if (server_name != nullptr) {
     
   } else {
     
   }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressRequest.task_id)
+  _impl_.server_name_.SetAllocated(server_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.server_name_.IsDefault()) {
+    _impl_.server_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:transfer.HelloResponse.server_name)
 }
 
 // -------------------------------------------------------------------
 
-// TransferProgressResponse
+// HeartbeatRequest
 
-// .transfer.ResponseHeader header = 1;
-inline bool TransferProgressResponse::has_header() const {
-  return this != internal_default_instance() && header_ != nullptr;
+// .transfer.RequestHeader header = 1;
+inline bool HeartbeatRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline void TransferProgressResponse::clear_header() {
-  if (GetArenaNoVirtual() == nullptr && header_ != nullptr) {
-    delete header_;
+inline bool HeartbeatRequest::has_header() const {
+  return _internal_has_header();
+}
+inline void HeartbeatRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
   }
-  header_ = nullptr;
+  _impl_.header_ = nullptr;
 }
-inline const ::transfer::ResponseHeader& TransferProgressResponse::header() const {
-  const ::transfer::ResponseHeader* p = header_;
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.header)
-  return p != nullptr ? *p : *reinterpret_cast<const ::transfer::ResponseHeader*>(
-      &::transfer::_ResponseHeader_default_instance_);
+inline const ::transfer::RequestHeader& HeartbeatRequest::_internal_header() const {
+  const ::transfer::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::RequestHeader&>(
+      ::transfer::_RequestHeader_default_instance_);
 }
-inline ::transfer::ResponseHeader* TransferProgressResponse::release_header() {
-  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.header)
+inline const ::transfer::RequestHeader& HeartbeatRequest::header() const {
+  // @@protoc_insertion_point(field_get:transfer.HeartbeatRequest.header)
+  return _internal_header();
+}
+inline void HeartbeatRequest::unsafe_arena_set_allocated_header(
+    ::transfer::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.HeartbeatRequest.header)
+}
+inline ::transfer::RequestHeader* HeartbeatRequest::release_header() {
   
-  ::transfer::ResponseHeader* temp = header_;
-  header_ = nullptr;
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::transfer::ResponseHeader* TransferProgressResponse::mutable_header() {
+inline ::transfer::RequestHeader* HeartbeatRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.HeartbeatRequest.header)
+  
+  ::transfer::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::transfer::RequestHeader* HeartbeatRequest::_internal_mutable_header() {
   
-  if (header_ == nullptr) {
-    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaNoVirtual());
-    header_ = p;
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.header)
-  return header_;
+  return _impl_.header_;
 }
-inline void TransferProgressResponse::set_allocated_header(::transfer::ResponseHeader* header) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline ::transfer::RequestHeader* HeartbeatRequest::mutable_header() {
+  ::transfer::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.HeartbeatRequest.header)
+  return _msg;
+}
+inline void HeartbeatRequest::set_allocated_header(::transfer::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete header_;
+    delete _impl_.header_;
   }
   if (header) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
     if (message_arena != submessage_arena) {
       header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, header, submessage_arena);
@@ -5911,180 +17405,142 @@ inline void TransferProgressResponse::set_allocated_header(::transfer::ResponseH
   } else {
     
   }
-  header_ = header;
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.header)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.HeartbeatRequest.header)
 }
 
-// string task_id = 2;
-inline void TransferProgressResponse::clear_task_id() {
-  task_id_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// uint64 timestamp_ms = 2;
+inline void HeartbeatRequest::clear_timestamp_ms() {
+  _impl_.timestamp_ms_ = uint64_t{0u};
 }
-inline const std::string& TransferProgressResponse::task_id() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.task_id)
-  return task_id_.GetNoArena();
+inline uint64_t HeartbeatRequest::_internal_timestamp_ms() const {
+  return _impl_.timestamp_ms_;
 }
-inline void TransferProgressResponse::set_task_id(const std::string& value) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.task_id)
+inline uint64_t HeartbeatRequest::timestamp_ms() const {
+  // @@protoc_insertion_point(field_get:transfer.HeartbeatRequest.timestamp_ms)
+  return _internal_timestamp_ms();
 }
-inline void TransferProgressResponse::set_task_id(std::string&& value) {
+inline void HeartbeatRequest::_internal_set_timestamp_ms(uint64_t value) {
   
-  task_id_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.TransferProgressResponse.task_id)
+  _impl_.timestamp_ms_ = value;
 }
-inline void TransferProgressResponse::set_task_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.TransferProgressResponse.task_id)
+inline void HeartbeatRequest::set_timestamp_ms(uint64_t value) {
+  _internal_set_timestamp_ms(value);
+  // @@protoc_insertion_point(field_set:transfer.HeartbeatRequest.timestamp_ms)
 }
-inline void TransferProgressResponse::set_task_id(const char* value, size_t size) {
-  
-  task_id_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.TransferProgressResponse.task_id)
+
+// -------------------------------------------------------------------
+
+// HeartbeatResponse
+
+// .transfer.ResponseHeader header = 1;
+inline bool HeartbeatResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
 }
-inline std::string* TransferProgressResponse::mutable_task_id() {
-  
-  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.task_id)
-  return task_id_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline bool HeartbeatResponse::has_header() const {
+  return _internal_has_header();
 }
-inline std::string* TransferProgressResponse::release_task_id() {
-  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.task_id)
-  
-  return task_id_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void HeartbeatResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
 }
-inline void TransferProgressResponse::set_allocated_task_id(std::string* task_id) {
-  if (task_id != nullptr) {
+inline const ::transfer::ResponseHeader& HeartbeatResponse::_internal_header() const {
+  const ::transfer::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::transfer::ResponseHeader&>(
+      ::transfer::_ResponseHeader_default_instance_);
+}
+inline const ::transfer::ResponseHeader& HeartbeatResponse::header() const {
+  // @@protoc_insertion_point(field_get:transfer.HeartbeatResponse.header)
+  return _internal_header();
+}
+inline void HeartbeatResponse::unsafe_arena_set_allocated_header(
+    ::transfer::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
     
   } else {
     
   }
-  task_id_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_id);
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.task_id)
-}
-
-// string task_name = 3;
-inline void TransferProgressResponse::clear_task_name() {
-  task_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& TransferProgressResponse::task_name() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.task_name)
-  return task_name_.GetNoArena();
-}
-inline void TransferProgressResponse::set_task_name(const std::string& value) {
-  
-  task_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.task_name)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:transfer.HeartbeatResponse.header)
 }
-inline void TransferProgressResponse::set_task_name(std::string&& value) {
+inline ::transfer::ResponseHeader* HeartbeatResponse::release_header() {
   
-  task_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:transfer.TransferProgressResponse.task_name)
-}
-inline void TransferProgressResponse::set_task_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  task_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:transfer.TransferProgressResponse.task_name)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void TransferProgressResponse::set_task_name(const char* value, size_t size) {
+inline ::transfer::ResponseHeader* HeartbeatResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:transfer.HeartbeatResponse.header)
   
-  task_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:transfer.TransferProgressResponse.task_name)
+  ::transfer::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
 }
-inline std::string* TransferProgressResponse::mutable_task_name() {
+inline ::transfer::ResponseHeader* HeartbeatResponse::_internal_mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:transfer.TransferProgressResponse.task_name)
-  return task_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::transfer::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
 }
-inline std::string* TransferProgressResponse::release_task_name() {
-  // @@protoc_insertion_point(field_release:transfer.TransferProgressResponse.task_name)
-  
-  return task_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::transfer::ResponseHeader* HeartbeatResponse::mutable_header() {
+  ::transfer::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:transfer.HeartbeatResponse.header)
+  return _msg;
 }
-inline void TransferProgressResponse::set_allocated_task_name(std::string* task_name) {
-  if (task_name != nullptr) {
+inline void HeartbeatResponse::set_allocated_header(::transfer::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.header_;
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(header);
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
     
   } else {
     
   }
-  task_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), task_name);
-  // @@protoc_insertion_point(field_set_allocated:transfer.TransferProgressResponse.task_name)
-}
-
-// .transfer.TransferStatus status = 4;
-inline void TransferProgressResponse::clear_status() {
-  status_ = 0;
-}
-inline ::transfer::TransferStatus TransferProgressResponse::status() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.status)
-  return static_cast< ::transfer::TransferStatus >(status_);
-}
-inline void TransferProgressResponse::set_status(::transfer::TransferStatus value) {
-  
-  status_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.status)
-}
-
-// uint64 transferred_size = 5;
-inline void TransferProgressResponse::clear_transferred_size() {
-  transferred_size_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 TransferProgressResponse::transferred_size() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.transferred_size)
-  return transferred_size_;
-}
-inline void TransferProgressResponse::set_transferred_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  transferred_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.transferred_size)
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:transfer.HeartbeatResponse.header)
 }
 
-// uint64 total_size = 6;
-inline void TransferProgressResponse::clear_total_size() {
-  total_size_ = PROTOBUF_ULONGLONG(0);
+// uint64 timestamp_ms = 2;
+inline void HeartbeatResponse::clear_timestamp_ms() {
+  _impl_.timestamp_ms_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 TransferProgressResponse::total_size() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.total_size)
-  return total_size_;
-}
-inline void TransferProgressResponse::set_total_size(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  total_size_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.total_size)
-}
-
-// uint32 speed = 7;
-inline void TransferProgressResponse::clear_speed() {
-  speed_ = 0u;
+inline uint64_t HeartbeatResponse::_internal_timestamp_ms() const {
+  return _impl_.timestamp_ms_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 TransferProgressResponse::speed() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.speed)
-  return speed_;
+inline uint64_t HeartbeatResponse::timestamp_ms() const {
+  // @@protoc_insertion_point(field_get:transfer.HeartbeatResponse.timestamp_ms)
+  return _internal_timestamp_ms();
 }
-inline void TransferProgressResponse::set_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void HeartbeatResponse::_internal_set_timestamp_ms(uint64_t value) {
   
-  speed_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.speed)
-}
-
-// uint32 progress = 8;
-inline void TransferProgressResponse::clear_progress() {
-  progress_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 TransferProgressResponse::progress() const {
-  // @@protoc_insertion_point(field_get:transfer.TransferProgressResponse.progress)
-  return progress_;
+  _impl_.timestamp_ms_ = value;
 }
-inline void TransferProgressResponse::set_progress(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  progress_ = value;
-  // @@protoc_insertion_point(field_set:transfer.TransferProgressResponse.progress)
+inline void HeartbeatResponse::set_timestamp_ms(uint64_t value) {
+  _internal_set_timestamp_ms(value);
+  // @@protoc_insertion_point(field_set:transfer.HeartbeatResponse.timestamp_ms)
 }
 
 #ifdef __GNUC__
@@ -6122,6 +17578,46 @@ inline void TransferProgressResponse::set_progress(::PROTOBUF_NAMESPACE_ID::uint
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -6129,6 +17625,16 @@ inline void TransferProgressResponse::set_progress(::PROTOBUF_NAMESPACE_ID::uint
 
 PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::transfer::ArchiveRequest_Direction> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::transfer::ArchiveRequest_Direction>() {
+  return ::transfer::ArchiveRequest_Direction_descriptor();
+}
+template <> struct is_proto_enum< ::transfer::SearchRequest_PatternType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::transfer::SearchRequest_PatternType>() {
+  return ::transfer::SearchRequest_PatternType_descriptor();
+}
 template <> struct is_proto_enum< ::transfer::TransferControlRequest_ControlType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::transfer::TransferControlRequest_ControlType>() {
@@ -6139,6 +17645,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::transfer::MessageType>() {
   return ::transfer::MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::transfer::ListingEncoding> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::transfer::ListingEncoding>() {
+  return ::transfer::ListingEncoding_descriptor();
+}
 template <> struct is_proto_enum< ::transfer::TransferStatus> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::transfer::TransferStatus>() {
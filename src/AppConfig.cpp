@@ -59,6 +59,46 @@ void AppConfig::setLastPort(quint16 port)
     m_settings.setValue("Network/LastPort", port);
 }
 
+int AppConfig::connectionProfile() const
+{
+    return m_settings.value("Network/ConnectionProfile", 0).toInt(); // 默认均衡
+}
+
+void AppConfig::setConnectionProfile(int profile)
+{
+    m_settings.setValue("Network/ConnectionProfile", profile);
+}
+
+int AppConfig::connectTimeout() const
+{
+    return m_settings.value("Network/ConnectTimeout", 10).toInt();
+}
+
+void AppConfig::setConnectTimeout(int seconds)
+{
+    m_settings.setValue("Network/ConnectTimeout", seconds);
+}
+
+bool AppConfig::useTls() const
+{
+    return m_settings.value("Network/UseTls", false).toBool(); // 默认不加密，兼容未启用TLS的服务端
+}
+
+void AppConfig::setUseTls(bool enabled)
+{
+    m_settings.setValue("Network/UseTls", enabled);
+}
+
+QString AppConfig::tlsCaFile() const
+{
+    return m_settings.value("Network/TlsCaFile", QString()).toString();
+}
+
+void AppConfig::setTlsCaFile(const QString& path)
+{
+    m_settings.setValue("Network/TlsCaFile", path);
+}
+
 int AppConfig::maxRetryCount() const
 {
     return m_settings.value("Transfer/MaxRetryCount", 3).toInt();
@@ -86,7 +126,68 @@ qint64 AppConfig::speedLimit() const
 
 void AppConfig::setSpeedLimit(qint64 bytesPerSecond)
 {
+    if (speedLimit() == bytesPerSecond) {
+        return;
+    }
     m_settings.setValue("Transfer/SpeedLimit", bytesPerSecond);
+    emit configChanged();  // 限速需要实时生效
+}
+
+qint64 AppConfig::serverSpeedLimit(const QString& host) const
+{
+    return m_settings.value("ServerSpeedLimit/" + host, 0).toLongLong();
+}
+
+void AppConfig::setServerSpeedLimit(const QString& host, qint64 bytesPerSecond)
+{
+    if (serverSpeedLimit(host) == bytesPerSecond) {
+        return;
+    }
+    m_settings.setValue("ServerSpeedLimit/" + host, bytesPerSecond);
+    emit configChanged();
+}
+
+QStringList AppConfig::knownServers() const
+{
+    QStringList servers = m_settings.value("Network/KnownServers").toStringList();
+    const QString prefix("ServerSpeedLimit/");
+    for (const QString& key : m_settings.allKeys()) {
+        QString host = key.mid(prefix.size());
+        if (key.startsWith(prefix) && !servers.contains(host)) {
+            servers.append(host);
+        }
+    }
+    return servers;
+}
+
+void AppConfig::addKnownServer(const QString& host)
+{
+    QStringList servers = m_settings.value("Network/KnownServers").toStringList();
+    if (host.isEmpty() || servers.contains(host)) {
+        return;
+    }
+    servers.append(host);
+    m_settings.setValue("Network/KnownServers", servers);
+}
+
+bool AppConfig::archiveTransfer() const
+{
+    return m_settings.value("Transfer/ArchiveMode", false).toBool();
+}
+
+void AppConfig::setArchiveTransfer(bool enable)
+{
+    m_settings.setValue("Transfer/ArchiveMode", enable);
+}
+
+bool AppConfig::archiveCompression() const
+{
+    return m_settings.value("Transfer/ArchiveCompression", true).toBool();
+}
+
+void AppConfig::setArchiveCompression(bool enable)
+{
+    m_settings.setValue("Transfer/ArchiveCompression", enable);
 }
 
 bool AppConfig::autoResume() const
@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QSettings>
 #include <QString>
+#include <QStringList>
 
 /**
  * @brief 应用程序配置管理类
@@ -26,6 +27,14 @@ public:
     void setLastHost(const QString& host);
     quint16 lastPort() const;
     void setLastPort(quint16 port);
+    int connectionProfile() const;        // ConnectionProfile取值
+    void setConnectionProfile(int profile);
+    int connectTimeout() const;           // 秒
+    void setConnectTimeout(int seconds);
+    bool useTls() const;
+    void setUseTls(bool enabled);
+    QString tlsCaFile() const;            // 为空时使用系统证书
+    void setTlsCaFile(const QString& path);
     
     // 传输设置
     int maxRetryCount() const;
@@ -34,6 +43,14 @@ public:
     void setRetryInterval(int msec);
     qint64 speedLimit() const;
     void setSpeedLimit(qint64 bytesPerSecond);
+    qint64 serverSpeedLimit(const QString& host) const;
+    void setServerSpeedLimit(const QString& host, qint64 bytesPerSecond);
+    QStringList knownServers() const;     // 连接过或设置过限速的服务器(连接时输入的主机名)
+    void addKnownServer(const QString& host);
+    bool archiveTransfer() const;
+    void setArchiveTransfer(bool enable);
+    bool archiveCompression() const;
+    void setArchiveCompression(bool enable);
     
     // 断点续传设置
     bool autoResume() const;
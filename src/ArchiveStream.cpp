@@ -0,0 +1,271 @@
+#include "ArchiveStream.h"
+#include "PathUtils.h"
+#include <algorithm>
+
+static const char ARCHIVE_MAGIC[] = "FCA1";
+static const char ARCHIVE_MAGIC_TRAILERS[] = "FCA2";
+static const size_t ARCHIVE_MAGIC_LENGTH = 4;
+static const size_t FILE_TRAILER_LENGTH = 5;
+static const uint64_t MAX_PATH_LENGTH = 4096;
+
+static const char ENTRY_DIRECTORY = 'D';
+static const char ENTRY_FILE = 'F';
+static const char ENTRY_END = 'E';
+static const char FILE_COMPLETE = 'K';
+static const char FILE_INVALID = 'X';
+
+// 标准CRC32(多项式0xEDB88320)，crc为上次的返回值，初始为0xffffffff，结果需取反
+static uint32_t updateCrc32(uint32_t crc, const char* data, size_t length)
+{
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady) {
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+        tableReady = true;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        crc = table[(crc ^ static_cast<unsigned char>(data[i])) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+ArchiveWriter::ArchiveWriter(bool trailers)
+    : m_trailers(trailers)
+    , m_crc(0xffffffffu)
+{
+    m_buffer.append(trailers ? ARCHIVE_MAGIC_TRAILERS : ARCHIVE_MAGIC, ARCHIVE_MAGIC_LENGTH);
+}
+
+void ArchiveWriter::putVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        m_buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    m_buffer.push_back(static_cast<char>(value));
+}
+
+void ArchiveWriter::putEntryHeader(char type, const std::string& path)
+{
+    m_buffer.push_back(type);
+    putVarint(path.size());
+    m_buffer.append(path);
+}
+
+void ArchiveWriter::addDirectory(const std::string& path)
+{
+    putEntryHeader(ENTRY_DIRECTORY, path);
+}
+
+void ArchiveWriter::beginFile(const std::string& path, uint64_t size)
+{
+    putEntryHeader(ENTRY_FILE, path);
+    putVarint(size);
+    m_crc = 0xffffffffu;
+}
+
+void ArchiveWriter::appendData(const char* data, size_t length)
+{
+    m_buffer.append(data, length);
+    if (m_trailers) {
+        m_crc = updateCrc32(m_crc, data, length);
+    }
+}
+
+void ArchiveWriter::endFile(bool complete)
+{
+    if (!m_trailers) {
+        return;
+    }
+    uint32_t crc = ~m_crc;
+    m_buffer.push_back(complete ? FILE_COMPLETE : FILE_INVALID);
+    for (int i = 0; i < 4; ++i) {
+        m_buffer.push_back(static_cast<char>((crc >> (8 * i)) & 0xff));
+    }
+}
+
+void ArchiveWriter::finish()
+{
+    m_buffer.push_back(ENTRY_END);
+}
+
+ArchiveReader::ArchiveReader(DirectoryCallback onDirectory, FileBeginCallback onFileBegin,
+    FileDataCallback onFileData, FileEndCallback onFileEnd)
+    : m_onDirectory(onDirectory)
+    , m_onFileBegin(onFileBegin)
+    , m_onFileData(onFileData)
+    , m_onFileEnd(onFileEnd)
+    , m_state(State::Magic)
+    , m_type(0)
+    , m_varint(0)
+    , m_varintShift(0)
+    , m_pathLength(0)
+    , m_remaining(0)
+    , m_trailers(false)
+    , m_crc(0xffffffffu)
+    , m_entryCount(0)
+{
+}
+
+bool ArchiveReader::fail(const std::string& error)
+{
+    m_state = State::Error;
+    m_error = error;
+    return false;
+}
+
+bool ArchiveReader::readVarint(const char*& data, const char* end, uint64_t& value)
+{
+    while (data < end) {
+        unsigned char byte = static_cast<unsigned char>(*data++);
+        if (m_varintShift >= 64) {
+            fail("varint overflow");
+            return false;
+        }
+        m_varint |= static_cast<uint64_t>(byte & 0x7f) << m_varintShift;
+        m_varintShift += 7;
+        if (!(byte & 0x80)) {
+            value = m_varint;
+            m_varint = 0;
+            m_varintShift = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 路径必须是相对路径，且每一级都不能为空、"."或".."
+// 路径读完后处理条目头
+bool ArchiveReader::finishEntryHeader()
+{
+    if (!isSafeRelativePath(m_path)) {
+        return fail("unsafe path in archive: " + m_path);
+    }
+    if (m_type == ENTRY_DIRECTORY) {
+        ++m_entryCount;
+        m_state = State::Type;
+        return m_onDirectory(m_path) || fail("failed to create directory: " + m_path);
+    }
+    m_state = State::FileSize;
+    return true;
+}
+
+// 文件数据(FCA2还有条目尾)读完后结束该条目，被标记为无效或校验和不符时以complete=false结束
+bool ArchiveReader::finishFile()
+{
+    bool complete = true;
+    if (m_trailers) {
+        uint32_t crc = 0;
+        for (int i = 0; i < 4; ++i) {
+            crc |= static_cast<uint32_t>(static_cast<unsigned char>(m_trailer[1 + i])) << (8 * i);
+        }
+        if (m_trailer[0] != FILE_COMPLETE && m_trailer[0] != FILE_INVALID) {
+            return fail("bad archive file trailer: " + m_path);
+        }
+        complete = m_trailer[0] == FILE_COMPLETE && crc == ~m_crc;
+    }
+    m_state = State::Type;
+    return m_onFileEnd(complete) || fail("failed to close file: " + m_path);
+}
+
+bool ArchiveReader::feed(const char* data, size_t length)
+{
+    const char* end = data + length;
+    while (data < end) {
+        switch (m_state) {
+        case State::Magic: {
+            size_t need = std::min<size_t>(ARCHIVE_MAGIC_LENGTH - m_magic.size(), end - data);
+            m_magic.append(data, need);
+            data += need;
+            if (m_magic.size() == ARCHIVE_MAGIC_LENGTH) {
+                m_trailers = m_magic == std::string(ARCHIVE_MAGIC_TRAILERS, ARCHIVE_MAGIC_LENGTH);
+                if (!m_trailers && m_magic != std::string(ARCHIVE_MAGIC, ARCHIVE_MAGIC_LENGTH)) {
+                    return fail("bad archive magic");
+                }
+                m_state = State::Type;
+            }
+            break;
+        }
+        case State::Type:
+            m_type = *data++;
+            if (m_type == ENTRY_END) {
+                m_state = State::Done;
+            } else if (m_type == ENTRY_DIRECTORY || m_type == ENTRY_FILE) {
+                m_state = State::PathLength;
+            } else {
+                return fail("bad archive entry type");
+            }
+            break;
+        case State::PathLength:
+            if (readVarint(data, end, m_pathLength)) {
+                if (m_pathLength == 0 || m_pathLength > MAX_PATH_LENGTH) {
+                    return fail("bad archive path length");
+                }
+                m_path.clear();
+                m_state = State::Path;
+            }
+            break;
+        case State::Path: {
+            size_t need = std::min<size_t>(m_pathLength - m_path.size(), end - data);
+            m_path.append(data, need);
+            data += need;
+            if (m_path.size() == m_pathLength && !finishEntryHeader()) {
+                return false;
+            }
+            break;
+        }
+        case State::FileSize:
+            if (readVarint(data, end, m_remaining)) {
+                ++m_entryCount;
+                if (!m_onFileBegin(m_path, m_remaining)) {
+                    return fail("failed to create file: " + m_path);
+                }
+                m_crc = 0xffffffffu;
+                m_state = State::FileData;
+            }
+            break;
+        case State::FileData: {
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(m_remaining, end - data));
+            if (chunk > 0 && !m_onFileData(data, chunk)) {
+                return fail("failed to write file: " + m_path);
+            }
+            if (m_trailers) {
+                m_crc = updateCrc32(m_crc, data, chunk);
+            }
+            data += chunk;
+            m_remaining -= chunk;
+            break;
+        }
+        case State::FileTrailer: {
+            size_t need = std::min<size_t>(FILE_TRAILER_LENGTH - m_trailer.size(), end - data);
+            m_trailer.append(data, need);
+            data += need;
+            if (m_trailer.size() == FILE_TRAILER_LENGTH && !finishFile()) {
+                return false;
+            }
+            break;
+        }
+        case State::Done:
+            return fail("data after end of archive");
+        case State::Error:
+            return false;
+        }
+
+        // 空文件没有数据，文件数据收完后立即结束该条目或开始读条目尾
+        if (m_state == State::FileData && m_remaining == 0) {
+            if (m_trailers) {
+                m_trailer.clear();
+                m_state = State::FileTrailer;
+            } else if (!finishFile()) {
+                return false;
+            }
+        }
+    }
+    return m_state != State::Error;
+}
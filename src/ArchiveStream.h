@@ -0,0 +1,120 @@
+#ifndef ARCHIVESTREAM_H
+#define ARCHIVESTREAM_H
+
+#include <string>
+#include <functional>
+#include <cstdint>
+
+/*
+ * 归档流格式(目录整体传输时使用)
+ *
+ *   流头:  "FCA1" 或 "FCA2"
+ *   条目:  类型(1字节) + 路径长度(varint) + 路径(UTF-8，'/'分隔的相对路径)
+ *          文件条目在路径后还有 文件大小(varint) + 文件数据
+ *          FCA2的文件条目在数据后还有 状态(1字节) + 数据的CRC32(4字节，小端序)
+ *   结束:  类型'E'
+ *
+ * 类型: 'D'目录 'F'文件 'E'结束；varint为LEB128无符号编码
+ * 状态: 'K'数据完整 'X'发送方读取中途出错(如文件变短)，数据不可用，接收方应丢弃该文件
+ * 目录条目总是先于其子条目出现
+ */
+
+/**
+ * @brief 归档流写入器
+ *
+ * 负责:
+ * 1. 把目录和文件条目按归档流格式写入内存缓冲区
+ * 2. 文件数据可以分多次追加，调用方按块取走缓冲区发送
+ * 3. 对端支持时(FCA2)在每个文件后写入状态和校验和，读取中途出错的文件可以标记为无效
+ */
+class ArchiveWriter
+{
+public:
+    // trailers为true时写FCA2格式，否则写FCA1
+    explicit ArchiveWriter(bool trailers = false);
+
+    // 添加目录条目
+    void addDirectory(const std::string& path);
+    // 开始一个文件条目，之后需要追加恰好size字节的数据
+    void beginFile(const std::string& path, uint64_t size);
+    // 追加当前文件的数据
+    void appendData(const char* data, size_t length);
+    // 结束当前文件条目；complete为false表示数据不完整，FCA2中标记为无效，FCA1无法标记
+    void endFile(bool complete);
+    // 写入结束标记
+    void finish();
+
+    // 缓冲区中待发送的数据
+    const std::string& data() const { return m_buffer; }
+    size_t size() const { return m_buffer.size(); }
+    // 数据发送后清空缓冲区
+    void clear() { m_buffer.clear(); }
+
+private:
+    void putVarint(uint64_t value);
+    void putEntryHeader(char type, const std::string& path);
+
+    std::string m_buffer;
+    bool m_trailers;
+    uint32_t m_crc;       // 当前文件已写入数据的CRC32(未取反)
+};
+
+/**
+ * @brief 归档流解析器
+ *
+ * 负责:
+ * 1. 增量解析归档流，数据可以按任意边界分块送入
+ * 2. 边解析边通过回调交出目录、文件头和文件数据，无需缓存整个文件
+ * 3. 拒绝绝对路径和包含".."的路径，防止写出目标目录
+ * 4. 兼容FCA1和FCA2，FCA2中被标记为无效或校验和不符的文件以complete=false结束
+ */
+class ArchiveReader
+{
+public:
+    typedef std::function<bool(const std::string& path)> DirectoryCallback;
+    typedef std::function<bool(const std::string& path, uint64_t size)> FileBeginCallback;
+    typedef std::function<bool(const char* data, size_t length)> FileDataCallback;
+    // complete为false时文件数据不可用，接收方应删除已写入的文件
+    typedef std::function<bool(bool complete)> FileEndCallback;
+
+    ArchiveReader(DirectoryCallback onDirectory, FileBeginCallback onFileBegin,
+        FileDataCallback onFileData, FileEndCallback onFileEnd);
+
+    // 送入一段数据，格式错误或回调返回false时返回false
+    bool feed(const char* data, size_t length);
+
+    // 是否已读到结束标记
+    bool isFinished() const { return m_state == State::Done; }
+    uint64_t entryCount() const { return m_entryCount; }
+    const std::string& errorString() const { return m_error; }
+
+private:
+    enum class State { Magic, Type, PathLength, Path, FileSize, FileData, FileTrailer, Done, Error };
+
+    // 增量解析varint，完成时返回true
+    bool readVarint(const char*& data, const char* end, uint64_t& value);
+    bool fail(const std::string& error);
+    bool finishEntryHeader();
+    bool finishFile();
+
+    DirectoryCallback m_onDirectory;
+    FileBeginCallback m_onFileBegin;
+    FileDataCallback m_onFileData;
+    FileEndCallback m_onFileEnd;
+
+    State m_state;
+    std::string m_magic;
+    char m_type;
+    uint64_t m_varint;
+    int m_varintShift;
+    uint64_t m_pathLength;
+    std::string m_path;
+    uint64_t m_remaining;     // 当前文件剩余字节数
+    bool m_trailers;          // 流头为FCA2，文件条目带状态和校验和
+    uint32_t m_crc;           // 当前文件已收到数据的CRC32(未取反)
+    std::string m_trailer;
+    uint64_t m_entryCount;
+    std::string m_error;
+};
+
+#endif // ARCHIVESTREAM_H
@@ -0,0 +1,154 @@
+#include "BandwidthLimiter.h"
+#include <thread>
+#include <algorithm>
+
+// 最小突发容量，避免限速很低时桶容量小于一个网络包
+static const double MIN_BURST_BYTES = 64 * 1024;
+// 单次睡眠上限，保证修改速率后能及时生效
+static const double MAX_SLEEP_SECONDS = 0.1;
+
+BandwidthLimiter& BandwidthLimiter::instance()
+{
+    static BandwidthLimiter limiter;
+    return limiter;
+}
+
+BandwidthLimiter::BandwidthLimiter()
+{
+}
+
+BandwidthLimiter::Bucket::Bucket()
+    : rate(0)
+    , capacity(0)
+    , tokens(0)
+    , last(Clock::now())
+{
+}
+
+void BandwidthLimiter::Bucket::setRate(uint64_t bytesPerSecond, Clock::time_point now)
+{
+    refill(now);
+    rate = static_cast<double>(bytesPerSecond);
+    // 容量取0.25秒的流量，保证限速平滑
+    capacity = std::max(rate / 4, MIN_BURST_BYTES);
+    if (rate <= 0) {
+        tokens = 0;  // 取消限速时清掉欠账
+    } else if (tokens > capacity) {
+        tokens = capacity;
+    }
+}
+
+void BandwidthLimiter::Bucket::refill(Clock::time_point now)
+{
+    if (rate > 0) {
+        double elapsed = std::chrono::duration<double>(now - last).count();
+        tokens = std::min(capacity, tokens + elapsed * rate);
+    }
+    last = now;
+}
+
+double BandwidthLimiter::Bucket::waitSeconds() const
+{
+    if (rate <= 0 || tokens >= 0) {
+        return 0;
+    }
+    return -tokens / rate;
+}
+
+void BandwidthLimiter::setGlobalLimit(uint64_t bytesPerSecond)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_global.setRate(bytesPerSecond, Clock::now());
+}
+
+void BandwidthLimiter::setServerLimit(const std::string& server, uint64_t bytesPerSecond)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (bytesPerSecond == 0) {
+        m_servers.erase(server);
+        return;
+    }
+    m_servers[server].setRate(bytesPerSecond, Clock::now());
+}
+
+void BandwidthLimiter::setTaskLimit(const std::string& taskId, uint64_t bytesPerSecond)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (bytesPerSecond == 0) {
+        m_tasks.erase(taskId);
+        return;
+    }
+    m_tasks[taskId].setRate(bytesPerSecond, Clock::now());
+}
+
+void BandwidthLimiter::removeTask(const std::string& taskId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.erase(taskId);
+}
+
+uint64_t BandwidthLimiter::globalLimit() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<uint64_t>(m_global.rate);
+}
+
+double BandwidthLimiter::pendingWait(const std::string& server, const std::string& taskId,
+    Clock::time_point now)
+{
+    m_global.refill(now);
+    double wait = m_global.waitSeconds();
+
+    auto serverIt = m_servers.find(server);
+    if (serverIt != m_servers.end()) {
+        serverIt->second.refill(now);
+        wait = std::max(wait, serverIt->second.waitSeconds());
+    }
+
+    auto taskIt = m_tasks.find(taskId);
+    if (taskIt != m_tasks.end()) {
+        taskIt->second.refill(now);
+        wait = std::max(wait, taskIt->second.waitSeconds());
+    }
+    return wait;
+}
+
+void BandwidthLimiter::acquire(const std::string& server, const std::string& taskId, uint64_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // 没有任何限速时直接返回，保持零开销
+        if (m_global.rate <= 0 && m_servers.empty() && m_tasks.empty()) {
+            return;
+        }
+
+        // 先在三级令牌桶上记账，允许欠账
+        Clock::time_point now = Clock::now();
+        pendingWait(server, taskId, now);
+        double amount = static_cast<double>(bytes);
+        if (m_global.rate > 0) {
+            m_global.tokens -= amount;
+        }
+        auto serverIt = m_servers.find(server);
+        if (serverIt != m_servers.end()) {
+            serverIt->second.tokens -= amount;
+        }
+        auto taskIt = m_tasks.find(taskId);
+        if (taskIt != m_tasks.end()) {
+            taskIt->second.tokens -= amount;
+        }
+    }
+
+    // 分段睡眠直到欠账还清，期间速率变化会在下一轮重新计算
+    while (true) {
+        double wait;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            wait = pendingWait(server, taskId, Clock::now());
+        }
+        if (wait <= 0) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::duration<double>(std::min(wait, MAX_SLEEP_SECONDS)));
+    }
+}
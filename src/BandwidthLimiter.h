@@ -0,0 +1,68 @@
+#ifndef BANDWIDTHLIMITER_H
+#define BANDWIDTHLIMITER_H
+
+#include <string>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief 分层令牌桶限速器
+ *
+ * 负责:
+ * 1. 维护全局、服务器、任务三级令牌桶
+ * 2. 在收发路径上按字节申请额度，超额时在socket锁之外等待
+ * 3. 支持运行中修改速率，立即生效
+ * 4. 目录浏览等交互请求不经过限速器，避免被批量传输拖慢
+ */
+class BandwidthLimiter
+{
+public:
+    static BandwidthLimiter& instance();
+
+    // 设置全局限速(字节/秒)，0表示不限速
+    void setGlobalLimit(uint64_t bytesPerSecond);
+    // 设置指定服务器的限速，0表示不限速
+    void setServerLimit(const std::string& server, uint64_t bytesPerSecond);
+    // 设置指定任务的限速，0表示不限速
+    void setTaskLimit(const std::string& taskId, uint64_t bytesPerSecond);
+    // 任务结束后移除任务级令牌桶
+    void removeTask(const std::string& taskId);
+
+    uint64_t globalLimit() const;
+
+    // 申请bytes字节的传输额度，额度不足时阻塞到欠账还清
+    void acquire(const std::string& server, const std::string& taskId, uint64_t bytes);
+
+private:
+    BandwidthLimiter();
+    BandwidthLimiter(const BandwidthLimiter&) = delete;
+    BandwidthLimiter& operator=(const BandwidthLimiter&) = delete;
+
+    typedef std::chrono::steady_clock Clock;
+
+    // 单个令牌桶，令牌允许为负(欠账)，这样大分片可以一次发出，之后再等待
+    struct Bucket {
+        double rate;          // 速率(字节/秒)，0表示不限速
+        double capacity;      // 桶容量(突发上限)
+        double tokens;        // 当前令牌数
+        Clock::time_point last;
+
+        Bucket();
+        void setRate(uint64_t bytesPerSecond, Clock::time_point now);
+        void refill(Clock::time_point now);
+        // 还清欠账还需要等待的秒数
+        double waitSeconds() const;
+    };
+
+    // 计算当前三级令牌桶中最长的等待时间(调用方需持有锁)
+    double pendingWait(const std::string& server, const std::string& taskId, Clock::time_point now);
+
+    mutable std::mutex m_mutex;
+    Bucket m_global;
+    std::map<std::string, Bucket> m_servers;
+    std::map<std::string, Bucket> m_tasks;
+};
+
+#endif // BANDWIDTHLIMITER_H
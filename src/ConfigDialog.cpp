@@ -1,21 +1,33 @@
 #include "ConfigDialog.h"
+#include "TlsTransport.h"
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QLabel>
+#include <QSignalBlocker>
 
-ConfigDialog::ConfigDialog(QWidget *parent)
+ConfigDialog::ConfigDialog(QWidget *parent, const QString& currentServer)
     : QDialog(parent)
     , m_tabWidget(nullptr)
     , m_defaultHostEdit(nullptr)
     , m_defaultPortSpin(nullptr)
+    , m_connectionProfileCombo(nullptr)
+    , m_connectTimeoutSpin(nullptr)
+    , m_tlsCheck(nullptr)
+    , m_tlsCaFileEdit(nullptr)
     , m_retryCountSpin(nullptr)
     , m_retryIntervalSpin(nullptr)
     , m_speedLimitCombo(nullptr)
+    , m_speedLimitServerCombo(nullptr)
+    , m_serverSpeedLimitCombo(nullptr)
+    , m_archiveModeCheck(nullptr)
+    , m_archiveCompressCheck(nullptr)
     , m_autoResumeCheck(nullptr)
     , m_minResumeSizeCombo(nullptr)
     , m_localPathEdit(nullptr)
     , m_showHiddenCheck(nullptr)
     , m_okBtn(nullptr)
     , m_cancelBtn(nullptr)
+    , m_currentServer(currentServer)
 {
     setupUI();
     loadConfig();
@@ -65,9 +77,36 @@ void ConfigDialog::createNetworkTab()
     m_defaultHostEdit = new QLineEdit(networkTab);
     m_defaultPortSpin = new QSpinBox(networkTab);
     m_defaultPortSpin->setRange(1, 65535);
+
+    // 连接模式，取值与ConnectionProfile一致
+    m_connectionProfileCombo = new QComboBox(networkTab);
+    m_connectionProfileCombo->addItem(tr("均衡"), 0);
+    m_connectionProfileCombo->addItem(tr("低延迟(频繁浏览目录)"), 1);
+    m_connectionProfileCombo->addItem(tr("高吞吐(大文件、高延迟链路)"), 2);
+
+    m_connectTimeoutSpin = new QSpinBox(networkTab);
+    m_connectTimeoutSpin->setRange(1, 120);
+    m_connectTimeoutSpin->setSuffix(tr(" 秒"));
+
+    // 服务端需启用TLS，CA证书用于校验自签名的服务端证书
+    m_tlsCheck = new QCheckBox(tr("加密传输(TLS 1.3)"), networkTab);
+    m_tlsCaFileEdit = new QLineEdit(networkTab);
+    m_tlsCaFileEdit->setPlaceholderText(tr("留空使用系统证书"));
+    connect(m_tlsCheck, &QCheckBox::toggled, m_tlsCaFileEdit, &QLineEdit::setEnabled);
     
     layout->addRow(tr("默认主机:"), m_defaultHostEdit);
     layout->addRow(tr("默认端口:"), m_defaultPortSpin);
+    layout->addRow(tr("连接模式:"), m_connectionProfileCombo);
+    layout->addRow(tr("连接超时:"), m_connectTimeoutSpin);
+    layout->addRow(m_tlsCheck);
+    layout->addRow(tr("CA证书:"), m_tlsCaFileEdit);
+    if (!TlsTransport::kernelOffloadAvailable()) {
+        // 默认构建链接OpenSSL 1.1，没有kTLS，说明一下免得用户以为已由内核加解密
+        QLabel* ktlsNote = new QLabel(tr("当前版本使用的OpenSSL不支持内核TLS(kTLS)，加解密在程序内进行"), networkTab);
+        ktlsNote->setWordWrap(true);
+        ktlsNote->setEnabled(false);
+        layout->addRow("", ktlsNote);
+    }
     
     m_tabWidget->addTab(networkTab, tr("网络"));
 }
@@ -91,7 +130,22 @@ void ConfigDialog::createTransferTab()
     m_speedLimitCombo->addItem(tr("2 MB/s"), 2 * 1024 * 1024);
     m_speedLimitCombo->addItem(tr("5 MB/s"), 5 * 1024 * 1024);
     m_speedLimitCombo->addItem(tr("10 MB/s"), 10 * 1024 * 1024);
+
+    // 单独限制某台服务器的速度，与全局限速同时生效；服务器按连接时输入的主机名区分
+    m_speedLimitServerCombo = new QComboBox(transferTab);
+    m_speedLimitServerCombo->setEditable(true);
+    m_serverSpeedLimitCombo = new QComboBox(transferTab);
+    for (int i = 0; i < m_speedLimitCombo->count(); ++i) {
+        m_serverSpeedLimitCombo->addItem(m_speedLimitCombo->itemText(i), m_speedLimitCombo->itemData(i));
+    }
+    QHBoxLayout* serverLimitLayout = new QHBoxLayout;
+    serverLimitLayout->addWidget(m_speedLimitServerCombo, 1);
+    serverLimitLayout->addWidget(m_serverSpeedLimitCombo);
     
+    m_archiveModeCheck = new QCheckBox(tr("目录以归档流方式传输"), transferTab);
+    m_archiveCompressCheck = new QCheckBox(tr("压缩归档流"), transferTab);
+    connect(m_archiveModeCheck, &QCheckBox::toggled, m_archiveCompressCheck, &QCheckBox::setEnabled);
+
     m_autoResumeCheck = new QCheckBox(tr("自动断点续传"), transferTab);
     
     m_minResumeSizeCombo = new QComboBox(transferTab);
@@ -103,6 +157,9 @@ void ConfigDialog::createTransferTab()
     layout->addRow(tr("重试次数:"), m_retryCountSpin);
     layout->addRow(tr("重试间隔:"), m_retryIntervalSpin);
     layout->addRow(tr("速度限制:"), m_speedLimitCombo);
+    layout->addRow(tr("服务器限速:"), serverLimitLayout);
+    layout->addRow("", m_archiveModeCheck);
+    layout->addRow("", m_archiveCompressCheck);
     layout->addRow("", m_autoResumeCheck);
     layout->addRow(tr("最小续传大小:"), m_minResumeSizeCombo);
     
@@ -137,6 +194,12 @@ void ConfigDialog::loadConfig()
     // 网络设置
     m_defaultHostEdit->setText(config.lastHost());
     m_defaultPortSpin->setValue(config.lastPort());
+    int profileIndex = m_connectionProfileCombo->findData(config.connectionProfile());
+    m_connectionProfileCombo->setCurrentIndex(profileIndex >= 0 ? profileIndex : 0);
+    m_connectTimeoutSpin->setValue(config.connectTimeout());
+    m_tlsCheck->setChecked(config.useTls());
+    m_tlsCaFileEdit->setText(config.tlsCaFile());
+    m_tlsCaFileEdit->setEnabled(config.useTls());
     
     // 传输设置
     m_retryCountSpin->setValue(config.maxRetryCount());
@@ -144,6 +207,27 @@ void ConfigDialog::loadConfig()
     
     int speedLimitIndex = m_speedLimitCombo->findData(config.speedLimit());
     m_speedLimitCombo->setCurrentIndex(speedLimitIndex >= 0 ? speedLimitIndex : 0);
+
+    QStringList servers = config.knownServers();
+    if (!m_currentServer.isEmpty() && !servers.contains(m_currentServer)) {
+        servers.prepend(m_currentServer);
+    }
+    m_speedLimitServerCombo->addItems(servers);
+    m_speedLimitServerCombo->setCurrentText(m_currentServer.isEmpty() ? config.lastHost() : m_currentServer);
+    loadServerSpeedLimit();
+    // 切换服务器时显示它的限速，修改的限速记在对话框中，确定时一起保存
+    connect(m_speedLimitServerCombo, &QComboBox::currentTextChanged, this, &ConfigDialog::loadServerSpeedLimit);
+    connect(m_serverSpeedLimitCombo, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+        this, [this](int) {
+        QString host = m_speedLimitServerCombo->currentText().trimmed();
+        if (!host.isEmpty()) {
+            m_serverSpeedLimits[host] = m_serverSpeedLimitCombo->currentData().toLongLong();
+        }
+    });
+
+    m_archiveModeCheck->setChecked(config.archiveTransfer());
+    m_archiveCompressCheck->setChecked(config.archiveCompression());
+    m_archiveCompressCheck->setEnabled(config.archiveTransfer());
     
     m_autoResumeCheck->setChecked(config.autoResume());
     
@@ -155,6 +239,20 @@ void ConfigDialog::loadConfig()
     m_showHiddenCheck->setChecked(config.showHiddenFiles());
 }
 
+void ConfigDialog::loadServerSpeedLimit()
+{
+    QString host = m_speedLimitServerCombo->currentText().trimmed();
+    m_serverSpeedLimitCombo->setEnabled(!host.isEmpty());
+    qint64 limit = 0;
+    if (!host.isEmpty()) {
+        limit = m_serverSpeedLimits.contains(host) ? m_serverSpeedLimits.value(host)
+                                                   : AppConfig::instance().serverSpeedLimit(host);
+    }
+    int index = m_serverSpeedLimitCombo->findData(limit);
+    QSignalBlocker blocker(m_serverSpeedLimitCombo);
+    m_serverSpeedLimitCombo->setCurrentIndex(index >= 0 ? index : 0);
+}
+
 void ConfigDialog::saveConfig()
 {
     AppConfig& config = AppConfig::instance();
@@ -162,11 +260,20 @@ void ConfigDialog::saveConfig()
     // 网络设置
     config.setLastHost(m_defaultHostEdit->text());
     config.setLastPort(m_defaultPortSpin->value());
+    config.setConnectionProfile(m_connectionProfileCombo->currentData().toInt());
+    config.setConnectTimeout(m_connectTimeoutSpin->value());
+    config.setUseTls(m_tlsCheck->isChecked());
+    config.setTlsCaFile(m_tlsCaFileEdit->text().trimmed());
     
     // 传输设置
     config.setMaxRetryCount(m_retryCountSpin->value());
     config.setRetryInterval(m_retryIntervalSpin->value());
     config.setSpeedLimit(m_speedLimitCombo->currentData().toLongLong());
+    for (auto it = m_serverSpeedLimits.constBegin(); it != m_serverSpeedLimits.constEnd(); ++it) {
+        config.setServerSpeedLimit(it.key(), it.value());
+    }
+    config.setArchiveTransfer(m_archiveModeCheck->isChecked());
+    config.setArchiveCompression(m_archiveCompressCheck->isChecked());
     config.setAutoResume(m_autoResumeCheck->isChecked());
     config.setMinResumeSize(m_minResumeSizeCombo->currentData().toLongLong());
     
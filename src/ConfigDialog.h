@@ -10,6 +10,7 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QComboBox>
+#include <QMap>
 #include "AppConfig.h"
 
 /**
@@ -26,7 +27,8 @@ class ConfigDialog : public QDialog
     Q_OBJECT
     
 public:
-    explicit ConfigDialog(QWidget *parent = nullptr);
+    // currentServer为当前连接的服务器，服务器限速默认显示它
+    explicit ConfigDialog(QWidget *parent = nullptr, const QString& currentServer = QString());
     ~ConfigDialog();
 
 private slots:
@@ -39,17 +41,28 @@ private:
     void createUITab();
     void loadConfig();
     void saveConfig();
+    void loadServerSpeedLimit();
 
     QTabWidget* m_tabWidget;
     
     // 网络设置
     QLineEdit* m_defaultHostEdit;
     QSpinBox* m_defaultPortSpin;
+    QComboBox* m_connectionProfileCombo;
+    QSpinBox* m_connectTimeoutSpin;
+    QCheckBox* m_tlsCheck;
+    QLineEdit* m_tlsCaFileEdit;
     
     // 传输设置
     QSpinBox* m_retryCountSpin;
     QSpinBox* m_retryIntervalSpin;
     QComboBox* m_speedLimitCombo;
+    QComboBox* m_speedLimitServerCombo;   // 可编辑，列出连接过的服务器
+    QComboBox* m_serverSpeedLimitCombo;
+    QMap<QString, qint64> m_serverSpeedLimits; // 对话框中修改过的服务器限速，确定时保存
+    QString m_currentServer;
+    QCheckBox* m_archiveModeCheck;
+    QCheckBox* m_archiveCompressCheck;
     QCheckBox* m_autoResumeCheck;
     QComboBox* m_minResumeSizeCombo;
     
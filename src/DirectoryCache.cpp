@@ -0,0 +1,345 @@
+#include "DirectoryCache.h"
+#include <fstream>
+#include <cstdio>
+#include <ctime>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// 默认有效期和内存上限
+static const int DEFAULT_TTL_SECONDS = 30;
+static const size_t DEFAULT_MEMORY_LIMIT = 32 * 1024 * 1024;
+// 持久化文件格式版本，以及载入时忽略的过旧条目(7天)
+static const uint32_t PERSIST_VERSION = 1;
+static const uint64_t PERSIST_MAX_AGE_SECONDS = 7 * 24 * 3600;
+
+static uint64_t nowSeconds()
+{
+    return static_cast<uint64_t>(std::time(nullptr));
+}
+
+DirectoryCache& DirectoryCache::instance()
+{
+    static DirectoryCache cache;
+    return cache;
+}
+
+DirectoryCache::DirectoryCache()
+    : m_totalBytes(0)
+    , m_memoryLimit(DEFAULT_MEMORY_LIMIT)
+    , m_ttl(DEFAULT_TTL_SECONDS)
+    , m_changes(0)
+    , m_savedChanges(0)
+{
+}
+
+std::string DirectoryCache::normalizePath(const std::string& path)
+{
+    std::string result;
+    result.reserve(path.size());
+    for (char c : path) {
+        if (c == '/' && !result.empty() && result.back() == '/') {
+            continue;
+        }
+        result.push_back(c);
+    }
+    if (result.size() > 1 && result.back() == '/') {
+        result.pop_back();
+    }
+    return result;
+}
+
+std::string DirectoryCache::resolveRequestPath(const transfer::DirectoryRequest& request)
+{
+    std::string current = normalizePath(request.current_path());
+    if (request.is_parent()) {
+        if (current.empty()) {
+            return std::string();
+        }
+        size_t slash = current.find_last_of('/');
+        return (slash == std::string::npos || slash == 0) ? "/" : current.substr(0, slash);
+    }
+    if (current.empty()) {
+        return normalizePath(request.dir_name());  // dir_name为完整路径
+    }
+    if (request.dir_name().empty()) {
+        return current;
+    }
+    return normalizePath(current + "/" + request.dir_name());
+}
+
+std::string DirectoryCache::makeKey(const std::string& server, const std::string& path)
+{
+    return server + '\n' + path;
+}
+
+void DirectoryCache::erase(std::map<std::string, Entry>::iterator it)
+{
+    m_totalBytes -= it->second.bytes;
+    m_lru.erase(it->second.lru);
+    m_entries.erase(it);
+    ++m_changes;
+}
+
+bool DirectoryCache::lookup(const std::string& server, const std::string& path, transfer::DirectoryResponse& response,
+    bool* stale)
+{
+    if (path.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(makeKey(server, normalizePath(path)));
+    if (it == m_entries.end()) {
+        return false;
+    }
+    Entry& entry = it->second;
+    if (!entry.stale && Clock::now() - entry.storedAt > m_ttl) {
+        entry.stale = true;  // 过期后保留，等待重新验证
+    }
+    if (entry.stale && !stale) {
+        return false;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, entry.lru);
+    response = entry.response;
+    if (stale) {
+        *stale = entry.stale;
+    }
+    return true;
+}
+
+bool DirectoryCache::contains(const std::string& server, const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(makeKey(server, normalizePath(path)));
+    return it != m_entries.end() && !it->second.stale && Clock::now() - it->second.storedAt <= m_ttl;
+}
+
+void DirectoryCache::insert(const std::string& key, const transfer::DirectoryResponse& response, size_t bytes,
+    uint64_t storedAtSeconds, bool stale)
+{
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        erase(it);
+    }
+    m_lru.push_front(key);
+    ++m_changes;
+    Entry& entry = m_entries[key];
+    entry.response = response;
+    entry.bytes = bytes;
+    entry.storedAt = Clock::now();
+    entry.storedAtSeconds = storedAtSeconds;
+    entry.stale = stale;
+    entry.lru = m_lru.begin();
+    m_totalBytes += bytes;
+
+    // 超出内存上限时淘汰最久未使用的条目
+    while (m_totalBytes > m_memoryLimit && !m_lru.empty()) {
+        erase(m_entries.find(m_lru.back()));
+    }
+}
+
+void DirectoryCache::store(const std::string& server, const transfer::DirectoryResponse& response)
+{
+    std::string path = normalizePath(response.path());
+    // 增量响应不是完整列表，不能作为缓存
+    if (!response.header().success() || response.not_modified() || response.is_delta() || path.empty()) {
+        return;
+    }
+    std::string key = makeKey(server, path);
+    size_t bytes = response.ByteSizeLong() * 2 + key.size();  // 解析后的对象大约是编码大小的两倍
+    if (bytes > m_memoryLimit) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    insert(key, response, bytes, nowSeconds(), false);
+}
+
+void DirectoryCache::markFresh(const std::string& server, const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(makeKey(server, normalizePath(path)));
+    if (it != m_entries.end()) {
+        it->second.stale = false;
+        it->second.storedAt = Clock::now();
+        it->second.storedAtSeconds = nowSeconds();
+        ++m_changes;
+    }
+}
+
+void DirectoryCache::invalidate(const std::string& server, const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(makeKey(server, normalizePath(path)));
+    if (it != m_entries.end()) {
+        erase(it);
+    }
+}
+
+void DirectoryCache::invalidateTree(const std::string& server, const std::string& path)
+{
+    std::string root = normalizePath(path);
+    std::string prefix = makeKey(server, root == "/" ? std::string() : root);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // 键按字典序排列，目录及其子目录的键都以prefix开头
+    auto it = m_entries.lower_bound(prefix);
+    while (it != m_entries.end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+        const std::string& key = it->first;
+        bool inTree = key.size() == prefix.size() || key[prefix.size()] == '/';
+        auto next = std::next(it);
+        if (inTree) {
+            erase(it);
+        }
+        it = next;
+    }
+}
+
+void DirectoryCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+    m_totalBytes = 0;
+    m_homePaths.clear();
+}
+
+void DirectoryCache::setTimeToLive(int seconds)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ttl = std::chrono::seconds(seconds);
+}
+
+void DirectoryCache::setMemoryLimit(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryLimit = bytes;
+    while (m_totalBytes > m_memoryLimit && !m_lru.empty()) {
+        erase(m_entries.find(m_lru.back()));
+    }
+}
+
+void DirectoryCache::setPersistDirectory(const std::string& directory)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_persistDir = directory;
+}
+
+std::string DirectoryCache::persistFile(const std::string& server) const
+{
+    // 服务器地址中的':'等字符不能出现在文件名中
+    std::string name;
+    for (char c : server) {
+        bool safe = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '.' || c == '-';
+        name.push_back(safe ? c : '_');
+    }
+    return m_persistDir + "/listing_" + name + ".cache";
+}
+
+std::string DirectoryCache::homePath(const std::string& server)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_homePaths.find(server);
+    return it == m_homePaths.end() ? std::string() : it->second;
+}
+
+void DirectoryCache::setHomePath(const std::string& server, const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_homePaths[server] = normalizePath(path);
+}
+
+bool DirectoryCache::loadPersistent(const std::string& server)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_persistDir.empty()) {
+        return false;
+    }
+    std::ifstream in(persistFile(server), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    transfer::ListingCacheFile file;
+    if (!file.ParseFromIstream(&in) || file.version() != PERSIST_VERSION || file.server() != server) {
+        return false;
+    }
+
+    if (!file.home_path().empty()) {
+        m_homePaths[server] = file.home_path();
+    }
+    uint64_t now = nowSeconds();
+    // 文件中最近使用的在前，倒序插入使其在LRU中也排在前面
+    for (int i = file.listings_size() - 1; i >= 0; --i) {
+        const auto& listing = file.listings(i);
+        std::string path = normalizePath(listing.response().path());
+        if (path.empty() || listing.stored_at() + PERSIST_MAX_AGE_SECONDS < now) {
+            continue;
+        }
+        std::string key = makeKey(server, path);
+        // 内存中已有的条目比磁盘上的新
+        if (m_entries.find(key) != m_entries.end()) {
+            continue;
+        }
+        size_t bytes = listing.response().ByteSizeLong() * 2 + key.size();
+        insert(key, listing.response(), bytes, listing.stored_at(), true);
+    }
+    return true;
+}
+
+bool DirectoryCache::hasUnsavedChanges()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_changes != m_savedChanges;
+}
+
+bool DirectoryCache::savePersistent(const std::string& server)
+{
+    std::lock_guard<std::mutex> saveLock(m_saveMutex);
+    transfer::ListingCacheFile file;
+    std::string target;
+    uint64_t changes;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_persistDir.empty()) {
+            return false;
+        }
+        changes = m_changes;
+        target = persistFile(server);
+        file.set_version(PERSIST_VERSION);
+        file.set_server(server);
+        auto home = m_homePaths.find(server);
+        if (home != m_homePaths.end()) {
+            file.set_home_path(home->second);
+        }
+        // 按最近使用顺序写出
+        std::string prefix = makeKey(server, std::string());
+        for (const std::string& key : m_lru) {
+            if (key.compare(0, prefix.size(), prefix) != 0) {
+                continue;
+            }
+            const Entry& entry = m_entries.find(key)->second;
+            auto* listing = file.add_listings();
+            *listing->mutable_response() = entry.response;
+            listing->set_stored_at(entry.storedAtSeconds);
+        }
+    }
+
+    // 先写临时文件再替换，写到一半退出不会损坏旧文件
+    std::string temp = target + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out || !file.SerializeToOstream(&out)) {
+            return false;
+        }
+    }
+    // 直接替换旧文件，不先删除，任何时刻磁盘上都有一份完整的文件
+#ifdef _WIN32
+    bool replaced = MoveFileExA(temp.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool replaced = std::rename(temp.c_str(), target.c_str()) == 0;
+#endif
+    if (replaced) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_savedChanges = changes;
+    }
+    return replaced;
+}
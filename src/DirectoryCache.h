@@ -0,0 +1,101 @@
+#ifndef DIRECTORYCACHE_H
+#define DIRECTORYCACHE_H
+
+#include <string>
+#include <map>
+#include <list>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include "../protos/transfer.pb.h"
+
+/**
+ * @brief 远程目录列表缓存
+ *
+ * 负责:
+ * 1. 按 服务器+路径 缓存目录响应，来回切换目录时无需再请求服务端
+ * 2. 条目超过有效期后失效
+ * 3. 本客户端修改远端目录(上传、建目录)后显式失效
+ * 4. 按内存上限淘汰最久未使用的条目
+ * 5. 按服务器持久化到磁盘，重连后先显示上次的列表，再在后台用etag重新验证
+ * 6. 过期条目不立即丢弃而是标记为待验证，重新验证时服务端未变化则直接沿用
+ */
+class DirectoryCache
+{
+public:
+    static DirectoryCache& instance();
+
+    // 查找缓存；stale为空时只返回未过期的条目，否则也返回待验证的条目并通过stale标明
+    bool lookup(const std::string& server, const std::string& path, transfer::DirectoryResponse& response,
+        bool* stale = nullptr);
+    // 缓存成功的目录响应，路径取响应中的path
+    void store(const std::string& server, const transfer::DirectoryResponse& response);
+    // 是否有未过期的条目
+    bool contains(const std::string& server, const std::string& path);
+    // 重新验证后服务端确认未变化，条目恢复为未过期
+    void markFresh(const std::string& server, const std::string& path);
+
+    // 使单个目录失效
+    void invalidate(const std::string& server, const std::string& path);
+    // 使目录及其所有子目录失效
+    void invalidateTree(const std::string& server, const std::string& path);
+    void clear();
+
+    void setTimeToLive(int seconds);
+    void setMemoryLimit(size_t bytes);
+
+    // 持久化文件所在目录，为空时不持久化
+    void setPersistDirectory(const std::string& directory);
+    // 从磁盘载入服务器的缓存，载入的条目均为待验证
+    bool loadPersistent(const std::string& server);
+    // 把服务器的缓存写入磁盘
+    bool savePersistent(const std::string& server);
+    // 上次保存后缓存是否有变化，用于定期保存
+    bool hasUnsavedChanges();
+    // 连接后默认进入的目录(上次载入或请求得到)，未知时返回空
+    std::string homePath(const std::string& server);
+    void setHomePath(const std::string& server, const std::string& path);
+
+    // 规范化路径：合并重复的'/'，去掉末尾的'/'
+    static std::string normalizePath(const std::string& path);
+    // 由目录请求推算目标路径，无法推算(如首次连接的默认目录)时返回空
+    static std::string resolveRequestPath(const transfer::DirectoryRequest& request);
+
+private:
+    DirectoryCache();
+    DirectoryCache(const DirectoryCache&) = delete;
+    DirectoryCache& operator=(const DirectoryCache&) = delete;
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct Entry {
+        transfer::DirectoryResponse response;
+        size_t bytes;                          // 估算的内存占用
+        Clock::time_point storedAt;
+        uint64_t storedAtSeconds;              // 缓存时间(Unix秒)，持久化用
+        bool stale;                            // 已过期或来自磁盘，使用前需重新验证
+        std::list<std::string>::iterator lru;  // 在LRU链表中的位置
+    };
+
+    static std::string makeKey(const std::string& server, const std::string& path);
+    std::string persistFile(const std::string& server) const;
+    // 删除条目(调用方需持有锁)
+    void erase(std::map<std::string, Entry>::iterator it);
+    // 插入条目并按内存上限淘汰(调用方需持有锁)
+    void insert(const std::string& key, const transfer::DirectoryResponse& response, size_t bytes,
+        uint64_t storedAtSeconds, bool stale);
+
+    std::mutex m_mutex;
+    std::mutex m_saveMutex;           // 串行化写文件，定期保存与断开时的保存可能同时进行
+    std::map<std::string, Entry> m_entries;
+    std::list<std::string> m_lru;     // 队首为最近使用
+    size_t m_totalBytes;
+    size_t m_memoryLimit;
+    std::chrono::seconds m_ttl;
+    std::string m_persistDir;
+    std::map<std::string, std::string> m_homePaths;  // 服务器 -> 默认目录
+    uint64_t m_changes;               // 条目每次增删改加1
+    uint64_t m_savedChanges;          // 上次保存时的m_changes
+};
+
+#endif // DIRECTORYCACHE_H
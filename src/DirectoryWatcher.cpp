@@ -0,0 +1,193 @@
+#include "DirectoryWatcher.h"
+#include "DirectoryCache.h"
+#include "Net_Tool.h"
+#include <thread>
+#include <vector>
+
+// 推送合并窗口：窗口内同一目录的多条推送只更新一次界面
+static const int CHANGE_FLUSH_INTERVAL_MS = 200;
+// 快速切换目录时只发最后一次订阅
+static const int SUBSCRIBE_DELAY_MS = 100;
+// 订阅失败后重试的间隔
+static const int SUBSCRIBE_RETRY_MS = 5000;
+
+DirectoryWatcher& DirectoryWatcher::instance()
+{
+    static DirectoryWatcher watcher;
+    return watcher;
+}
+
+DirectoryWatcher::DirectoryWatcher()
+    : QObject(nullptr)
+    , m_sending(false)
+{
+    qRegisterMetaType<transfer::ChangeNotification>("transfer::ChangeNotification");
+    qRegisterMetaType<transfer::DirectoryResponse>("transfer::DirectoryResponse");
+
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(CHANGE_FLUSH_INTERVAL_MS);
+    connect(&m_flushTimer, &QTimer::timeout, this, &DirectoryWatcher::flushChanges);
+    m_subscribeTimer.setSingleShot(true);
+    m_subscribeTimer.setInterval(SUBSCRIBE_DELAY_MS);
+    connect(&m_subscribeTimer, &QTimer::timeout, this, &DirectoryWatcher::sendSubscription);
+
+    // 推送在网络线程中到达，转到GUI线程合并
+    Net_Tool::getInstance()->setChangeCallback([this](const transfer::ChangeNotification& notification) {
+        QMetaObject::invokeMethod(this, "enqueueChange", Qt::QueuedConnection,
+            Q_ARG(transfer::ChangeNotification, notification));
+    });
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+    Net_Tool::getInstance()->setChangeCallback(nullptr);
+}
+
+void DirectoryWatcher::watch(QObject* owner, const QString& path)
+{
+    auto it = m_owners.find(owner);
+    if (it == m_owners.end()) {
+        connect(owner, &QObject::destroyed, this, [this, owner]() { unwatch(owner); });
+        m_owners[owner] = path;
+    } else if (it->second == path) {
+        return;
+    } else {
+        it->second = path;
+    }
+    scheduleSubscription();
+}
+
+void DirectoryWatcher::unwatch(QObject* owner)
+{
+    if (m_owners.erase(owner) > 0) {
+        scheduleSubscription();
+    }
+}
+
+void DirectoryWatcher::reset()
+{
+    m_owners.clear();
+    m_subscribed.clear();
+    m_pending.clear();
+    m_flushTimer.stop();
+    m_subscribeTimer.stop();
+}
+
+void DirectoryWatcher::resubscribe()
+{
+    std::set<QString> subscribed;
+    subscribed.swap(m_subscribed);
+    m_pending.clear();
+    m_flushTimer.stop();
+    for (const QString& path : subscribed) {
+        emit directoryInvalidated(path);
+    }
+    scheduleSubscription();
+}
+
+void DirectoryWatcher::scheduleSubscription()
+{
+    m_subscribeTimer.start();
+}
+
+void DirectoryWatcher::sendSubscription()
+{
+    if (m_sending) {
+        return;  // 在途的订阅完成后再比较
+    }
+    std::set<QString> paths;
+    for (const auto& owner : m_owners) {
+        if (!owner.second.isEmpty()) {
+            paths.insert(QString::fromStdString(DirectoryCache::normalizePath(owner.second.toStdString())));
+        }
+    }
+    // 服务端不支持推送时不订阅，传输完成后由本端主动刷新
+    if (paths == m_subscribed || !Net_Tool::getInstance()->isConnected()
+        || !Net_Tool::getInstance()->hasFeature(FEATURE_WATCH)) {
+        return;
+    }
+
+    m_sending = true;
+    m_subscribed = paths;
+    std::vector<std::string> list;
+    for (const QString& path : paths) {
+        list.push_back(path.toStdString());
+    }
+    std::thread([list]() {
+        bool ok = Net_Tool::getInstance()->watchDirectories(list);
+        QMetaObject::invokeMethod(&DirectoryWatcher::instance(), "subscriptionDone", Qt::QueuedConnection,
+            Q_ARG(bool, ok));
+    }).detach();
+}
+
+void DirectoryWatcher::subscriptionDone(bool ok)
+{
+    m_sending = false;
+    if (!ok) {
+        // 订阅未生效，传输完成后仍主动刷新(见Net_Tool::refreshRemoteDirectory)，稍后重试
+        m_subscribed.clear();
+        QTimer::singleShot(SUBSCRIBE_RETRY_MS, this, &DirectoryWatcher::sendSubscription);
+        return;
+    }
+    // 请求在途期间视图切换了目录，按最新的目录再订阅一次
+    sendSubscription();
+}
+
+void DirectoryWatcher::enqueueChange(const transfer::ChangeNotification& notification)
+{
+    std::string path = DirectoryCache::normalizePath(notification.path());
+    auto it = m_pending.find(path);
+    if (it == m_pending.end()) {
+        PendingChange change;
+        change.baseVersion = notification.base_version();
+        change.version = notification.base_version();
+        change.complete = notification.base_version() != 0;
+        it = m_pending.insert(std::make_pair(path, change)).first;
+    }
+
+    // 版本首尾相接的推送才能合成一个增量，后到的变化覆盖先到的
+    PendingChange& change = it->second;
+    if (notification.version() == 0 || notification.base_version() != change.version) {
+        change.complete = false;
+    }
+    change.version = notification.version();
+    for (const auto& name : notification.removed()) {
+        change.changed.erase(name);
+        change.removed.insert(name);
+    }
+    for (const auto& file : notification.changed()) {
+        change.removed.erase(file.name());
+        change.changed[file.name()] = file;
+    }
+
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+void DirectoryWatcher::flushChanges()
+{
+    std::map<std::string, PendingChange> pending;
+    pending.swap(m_pending);
+    for (const auto& item : pending) {
+        const PendingChange& change = item.second;
+        if (!change.complete) {
+            emit directoryInvalidated(QString::fromStdString(item.first));
+            continue;
+        }
+        transfer::DirectoryResponse delta;
+        delta.mutable_header()->set_type(transfer::DIRECTORY);
+        delta.mutable_header()->set_success(true);
+        delta.set_path(item.first);
+        delta.set_is_delta(true);
+        delta.set_base_version(change.baseVersion);
+        delta.set_version(change.version);
+        for (const auto& file : change.changed) {
+            *delta.add_files() = file.second;
+        }
+        for (const auto& name : change.removed) {
+            delta.add_removed(name);
+        }
+        emit directoryChanged(delta);
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef DIRECTORYWATCHER_H
+#define DIRECTORYWATCHER_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QString>
+#include <QTimer>
+#include <map>
+#include <set>
+#include <string>
+#include "RemoteDirectoryLoader.h"
+#include "../protos/transfer.pb.h"
+
+Q_DECLARE_METATYPE(transfer::ChangeNotification)
+
+/**
+ * @brief 远程目录变化订阅
+ *
+ * 负责:
+ * 1. 汇总各远程视图当前查看的目录，变化时向服务端重新订阅
+ * 2. 接收服务端推送的目录变化，按目录合并一段时间内的多条推送
+ * 3. 合并后的变化以增量形式交给视图就地更新，版本不连续时通知视图重新加载
+ */
+class DirectoryWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    static DirectoryWatcher& instance();
+
+    // 视图owner当前查看path，取代owner之前的订阅；owner销毁时自动取消
+    void watch(QObject* owner, const QString& path);
+    void unwatch(QObject* owner);
+    // 断开连接后清空订阅和未处理的变化
+    void reset();
+    // 自动重连后重新订阅，断线期间错过的变化通过重新加载已订阅的目录补上
+    void resubscribe();
+
+signals:
+    // 一个目录的合并增量(is_delta为true的目录响应)
+    void directoryChanged(const transfer::DirectoryResponse& delta);
+    // 变化无法以增量表示，需重新加载该目录
+    void directoryInvalidated(const QString& path);
+
+private slots:
+    void enqueueChange(const transfer::ChangeNotification& notification);
+    void flushChanges();
+    void sendSubscription();
+    void subscriptionDone(bool ok);
+
+private:
+    DirectoryWatcher();
+    ~DirectoryWatcher();
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    // 订阅的目录有变化时安排重新订阅
+    void scheduleSubscription();
+
+    // 一个目录待合并的变化
+    struct PendingChange {
+        quint64 baseVersion;     // 第一条推送的变化前版本
+        quint64 version;         // 最后一条推送的变化后版本
+        bool complete;           // 推送的版本首尾相接，可以合成增量
+        std::map<std::string, transfer::DirectoryResponse::FileInfo> changed;
+        std::set<std::string> removed;
+    };
+
+    std::map<QObject*, QString> m_owners;         // 视图 -> 查看的目录
+    std::set<QString> m_subscribed;               // 已向服务端订阅的目录
+    std::map<std::string, PendingChange> m_pending;
+    QTimer m_flushTimer;       // 推送合并窗口
+    QTimer m_subscribeTimer;   // 切换目录时合并多次订阅
+    bool m_sending;            // 订阅请求是否在途
+};
+
+#endif // DIRECTORYWATCHER_H
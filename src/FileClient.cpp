@@ -1,5 +1,14 @@
 #include <QDebug>
+#include <QStandardPaths>
+#include <QDir>
+#include <QTimer>
 #include "FileClient.h"
+#include "DirectoryCache.h"
+#include "DirectoryWatcher.h"
+#include "RefreshCoordinator.h"
+
+// 连接期间保存目录缓存的间隔
+static const int DIRECTORY_CACHE_SAVE_INTERVAL_MS = 60000;
 
 Net_Tool* FileClient::m_netTool = Net_Tool::getInstance();
 
@@ -21,6 +30,7 @@ FileClient::FileClient(QWidget *parent)
     , m_downloadAction(nullptr)
     , m_onTopButton(nullptr)
     , m_isOnTop(false)
+    , m_connecting(false)
     //, m_netTool(Net_Tool::getInstance())
 {
     // 设置窗口标题和大小
@@ -86,10 +96,47 @@ FileClient::FileClient(QWidget *parent)
                            Qt::QueuedConnection);
     
     //qDebug() << "Signal-slot connection established:" << connected;
+
+    // 远程目录列表按服务器持久化，重连后可立即显示
+    QString dataPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dataPath);
+    DirectoryCache::instance().setPersistDirectory(dataPath.toLocal8Bit().toStdString());
+    // 连接期间定期保存目录缓存，程序异常退出时不至于丢失整个会话的列表；写文件在后台进行
+    QTimer* cacheSaveTimer = new QTimer(this);
+    cacheSaveTimer->setInterval(DIRECTORY_CACHE_SAVE_INTERVAL_MS);
+    connect(cacheSaveTimer, &QTimer::timeout, this, []() {
+        std::string server = m_netTool->serverAddress();
+        if (m_netTool->isConnected() && !server.empty() && DirectoryCache::instance().hasUnsavedChanges()) {
+            std::thread([server]() { DirectoryCache::instance().savePersistent(server); }).detach();
+        }
+    });
+    cacheSaveTimer->start();
+
+    // 传输完成后的远端目录刷新按目录节流，在GUI线程执行
+    connect(&RefreshCoordinator::instance(), &RefreshCoordinator::refreshDue,
+            m_remoteView, &FileListView::refreshRemotePath);
+
+    // 限速配置变更后立即生效
+    applySpeedLimits();
+    connect(&AppConfig::instance(), &AppConfig::configChanged, this, &FileClient::applySpeedLimits);
+
+    // 任务管理器中调整优先级后同步到网络层调度器
+    connect(&TransferQueue::instance(), &TransferQueue::taskPriorityChanged,
+            this, [](const QString& taskId, TransferPriority priority) {
+        m_netTool->setTaskPriority(taskId.toStdString(), priority);
+    });
+    connect(&TransferQueue::instance(), &TransferQueue::taskSpeedLimitChanged,
+            this, [](const QString& taskId, qint64 bytesPerSecond) {
+        m_netTool->setTaskSpeedLimit(taskId.toStdString(), static_cast<uint64_t>(qMax<qint64>(0, bytesPerSecond)));
+    });
 }
 
 FileClient::~FileClient()
 {
+    // 退出前保存远程目录缓存
+    if (m_netTool->isConnected()) {
+        DirectoryCache::instance().savePersistent(m_netTool->serverAddress());
+    }
     // Qt的父子对象系统会自动删除子对象
 }
 
@@ -104,6 +151,7 @@ void FileClient::initMenuBar()
     fileMenu->addSeparator();
     fileMenu->addAction(tr("设置(&S)"), this, &FileClient::showConfig);
     fileMenu->addAction(tr("历史记录(&H)"), this, &FileClient::showHistory);
+    fileMenu->addAction(tr("搜索远程文件(&F)"), this, &FileClient::showSearch);
     fileMenu->addSeparator();
     fileMenu->addAction(tr("退出(&Q)"));
     
@@ -272,33 +320,49 @@ void FileClient::initCentralWidget()
 
 void FileClient::handleConnect()
 {
+    if (m_connecting) {
+        return;
+    }
+
     // 从地址栏获取服务器地址和端口
-    QString serverIP = m_addressBar->host();
+    QString serverIP = m_addressBar->host().trimmed();
     uint16_t port = m_addressBar->port();
-    
-    // 使用Net_Tool连接服务器
-    if (m_netTool->connectToServer(serverIP.toStdString(), port)) {
+
+    // 错误可能在连接线程和传输线程中报告，转到GUI线程显示
+    m_netTool->setErrorCallback([this](const std::string& error) {
+        QMetaObject::invokeMethod(m_logWidget, "appendLog", Qt::QueuedConnection,
+            Q_ARG(QString, QString::fromStdString(error)), Q_ARG(bool, true));
+    });
+    m_netTool->setConnectionStateCallback([this](bool connected) {
+        QMetaObject::invokeMethod(this, "onConnectionStateChanged", Qt::QueuedConnection,
+            Q_ARG(bool, connected));
+    });
+    AppConfig& config = AppConfig::instance();
+    m_netTool->setConnectionProfile(static_cast<ConnectionProfile>(config.connectionProfile()));
+    m_netTool->setConnectTimeout(config.connectTimeout() * 1000);
+    m_netTool->setTls(config.useTls(), config.tlsCaFile().toLocal8Bit().toStdString());
+
+    // 解析域名和建立连接可能耗时数秒，在后台线程中进行，不阻塞界面
+    m_connecting = true;
+    m_connectAction->setEnabled(false);
+    m_logWidget->appendLog(tr("正在连接服务器 %1:%2...").arg(serverIP).arg(port));
+    std::thread([this, serverIP, port]() {
+        bool ok = m_netTool->connectToServer(serverIP.toStdString(), port);
+        QMetaObject::invokeMethod(this, "onConnectFinished", Qt::QueuedConnection,
+            Q_ARG(bool, ok), Q_ARG(QString, serverIP), Q_ARG(int, port));
+    }).detach();
+}
+
+void FileClient::onConnectFinished(bool ok, const QString& serverIP, int port)
+{
+    m_connecting = false;
+    if (ok) {
         // 更新UI状态
         m_connectAction->setEnabled(false);
         m_disconnectAction->setEnabled(true);
         m_uploadAction->setEnabled(true);
         m_downloadAction->setEnabled(true);
 
-        // 发送目录请求报文
-        transfer::DirectoryRequest request;
-        request.mutable_header()->set_type(transfer::DIRECTORY);
-        request.set_current_path("");
-        request.set_dir_name("");
-        request.set_is_parent(false);
-        
-        //同步，等服务端响应
-        transfer::DirectoryResponse response = m_netTool->sendDirectoryRequest(request);
-
-        // 设置错误回调
-        m_netTool->setErrorCallback([this](const std::string& error) {
-            m_logWidget->appendLog(QString::fromStdString(error), true);
-        });
-
         // 将远程视图添加到分割器中并显示
         if (!m_remoteView->isVisible()) {
             m_hSplitter->addWidget(m_remoteView);
@@ -306,21 +370,57 @@ void FileClient::handleConnect()
             m_remoteView->show();
         }
 
+        // 应用该服务器的限速，限速按连接时输入的主机名保存
+        m_connectedHost = serverIP;
+        AppConfig::instance().addKnownServer(serverIP);
+        applySpeedLimits();
+
         // 添加或更新服务器标签页
         QString serverAddress = QString("%1:%2").arg(serverIP).arg(port);
         m_remoteView->addServerTab(serverAddress, "/");
 
-        m_remoteView->dispatchRemoteResponse(response);
+        // 载入上次保存的目录列表，已知默认目录时直接从缓存显示，随后在后台重新验证
+        DirectoryCache::instance().loadPersistent(m_netTool->serverAddress());
+        std::string homePath = DirectoryCache::instance().homePath(m_netTool->serverAddress());
+
+        // 异步加载根目录，不阻塞界面
+        transfer::DirectoryRequest request;
+        request.mutable_header()->set_type(transfer::DIRECTORY);
+        request.set_current_path("");
+        request.set_dir_name(homePath);
+        request.set_is_parent(false);
+        m_remoteView->loadRemoteDirectory(request);
         
         m_logWidget->appendLog(tr("成功连接到服务器 %1:%2").arg(serverIP).arg(port));
+        if (m_netTool->isEncrypted()) {
+            const TlsTransport& tls = m_netTool->tls();
+            m_logWidget->appendLog(tr("连接已加密(TLS 1.3%1%2)")
+                .arg(tls.sessionResumed() ? tr("，会话恢复") : QString())
+                .arg(tls.kernelSend() ? tr("，内核加密") : QString()));
+        }
     } else {
+        m_connectAction->setEnabled(true);
         m_logWidget->appendLog(tr("连接服务器失败"), true);
     }
 }
 
+void FileClient::onConnectionStateChanged(bool connected)
+{
+    if (!connected) {
+        m_logWidget->appendLog(tr("与服务器的连接中断，正在重连..."), true);
+        return;
+    }
+    // 进行中的传输由网络层从断点续传，这里只恢复目录订阅
+    DirectoryWatcher::instance().resubscribe();
+    m_logWidget->appendLog(tr("已重新连接到服务器 %1").arg(QString::fromStdString(m_netTool->serverAddress())));
+}
+
 void FileClient::handleDisconnect()
 {
+    DirectoryCache::instance().savePersistent(m_netTool->serverAddress());
+    DirectoryWatcher::instance().reset();
     m_netTool->disconnect();
+    m_connectedHost.clear();
     
     // 更新UI状态
     m_connectAction->setEnabled(true);
@@ -418,7 +518,7 @@ void FileClient::showTaskManager()
 
 void FileClient::showConfig()
 {
-    ConfigDialog dialog(this);
+    ConfigDialog dialog(this, m_connectedHost);
     dialog.exec();
 }
 
@@ -428,6 +528,18 @@ void FileClient::showHistory()
     dialog.exec();
 }
 
+void FileClient::showSearch()
+{
+    if (!m_remoteView->isVisible()) {
+        m_logWidget->appendLog(tr("请先连接到远程服务器"), true);
+        return;
+    }
+    // 非模态，搜索期间仍可操作主窗口
+    SearchDialog* dialog = new SearchDialog(m_remoteView->rootPath(), this);
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
+}
+
 void FileClient::showHelp()
 {
     HelpDialog dialog(this);
@@ -540,6 +652,19 @@ void FileClient::handleRemoteTabClosed()
     handleDisconnect();
 }
 
+void FileClient::applySpeedLimits()
+{
+    AppConfig& config = AppConfig::instance();
+    BandwidthLimiter& limiter = BandwidthLimiter::instance();
+    limiter.setGlobalLimit(static_cast<uint64_t>(qMax<qint64>(0, config.speedLimit())));
+
+    // 限速器按实际连接的地址计量，配置按用户输入的主机名查找
+    std::string server = m_netTool->serverAddress();
+    if (!server.empty() && !m_connectedHost.isEmpty()) {
+        limiter.setServerLimit(server, static_cast<uint64_t>(qMax<qint64>(0, config.serverSpeedLimit(m_connectedHost))));
+    }
+}
+
 void FileClient::updateTransferProgress(
     const std::string& taskId,
     const std::string& fileName,
@@ -26,6 +26,7 @@
 #include "TaskManagerDialog.h"
 #include "ConfigDialog.h"
 #include "TransferHistoryDialog.h"
+#include "SearchDialog.h"
 #include "HelpDialog.h"
 #include "ThemeManager.h"
 
@@ -44,6 +45,7 @@ public:
 
     FileListView* getLocalView() const { return m_localView; }
     FileListView* getRemoteView() const { return m_remoteView; }
+    LogWidget* getLogWidget() const { return m_logWidget; }
 
     explicit FileClient(QWidget *parent = nullptr);
     ~FileClient();
@@ -81,6 +83,8 @@ private:
     
 private slots:
     void handleConnect();       // 处理连接
+    void onConnectFinished(bool ok, const QString& serverIP, int port); // 后台连接完成
+    void onConnectionStateChanged(bool connected); // 连接意外中断或自动重连成功
     void handleDisconnect();    // 处理断开连接
     void handleUpload();        // 处理上传
     void handleDownload();      // 处理下载
@@ -88,10 +92,12 @@ private slots:
     void showTaskManager();     // 显示任务管理器
     void showConfig();          // 显示配置对话框
     void showHistory();         // 显示历史记录
+    void showSearch();          // 显示远程搜索
     void showHelp();            // 显示帮助
     void showAbout();           // 显示关于对话框
     void toggleWindowOnTop();   // 切换窗口置顶状态
     void handleRemoteTabClosed();  // 添加这个槽函数
+    void applySpeedLimits();    // 将配置中的限速应用到限速器
     
 private:
     // 界面组件
@@ -115,6 +121,8 @@ private:
     
     QPushButton* m_onTopButton;  // 窗口置顶按钮
     bool m_isOnTop;              // 窗口置顶状态
+    bool m_connecting;           // 是否正在后台连接
+    QString m_connectedHost;     // 当前连接时输入的主机名，服务器限速按它保存
 
 public:
     static Net_Tool* m_netTool;  // 网络交互工具,改成静态便于其他类使用
@@ -368,3 +368,21 @@ void FileListView::dispatchRemoteResponse(const transfer::DirectoryResponse& res
         model->updateModel(response);
     }
 }
+
+void FileListView::loadRemoteDirectory(const transfer::DirectoryRequest& request)
+{
+    FileTabPage* currentPage = qobject_cast<FileTabPage*>(m_tabWidget->currentWidget());
+    if (currentPage && currentPage->isRemote()) {
+        currentPage->loadRemoteDirectory(request);
+    }
+}
+
+void FileListView::refreshRemotePath(const QString& path)
+{
+    for (int i = 0; i < m_tabWidget->count(); ++i) {
+        FileTabPage* page = qobject_cast<FileTabPage*>(m_tabWidget->widget(i));
+        if (page && page->isRemote()) {
+            page->refreshRemoteDirectory(path);
+        }
+    }
+}
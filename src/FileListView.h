@@ -53,6 +53,8 @@ public:
     
     // 远程响应分发
     void dispatchRemoteResponse(const transfer::DirectoryResponse& response);
+    // 当前远程标签页异步加载目录
+    void loadRemoteDirectory(const transfer::DirectoryRequest& request);
 
     // 判断视图是否可见                 
     bool isVisible() const { return QWidget::isVisible(); }
@@ -62,6 +64,8 @@ public:
 public slots:
     // 关闭指定索引的标签页
     void closeTab(int index);
+    // 刷新正在显示path的远程标签页，可从传输线程排队调用
+    void refreshRemotePath(const QString& path);
 
 signals:
     // 当最后一个远程标签页关闭时发出信号
@@ -1,5 +1,7 @@
 #include "FileTabPage.h"
 #include "FileClient.h"
+#include "TransferQueue.h"
+#include "DirectoryCache.h"
 
 
 // 实现FileTabPage类
@@ -10,10 +12,21 @@ FileTabPage::FileTabPage(QWidget* parent, bool isRemote)
     , m_model(nullptr)
     , m_remoteModel(nullptr)
     , m_isRemote(isRemote)
+    , m_dirLoader(nullptr)
+    , m_spinner(nullptr)
+    , m_prefetchTimer(nullptr)
+    , m_filterEdit(nullptr)
 {
     m_layout = new QVBoxLayout(this);
     m_layout->setContentsMargins(0, 0, 0, 0);
     m_layout->setSpacing(0);
+
+    // 筛选框：输入时即时缩小当前目录的显示范围
+    m_filterEdit = new QLineEdit(this);
+    m_filterEdit->setPlaceholderText(tr("筛选当前目录"));
+    m_filterEdit->setClearButtonEnabled(true);
+    m_layout->addWidget(m_filterEdit);
+    connect(m_filterEdit, &QLineEdit::textChanged, this, &FileTabPage::applyFilter);
     
     m_treeView = new QTreeView(this);
     m_treeView->setSelectionMode(QAbstractItemView::ExtendedSelection);// 设置选择模式为扩展选择,允许用户通过Ctrl/Shift选择多个项目
@@ -26,6 +39,45 @@ FileTabPage::FileTabPage(QWidget* parent, bool isRemote)
     if (m_isRemote) {
         m_remoteModel = new RemoteFileSystemModel(this);
         m_treeView->setModel(m_remoteModel);
+        // 点击表头按列排序，默认按名称升序
+        m_treeView->setSortingEnabled(true);
+        m_treeView->sortByColumn(0, Qt::AscendingOrder);
+
+        // 目录列表在后台加载，等待期间显示加载动画
+        m_dirLoader = new RemoteDirectoryLoader(this);
+        m_spinner = new LoadingSpinner(m_treeView->viewport());
+        connect(m_dirLoader, &RemoteDirectoryLoader::loaded,
+                this, &FileTabPage::onRemoteDirectoryLoaded);
+        // 大目录分页加载：第一页先显示，滚动到底部时再取后续页
+        connect(m_remoteModel, &RemoteFileSystemModel::fetchMoreRequested,
+                this, &FileTabPage::loadRemotePage);
+        connect(m_dirLoader, &RemoteDirectoryLoader::pageLoaded, this,
+                [this](quint64, const transfer::DirectoryResponse& response) {
+            m_remoteModel->appendPage(response);
+        });
+        connect(m_dirLoader, &RemoteDirectoryLoader::failed, this, [this](quint64) {
+            m_remoteModel->abortFetch();
+        });
+        connect(m_dirLoader, &RemoteDirectoryLoader::loadingChanged, this, [this](bool loading) {
+            if (loading) {
+                centerSpinner();
+                m_spinner->raise();
+                m_spinner->start();
+            } else {
+                m_spinner->stop();
+            }
+        });
+
+        // 服务端推送的目录变化，合并后就地更新，不再整目录重新加载
+        connect(&DirectoryWatcher::instance(), &DirectoryWatcher::directoryChanged,
+                this, &FileTabPage::applyRemoteChanges);
+        connect(&DirectoryWatcher::instance(), &DirectoryWatcher::directoryInvalidated,
+                this, &FileTabPage::refreshRemoteDirectory);
+
+        m_prefetchTimer = new QTimer(this);
+        m_prefetchTimer->setSingleShot(true);
+        m_prefetchTimer->setInterval(1500);
+        connect(m_prefetchTimer, &QTimer::timeout, this, &FileTabPage::prefetchSubdirectories);
     } else {
         m_model = new LocalFileSystemModel(this);
     	m_model->setReadOnly(false);
@@ -118,18 +170,8 @@ FileTabPage::FileTabPage(QWidget* parent, bool isRemote)
                     request.set_is_parent(true);
                 }   
                 
-                transfer::DirectoryResponse response = FileClient::m_netTool->sendDirectoryRequest(request);
-
-                // 更新当前路径
-                //QString newPath = fileInfo.path + "/" + fileInfo.name;
-                QString newPath = response.path().c_str();
-                if(newPath.contains("//")) {
-                    newPath = newPath.replace("//", "/");
-                }
-                model->setCurrentPath(newPath);
-
-                // 更新模型数据
-                model->updateModel(response);
+                // 异步加载，结果在onRemoteDirectoryLoaded中更新模型
+                loadRemoteDirectory(request);
             }
             else
             {//双击文件
@@ -167,8 +209,162 @@ void FileTabPage::onConfigChanged()
     setRootPath(rootPath());
 }
 
+void FileTabPage::loadRemoteDirectory(const transfer::DirectoryRequest& request)
+{
+    if (m_dirLoader) {
+        m_prefetchTimer->stop();
+        m_dirLoader->load(request);
+    }
+}
+
+void FileTabPage::loadRemotePage(const QString& path, const QString& cursor)
+{
+    transfer::DirectoryRequest request;
+    request.mutable_header()->set_type(transfer::DIRECTORY);
+    request.set_current_path("");
+    request.set_dir_name(path.toStdString());
+    request.set_is_parent(false);
+    request.set_cursor(cursor.toStdString());
+    m_dirLoader->loadPage(request);
+}
+
+void FileTabPage::refreshRemoteDirectory(const QString& path)
+{
+    if (!m_isRemote || rootPath() != path) {
+        return;
+    }
+    transfer::DirectoryRequest request;
+    request.mutable_header()->set_type(transfer::DIRECTORY);
+    request.set_current_path("");
+    request.set_dir_name(path.toStdString());
+    request.set_is_parent(false);
+    // 已有完整列表时只请求此后的变化
+    if (m_remoteModel->version() != 0 && m_remoteModel->isComplete()
+        && FileClient::m_netTool->hasFeature(FEATURE_LISTING_DELTA)) {
+        request.set_since_version(m_remoteModel->version());
+    }
+    loadRemoteDirectory(request);
+}
+
+void FileTabPage::onRemoteDirectoryLoaded(quint64 requestId, const transfer::DirectoryResponse& response)
+{
+    Q_UNUSED(requestId);
+    if (!response.header().success()) {
+        // 服务端拒绝了请求(如目录不存在或无权限)，保留当前列表并报告原因
+        m_remoteModel->abortFetch();
+        QString path = QString::fromStdString(response.path());
+        QString reason = QString::fromStdString(response.header().error_message());
+        FileClient::instance()->getLogWidget()->appendLog(
+            reason.isEmpty() ? tr("无法打开远程目录 %1").arg(path)
+                             : tr("无法打开远程目录 %1: %2").arg(path, reason), true);
+        return;
+    }
+
+    // 更新当前路径
+    QString newPath = QString::fromStdString(response.path());
+    if(newPath.contains("//")) {
+        newPath = newPath.replace("//", "/");
+    }
+    // 进入别的目录时清空筛选，刷新当前目录时保留
+    if (newPath != m_remoteModel->currentPath()) {
+        clearFilter();
+    }
+    m_remoteModel->setCurrentPath(newPath);
+    // 订阅当前目录的变化
+    DirectoryWatcher::instance().watch(this, newPath);
+
+    // 更新模型数据：增量就地应用，无法应用时整体重新加载
+    if (response.is_delta()) {
+        if (!m_remoteModel->applyDelta(response)) {
+            transfer::DirectoryRequest request;
+            request.mutable_header()->set_type(transfer::DIRECTORY);
+            request.set_current_path("");
+            request.set_dir_name(response.path());
+            request.set_is_parent(false);
+            loadRemoteDirectory(request);
+            return;
+        }
+    } else {
+        m_remoteModel->updateModel(response);
+    }
+
+    // 用户停留在该目录时预取子目录，下次进入可直接命中缓存
+    m_prefetchTimer->start();
+}
+
+void FileTabPage::applyRemoteChanges(const transfer::DirectoryResponse& delta)
+{
+    if (DirectoryCache::normalizePath(rootPath().toStdString()) != delta.path()) {
+        return;
+    }
+    // 列表未加载完整或版本不符时重新加载(服务端支持时仍只取增量)
+    if (!m_remoteModel->applyDelta(delta)) {
+        refreshRemoteDirectory(rootPath());
+    }
+}
+
+void FileTabPage::prefetchSubdirectories()
+{
+    static const int MAX_PREFETCH_DIRS = 16;
+
+    QString currentPath = m_remoteModel->currentPath();
+    QStringList paths;
+    for (int row = 0; row < m_remoteModel->rowCount() && paths.size() < MAX_PREFETCH_DIRS; ++row) {
+        const RemoteFileInfo& fileInfo = m_remoteModel->fileInfo(m_remoteModel->index(row, 0));
+        if (fileInfo.isDirectory && fileInfo.name != "..") {
+            paths << (currentPath.endsWith('/') ? currentPath : currentPath + '/') + fileInfo.name;
+        }
+    }
+    m_dirLoader->prefetch(paths);
+}
+
+void FileTabPage::centerSpinner()
+{
+    if (m_spinner) {
+        QWidget* viewport = m_treeView->viewport();
+        m_spinner->move((viewport->width() - m_spinner->width()) / 2,
+                        (viewport->height() - m_spinner->height()) / 2);
+    }
+}
+
+void FileTabPage::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+    centerSpinner();
+}
+
+void FileTabPage::applyFilter(const QString& text)
+{
+    if (m_isRemote) {
+        m_remoteModel->setFilterText(text);
+        return;
+    }
+
+    // 本地视图使用文件系统模型自带的名称过滤，通配符按字面匹配
+    QString pattern = text.trimmed();
+    if (pattern.isEmpty()) {
+        m_model->setNameFilters(QStringList());
+        return;
+    }
+    pattern.replace("[", "[[]");
+    pattern.replace("*", "[*]");
+    pattern.replace("?", "[?]");
+    m_model->setNameFilterDisables(false);
+    m_model->setNameFilters(QStringList() << "*" + pattern + "*");
+}
+
+void FileTabPage::clearFilter()
+{
+    if (m_filterEdit && !m_filterEdit->text().isEmpty()) {
+        m_filterEdit->clear();
+    }
+}
+
 void FileTabPage::setRootPath(const QString& path)
 {
+    if (path != rootPath()) {
+        clearFilter();
+    }
     if (m_isRemote) {
         if (auto* model = qobject_cast<RemoteFileSystemModel*>(m_remoteModel)) {
             model->setCurrentPath(path);
@@ -589,42 +785,75 @@ bool FileTabPage::containsDirectory(const QModelIndexList& indexes) const
 // 添加上传文件的处理函数
 void FileTabPage::handleUploadFiles(const QModelIndexList& indexes, const QString& targetPath)
 {
-    // 检查是否包含目录
-    if (containsDirectory(indexes)) {
-        QMessageBox::warning(this, tr("上传提示"), 
-            tr("选中的文件中包含目录，本次不进行上传操作。"));
-        return;
-    }
-
-    // 遍历选中的文件进行上传
+    std::vector<std::string> smallFiles, smallTaskIds;
+    // 遍历选中的文件和目录进行上传
     for (const QModelIndex& index : indexes) {
         if (index.column() == 0) { // 只处理第一列
             QString sourcePathFileName = m_model->filePath(index);
             QString fileName = QFileInfo(sourcePathFileName).fileName();
             QString fullTargetPath = targetPath;
             
+            // 登记到传输队列，任务管理器可查看并调整优先级
+            QString taskId = TransferQueue::instance().addRunningTask(
+                sourcePathFileName, fullTargetPath, TransferPriority::Normal, true);
+
+            if (m_model->isDir(index) && AppConfig::instance().archiveTransfer()
+                && FileClient::m_netTool->hasFeature(FEATURE_ARCHIVE)) {
+                // 目录打包成一个连续的归档流上传
+                FileClient::m_netTool->startArchiveUploadTask(
+                    sourcePathFileName.toStdString(),
+                    fullTargetPath.toStdString(),
+                    std::bind(&FileTabPage::onTransferProgress, this,
+                        std::placeholders::_1),
+                    taskId.toStdString(),
+                    TransferPriority::Normal,
+                    AppConfig::instance().archiveCompression()
+                );
+                continue;
+            }
+            if (m_model->isDir(index)) {
+                // 目录整体作为一个任务递归上传
+                FileClient::m_netTool->startDirectoryUploadTask(
+                    sourcePathFileName.toStdString(),
+                    fullTargetPath.toStdString(),
+                    std::bind(&FileTabPage::onTransferProgress, this,
+                        std::placeholders::_1),
+                    taskId.toStdString()
+                );
+                continue;
+            }
+
+            // 小文件先收集起来，多个时打包上传，省去逐个请求的往返
+            if (QFileInfo(sourcePathFileName).size() <= SMALL_FILE_SIZE) {
+                smallFiles.push_back(sourcePathFileName.toStdString());
+                smallTaskIds.push_back(taskId.toStdString());
+                continue;
+            }
+
             // 调用Net_Tool开始上传任务
             FileClient::m_netTool->startUploadTask(
                 sourcePathFileName.toStdString(),
                 fullTargetPath.toStdString(),
                 std::bind(&FileTabPage::onTransferProgress, this, 
-                    std::placeholders::_1)
+                    std::placeholders::_1),
+                taskId.toStdString()
             );
         }
     }
+
+    if (smallFiles.size() > 1) {
+        FileClient::m_netTool->startUploadBatchTask(smallFiles, targetPath.toStdString(),
+            std::bind(&FileTabPage::onTransferProgress, this, std::placeholders::_1), smallTaskIds);
+    } else if (smallFiles.size() == 1) {
+        FileClient::m_netTool->startUploadTask(smallFiles.front(), targetPath.toStdString(),
+            std::bind(&FileTabPage::onTransferProgress, this, std::placeholders::_1), smallTaskIds.front());
+    }
 }
 
 // 添加下载文件的处理函数
 void FileTabPage::handleDownloadFiles(const QModelIndexList& indexes, const QString& targetPath)
 {
-    // 检查是否包含目录
-    if (containsDirectory(indexes)) {
-        QMessageBox::warning(this, tr("下载提示"), 
-            tr("选中的文件中包含目录，本次不进行下载操作。"));
-        return;
-    }
-
-    // 遍历选中的文件进行下载
+    // 遍历选中的文件和目录进行下载
     for (const QModelIndex& index : indexes) {
         if (index.column() == 0) { // 只处理第一列
             auto* model = qobject_cast<RemoteFileSystemModel*>(m_remoteModel);
@@ -636,17 +865,52 @@ void FileTabPage::handleDownloadFiles(const QModelIndexList& indexes, const QStr
             else
                 file_name = remote_cur_path + '/' + fileInfo.name;
 
-            // 调用Net_Tool开始下载任务
-            FileClient::m_netTool->startDownloadTask(
-                file_name.toStdString(),//远程文件路径+文件名
-                targetPath.toStdString(),//下载本地目标位置
-                std::bind(&FileTabPage::onTransferProgress, this, 
-                    std::placeholders::_1)
-            );
+            downloadRemoteItem(file_name, fileInfo.isDirectory, targetPath);
         }
     }
 }
 
+void FileTabPage::downloadRemoteItem(const QString& remotePath, bool isDirectory, const QString& targetPath)
+{
+    QString taskId = TransferQueue::instance().addRunningTask(
+        remotePath, targetPath, TransferPriority::Normal, false);
+
+    if (isDirectory && AppConfig::instance().archiveTransfer()
+        && FileClient::m_netTool->hasFeature(FEATURE_ARCHIVE)) {
+        // 服务端把目录打包成归档流，边收边解包
+        FileClient::m_netTool->startArchiveDownloadTask(
+            remotePath.toStdString(),
+            targetPath.toStdString(),
+            std::bind(&FileTabPage::onTransferProgress, this,
+                std::placeholders::_1),
+            taskId.toStdString(),
+            TransferPriority::Normal,
+            AppConfig::instance().archiveCompression()
+        );
+        return;
+    }
+    if (isDirectory) {
+        // 目录整体作为一个任务递归下载
+        FileClient::m_netTool->startDirectoryDownloadTask(
+            remotePath.toStdString(),
+            targetPath.toStdString(),
+            std::bind(&FileTabPage::onTransferProgress, this,
+                std::placeholders::_1),
+            taskId.toStdString()
+        );
+        return;
+    }
+
+    // 调用Net_Tool开始下载任务
+    FileClient::m_netTool->startDownloadTask(
+        remotePath.toStdString(),//远程文件路径+文件名
+        targetPath.toStdString(),//下载本地目标位置
+        std::bind(&FileTabPage::onTransferProgress, this, 
+            std::placeholders::_1),
+        taskId.toStdString()
+    );
+}
+
 // 传输进度回调函数
 void FileTabPage::onTransferProgress(const transfer::TransferProgressResponse& progress)
 {
@@ -19,10 +19,15 @@
 #include <QGuiApplication>
 #include <QScreen>
 #include <QApplication>
+#include <QTimer>
+#include <QLineEdit>
 
 #include "AppConfig.h"
 #include "LocalFileSystemModel.h"
 #include "RemoteFileSystemModel.h"
+#include "RemoteDirectoryLoader.h"
+#include "DirectoryWatcher.h"
+#include "LoadingSpinner.h"
 
 
 /**
@@ -58,6 +63,13 @@ public:
     bool containsDirectory(const QModelIndexList& indexes) const;
     void handleUploadFiles(const QModelIndexList& indexes, const QString& targetPath);
     void handleDownloadFiles(const QModelIndexList& indexes, const QString& targetPath);
+    // 下载单个远程文件或目录(完整远程路径)到本地targetPath
+    void downloadRemoteItem(const QString& remotePath, bool isDirectory, const QString& targetPath);
+
+    // 异步加载远程目录，加载期间显示加载动画，新请求会取代未完成的旧请求
+    void loadRemoteDirectory(const transfer::DirectoryRequest& request);
+    // 当前显示的正是path时重新加载
+    void refreshRemoteDirectory(const QString& path);
 
 signals:
     void transferProgressUpdated(const QString& taskId, int progress, 
@@ -68,6 +80,14 @@ private slots:
     void showContextMenu(const QPoint& pos);
     // 配置变更时更新视图
     void onConfigChanged();
+    // 远程目录加载完成
+    void onRemoteDirectoryLoaded(quint64 requestId, const transfer::DirectoryResponse& response);
+    // 按游标加载远程目录的后续页
+    void loadRemotePage(const QString& path, const QString& cursor);
+    // 按筛选框内容过滤当前目录
+    void applyFilter(const QString& text);
+    // 服务端推送的目录变化，属于当前目录时就地应用
+    void applyRemoteChanges(const transfer::DirectoryResponse& delta);
     
 private:
     // 复制选中的文件
@@ -88,12 +108,26 @@ private:
     void createNewFile(const QString& parentPath);
     // 格式化时间显示
     QString formatTime(qint64 milliseconds);
+    // 把加载动画放到视图中央
+    void centerSpinner();
+    // 预取当前远程目录下的子目录
+    void prefetchSubdirectories();
+    // 清空筛选框
+    void clearFilter();
+
+protected:
+    void resizeEvent(QResizeEvent* event) override;
 
+private:
     QVBoxLayout* m_layout;              // 主布局
     QTreeView* m_treeView;             // 树形视图控件
     LocalFileSystemModel* m_model;    // 本地文件系统模型
     RemoteFileSystemModel* m_remoteModel; // 远程文件系统模型
     bool m_isRemote;                    // 是否为远程标签页
+    RemoteDirectoryLoader* m_dirLoader; // 远程目录异步加载器
+    LoadingSpinner* m_spinner;          // 远程目录加载动画
+    QTimer* m_prefetchTimer;            // 空闲一段时间后预取子目录
+    QLineEdit* m_filterEdit;            // 当前目录的筛选框
 
     void onTransferProgress(const transfer::TransferProgressResponse& progress);
 };
@@ -0,0 +1,268 @@
+#include "LocalTreeWalker.h"
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <sys/types.h>
+#endif
+
+// 每批回调的最大条目数
+static const size_t WALK_BATCH_SIZE = 512;
+
+#ifdef _WIN32
+static std::wstring utf8ToWide(const std::string& str)
+{
+    int len = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, NULL, 0);
+    std::wstring wstr(len > 0 ? len - 1 : 0, L'\0');
+    if (len > 1) {
+        MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, &wstr[0], len);
+    }
+    return wstr;
+}
+
+static std::string wideToUtf8(const wchar_t* wstr)
+{
+    int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
+    std::string str(len > 0 ? len - 1 : 0, '\0');
+    if (len > 1) {
+        WideCharToMultiByte(CP_UTF8, 0, wstr, -1, &str[0], len, NULL, NULL);
+    }
+    return str;
+}
+#else
+// 获取条目类型和大小，只请求需要的字段以减少内核开销
+// 返回false表示条目无法访问
+static bool statEntry(int dirFd, const char* name, bool followLink, bool& isDir, bool& isLink,
+    bool& isRegular, uint64_t& size)
+{
+#ifdef STATX_SIZE
+    struct statx stx;
+    int flags = AT_STATX_DONT_SYNC | (followLink ? 0 : AT_SYMLINK_NOFOLLOW);
+    if (statx(dirFd, name, flags, STATX_TYPE | STATX_SIZE, &stx) != 0) {
+        return false;
+    }
+    isDir = S_ISDIR(stx.stx_mode);
+    isLink = S_ISLNK(stx.stx_mode);
+    isRegular = S_ISREG(stx.stx_mode);
+    size = stx.stx_size;
+#else
+    // 旧版glibc(如CentOS7)没有statx，退回fstatat
+    struct stat st;
+    if (fstatat(dirFd, name, &st, followLink ? 0 : AT_SYMLINK_NOFOLLOW) != 0) {
+        return false;
+    }
+    isDir = S_ISDIR(st.st_mode);
+    isLink = S_ISLNK(st.st_mode);
+    isRegular = S_ISREG(st.st_mode);
+    size = st.st_size;
+#endif
+    return true;
+}
+#endif
+
+LocalTreeWalker::LocalTreeWalker(const std::string& rootPath, int threadCount)
+    : m_rootPath(rootPath)
+    , m_threadCount(threadCount > 0 ? threadCount : 1)
+    , m_activeWorkers(0)
+    , m_runningThreads(0)
+    , m_cancelled(false)
+    , m_finished(false)
+    , m_totalBytes(0)
+    , m_fileCount(0)
+    , m_dirCount(0)
+    , m_skippedCount(0)
+{
+    // 去掉末尾的路径分隔符
+    while (m_rootPath.size() > 1 && (m_rootPath.back() == '/' || m_rootPath.back() == '\\')) {
+        m_rootPath.pop_back();
+    }
+}
+
+LocalTreeWalker::~LocalTreeWalker()
+{
+    cancel();
+    wait();
+}
+
+void LocalTreeWalker::start(BatchCallback onBatch, FinishedCallback onFinished)
+{
+    m_onBatch = onBatch;
+    m_onFinished = onFinished;
+    m_pendingDirs.push_back(std::string());  // 从根目录开始
+    m_runningThreads = m_threadCount;
+    for (int i = 0; i < m_threadCount; ++i) {
+        m_threads.push_back(std::thread(&LocalTreeWalker::workerLoop, this));
+    }
+}
+
+void LocalTreeWalker::cancel()
+{
+    m_cancelled = true;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cond.notify_all();
+}
+
+void LocalTreeWalker::wait()
+{
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+}
+
+void LocalTreeWalker::workerLoop()
+{
+    while (true) {
+        std::string dir;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() {
+                return m_cancelled || !m_pendingDirs.empty() || m_activeWorkers == 0;
+            });
+            if (m_cancelled || m_pendingDirs.empty()) {
+                break;  // 取消，或者没有待处理目录且没有线程还会产生新目录
+            }
+            dir = m_pendingDirs.front();
+            m_pendingDirs.pop_front();
+            ++m_activeWorkers;
+        }
+
+        std::vector<std::string> subDirs;
+        scanDirectory(dir, subDirs);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& subDir : subDirs) {
+                m_pendingDirs.push_back(std::move(subDir));
+            }
+            --m_activeWorkers;
+            m_cond.notify_all();
+        }
+    }
+
+    // 最后一个退出的线程负责通知遍历结束
+    if (--m_runningThreads == 0) {
+        m_finished = true;
+        if (m_onFinished) {
+            m_onFinished();
+        }
+    }
+}
+
+void LocalTreeWalker::flushBatch(std::vector<LocalEntry>& batch)
+{
+    if (!batch.empty() && m_onBatch) {
+        m_onBatch(batch);
+    }
+    batch.clear();
+}
+
+void LocalTreeWalker::scanDirectory(const std::string& relativeDir, std::vector<std::string>& subDirs)
+{
+    std::vector<LocalEntry> batch;
+    batch.reserve(WALK_BATCH_SIZE);
+    std::string prefix = relativeDir.empty() ? std::string() : relativeDir + "/";
+
+#ifdef _WIN32
+    std::wstring pattern = utf8ToWide(m_rootPath + (relativeDir.empty() ? "" : "/" + relativeDir) + "/*");
+    WIN32_FIND_DATAW findData;
+    // LARGE_FETCH让系统一次读出更多目录项
+    HANDLE handle = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &findData,
+        FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    do {
+        if (m_cancelled) {
+            break;
+        }
+        const wchar_t* name = findData.cFileName;
+        if (wcscmp(name, L".") == 0 || wcscmp(name, L"..") == 0) {
+            continue;
+        }
+        LocalEntry entry;
+        entry.relativePath = prefix + wideToUtf8(name);
+        entry.isDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        if (entry.isDirectory && (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+            continue;  // 跳过目录链接，避免循环
+        }
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DEVICE) {
+            ++m_skippedCount;
+            continue;
+        }
+        entry.size = entry.isDirectory ? 0 :
+            ((static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow);
+#else
+    std::string fullPath = relativeDir.empty() ? m_rootPath : m_rootPath + "/" + relativeDir;
+    DIR* dir = opendir(fullPath.c_str());
+    if (!dir) {
+        return;
+    }
+    int dirFd = dirfd(dir);
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (m_cancelled) {
+            break;
+        }
+        const char* name = ent->d_name;
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+            continue;
+        }
+        LocalEntry entry;
+        entry.relativePath = prefix + name;
+        entry.size = 0;
+
+        bool isDir = (ent->d_type == DT_DIR);
+        bool isLink = (ent->d_type == DT_LNK);
+        bool isRegular = (ent->d_type == DT_REG);
+        if (ent->d_type == DT_REG || ent->d_type == DT_UNKNOWN) {
+            // 普通文件只需要大小，类型未知时一并取类型
+            if (!statEntry(dirFd, name, false, isDir, isLink, isRegular, entry.size)) {
+                continue;
+            }
+        }
+        if (isLink) {
+            // 符号链接按目标处理，但不进入链接目录，避免循环
+            bool targetIsLink = false;
+            if (!statEntry(dirFd, name, true, isDir, targetIsLink, isRegular, entry.size) || isDir) {
+                continue;
+            }
+        }
+        if (!isDir && !isRegular) {
+            // 管道、套接字、设备文件无法按文件读取，打开FIFO还会一直阻塞
+            ++m_skippedCount;
+            continue;
+        }
+        entry.isDirectory = isDir;
+        if (isDir) {
+            entry.size = 0;
+        }
+#endif
+        if (entry.isDirectory) {
+            ++m_dirCount;
+            subDirs.push_back(entry.relativePath);
+        } else {
+            ++m_fileCount;
+            m_totalBytes += entry.size;
+        }
+        batch.push_back(std::move(entry));
+        if (batch.size() >= WALK_BATCH_SIZE) {
+            flushBatch(batch);
+        }
+#ifdef _WIN32
+    } while (FindNextFileW(handle, &findData));
+    FindClose(handle);
+#else
+    }
+    closedir(dir);
+#endif
+
+    // 子目录在本批回调之后才会被其他线程遍历，保证父目录条目先到
+    flushBatch(batch);
+}
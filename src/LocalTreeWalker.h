@@ -0,0 +1,83 @@
+#ifndef LOCALTREEWALKER_H
+#define LOCALTREEWALKER_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <cstdint>
+
+// 遍历得到的一个条目
+struct LocalEntry {
+    std::string relativePath;  // 相对根目录的路径，使用'/'分隔，UTF-8编码
+    bool isDirectory;
+    uint64_t size;
+};
+
+/**
+ * @brief 多线程本地目录遍历器
+ *
+ * 负责:
+ * 1. 多个线程并行遍历目录树，每个目录一次readdir批量读出
+ * 2. Linux下用statx(只取类型和大小)获取文件信息，Windows下直接使用FindNextFile返回的信息
+ * 3. 边遍历边按批回调结果，并累计文件数和总字节数
+ * 4. 保证目录条目先于其子条目回调，便于调用方先建目录再传文件
+ * 5. 只返回普通文件和目录，管道、套接字、设备文件跳过并计数
+ */
+class LocalTreeWalker
+{
+public:
+    typedef std::function<void(const std::vector<LocalEntry>&)> BatchCallback;
+    typedef std::function<void()> FinishedCallback;
+
+    explicit LocalTreeWalker(const std::string& rootPath, int threadCount = 4);
+    ~LocalTreeWalker();
+
+    // 开始遍历，回调在遍历线程中执行
+    void start(BatchCallback onBatch, FinishedCallback onFinished);
+    // 取消遍历
+    void cancel();
+    // 等待遍历线程退出
+    void wait();
+
+    uint64_t totalBytes() const { return m_totalBytes; }
+    uint64_t fileCount() const { return m_fileCount; }
+    uint64_t directoryCount() const { return m_dirCount; }
+    // 跳过的特殊文件(管道、套接字、设备)数
+    uint64_t skippedCount() const { return m_skippedCount; }
+    bool isFinished() const { return m_finished; }
+
+private:
+    LocalTreeWalker(const LocalTreeWalker&) = delete;
+    LocalTreeWalker& operator=(const LocalTreeWalker&) = delete;
+
+    void workerLoop();
+    // 读取一个目录，返回其中的子目录
+    void scanDirectory(const std::string& relativeDir, std::vector<std::string>& subDirs);
+    void flushBatch(std::vector<LocalEntry>& batch);
+
+    std::string m_rootPath;
+    int m_threadCount;
+    std::vector<std::thread> m_threads;
+    BatchCallback m_onBatch;
+    FinishedCallback m_onFinished;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<std::string> m_pendingDirs;  // 待遍历的目录
+    int m_activeWorkers;                    // 正在处理目录的线程数
+    std::atomic<int> m_runningThreads;      // 尚未退出的遍历线程数
+
+    std::atomic<bool> m_cancelled;
+    std::atomic<bool> m_finished;
+    std::atomic<uint64_t> m_totalBytes;
+    std::atomic<uint64_t> m_fileCount;
+    std::atomic<uint64_t> m_dirCount;
+    std::atomic<uint64_t> m_skippedCount;
+};
+
+#endif // LOCALTREEWALKER_H
@@ -0,0 +1,16 @@
+#include "MessageRegistry.h"
+
+FrameDispatcher::FrameDispatcher()
+{
+}
+
+bool FrameDispatcher::handles(char tag) const
+{
+    return static_cast<bool>(m_handlers[static_cast<unsigned char>(tag)]);
+}
+
+bool FrameDispatcher::dispatch(char tag, const std::string& frame) const
+{
+    const auto& handler = m_handlers[static_cast<unsigned char>(tag)];
+    return handler && handler(frame);
+}
@@ -0,0 +1,93 @@
+#ifndef MESSAGEREGISTRY_H
+#define MESSAGEREGISTRY_H
+
+#include <string>
+#include <functional>
+#include "../protos/transfer.pb.h"
+
+//用于区分底层收发请求类型
+#define DIRECTORY_TYPE 1
+#define UPLOAD_TYPE 2
+#define DOWNLOAD_TYPE 3
+#define TRANSFER_CONTROL_TYPE 4
+#define TRANSFER_PROGRESS_TYPE 5
+#define MKDIR_TYPE 6
+#define TREE_LIST_TYPE 7
+#define ARCHIVE_TYPE 8
+#define SEARCH_TYPE 9
+#define WATCH_TYPE 10
+#define CHANGE_NOTIFY_TYPE 11
+#define HELLO_TYPE 12
+#define HEARTBEAT_TYPE 13
+
+// 消息类型与帧类型的编译期绑定，收发时由消息类型得出帧类型，未登记的消息无法收发
+template<typename T>
+struct MessageTraits;
+
+// 请求对应的响应类型，exchangeMessage据此推导响应
+template<typename Req>
+struct ResponseOf;
+
+#define REGISTER_MESSAGE(Message, Tag) \
+    template<> struct MessageTraits<Message> { \
+        static constexpr char tag() { return Tag; } \
+    };
+
+#define REGISTER_EXCHANGE(Request, Response, Tag) \
+    REGISTER_MESSAGE(Request, Tag) \
+    REGISTER_MESSAGE(Response, Tag) \
+    template<> struct ResponseOf<Request> { typedef Response type; };
+
+REGISTER_EXCHANGE(transfer::DirectoryRequest, transfer::DirectoryResponse, DIRECTORY_TYPE)
+REGISTER_EXCHANGE(transfer::UploadRequest, transfer::UploadResponse, UPLOAD_TYPE)
+REGISTER_EXCHANGE(transfer::DownloadRequest, transfer::DownloadResponse, DOWNLOAD_TYPE)
+REGISTER_EXCHANGE(transfer::TransferControlRequest, transfer::TransferControlResponse, TRANSFER_CONTROL_TYPE)
+REGISTER_EXCHANGE(transfer::TransferProgressRequest, transfer::TransferProgressResponse, TRANSFER_PROGRESS_TYPE)
+REGISTER_EXCHANGE(transfer::MakeDirectoryRequest, transfer::MakeDirectoryResponse, MKDIR_TYPE)
+REGISTER_EXCHANGE(transfer::TreeListRequest, transfer::TreeListResponse, TREE_LIST_TYPE)
+REGISTER_EXCHANGE(transfer::ArchiveRequest, transfer::ArchiveResponse, ARCHIVE_TYPE)
+REGISTER_EXCHANGE(transfer::SearchRequest, transfer::SearchResponse, SEARCH_TYPE)
+REGISTER_EXCHANGE(transfer::WatchRequest, transfer::WatchResponse, WATCH_TYPE)
+REGISTER_EXCHANGE(transfer::HelloRequest, transfer::HelloResponse, HELLO_TYPE)
+REGISTER_EXCHANGE(transfer::HeartbeatRequest, transfer::HeartbeatResponse, HEARTBEAT_TYPE)
+REGISTER_MESSAGE(transfer::ChangeNotification, CHANGE_NOTIFY_TYPE)
+
+#undef REGISTER_EXCHANGE
+#undef REGISTER_MESSAGE
+
+/**
+ * @brief 帧分发表
+ *
+ * 负责:
+ * 1. 按帧类型登记带类型的处理函数，类型由MessageTraits在编译期确定
+ * 2. 收到不属于当前请求的帧(如服务端推送)时按帧类型查表，直接解析为登记的消息类型并调用处理函数
+ */
+class FrameDispatcher
+{
+public:
+    FrameDispatcher();
+
+    // 登记消息T的处理函数，取代之前登记的
+    template<typename T>
+    void on(std::function<void(const T&)> handler) {
+        m_handlers[static_cast<unsigned char>(MessageTraits<T>::tag())] =
+            [handler](const std::string& frame) {
+                T message;
+                if (!message.ParseFromString(frame)) {
+                    return false;
+                }
+                handler(message);
+                return true;
+            };
+    }
+
+    // 是否登记了该帧类型
+    bool handles(char tag) const;
+    // 交给登记的处理函数，未登记或解析失败返回false
+    bool dispatch(char tag, const std::string& frame) const;
+
+private:
+    std::function<bool(const std::string&)> m_handlers[256];
+};
+
+#endif // MESSAGEREGISTRY_H
@@ -6,7 +6,39 @@
 #include <iomanip>
 #include <openssl/md5.h>
 #include <QDebug>
+#include <QDir>
+#include <QByteArray>
+#include <QMetaObject>
 #include "FileClient.h"
+#include "TransferQueue.h"
+#include "TransferScheduler.h"
+#include "LocalTreeWalker.h"
+#include "ArchiveStream.h"
+#include "PathUtils.h"
+#include "DirectoryCache.h"
+#include "RefreshCoordinator.h"
+#include <condition_variable>
+#include <deque>
+#include <cstring>
+#include <csignal>
+#include <google/protobuf/io/coded_stream.h>
+
+// 拼接远端路径
+static std::string joinRemotePath(const std::string& base, const std::string& name) {
+    if (base.empty() || base[base.size() - 1] == '/') {
+        return base + name;
+    }
+    return base + "/" + name;
+}
+
+// MD5摘要转换为十六进制字符串
+static std::string md5ToHex(const unsigned char* digest) {
+    std::stringstream ss;
+    for (int i = 0; i < MD5_DIGEST_LENGTH; i++) {
+        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+    }
+    return ss.str();
+}
 
 // CRC32表
 static uint32_t crc32_table[256];
@@ -28,8 +60,359 @@ static void make_crc32_table() {
     crc32_table_computed = true;
 }
 
+SocketProfile SocketProfile::forProfile(ConnectionProfile profile) {
+    SocketProfile result;
+    result.noDelay = true;
+    result.sendBufferSize = 0;
+    result.receiveBufferSize = 0;
+    result.keepAliveIdle = 60;
+    result.keepAliveInterval = 10;
+    result.keepAliveCount = 6;
+    switch (profile) {
+    case ConnectionProfile::LowLatency:
+        result.keepAliveIdle = 15;
+        result.keepAliveInterval = 5;
+        result.keepAliveCount = 3;
+        break;
+    case ConnectionProfile::Throughput:
+        // 手动设置缓冲区会关闭Linux的自动调节，只在高吞吐模式下按高带宽时延积给足
+        result.sendBufferSize = 8 * 1024 * 1024;
+        result.receiveBufferSize = 8 * 1024 * 1024;
+        result.congestion = "bbr";
+        break;
+    case ConnectionProfile::Balanced:
+        break;
+    }
+    return result;
+}
+
+// 只解析响应的header取序列号，不解析整个消息(目录列表可能很大)；没有序列号时返回0
+static uint64_t responseSequence(const std::string& serialized) {
+    google::protobuf::io::CodedInputStream input(
+        reinterpret_cast<const uint8_t*>(serialized.data()), static_cast<int>(serialized.size()));
+    while (uint32_t tag = input.ReadTag()) {
+        uint32_t field = tag >> 3;
+        uint32_t wireType = tag & 7;
+        uint32_t length = 0;
+        uint64_t value = 0;
+        switch (wireType) {
+        case 0:
+            if (!input.ReadVarint64(&value)) return 0;
+            break;
+        case 1:
+            if (!input.Skip(8)) return 0;
+            break;
+        case 2:
+            if (!input.ReadVarint32(&length)) return 0;
+            if (field == 1) {   // 所有响应的header都是字段1
+                std::string bytes;
+                transfer::ResponseHeader header;
+                if (!input.ReadString(&bytes, static_cast<int>(length)) || !header.ParseFromString(bytes)) {
+                    return 0;
+                }
+                return header.sequence();
+            }
+            if (!input.Skip(static_cast<int>(length))) return 0;
+            break;
+        case 5:
+            if (!input.Skip(4)) return 0;
+            break;
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+#if !defined(_WIN32) && !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+// 单调时钟的毫秒数
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 设置socket选项，必须在connect之前调用，接收缓冲区要在握手时确定窗口缩放
+static void applySocketProfile(socket_t sock, const SocketProfile& profile) {
+    int on = 1;
+    if (profile.noDelay) {
+        setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&on, sizeof(on));
+    }
+    if (profile.sendBufferSize > 0) {
+        setsockopt(sock, SOL_SOCKET, SO_SNDBUF, (const char*)&profile.sendBufferSize, sizeof(int));
+    }
+    if (profile.receiveBufferSize > 0) {
+        setsockopt(sock, SOL_SOCKET, SO_RCVBUF, (const char*)&profile.receiveBufferSize, sizeof(int));
+    }
+    setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, (const char*)&on, sizeof(on));
+#ifdef TCP_KEEPIDLE
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPIDLE, (const char*)&profile.keepAliveIdle, sizeof(int));
+#endif
+#ifdef TCP_KEEPINTVL
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPINTVL, (const char*)&profile.keepAliveInterval, sizeof(int));
+#endif
+#ifdef TCP_KEEPCNT
+    setsockopt(sock, IPPROTO_TCP, TCP_KEEPCNT, (const char*)&profile.keepAliveCount, sizeof(int));
+#endif
+#ifdef TCP_USER_TIMEOUT
+    // 已发出的数据超过该时间未被确认即断开，比保活更早发现传输中的死连接
+    unsigned int userTimeout = UNACKED_TIMEOUT_MS;
+    setsockopt(sock, IPPROTO_TCP, TCP_USER_TIMEOUT, (const char*)&userTimeout, sizeof(userTimeout));
+#endif
+#ifdef TCP_CONGESTION
+    // 内核未加载该算法时设置失败，沿用系统默认
+    if (!profile.congestion.empty()) {
+        setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, profile.congestion.c_str(),
+            static_cast<socklen_t>(profile.congestion.size()));
+    }
+#endif
+}
+
+//linux和window下非阻塞设置不一样
+static void setSocketBlocking(socket_t sock, bool blocking) {
+#ifdef _WIN32
+    u_long iMode = blocking ? 0 : 1;
+    ioctlsocket(sock, FIONBIO, &iMode);
+#else
+    int flags = fcntl(sock, F_GETFL, 0);
+    fcntl(sock, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK));
+#endif
+}
+
+// 设置单次接收或发送的超时
+static void setSocketTimeout(socket_t sock, int option, int timeoutMs) {
+#ifdef _WIN32
+    DWORD timeout = timeoutMs;
+#else
+    timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+#endif
+    setsockopt(sock, SOL_SOCKET, option, (const char*)&timeout, sizeof(timeout));
+}
+
+// 设置单次收发的超时，对端无响应时recv/send不再无限阻塞
+static void setSocketTimeouts(socket_t sock, int timeoutMs) {
+    setSocketTimeout(sock, SO_RCVTIMEO, timeoutMs);
+    setSocketTimeout(sock, SO_SNDTIMEO, timeoutMs);
+}
+
+// 收发失败是否因为超时
+static bool isTimeoutError() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAETIMEDOUT;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+// 发起一次非阻塞连接，连接进行中或已连上时返回socket
+static socket_t startConnect(const addrinfo* address, const SocketProfile& profile) {
+    socket_t sock = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (sock == INVALID_SOCK) {
+        return INVALID_SOCK;
+    }
+    applySocketProfile(sock, profile);
+    setSocketBlocking(sock, false);
+    if (connect(sock, address->ai_addr, static_cast<int>(address->ai_addrlen)) == 0) {
+        return sock;
+    }
+#ifdef _WIN32
+    if (WSAGetLastError() == WSAEWOULDBLOCK) {
+        return sock;
+    }
+#else
+    if (errno == EINPROGRESS) {
+        return sock;
+    }
+#endif
+    CLOSE_SOCKET(sock);
+    return INVALID_SOCK;
+}
+
+// 一次域名解析的结果，由解析线程和等待方共享
+struct HostResolution {
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool done = false;
+    bool abandoned = false;  // 等待方已超时返回，结果由解析线程自行释放
+    int rc = 0;
+    addrinfo* result = nullptr;
+};
+
+// getaddrinfo无法设置超时，放到单独的线程中解析，deadline前没有结果或stopRequested为true时就不再等待
+static addrinfo* resolveHost(const std::string& host, uint16_t port,
+    std::chrono::steady_clock::time_point deadline, const std::function<bool()>& stopRequested,
+    std::string& error) {
+    auto state = std::make_shared<HostResolution>();
+    std::string service = std::to_string(port);
+    std::thread([state, host, service]() {
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+        addrinfo* result = nullptr;
+        int rc = getaddrinfo(host.c_str(), service.c_str(), &hints, &result);
+
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->abandoned) {
+            if (result) {
+                freeaddrinfo(result);
+            }
+            return;
+        }
+        state->rc = rc;
+        state->result = result;
+        state->done = true;
+        state->cond.notify_all();
+    }).detach();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->done) {
+        if (stopRequested()) {
+            state->abandoned = true;
+            error = "Connection cancelled";
+            return nullptr;
+        }
+        auto slice = std::min(deadline, std::chrono::steady_clock::now()
+            + std::chrono::milliseconds(WATCH_POLL_INTERVAL_MS));
+        if (!state->cond.wait_until(lock, slice, [&state]() { return state->done; })
+            && std::chrono::steady_clock::now() >= deadline) {
+            state->abandoned = true;
+            error = "Resolving host " + host + " timed out";
+            return nullptr;
+        }
+    }
+    if (state->rc != 0 || !state->result) {
+        if (state->result) {
+            freeaddrinfo(state->result);
+        }
+#ifdef _WIN32
+        error = "Failed to resolve host " + host + ": error " + std::to_string(state->rc);
+#else
+        error = "Failed to resolve host " + host + ": " + gai_strerror(state->rc);
+#endif
+        return nullptr;
+    }
+    return state->result;
+}
+
+// 解析host并连接，解析和连接共用timeoutMs；多个地址时IPv6和IPv4交替排列，
+// 每隔CONNECT_ATTEMPT_DELAY_MS并行尝试下一个地址，最先连上的胜出(RFC 8305)
+// 至少每WATCH_POLL_INTERVAL_MS检查一次stopRequested，为true时放弃连接
+static socket_t connectHappyEyeballs(const std::string& host, uint16_t port, const SocketProfile& profile,
+    int timeoutMs, const std::function<bool()>& stopRequested, std::string& error) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    addrinfo* result = resolveHost(host, port, deadline, stopRequested, error);
+    if (!result) {
+        return INVALID_SOCK;
+    }
+
+    std::vector<const addrinfo*> ipv6, ipv4, addresses;
+    for (const addrinfo* it = result; it; it = it->ai_next) {
+        (it->ai_family == AF_INET6 ? ipv6 : ipv4).push_back(it);
+    }
+    for (size_t i = 0; i < std::max(ipv6.size(), ipv4.size()); ++i) {
+        if (i < ipv6.size()) addresses.push_back(ipv6[i]);
+        if (i < ipv4.size()) addresses.push_back(ipv4[i]);
+    }
+
+    std::vector<socket_t> pending;
+    socket_t connected = INVALID_SOCK;
+    size_t next = 0;
+    auto nextAttempt = std::chrono::steady_clock::now();
+    error = "Failed to connect to server";
+    while (connected == INVALID_SOCK) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            error = "Connection to " + host + " timed out";
+            break;
+        }
+        if (stopRequested()) {
+            error = "Connection cancelled";
+            break;
+        }
+        // 到了尝试下一个地址的时间，或在途的连接都已失败
+        if (next < addresses.size() && (now >= nextAttempt || pending.empty())) {
+            socket_t sock = startConnect(addresses[next++], profile);
+            if (sock != INVALID_SOCK) {
+                pending.push_back(sock);
+            }
+            nextAttempt = now + std::chrono::milliseconds(CONNECT_ATTEMPT_DELAY_MS);
+            continue;
+        }
+        if (pending.empty()) {
+            break;  // 所有地址都连接失败
+        }
+
+        auto waitUntil = next < addresses.size() ? std::min(nextAttempt, deadline) : deadline;
+        long long waitMs = std::max<long long>(0, std::min<long long>(WATCH_POLL_INTERVAL_MS,
+            std::chrono::duration_cast<std::chrono::milliseconds>(waitUntil - now).count()));
+        fd_set writeSet, errorSet;
+        FD_ZERO(&writeSet);
+        FD_ZERO(&errorSet);
+        socket_t maxSock = 0;
+        for (socket_t sock : pending) {
+            FD_SET(sock, &writeSet);
+            FD_SET(sock, &errorSet);
+            maxSock = std::max(maxSock, sock);
+        }
+        timeval timeout;
+        timeout.tv_sec = static_cast<long>(waitMs / 1000);
+        timeout.tv_usec = static_cast<long>((waitMs % 1000) * 1000);
+        int ready = select(static_cast<int>(maxSock + 1), nullptr, &writeSet, &errorSet, &timeout);
+        if (ready < 0) {
+            break;
+        }
+
+        // 可写表示连接完成，再由SO_ERROR区分成功和失败
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (!FD_ISSET(*it, &writeSet) && !FD_ISSET(*it, &errorSet)) {
+                ++it;
+                continue;
+            }
+            int soError = 0;
+            socklen_t len = sizeof(soError);
+            getsockopt(*it, SOL_SOCKET, SO_ERROR, (char*)&soError, &len);
+            if (soError == 0 && connected == INVALID_SOCK) {
+                connected = *it;
+            } else {
+                CLOSE_SOCKET(*it);
+            }
+            it = pending.erase(it);
+        }
+    }
+
+    for (socket_t sock : pending) {
+        CLOSE_SOCKET(sock);
+    }
+    freeaddrinfo(result);
+    if (connected != INVALID_SOCK) {
+        setSocketBlocking(connected, true);
+        setSocketTimeouts(connected, IO_TIMEOUT_MS);
+    }
+    return connected;
+}
+
 // 构造函数：初始化网络环境
-Net_Tool::Net_Tool() : m_sock(INVALID_SOCK), m_isConnected(false) {
+Net_Tool::Net_Tool() : m_sock(INVALID_SOCK), m_isConnected(false), m_port(0)
+    , m_connectionGeneration(0), m_lastActivityMs(0), m_reconnecting(false)
+    , m_connectAborted(false), m_connectingSock(INVALID_SOCK), m_nextSequence(0)
+    , m_socketProfile(SocketProfile::forProfile(ConnectionProfile::Balanced))
+    , m_connectTimeoutMs(CONNECT_TIMEOUT_MS), m_tlsEnabled(false), m_capabilities(new ServerCapabilities())
+    , m_watchRunning(false), m_watchActive(false) {
+    TransferScheduler::instance().registerTask(PREFETCH_FLOW_ID,
+        TransferScheduler::weightForPriority(static_cast<int>(TransferPriority::Low)));
+    // 服务端主动发来的帧
+    m_dispatcher.on<transfer::ChangeNotification>([this](const transfer::ChangeNotification& notification) {
+        handleNotification(notification);
+    });
+    // 握手超时后才到达的响应，本次连接已按旧协议处理，读走丢弃
+    m_dispatcher.on<transfer::HelloResponse>([](const transfer::HelloResponse&) {});
 #ifdef _WIN32
     WSADATA wsaData;
     if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
@@ -37,6 +420,9 @@ Net_Tool::Net_Tool() : m_sock(INVALID_SOCK), m_isConnected(false) {
             m_errorCallback("Failed to initialize Winsock");
         }
     }
+#else
+    // OpenSSL用write发送，无法按次指定MSG_NOSIGNAL，对端关闭时改为返回EPIPE
+    signal(SIGPIPE, SIG_IGN);
 #endif
 }
 
@@ -61,70 +447,453 @@ Net_Tool::~Net_Tool() {
 }
 
 // 连接到指定服务器
-bool Net_Tool::connectToServer(const std::string& serverIP, uint16_t port) {
-    std::lock_guard<std::mutex> lock(m_sockMutex);
-    
+bool Net_Tool::connectToServer(const std::string& host, uint16_t port) {
     if (m_isConnected) {
         disconnect();
     }
+    stopWatchThread();
+    m_connectAborted = false;
 
-    // 创建socket
-    m_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (m_sock == INVALID_SOCK) {
-        if (m_errorCallback) {
-            m_errorCallback("Failed to create socket");
-        }
+    m_host = host;
+    m_port = port;
+    if (!establishConnection()) {
         return false;
     }
 
-    //linux和window下非阻塞设置不一样
-// #ifdef _WIN32
-//     u_long iMode = 1;
-//     ioctlsocket(m_sock, FIONBIO, &iMode);
-// #else
-//     int flags = fcntl(m_sock, F_GETFL, 0);
-//     fcntl(m_sock, F_SETFL, flags | O_NONBLOCK);
-// #endif
-
-    // 设置服务器地址
-    sockaddr_in serverAddr;
-    serverAddr.sin_family = AF_INET;
-    serverAddr.sin_port = htons(port);
-    if (inet_pton(AF_INET, serverIP.c_str(), &serverAddr.sin_addr) != 1) {
-        if (m_errorCallback) {
-            m_errorCallback("Invalid IP address");
-        }
-        CLOSE_SOCKET(m_sock);
+    // 订阅目录变化后服务端随时可能推送，空闲时由单独的线程读取；该线程同时负责心跳和断线重连
+    m_watchActive = false;
+    m_watchRunning = true;
+    m_watchThread = std::thread(&Net_Tool::watchLoop, this);
+    return true;
+}
+
+bool Net_Tool::establishConnection() {
+    // 握手完成前按旧协议的默认能力收发
+    setCapabilities(ServerCapabilities());
+    if (!openConnection(m_host, m_port)) {
         return false;
     }
+    // 已确认不支持握手的服务端，重连时不再等待握手超时
+    std::string server = m_host + ":" + std::to_string(m_port);
+    if (m_legacyServers.count(server) > 0) {
+        return true;
+    }
+    // 协商结果先写入局部对象，完成后整体发布，其他线程不会读到一半的结果
+    // 旧服务端收到未知的握手消息可能直接断开，此时重连并按旧协议通信
+    ServerCapabilities negotiated;
+    bool legacy = false;
+    if (!negotiateCapabilities(negotiated, legacy)) {
+        closeSocket();
+        if (!openConnection(m_host, m_port)) {
+            return false;
+        }
+        negotiated = ServerCapabilities();
+        legacy = true;
+    }
+    // 超时可能只是服务端或网络一时繁忙，下次连接仍然握手
+    if (legacy) {
+        m_legacyServers.insert(server);
+    }
+    setCapabilities(negotiated);
+    return true;
+}
 
-    // 连接服务器
-    if (connect(m_sock, (sockaddr*)&serverAddr, sizeof(serverAddr)) == SOCK_ERROR) {
-        if (m_errorCallback) {
-#ifdef _WIN32
-            m_errorCallback("Failed to connect to server");
-#else
-            m_errorCallback(std::string("Failed to connect to server: ") + strerror(errno));
-#endif
+void Net_Tool::setCapabilities(const ServerCapabilities& capabilities) {
+    std::atomic_store(&m_capabilities, std::shared_ptr<const ServerCapabilities>(new ServerCapabilities(capabilities)));
+}
+
+bool Net_Tool::openConnection(const std::string& host, uint16_t port) {
+    // 解析和连接可能耗时数秒，不持有socket锁
+    std::string error;
+    socket_t sock = connectHappyEyeballs(host, port, m_socketProfile, m_connectTimeoutMs,
+        [this]() { return m_connectAborted.load(); }, error);
+    if (sock == INVALID_SOCK) {
+        // 自动重连期间反复失败只在断开时报告一次，用户断开时不报告
+        if (m_errorCallback && !m_reconnecting && !m_connectAborted) {
+            m_errorCallback(error);
         }
-        CLOSE_SOCKET(m_sock);
         return false;
     }
 
+    // 握手在新建的TLS连接上进行，不改动m_tls，同样不持有socket锁；socket已设置收发超时，握手不会无限阻塞
+    // 握手期间登记socket，用户断开时关闭其读写，握手立即失败
+    ssl_st* ssl = nullptr;
+    if (m_tlsEnabled) {
+        bool aborted = false;
+        {
+            std::lock_guard<std::mutex> lock(m_connectingMutex);
+            aborted = m_connectAborted;
+            m_connectingSock = aborted ? INVALID_SOCK : sock;
+        }
+        if (!aborted) {
+            ssl = m_tls.handshake(static_cast<int>(sock), host, port, error);
+            std::lock_guard<std::mutex> lock(m_connectingMutex);
+            m_connectingSock = INVALID_SOCK;
+        }
+        if (!ssl) {
+            CLOSE_SOCKET(sock);
+            if (m_errorCallback && !m_reconnecting && !m_connectAborted) {
+                m_errorCallback(error);
+            }
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_sockMutex);
+    // 断开时已关闭了m_sock，在锁内再确认一次，不在断开之后换入新连接
+    if (m_connectAborted) {
+        TlsTransport::discard(ssl);
+        CLOSE_SOCKET(sock);
+        return false;
+    }
+    m_tls.attach(ssl);
+    m_sock = sock;
     m_isConnected = true;
+    std::atomic_store(&m_serverAddress, std::shared_ptr<const std::string>(
+        new std::string(host + ":" + std::to_string(port))));
+    std::atomic_store(&m_sessionId, std::shared_ptr<const std::string>(new std::string(generateTaskId())));
+    ++m_connectionGeneration;
+    m_lastActivityMs = steadyNowMs();
+    return true;
+}
+
+bool Net_Tool::negotiateCapabilities(ServerCapabilities& result, bool& legacy) {
+    result = ServerCapabilities();
+    legacy = false;
+
+    transfer::HelloRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::HELLO)));
+    request.set_protocol_version(PROTOCOL_VERSION);
+    request.set_min_protocol_version(MIN_PROTOCOL_VERSION);
+    request.set_max_frame_size(MAX_FRAME_SIZE);
+    request.add_compressions(COMPRESSION_ZLIB);
+    // 文件校验目前只实现了MD5(分片另有CRC32校验和，与协商无关)，不声明未实现的算法
+    request.add_hash_algorithms(HASH_MD5);
+    request.set_raw_data_frames(false);
+    request.set_window_size(CLIENT_WINDOW_SIZE);
+    request.set_multiplexing(false);
+    for (const char* feature : { FEATURE_LISTING_V2, FEATURE_LISTING_DELTA, FEATURE_WATCH,
+                                 FEATURE_SEARCH, FEATURE_SEARCH_CURSOR, FEATURE_ARCHIVE, FEATURE_ARCHIVE_TRAILER,
+                                 FEATURE_HEARTBEAT }) {
+        request.add_features(feature);
+    }
+    request.set_client_name("FileClient");
+
+    TransferScheduler::instance().acquireInteractive();
+    uint64_t sequence = stampHeader(request.mutable_header());
+    bool alive = sendMessage(request);
+    bool answered = alive && waitReadable(HELLO_TIMEOUT_MS);
+    char probe = 0;
+    if (answered && peek_read(&probe, 1) <= 0) {
+        alive = false;  // 服务端关闭了连接
+    }
+    // 握手期间没有其他请求，直接读一帧；旧服务端可能回了别的消息，读走后不作为错误报告
+    transfer::HelloResponse response;
+    bool received = false;
+    if (alive && answered) {
+        char type = 0;
+        std::string frame;
+        alive = receiveFrame(type, frame);
+        legacy = alive && type != HELLO_TYPE;
+        received = alive && type == HELLO_TYPE && response.ParseFromString(frame)
+            && (response.header().sequence() == 0 || response.header().sequence() == sequence);
+    }
+    TransferScheduler::instance().release();
+    if (!alive) {
+        return false;
+    }
+    if (!received) {
+        // 回了别的消息或超时，连接仍可用，本次按旧协议处理；超时后迟到的握手响应由m_dispatcher丢弃
+        return true;
+    }
+    if (!response.header().success() || response.protocol_version() < MIN_PROTOCOL_VERSION
+        || response.protocol_version() > PROTOCOL_VERSION) {
+        return true;
+    }
+
+    // 协商结果只取双方都支持的部分
+    result.protocolVersion = response.protocol_version();
+    if (response.max_frame_size() > 0) {
+        result.maxFrameSize = std::min<uint64_t>(response.max_frame_size(), MAX_FRAME_SIZE);
+    }
+    if (response.compression() == COMPRESSION_ZLIB) {
+        result.compression = response.compression();
+    }
+    if (response.hash_algorithm() == HASH_MD5) {
+        result.hashAlgorithm = response.hash_algorithm();
+    }
+    result.rawDataFrames = false;
+    result.windowSize = std::max<uint32_t>(1, std::min<uint32_t>(response.window_size(), CLIENT_WINDOW_SIZE));
+    result.multiplexing = false;
+    for (const auto& feature : response.features()) {
+        result.features.insert(feature);
+    }
+    result.serverName = response.server_name();
     return true;
 }
 
+void Net_Tool::setTls(bool enabled, const std::string& caFile) {
+    m_tlsEnabled = enabled;
+    m_tls.setCaFile(caFile);
+}
+
 // 断开服务器连接
 void Net_Tool::disconnect() {
+    m_watchRunning = false;
+    m_watchActive = false;
+    // 后台线程可能正在重连，先让解析、连接和握手尽快失败，等待它退出时不会阻塞界面
+    abortConnecting();
+    closeSocket();
+    stopWatchThread();
+    m_connectedCond.notify_all();
+}
+
+void Net_Tool::abortConnecting() {
+    m_connectAborted = true;
+    std::lock_guard<std::mutex> lock(m_connectingMutex);
+    if (m_connectingSock != INVALID_SOCK) {
+        shutdown(m_connectingSock, SHUTDOWN_BOTH);
+    }
+}
+
+void Net_Tool::closeSocket() {
     std::lock_guard<std::mutex> lock(m_sockMutex);
+    // 主动断开时通知服务端，会话票据仍可用于下次连接
+    m_tls.close(true);
     if (m_sock != INVALID_SOCK) {
+        // 先关闭读写，唤醒正在select该socket的线程(如等待握手响应)
+        shutdown(m_sock, SHUTDOWN_BOTH);
         CLOSE_SOCKET(m_sock);
         m_sock = INVALID_SOCK;
     }
     m_isConnected = false;
 }
 
+void Net_Tool::dropConnectionLocked(const std::string& reason) {
+    m_tls.close(false);
+    if (m_sock != INVALID_SOCK) {
+        CLOSE_SOCKET(m_sock);
+        m_sock = INVALID_SOCK;
+    }
+    // 旧连接上的请求不会再有响应
+    m_pendingRequests.clear();
+    m_watchActive = false;
+    if (!m_isConnected.exchange(false) || m_reconnecting) {
+        return;
+    }
+    if (m_errorCallback) {
+        m_errorCallback(reason);
+    }
+    // 后台线程运行时(连接建立之后)才自动重连
+    if (m_watchRunning && m_connectionStateCallback) {
+        m_connectionStateCallback(false);
+    }
+}
+
+// 按退避间隔重连，服务端重启期间不频繁重试
+void Net_Tool::reconnect() {
+    m_reconnecting = true;
+    int delay = RECONNECT_MIN_DELAY_MS;
+    while (m_watchRunning) {
+        for (int waited = 0; waited < delay && m_watchRunning; waited += WATCH_POLL_INTERVAL_MS) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_POLL_INTERVAL_MS));
+        }
+        if (!m_watchRunning || establishConnection()) {
+            break;
+        }
+        delay = std::min(delay * 2, RECONNECT_MAX_DELAY_MS);
+    }
+    m_reconnecting = false;
+    if (m_watchRunning && m_isConnected && m_connectionStateCallback) {
+        m_connectionStateCallback(true);
+    }
+    m_connectedCond.notify_all();
+}
+
+bool Net_Tool::waitForReconnect(TransferTask* task, uint64_t generation) {
+    // 连接仍是原来的连接，失败与连接无关(如服务端拒绝)，不重试
+    if (m_isConnected && !m_reconnecting && m_connectionGeneration == generation) {
+        return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(RECONNECT_WAIT_MS);
+    std::unique_lock<std::mutex> lock(m_sockMutex);
+    while (!task->cancelled() && m_watchRunning && std::chrono::steady_clock::now() < deadline) {
+        if (m_isConnected && !m_reconnecting && m_connectionGeneration != generation) {
+            return true;
+        }
+        m_connectedCond.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+void Net_Tool::sendHeartbeat() {
+    transfer::HeartbeatRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::HEARTBEAT)));
+    request.set_timestamp_ms(static_cast<uint64_t>(steadyNowMs()));
+
+    TransferScheduler::instance().acquireInteractive();
+    uint64_t sequence = stampHeader(request.mutable_header());
+    if (sendMessage(request)) {
+        transfer::HeartbeatResponse response;
+        if (waitReadable(HEARTBEAT_TIMEOUT_MS)) {
+            receiveMessage(response, sequence);  // 收不到时receiveData已标记连接中断
+        } else {
+            std::lock_guard<std::mutex> lock(m_sockMutex);
+            dropConnectionLocked("Heartbeat timed out, connection lost");
+        }
+    }
+    TransferScheduler::instance().release();
+}
+
+void Net_Tool::stopWatchThread() {
+    m_watchRunning = false;
+    if (m_watchThread.joinable()) {
+        if (m_watchThread.get_id() == std::this_thread::get_id()) {
+            m_watchThread.detach();
+        } else {
+            m_watchThread.join();
+        }
+    }
+}
+
+bool Net_Tool::waitReadable(int timeoutMs) {
+    // socket可能随时被其他线程关闭或替换，在锁内取快照；
+    // 锁被占用说明有交互正在收发，到达的数据由它读取，这里按不可读处理
+    socket_t sock = INVALID_SOCK;
+    uint64_t generation = 0;
+    bool tls = false;
+    {
+        std::unique_lock<std::mutex> lock(m_sockMutex, std::try_to_lock);
+        if (lock.owns_lock() && m_isConnected) {
+            sock = m_sock;
+            generation = m_connectionGeneration;
+            tls = m_tls.isActive();
+            // TLS已解密缓存的数据select看不到
+            if (sock != INVALID_SOCK && m_tls.pending() > 0) {
+                return true;
+            }
+        }
+    }
+    if (sock == INVALID_SOCK) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+        return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true) {
+        long long waitMs = std::max<long long>(0, std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count());
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(sock, &readSet);
+        timeval timeout;
+        timeout.tv_sec = static_cast<long>(waitMs / 1000);
+        timeout.tv_usec = static_cast<long>((waitMs % 1000) * 1000);
+#ifdef _WIN32
+        int ready = select(0, &readSet, nullptr, nullptr, &timeout);
+#else
+        int ready = select(sock + 1, &readSet, nullptr, nullptr, &timeout);
+#endif
+        if (ready < 0) {
+            // socket已关闭等情况，避免空转
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+            return false;
+        }
+        // 等待期间连接被关闭或替换时，描述符可能已被复用，结果不属于当前连接
+        if (!m_isConnected || m_connectionGeneration != generation || ready == 0) {
+            return false;
+        }
+        if (!tls) {
+            return true;
+        }
+        // TLS连接可读时到达的可能只是会话票据等握手后的记录，接着读帧会持有锁一直阻塞；
+        // 在非阻塞socket上处理掉这些记录，确认有应用数据才算可读，否则继续等到超时
+        {
+            std::unique_lock<std::mutex> lock(m_sockMutex, std::try_to_lock);
+            if (!lock.owns_lock() || !m_isConnected || m_connectionGeneration != generation) {
+                return false;
+            }
+            setSocketBlocking(sock, false);
+            bool hasData = m_tls.applicationDataReady();
+            setSocketBlocking(sock, true);
+            if (hasData) {
+                return true;
+            }
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+    }
+}
+
+// 空闲时读取服务端推送
+// 取得socket后仍然可读才读：此时没有未完成的交互，到达的数据只能是推送
+// 交互进行中到达的推送由receiveMessage顺带处理
+// 连接空闲超过HEARTBEAT_INTERVAL_MS时发送心跳，连接中断后在本线程中重连
+void Net_Tool::watchLoop() {
+    while (m_watchRunning) {
+        if (!m_isConnected) {
+            reconnect();
+            continue;
+        }
+        if (!waitReadable(WATCH_POLL_INTERVAL_MS)) {
+            if (m_isConnected && hasFeature(FEATURE_HEARTBEAT)
+                && steadyNowMs() - m_lastActivityMs >= HEARTBEAT_INTERVAL_MS) {
+                sendHeartbeat();
+            }
+            continue;
+        }
+        TransferScheduler::instance().acquireInteractive();
+        bool ok = true;
+        while (ok && m_watchRunning && waitReadable(0)) {
+            char type = 0;
+            std::string frame;
+            ok = receiveFrame(type, frame);
+            if (ok && !m_dispatcher.dispatch(type, frame) && m_errorCallback) {
+                m_errorCallback("Unexpected frame type " + std::to_string(static_cast<int>(type)));
+            }
+        }
+        TransferScheduler::instance().release();
+        // 连接断开时下一轮重连；收到意外的消息时已读走，继续读取推送
+    }
+}
+
+void Net_Tool::handleNotification(const transfer::ChangeNotification& notification) {
+    // 缓存中的列表已过时
+    DirectoryCache::instance().invalidate(serverAddress(), notification.path());
+    if (m_changeCallback) {
+        m_changeCallback(notification);
+    }
+}
+
+bool Net_Tool::watchDirectories(const std::vector<std::string>& paths) {
+    transfer::WatchRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::WATCH)));
+    for (const auto& path : paths) {
+        request.add_paths(path);
+    }
+    transfer::WatchResponse response;
+    bool accepted = exchangeMessage(request, response) && response.header().success();
+    {
+        std::lock_guard<std::mutex> lock(m_watchMutex);
+        m_watchedPaths.clear();
+        if (accepted) {
+            for (const auto& path : paths) {
+                m_watchedPaths.insert(DirectoryCache::normalizePath(path));
+            }
+        }
+    }
+    m_watchActive = accepted;
+    return accepted;
+}
+
+bool Net_Tool::isWatching(const std::string& path) {
+    if (!m_watchActive) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_watchMutex);
+    return m_watchedPaths.count(DirectoryCache::normalizePath(path)) > 0;
+}
+
 // 发送数据的底层实现
 bool Net_Tool::sendData(const void* data, size_t length) {
     std::lock_guard<std::mutex> lock(m_sockMutex);
@@ -139,28 +908,28 @@ bool Net_Tool::sendData(const void* data, size_t length) {
     size_t totalSent = 0;
     while (totalSent < length) {
 #ifdef _WIN32
-        int sent = send(m_sock, buffer + totalSent, static_cast<int>(length - totalSent), 0);
-        if (sent == SOCK_ERROR) {
-#else
-        ssize_t sent = send(m_sock, buffer + totalSent, length - totalSent, 0);
-        if (sent < 0) {
-#endif
-            if (m_errorCallback) {
-#ifdef _WIN32
-                m_errorCallback("Failed to send data");
+        int sent = m_tls.isActive() ? m_tls.send(buffer + totalSent, length - totalSent)
+            : send(m_sock, buffer + totalSent, static_cast<int>(length - totalSent), 0);
+        if (sent <= 0) {
+            dropConnectionLocked(isTimeoutError() ? "Send timed out, connection lost" : "Failed to send data");
 #else
-                m_errorCallback(std::string("Failed to send data: ") + strerror(errno));
+        // 对端已关闭时不产生SIGPIPE
+        ssize_t sent = m_tls.isActive() ? m_tls.send(buffer + totalSent, length - totalSent)
+            : send(m_sock, buffer + totalSent, length - totalSent, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            dropConnectionLocked(isTimeoutError() ? std::string("Send timed out, connection lost")
+                : std::string("Failed to send data: ") + strerror(errno));
 #endif
-            }
             return false;
         }
         totalSent += sent;
+        m_lastActivityMs = steadyNowMs();
     }
     return true;
 }
 
 // 接收数据的底层实现
-bool Net_Tool::receiveData(void* buffer, size_t length) {
+bool Net_Tool::receiveData(void* buffer, size_t length, int stallTimeoutMs) {
     std::lock_guard<std::mutex> lock(m_sockMutex);
     if (!m_isConnected) {
         if (m_errorCallback) {
@@ -168,25 +937,34 @@ bool Net_Tool::receiveData(void* buffer, size_t length) {
         }
         return false;
     }
+    // 其余收发仍按IO_TIMEOUT_MS，本次接收结束后恢复
+    bool shortened = stallTimeoutMs != IO_TIMEOUT_MS;
+    if (shortened) {
+        setSocketTimeout(m_sock, SO_RCVTIMEO, stallTimeoutMs);
+    }
 
     // 分块接收数据，确保完整性
     char* buf = static_cast<char*>(buffer);
     size_t totalReceived = 0;
     while (totalReceived < length) {
-        int received = recv(m_sock, buf + totalReceived, static_cast<int>(length - totalReceived), 0);
+        int received = m_tls.isActive() ? m_tls.receive(buf + totalReceived, length - totalReceived)
+            : recv(m_sock, buf + totalReceived, static_cast<int>(length - totalReceived), 0);
         if (received <= 0) {
-            if (m_errorCallback) {
-                m_errorCallback("Failed to receive data");
-            }
+            dropConnectionLocked(received == 0 ? "Connection closed by server"
+                : isTimeoutError() ? "Receive timed out, connection lost" : "Failed to receive data");
             return false;
         }
         totalReceived += received;
+        m_lastActivityMs = steadyNowMs();
+    }
+    if (shortened) {
+        setSocketTimeout(m_sock, SO_RCVTIMEO, IO_TIMEOUT_MS);
     }
     return true;
 }
 
 template<typename T>
-bool Net_Tool::sendMessage(const T& message, char type) {
+bool Net_Tool::sendMessage(const T& message) {
     // // 直接序列化消息并发送
     std::string serialized;
     bool retcode = message.SerializeToString(&serialized);
@@ -197,66 +975,85 @@ bool Net_Tool::sendMessage(const T& message, char type) {
         return false;
     }
 
+    // 超过服务端能接收的最大帧
+    if (serialized.size() > capabilities()->maxFrameSize) {
+        if (m_errorCallback) {
+            m_errorCallback("Message exceeds server max frame size");
+        }
+        return false;
+    }
+
     //再包个底层收发的长度和类型头
     char* buf = new char[sizeof(uint64_t)+sizeof(char)+serialized.size()];
     uint64_t data_len = serialized.size();
-    char type_char = type;
+    char type_char = MessageTraits<T>::tag();
     memcpy((char*)buf,(char*)&data_len,sizeof(uint64_t));//序列化数据长度
     memcpy(buf+sizeof(uint64_t),&type_char,sizeof(char));//类型
     memcpy(buf+sizeof(uint64_t)+sizeof(char),serialized.c_str(),serialized.size());//序列化数据
 
-    sendData(buf, sizeof(uint64_t)+sizeof(char)+serialized.size());
-    free(buf);
-    return true;
+    bool sent = sendData(buf, sizeof(uint64_t)+sizeof(char)+serialized.size());
+    delete[] buf;
+    return sent;
 }
 
-template<typename T>
-bool Net_Tool::receiveMessage(T& message, char type) {
-    // 接收序列化的消息
-    std::string serialized;
-    char buff[65535] = {0};//一包长
-    int ret=0;
-    uint64_t data_len=0;
-    char type_char=0;
-    bool res = true;
-
-    //先看下数据有多少，在接收
-    ret = peek_read(buff, sizeof(buff));
-    if(ret <= 0) {
+bool Net_Tool::receiveFrame(char& type, std::string& frame) {
+    // 先收固定长度的底层收发头
+    char head[sizeof(uint64_t) + sizeof(char)] = {0};
+    uint64_t data_len = 0;
+    if (!receiveData(head, sizeof(head))) {
         return false;
     }
+    memcpy((char*)&data_len, head, sizeof(uint64_t));
+    memcpy((char*)&type, head + sizeof(uint64_t), sizeof(char));
 
-    //接收数据
-    res = receiveData(buff, ret);
-    if(!res) {
-        return false;
-    }
-    //解析底层收发头
-    memcpy((char*)&data_len,buff,sizeof(uint64_t));
-    memcpy((char*)&type_char,buff+sizeof(uint64_t),sizeof(char));
-    if(type_char != type) {
-        //类型不对，返回false
+    // 长度异常说明数据已错位，不按它分配内存
+    if (data_len > MAX_FRAME_SIZE) {
+        std::lock_guard<std::mutex> lock(m_sockMutex);
+        dropConnectionLocked("Frame exceeds max frame size");
         return false;
     }
-    //把序列化部分数据拿到
-    serialized += std::string(buff+sizeof(uint64_t)+sizeof(char), ret-sizeof(uint64_t)-sizeof(char));
+    // 按长度一次分配好缓冲区，直接收到位，避免大目录列表反复拼接字符串
+    // 等帧头的时间包含服务端处理时间；帧头到达后帧体应持续到达，停顿较久即视为连接已断开，
+    // 下载过程中半开的连接不必等满IO_TIMEOUT_MS(空闲时由心跳发现)
+    frame.resize(static_cast<size_t>(data_len));
+    return data_len == 0 || receiveData(&frame[0], frame.size(), FRAME_STALL_TIMEOUT_MS);
+}
 
-    //一包拿不完，继续拿(整理逻辑不太好，有空再优化)
-    uint64_t total_len = ret;
-    while(data_len+sizeof(uint64_t)+sizeof(char) > total_len)
-    {
-        ret = peek_read(buff, sizeof(buff));
-        if(ret <= 0) {
+template<typename T>
+bool Net_Tool::receiveMessage(T& message, uint64_t sequence) {
+    const char type = MessageTraits<T>::tag();
+    std::string serialized;
+    char type_char = 0;
+    while (true) {
+        // 其他请求读socket时可能已把本请求的响应转交过来
+        if (sequence != 0 && m_pendingRequests.take(sequence, type_char, serialized)) {
+            break;
+        }
+        if (!receiveFrame(type_char, serialized)) {
             return false;
         }
-        //接收数据
-        res = receiveData(buff, ret);
-        if(!res) {
+        if (type_char != type) {
+            // 服务端推送可能先于响应到达，按帧类型交给登记的处理函数后继续读响应
+            if (m_dispatcher.dispatch(type_char, serialized)) {
+                continue;
+            }
+            //类型不对，消息体已读走，连接仍保持同步
+            if (m_errorCallback) {
+                m_errorCallback("Unexpected frame type " + std::to_string(static_cast<int>(type_char)));
+            }
             return false;
         }
-        serialized += std::string(buff, ret);
-        total_len += ret;
-    }
+        // 服务端回送了序列号时按序列号匹配：其他在途请求的响应转交给它，
+        // 没有请求登记的是已放弃的请求(如取消、超时)的响应，丢弃后继续读
+        if (sequence != 0) {
+            uint64_t received = responseSequence(serialized);
+            if (received != 0 && received != sequence) {
+                m_pendingRequests.deliver(received, type_char, serialized);
+                continue;
+            }
+        }
+        break;
+    }
 
     // 反序列化消息
     if (!message.ParseFromString(serialized)) {
@@ -269,7 +1066,54 @@ bool Net_Tool::receiveMessage(T& message, char type) {
     return true;
 }
 
+// 发送请求并接收对应的响应，整个交互期间由调度器保证独占socket
+// taskId为空表示交互请求(目录浏览)，优先于所有批量传输
+template<typename Req>
+bool Net_Tool::exchangeMessage(Req& request, typename ResponseOf<Req>::type& response,
+    const std::string& taskId, uint64_t bytes, const std::function<bool()>& isCancelled) {
+    if (taskId.empty()) {
+        TransferScheduler::instance().acquireInteractive();
+    } else if (!TransferScheduler::instance().acquire(taskId, bytes)) {
+        return false;  // 等待期间任务已被取消
+    }
+    if (isCancelled && isCancelled()) {
+        TransferScheduler::instance().release();  // 排队期间请求已作废
+        return false;
+    }
+    // 重发的请求(如重连后续传)也分配新的序列号，旧请求迟到的响应不会被误认
+    uint64_t sequence = stampHeader(request.mutable_header());
+    // 槽位被未注销的旧请求占用时，别人替本请求读到的响应会被丢弃，不发送
+    if (!m_pendingRequests.add(sequence)) {
+        TransferScheduler::instance().release();
+        if (m_errorCallback) {
+            m_errorCallback("Too many requests in flight");
+        }
+        return false;
+    }
+    bool ok = sendMessage(request) && receiveMessage(response, sequence);
+    m_pendingRequests.remove(sequence);
+    TransferScheduler::instance().release();
+    return ok;
+}
+
+template<typename Req>
+bool Net_Tool::exchangeRetrying(TransferTask* task, Req& request, typename ResponseOf<Req>::type& response,
+    uint64_t bytes) {
+    while (true) {
+        uint64_t generation = m_connectionGeneration;
+        if (exchangeMessage(request, response, task->flowId, bytes)) {
+            return true;
+        }
+        if (!waitForReconnect(task, generation)) {
+            return false;
+        }
+    }
+}
+
 int Net_Tool::peek_read(char *buf, int len) {
+    if (m_tls.isActive()) {
+        return m_tls.peek(buf, len);
+    }
 #ifndef _WIN32
     // 使用临时缓冲区进行MSG_PEEK
     int ret = recv(m_sock, buf, len, MSG_PEEK);
@@ -294,12 +1138,175 @@ int Net_Tool::peek_read(char *buf, int len) {
 
 transfer::DirectoryResponse Net_Tool::sendDirectoryRequest(const transfer::DirectoryRequest& request) {
     transfer::DirectoryResponse response;
-    if (!sendMessage(request, DIRECTORY_TYPE) || !receiveMessage(response, DIRECTORY_TYPE)) {
-        if (m_errorCallback) {
+    requestDirectory(request, response);
+    return response;
+}
+
+bool Net_Tool::requestDirectory(const transfer::DirectoryRequest& request, transfer::DirectoryResponse& response,
+    std::function<bool()> isCancelled) {
+    // 未指定页大小时按默认分页，大目录的第一页到达即可显示
+    transfer::DirectoryRequest pagedRequest(request);
+    if (pagedRequest.page_size() == 0) {
+        pagedRequest.set_page_size(DIRECTORY_PAGE_SIZE);
+    }
+    // 服务端支持时请求列式编码
+    if (pagedRequest.encoding() == transfer::LISTING_V1 && hasFeature(FEATURE_LISTING_V2)) {
+        pagedRequest.set_encoding(transfer::LISTING_V2_COLUMNS);
+    }
+    // 只缓存第一页，后续页按游标直接向服务端请求
+    bool firstPage = pagedRequest.cursor().empty();
+
+    // 先查目录缓存，待验证的条目带上etag，服务端未变化时只回not_modified
+    std::string path = DirectoryCache::resolveRequestPath(pagedRequest);
+    transfer::DirectoryResponse cached;
+    bool stale = false;
+    bool hasCached = firstPage && DirectoryCache::instance().lookup(serverAddress(), path, cached, &stale);
+    if (hasCached && !stale) {
+        response = cached;
+        return true;
+    }
+    if (hasCached && !cached.etag().empty()) {
+        pagedRequest.set_if_none_match(cached.etag());
+    }
+
+    if (!exchangeMessage(pagedRequest, response, std::string(), 0, isCancelled)) {
+        if (m_errorCallback && !(isCancelled && isCancelled())) {
             m_errorCallback("Failed to send directory request");
         }
+        return false;
     }
-    return response;
+    if (hasCached && response.header().success() && response.not_modified()) {
+        DirectoryCache::instance().markFresh(serverAddress(), path);
+        response = cached;
+        return true;
+    }
+    if (firstPage) {
+        DirectoryCache::instance().store(serverAddress(), response);
+        if (path.empty() && response.header().success()) {
+            // 记住服务端的默认目录，下次连接可直接从缓存显示
+            DirectoryCache::instance().setHomePath(serverAddress(), response.path());
+        }
+    }
+    return true;
+}
+
+// 预取目录走低优先级的流，不抢占用户操作和传输任务
+bool Net_Tool::prefetchDirectory(const std::string& path, std::function<bool()> isCancelled) {
+    if (DirectoryCache::instance().contains(serverAddress(), path)) {
+        return true;
+    }
+    transfer::DirectoryRequest request;
+    request.mutable_header()->set_type(transfer::DIRECTORY);
+    request.set_current_path("");
+    request.set_dir_name(path);
+    request.set_is_parent(false);
+    request.set_page_size(DIRECTORY_PAGE_SIZE);
+    if (hasFeature(FEATURE_LISTING_V2)) {
+        request.set_encoding(transfer::LISTING_V2_COLUMNS);
+    }
+    transfer::DirectoryResponse cached;
+    bool stale = false;
+    bool hasCached = DirectoryCache::instance().lookup(serverAddress(), path, cached, &stale);
+    if (hasCached && !cached.etag().empty()) {
+        request.set_if_none_match(cached.etag());
+    }
+    transfer::DirectoryResponse response;
+    if (!exchangeMessage(request, response, PREFETCH_FLOW_ID, 0, isCancelled)) {
+        return false;
+    }
+    if (hasCached && response.header().success() && response.not_modified()) {
+        DirectoryCache::instance().markFresh(serverAddress(), path);
+        return true;
+    }
+    DirectoryCache::instance().store(serverAddress(), response);
+    return true;
+}
+
+// 一次请求，多个响应：搜索期间按交互请求独占socket，结果数受limit约束
+bool Net_Tool::searchRemote(const transfer::SearchRequest& request,
+    const std::function<void(const transfer::SearchResponse&)>& onPage,
+    const std::function<bool()>& isCancelled) {
+    transfer::SearchRequest pagedRequest(request);
+    pagedRequest.mutable_header()->set_type(transfer::SEARCH);
+    if (pagedRequest.page_size() == 0) {
+        pagedRequest.set_page_size(SEARCH_PAGE_SIZE);
+    }
+
+    std::string error;
+    transfer::SearchResponse response;
+    if (hasFeature(FEATURE_SEARCH_CURSOR)) {
+        // 每页一次请求-响应，期间的浏览请求和传输可以插在页与页之间
+        bool ok = true;
+        while (true) {
+            if (!exchangeMessage(pagedRequest, response, std::string(), 0, isCancelled)) {
+                ok = false;
+                break;
+            }
+            if (!response.header().success()) {
+                ok = false;
+                error = response.header().error_message();
+                break;
+            }
+            if (!(isCancelled && isCancelled())) {
+                onPage(response);
+            }
+            if (!response.has_more() || (isCancelled && isCancelled())) {
+                break;
+            }
+            pagedRequest.set_cursor(response.next_cursor());
+        }
+        bool cancelled = isCancelled && isCancelled();
+        if (cancelled && !pagedRequest.cursor().empty() && (!ok || response.has_more())) {
+            // 服务端还保留着这次搜索，通知它放弃；失败也无妨，服务端会按超时清理
+            pagedRequest.set_cancel(true);
+            exchangeMessage(pagedRequest, response);
+        }
+        if (!ok && !cancelled && m_errorCallback) {
+            m_errorCallback("Remote search failed: " + request.root_path()
+                + (error.empty() ? "" : " (" + error + ")"));
+        }
+        return ok && !cancelled;
+    }
+
+    TransferScheduler::instance().acquireInteractive();
+    if (isCancelled && isCancelled()) {
+        TransferScheduler::instance().release();
+        return false;
+    }
+    // 各页结果都带这次请求的序列号
+    uint64_t sequence = stampHeader(pagedRequest.mutable_header());
+    bool registered = m_pendingRequests.add(sequence);
+    if (!registered) {
+        error = "too many requests in flight";
+    }
+    bool ok = registered && sendMessage(pagedRequest);
+    while (ok) {
+        if (!receiveMessage(response, sequence)) {
+            ok = false;
+            break;
+        }
+        if (!response.header().success()) {
+            ok = false;
+            error = response.header().error_message();
+            break;
+        }
+        if (!(isCancelled && isCancelled())) {
+            onPage(response);
+        }
+        if (!response.has_more()) {
+            break;
+        }
+    }
+    if (registered) {
+        m_pendingRequests.remove(sequence);
+    }
+    TransferScheduler::instance().release();
+
+    if (!ok && m_errorCallback) {
+        m_errorCallback("Remote search failed: " + request.root_path()
+            + (error.empty() ? "" : " (" + error + ")"));
+    }
+    return ok;
 }
 
 /**
@@ -351,14 +1358,22 @@ std::string Net_Tool::convertToUTF8(const std::string& gbk_str) {
 
 transfer::RequestHeader Net_Tool::createRequestHeader(transfer::MessageType type) {
     transfer::RequestHeader header;
-    header.set_session_id(generateTaskId());  // 使用任务ID生成器来生成会话ID
     header.set_type(type);
-    header.set_timestamp(std::chrono::system_clock::now().time_since_epoch().count());
-    static uint64_t sequence = 0;
-    header.set_sequence(++sequence);
+    stampHeader(&header);
     return header;
 }
 
+uint64_t Net_Tool::stampHeader(transfer::RequestHeader* header) {
+    std::shared_ptr<const std::string> sessionId = std::atomic_load(&m_sessionId);
+    if (sessionId) {
+        header->set_session_id(*sessionId);
+    }
+    header->set_timestamp(std::chrono::system_clock::now().time_since_epoch().count());
+    uint64_t sequence = m_nextSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+    header->set_sequence(sequence);
+    return sequence;
+}
+
 // 计算文件的MD5值
 std::string Net_Tool::calculateFileMD5(const std::string& filePath) {
     std::ifstream file(filePath, std::ios::binary);
@@ -382,13 +1397,14 @@ std::string Net_Tool::calculateFileMD5(const std::string& filePath) {
     // 获取最终的MD5值
     unsigned char result[MD5_DIGEST_LENGTH];
     MD5_Final(result, &md5Context);
+    return md5ToHex(result);
+}
 
-    // 转换为十六进制字符串
-    std::stringstream ss;
-    for (int i = 0; i < MD5_DIGEST_LENGTH; i++) {
-        ss << std::hex << std::setw(2) << std::setfill('0') << (int)result[i];
-    }
-    return ss.str();
+// 计算内存数据的MD5，小文件已整个读入内存时无需再读一遍文件
+std::string Net_Tool::calculateDataMD5(const void* data, size_t length) {
+    unsigned char result[MD5_DIGEST_LENGTH];
+    MD5(static_cast<const unsigned char*>(data), length, result);
+    return md5ToHex(result);
 }
 
 uint32_t Net_Tool::calculateCRC32(const void* data, size_t length) {
@@ -407,16 +1423,16 @@ uint32_t Net_Tool::calculateCRC32(const void* data, size_t length) {
 
 // 生成唯一的任务ID
 std::string Net_Tool::generateTaskId() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 15);
+    // 每个线程一个生成器，多个传输线程同时生成时无需加锁
+    static thread_local std::mt19937_64 gen(std::random_device{}() ^
+        static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
     static const char* hex = "0123456789abcdef";
 
-    // 生成32位的随机十六进制字符串
-    std::string uuid;
-    uuid.reserve(32);
+    // 两个64位随机数拼成32位的十六进制字符串
+    uint64_t parts[2] = { gen(), gen() };
+    std::string uuid(32, '0');
     for (int i = 0; i < 32; ++i) {
-        uuid += hex[dis(gen)];
+        uuid[i] = hex[(parts[i / 16] >> ((15 - i % 16) * 4)) & 0xf];
     }
     return uuid;
 }
@@ -566,6 +1582,7 @@ void Net_Tool::handleTransferProgress(const transfer::TransferProgressResponse&
         case transfer::TRANSFERRING: status = "传输中"; break;
         case transfer::COMPLETED: status = "已完成"; break;
         case transfer::PAUSED: status = "已暂停"; break;
+        case transfer::FAILED: status = "失败"; break;
         default: status = "未知";
     }
 
@@ -580,8 +1597,17 @@ void Net_Tool::handleTransferProgress(const transfer::TransferProgressResponse&
         remainingTime
     );
 
-    // 如果传输完成,清理记录
+    // 同步到传输队列，任务管理器据此显示进度
+    QString queueTaskId = QString::fromStdString(progress.task_id());
+    TransferQueue::instance().updateTaskProgress(queueTaskId, progress.transferred_size(), progress.total_size());
     if (progress.status() == transfer::COMPLETED) {
+        TransferQueue::instance().updateTaskStatus(queueTaskId, TransferStatus::Completed);
+    } else if (progress.status() == transfer::FAILED) {
+        TransferQueue::instance().updateTaskStatus(queueTaskId, TransferStatus::Failed);
+    }
+
+    // 如果传输完成,清理记录
+    if (progress.status() == transfer::COMPLETED || progress.status() == transfer::FAILED) {
         std::lock_guard<std::mutex> lock(progressMutex);
         lastUpdateTime.erase(progress.task_id());
         lastTransferredSize.erase(progress.task_id());
@@ -590,44 +1616,110 @@ void Net_Tool::handleTransferProgress(const transfer::TransferProgressResponse&
 
 // 修改startUploadTask和startDownloadTask中的progressCallback参数
 void Net_Tool::startUploadTask(const std::string& fileName, const std::string& targetPath,
-    std::function<void(const transfer::TransferProgressResponse&)> progressCallback) {
-    std::string taskId = generateTaskId();
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority) {
     
     // 使用普通指针
     TransferTask* task = new TransferTask();
-    task->taskId = taskId;
+    task->taskId = taskId.empty() ? generateTaskId() : taskId;
     task->fileName = fileName;
     task->targetPath = targetPath;
+    task->fileSize = 0;
+    task->transferredSize = 0;
     task->progressCallback = handleTransferProgress;  // 使用统一的进度处理函数
     task->isPaused = false;
     task->isCancelled = false;
+    task->flowId = task->taskId;
+    task->parent = nullptr;
+    task->refreshRemote = true;
     
     {
         // 使用互斥锁保护对任务列表的访问
         std::lock_guard<std::mutex> lock(m_tasksMutex);
         // 将新的传输任务添加到任务映射表中
-        m_transferTasks[taskId] = task;
+        m_transferTasks[task->taskId] = task;
     }
+    TransferScheduler::instance().registerTask(task->taskId,
+        TransferScheduler::weightForPriority(static_cast<int>(priority)));
 
     // 使用成员函数替代lambda表达式
     task->transferThread = std::thread(&Net_Tool::handleUploadTask, this, task);
     task->transferThread.detach();//线程分离
 }
 
+// 开始多个小文件的打包上传任务
+void Net_Tool::startUploadBatchTask(const std::vector<std::string>& fileNames, const std::string& targetPath,
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::vector<std::string>& taskIds, TransferPriority priority) {
+    int weight = TransferScheduler::weightForPriority(static_cast<int>(priority));
+    std::vector<TransferTask*> tasks;
+    for (size_t i = 0; i < fileNames.size(); ++i) {
+        TransferTask* task = new TransferTask();
+        task->taskId = i < taskIds.size() && !taskIds[i].empty() ? taskIds[i] : generateTaskId();
+        task->fileName = fileNames[i];
+        task->targetPath = targetPath;
+        task->fileSize = 0;
+        task->transferredSize = 0;
+        task->progressCallback = handleTransferProgress;  // 使用统一的进度处理函数
+        task->isPaused = false;
+        task->isCancelled = false;
+        task->flowId = task->taskId;
+        task->parent = nullptr;
+        task->refreshRemote = false;  // 全部完成后统一刷新一次
+        tasks.push_back(task);
+    }
+
+    // 打包请求使用单独的调度流，文件的暂停、取消和限速仍按各自的任务处理
+    TransferTask* batch = new TransferTask();
+    batch->taskId = generateTaskId();
+    batch->fileName = targetPath;
+    batch->targetPath = targetPath;
+    batch->fileSize = 0;
+    batch->transferredSize = 0;
+    batch->isPaused = false;
+    batch->isCancelled = false;
+    batch->flowId = batch->taskId;
+    batch->parent = nullptr;
+    batch->refreshRemote = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_tasksMutex);
+        for (TransferTask* task : tasks) {
+            m_transferTasks[task->taskId] = task;
+        }
+        m_transferTasks[batch->taskId] = batch;
+    }
+    for (TransferTask* task : tasks) {
+        TransferScheduler::instance().registerTask(task->taskId, weight);
+    }
+    TransferScheduler::instance().registerTask(batch->taskId, weight);
+
+    batch->transferThread = std::thread(&Net_Tool::handleUploadBatchTask, this, batch, tasks);
+    batch->transferThread.detach();//线程分离
+}
+
 void Net_Tool::startDownloadTask(const std::string& fileName, const std::string& targetPath,
-    std::function<void(const transfer::TransferProgressResponse&)> progressCallback) {
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority) {
     TransferTask* task = new TransferTask();
-    task->taskId = generateTaskId();
+    task->taskId = taskId.empty() ? generateTaskId() : taskId;
     task->fileName = fileName;
     task->targetPath = targetPath;
+    task->fileSize = 0;
+    task->transferredSize = 0;
     task->progressCallback = handleTransferProgress;  // 使用统一的进度处理函数
     task->isPaused = false;
     task->isCancelled = false;
+    task->flowId = task->taskId;
+    task->parent = nullptr;
+    task->refreshRemote = true;
 
     {
         std::lock_guard<std::mutex> lock(m_tasksMutex);
         m_transferTasks[task->taskId] = task;
     }
+    TransferScheduler::instance().registerTask(task->taskId,
+        TransferScheduler::weightForPriority(static_cast<int>(priority)));
 
     // 使用成员函数替代lambda表达式
     task->transferThread = std::thread(&Net_Tool::handleDownloadTask, this, task);
@@ -636,13 +1728,88 @@ void Net_Tool::startDownloadTask(const std::string& fileName, const std::string&
 
 // 上传任务处理函数
 void Net_Tool::handleUploadTask(TransferTask* task)
+{
+    uploadFile(task);
+    finishTask(task);
+}
+
+// 打包上传多个小文件
+// 暂停或取消的文件不参与打包，打包未成功的文件逐个上传，由uploadFile负责暂停和报错
+void Net_Tool::handleUploadBatchTask(TransferTask* batch, std::vector<TransferTask*> tasks)
+{
+    std::vector<bool> uploaded(tasks.size(), false);
+    size_t next = 0;
+    while (next < tasks.size()) {
+        std::vector<size_t> group;
+        std::vector<std::string> fileNames, targetPaths;
+        uint64_t groupBytes = 0;
+        for (; next < tasks.size() && group.size() < SMALL_BATCH_COUNT; ++next) {
+            TransferTask* task = tasks[next];
+            if (task->paused() || task->cancelled()) {
+                continue;
+            }
+            std::ifstream file(convertToGBK(task->fileName), std::ios::binary | std::ios::ate);
+            uint64_t fileSize = file ? static_cast<uint64_t>(file.tellg()) : 0;
+            if (!group.empty() && groupBytes + fileSize > SMALL_BATCH_BYTES) {
+                break;
+            }
+            task->fileSize = fileSize;
+            groupBytes += fileSize;
+            group.push_back(next);
+            fileNames.push_back(task->fileName);
+            targetPaths.push_back(task->targetPath);
+        }
+        if (group.size() < 2) {
+            continue;  // 单个文件打包没有好处，留给逐个上传
+        }
+
+        std::vector<bool> results;
+        uploadFileBatch(batch, fileNames, targetPaths, results);
+        for (size_t k = 0; k < group.size(); ++k) {
+            TransferTask* task = tasks[group[k]];
+            if (!results[k]) {
+                continue;
+            }
+            uploaded[group[k]] = true;
+            task->transferredSize = task->fileSize;
+            if (task->progressCallback) {
+                transfer::TransferProgressResponse progress;
+                progress.set_task_id(task->taskId);
+                progress.set_task_name(task->fileName);
+                progress.set_total_size(task->fileSize);
+                progress.set_transferred_size(task->fileSize);
+                progress.set_progress(100);
+                progress.set_status(transfer::COMPLETED);
+                task->progressCallback(progress);
+            }
+        }
+    }
+
+    bool anyUploaded = false;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (!uploaded[i]) {
+            uploaded[i] = uploadFile(tasks[i]);
+        }
+        anyUploaded = anyUploaded || uploaded[i];
+    }
+    if (anyUploaded && !tasks.empty()) {
+        refreshRemoteDirectory(tasks.front()->targetPath);
+    }
+    for (TransferTask* task : tasks) {
+        finishTask(task);
+    }
+    finishTask(batch);
+}
+
+// 上传单个文件
+bool Net_Tool::uploadFile(TransferTask* task)
 {
     std::ifstream file(convertToGBK(task->fileName), std::ios::binary | std::ios::ate);
     if (!file) {
         if (m_errorCallback) {
             m_errorCallback("Failed to open file: " + task->fileName);
         }
-        return;
+        return false;
     }
 
     // 获取文件大小
@@ -650,327 +1817,1226 @@ void Net_Tool::handleUploadTask(TransferTask* task)
     // 将文件指针重置到开头
     file.seekg(0);
 
-    // 创建并发送上传请求
+    // 创建上传请求，之后每个分片都是一次 请求-响应 交互
     auto request = createUploadRequest(task->fileName, task->targetPath);
-    if (!sendMessage(request, UPLOAD_TYPE)) {
-        if (m_errorCallback) {
-            m_errorCallback("Failed to send upload request");
-        }
-        file.close();
-        return;
-    }
     uint64_t file_total_len = 0;//以获取文件数据长度
+    int retry = 0;
+    bool completed = false;
     
     transfer::UploadResponse response;
-    do
+    while (!task->cancelled())
     {
-        if (!receiveMessage(response, UPLOAD_TYPE)) {
+        // 处理暂停状态
+        while (task->paused() && !task->cancelled()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        uint64_t chunk_len = request.files(0).data().size();
+        BandwidthLimiter::instance().acquire(serverAddress(), task->flowId, chunk_len);
+        uint64_t generation = m_connectionGeneration;
+        if (!exchangeMessage(request, response, task->flowId, chunk_len)) {
+            // 连接中断时等待自动重连，重连后重发当前分片续传
+            if (waitForReconnect(task, generation)) {
+                continue;
+            }
             if (m_errorCallback) {
-                m_errorCallback("Failed to receive upload response");
+                m_errorCallback("Failed to upload file: " + task->fileName);
             }
-            file.close();
-            return;
+            break;
         }
-        if(response.results().size() > 0
-        && response.header().session_id() == request.header().session_id())
-        {
-            file_total_len += request.files(0).data().length();//暂时只针对单个文件
-            auto fileInfo = response.results(0);
-            if(fileInfo.success() == true)
-            {//上传成功
-                int next_sequence = fileInfo.next_sequence();
-                // 更新进度
-                if (task->progressCallback) {
-                    transfer::TransferProgressResponse progress;
-                    progress.set_task_id(task->taskId);
-                    progress.set_task_name(task->fileName);
-                    progress.set_total_size(task->fileSize);
-
-                    if (next_sequence == -1 || next_sequence * CHUNK_SIZE >= task->fileSize) {
-                        progress.set_status(transfer::COMPLETED);
-                        progress.set_transferred_size(task->fileSize);
-                        progress.set_progress(100);
-                    } else {
-                        progress.set_status(transfer::TRANSFERRING);
-                        progress.set_transferred_size(file_total_len);
-                        if (task->fileSize > 0) {
-                            progress.set_progress(static_cast<uint32_t>((file_total_len * 100) / task->fileSize));
-                        } else {
-                            progress.set_progress(0); // 防止除以零
-                        }
-                    }
+        if(response.results().size() == 0
+        || response.header().session_id() != request.header().session_id()
+        || response.results(0).success() == false)
+        {//上个没成功，重新上传
+            if (++retry > MAX_CHUNK_RETRY) {
+                if (m_errorCallback) {
+                    m_errorCallback("Failed to upload file: " + task->fileName);
+                }
+                break;
+            }
+            continue;
+        }
+        retry = 0;
+
+        //上传成功
+        file_total_len += request.files(0).data().length();//暂时只针对单个文件
+        task->transferredSize = file_total_len;
+        int next_sequence = response.results(0).next_sequence();
+        // 更新进度
+        if (task->progressCallback) {
+            transfer::TransferProgressResponse progress;
+            progress.set_task_id(task->taskId);
+            progress.set_task_name(task->fileName);
+            progress.set_total_size(task->fileSize);
 
-                    task->progressCallback(progress);
+            if (next_sequence == -1 || next_sequence * CHUNK_SIZE >= task->fileSize) {
+                progress.set_status(transfer::COMPLETED);
+                progress.set_transferred_size(task->fileSize);
+                progress.set_progress(100);
+            } else {
+                progress.set_status(transfer::TRANSFERRING);
+                progress.set_transferred_size(file_total_len);
+                if (task->fileSize > 0) {
+                    progress.set_progress(static_cast<uint32_t>((file_total_len * 100) / task->fileSize));
+                } else {
+                    progress.set_progress(0); // 防止除以零
                 }
-                if(next_sequence > 0)
-                {//分片，还未传完
-                    //分片需要更新的参数有：分片序号、数据、校验和、传输状态、断点续传的起始位置
-                    //auto req_info = request.mutable_files(0);//可修改
-                    for (int i = 0; i < request.files_size(); ++i) 
-                    {
-                        auto req_info = request.mutable_files(i);//可修改
-                        req_info->set_chunk_sequence(next_sequence);//分片序号
-                        file.seekg(next_sequence*CHUNK_SIZE,std::ios::beg);//偏移到待取的位置
-                        uint64_t next_size = task->fileSize-next_sequence*CHUNK_SIZE;
-                        if(next_size > CHUNK_SIZE)
-                            next_size = CHUNK_SIZE;
-                        std::vector<char> chunk_data(next_size);
-                        file.read(chunk_data.data(),next_size);
-                        req_info->set_data(chunk_data.data(),next_size);//读取数据
-                        req_info->set_checksum(calculateCRC32(chunk_data.data(),next_size));//校验和
-                        req_info->set_status(transfer::TRANSFERRING);//传输状态
-                        req_info->set_offset(next_sequence*CHUNK_SIZE);//断点续传的起始位置
-                        if (!sendMessage(request, UPLOAD_TYPE)) {
-                            if (m_errorCallback) {
-                                m_errorCallback("Failed to send upload request");
-                            }
-                            file.close();
-                            return;
+            }
+
+            task->progressCallback(progress);
+        }
+
+        if(next_sequence <= 0)
+        {//文件上传完成
+            completed = true;
+            DirectoryCache::instance().invalidate(serverAddress(), request.files(0).target_path());
+            if (task->refreshRemote) {
+                refreshRemoteDirectory(request.files(0).target_path());
+            }
+            break;
+        }
+
+        //分片，还未传完
+        //分片需要更新的参数有：分片序号、数据、校验和、传输状态、断点续传的起始位置
+        for (int i = 0; i < request.files_size(); ++i) 
+        {
+            auto req_info = request.mutable_files(i);//可修改
+            req_info->set_chunk_sequence(next_sequence);//分片序号
+            file.seekg(next_sequence*CHUNK_SIZE,std::ios::beg);//偏移到待取的位置
+            uint64_t next_size = task->fileSize-next_sequence*CHUNK_SIZE;
+            if(next_size > CHUNK_SIZE)
+                next_size = CHUNK_SIZE;
+            std::vector<char> chunk_data(next_size);
+            file.read(chunk_data.data(),next_size);
+            req_info->set_data(chunk_data.data(),next_size);//读取数据
+            req_info->set_checksum(calculateCRC32(chunk_data.data(),next_size));//校验和
+            req_info->set_status(transfer::TRANSFERRING);//传输状态
+            req_info->set_offset(next_sequence*CHUNK_SIZE);//断点续传的起始位置
+        }
+    }
+
+    file.close();
+    return completed;
+}
+
+// 把多个小文件打包进一个上传请求
+// 每个文件都不分片，服务端在同一个响应中逐个文件确认；打包失败的文件由调用方逐个重传
+void Net_Tool::uploadFileBatch(TransferTask* job, const std::vector<std::string>& fileNames,
+    const std::vector<std::string>& targetPaths, std::vector<bool>& results)
+{
+    results.assign(fileNames.size(), false);
+
+    transfer::UploadRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::UPLOAD)));
+    std::map<std::string, size_t> indexOf;   // 目标路径/文件名 -> 在fileNames中的下标
+    std::vector<size_t> requestIndex;        // 请求中第i个文件对应的下标
+    uint64_t totalBytes = 0;
+    std::vector<char> data;
+    for (size_t i = 0; i < fileNames.size(); ++i) {
+        std::ifstream file(convertToGBK(fileNames[i]), std::ios::binary | std::ios::ate);
+        if (!file) {
+            continue;  // 留给逐个重传时报告错误
+        }
+        uint64_t fileSize = file.tellg();
+        file.seekg(0);
+        data.resize(fileSize);
+        if (fileSize > 0 && !file.read(data.data(), fileSize)) {
+            continue;
+        }
+
+        std::string name = fileNames[i].substr(fileNames[i].find_last_of("/\\") + 1);
+        auto fileInfo = request.add_files();
+        fileInfo->set_file_name(name);//文件名
+        fileInfo->set_target_path(targetPaths[i]);//目标路径
+        fileInfo->set_file_size(fileSize);//文件大小
+        fileInfo->set_md5(calculateDataMD5(data.data(), fileSize));//文件MD5
+        fileInfo->set_need_chunk(false);//小文件不分片
+        fileInfo->set_chunk_size(CHUNK_SIZE);//分片大小
+        fileInfo->set_chunk_sequence(0);//分片序号
+        fileInfo->set_data(data.data(), fileSize);//数据
+        fileInfo->set_checksum(calculateCRC32(data.data(), fileSize));//校验和
+        fileInfo->set_task_id(generateTaskId());//任务ID
+        fileInfo->set_status(transfer::INIT);//传输状态
+        fileInfo->set_offset(0);//断点续传的起始位置
+        fileInfo->set_upload_id(generateTaskId());//上传会话ID
+        indexOf[targetPaths[i] + "/" + name] = i;
+        requestIndex.push_back(i);
+        totalBytes += fileSize;
+    }
+    if (request.files_size() == 0) {
+        return;
+    }
+
+    while (job->paused() && !job->cancelled()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    if (job->cancelled()) {
+        return;
+    }
+
+    transfer::UploadResponse response;
+    BandwidthLimiter::instance().acquire(serverAddress(), job->flowId, totalBytes);
+    if (!exchangeRetrying(job, request, response, totalBytes)
+        || response.header().session_id() != request.header().session_id()) {
+        return;
+    }
+
+    // 优先按目标路径和文件名匹配结果，服务端未回填时按顺序对应
+    for (int i = 0; i < response.results_size(); ++i) {
+        const auto& result = response.results(i);
+        size_t index;
+        auto it = indexOf.find(result.target_path() + "/" + result.file_name());
+        if (it != indexOf.end()) {
+            index = it->second;
+        } else if (i < static_cast<int>(requestIndex.size())) {
+            index = requestIndex[i];
+        } else {
+            continue;
+        }
+        results[index] = result.success() && result.next_sequence() <= 0;
+        if (results[index]) {
+            DirectoryCache::instance().invalidate(serverAddress(), targetPaths[index]);
+        }
+    }
+}
+
+// 通知远端视图刷新目录，按目录合并后由GUI线程异步加载，传输线程不等待
+void Net_Tool::refreshRemoteDirectory(const std::string& path)
+{
+    DirectoryCache::instance().invalidate(serverAddress(), path);
+    // 已订阅该目录的变化时，界面由服务端推送驱动更新；未订阅的目录仍需主动刷新
+    if (isWatching(path)) {
+        return;
+    }
+    RefreshCoordinator::instance().requestRefresh(QString::fromStdString(path));
+}
+
+// 目录任务(上传/下载)的共享状态
+namespace {
+struct DirectoryJobState {
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<LocalEntry> incoming;  // 遍历线程产生、尚未处理的条目(仅上传)
+    std::deque<LocalEntry> readyFiles; // 父目录已创建、可以传输的文件
+    std::deque<LocalEntry> smallFiles; // 同上，可打包传输的小文件
+    bool walkFinished = false;
+    bool dispatchFinished = false;     // 所有文件都已进入readyFiles
+    int finishedWorkers = 0;
+    uint64_t doneFiles = 0;
+    uint64_t failedFiles = 0;
+    std::atomic<uint64_t> transferredBytes{0};
+};
+
+// 上报目录任务的整体进度
+void reportDirectoryProgress(Net_Tool::TransferTask* job, DirectoryJobState& state,
+    const std::string& dirName, uint64_t totalBytes, uint64_t totalFiles, transfer::TransferStatus status)
+{
+    if (!job->progressCallback) {
+        return;
+    }
+    uint64_t done = state.transferredBytes;
+    uint64_t doneFiles;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        doneFiles = state.doneFiles + state.failedFiles;
+    }
+    transfer::TransferProgressResponse progress;
+    progress.set_task_id(job->taskId);
+    progress.set_task_name(dirName + " [" + std::to_string(doneFiles) + "/"
+        + std::to_string(totalFiles) + "]");
+    progress.set_status(status);
+    progress.set_total_size(totalBytes);
+    progress.set_transferred_size(status == transfer::COMPLETED ? totalBytes : done);
+    progress.set_progress(status == transfer::COMPLETED ? 100 :
+        (totalBytes > 0 ? static_cast<uint32_t>(done * 100 / totalBytes) : 0));
+    job->progressCallback(progress);
+}
+
+// 启动目录任务的文件传输线程池
+// 子任务共享目录任务的调度流和限速桶，setup负责填写子任务的源和目标路径；
+// transferBatch不为空时，smallFiles中的文件按预算打包交给它，打包失败的再逐个传输
+void startDirectoryWorkers(Net_Tool::TransferTask* job, DirectoryJobState& state,
+    std::vector<std::thread>& workers,
+    std::function<void(Net_Tool::TransferTask&, const LocalEntry&)> setup,
+    std::function<bool(Net_Tool::TransferTask*)> transferFile,
+    std::function<void(const std::deque<Net_Tool::TransferTask>&, std::vector<bool>&)> transferBatch = nullptr)
+{
+    for (int i = 0; i < DIR_TRANSFER_WORKERS; ++i) {
+        workers.push_back(std::thread([job, &state, setup, transferFile, transferBatch]() {
+            std::vector<LocalEntry> entries;
+            std::deque<Net_Tool::TransferTask> subs;  // 任务含原子标志不可移动，用deque原地构造
+            std::vector<bool> results;
+            while (true) {
+                entries.clear();
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.cond.wait(lock, [&]() {
+                        return job->isCancelled || !state.readyFiles.empty()
+                            || !state.smallFiles.empty() || state.dispatchFinished;
+                    });
+                    if (job->isCancelled || (state.readyFiles.empty() && state.smallFiles.empty())) {
+                        break;
+                    }
+                    if (!state.smallFiles.empty()) {
+                        // 按数量和字节预算取一批小文件
+                        uint64_t bytes = 0;
+                        while (!state.smallFiles.empty() && entries.size() < SMALL_BATCH_COUNT
+                            && (entries.empty() || bytes + state.smallFiles.front().size <= SMALL_BATCH_BYTES)) {
+                            bytes += state.smallFiles.front().size;
+                            entries.push_back(std::move(state.smallFiles.front()));
+                            state.smallFiles.pop_front();
                         }
+                    } else {
+                        entries.push_back(std::move(state.readyFiles.front()));
+                        state.readyFiles.pop_front();
                     }
                 }
-                else
-                {//文件上传完成
-                    // 发送目录请求以刷新远端目录显示
-                    transfer::DirectoryRequest dirRequest;
-                    dirRequest.mutable_header()->set_type(transfer::DIRECTORY);
-                    dirRequest.set_current_path("");
-                    dirRequest.set_dir_name(request.files(0).target_path());
-                    dirRequest.set_is_parent(false);
-                    transfer::DirectoryResponse response = sendDirectoryRequest(dirRequest);
-                    FileClient::instance()->getRemoteView()->dispatchRemoteResponse(response);
-
-                    break;//终止while
+
+                subs.clear();
+                for (const auto& entry : entries) {
+                    subs.emplace_back();
+                    Net_Tool::TransferTask& sub = subs.back();
+                    sub.taskId = job->taskId;
+                    sub.fileSize = entry.size;
+                    sub.transferredSize = 0;
+                    sub.isPaused = false;
+                    sub.isCancelled = false;
+                    sub.flowId = job->flowId;
+                    sub.parent = job;
+                    sub.refreshRemote = false;  // 整个目录完成后统一刷新一次
+                    setup(sub, entry);
                 }
-            }
-            else
-            {//上个没成功，重新上传
-                if (!sendMessage(request, UPLOAD_TYPE)) {
-                    if (m_errorCallback) {
-                        m_errorCallback("Failed to send upload request");
+
+                results.assign(subs.size(), false);
+                if (subs.size() > 1 && transferBatch) {
+                    transferBatch(subs, results);
+                }
+                for (size_t k = 0; k < subs.size(); ++k) {
+                    bool ok = results[k];
+                    if (ok) {
+                        state.transferredBytes += subs[k].fileSize;
+                    } else if (!job->cancelled()) {
+                        uint64_t reported = 0;
+                        subs[k].progressCallback = [&state, &reported](const transfer::TransferProgressResponse& progress) {
+                            state.transferredBytes += progress.transferred_size() - reported;
+                            reported = progress.transferred_size();
+                        };
+                        ok = transferFile(&subs[k]);
                     }
-                    file.close();
-                    return;
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    ok ? ++state.doneFiles : ++state.failedFiles;
                 }
             }
-        }
-    } while (1);
+            std::lock_guard<std::mutex> lock(state.mutex);
+            ++state.finishedWorkers;
+            state.cond.notify_all();
+        }));
+    }
+}
 
-    file.close();
-    
-    {   // 使用花括号创建局部作用域,确保互斥锁的RAII特性,锁会在作用域结束时自动释放
-        std::lock_guard<std::mutex> lock(m_tasksMutex);  // 加锁保护共享资源m_transferTasks
-        auto it = m_transferTasks.find(task->taskId);    // 查找当前任务
-        if (it != m_transferTasks.end()) {
-            delete it->second;  // 释放任务对象占用的内存
-            m_transferTasks.erase(it);  // 从任务映射中移除该任务
+// 等待传输线程池把队列中的文件传完，期间定时上报进度
+void waitDirectoryWorkers(Net_Tool::TransferTask* job, DirectoryJobState& state,
+    std::vector<std::thread>& workers, std::function<void()> report)
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            if (state.finishedWorkers == static_cast<int>(workers.size())) {
+                break;
+            }
+            state.cond.wait_for(lock, std::chrono::milliseconds(200));
+            if (job->isCancelled) {
+                state.cond.notify_all();  // 唤醒等待文件的线程
+            }
         }
-    }   // 作用域结束,锁自动释放
+        if (!job->isCancelled) {
+            report();
+        }
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
 }
 
-// 下载任务处理函数
-void Net_Tool::handleDownloadTask(TransferTask* task) {
-    // 创建并发送下载请求
-    auto request = createDownloadRequest(task->fileName, task->targetPath);
-    if (!sendMessage(request, DOWNLOAD_TYPE)) {
-        if (m_errorCallback) {
-            m_errorCallback("Failed to send download request");
-        }
+// 取路径最后一级名称
+std::string baseName(std::string path)
+{
+    while (path.size() > 1 && (path.back() == '/' || path.back() == '\\')) {
+        path.pop_back();
+    }
+    return path.substr(path.find_last_of("/\\") + 1);
+}
+
+// 取相对路径中的目录部分
+std::string parentOf(const std::string& relativePath)
+{
+    size_t slash = relativePath.find_last_of('/');
+    return slash == std::string::npos ? std::string() : relativePath.substr(0, slash);
+}
+}
+
+// 开始目录上传任务
+void Net_Tool::startDirectoryUploadTask(const std::string& localDir, const std::string& targetPath,
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority) {
+    TransferTask* job = createDirectoryJob(localDir, targetPath, taskId, priority);
+    job->transferThread = std::thread(&Net_Tool::handleDirectoryUploadTask, this, job);
+    job->transferThread.detach();//线程分离
+}
+
+// 开始目录下载任务
+void Net_Tool::startDirectoryDownloadTask(const std::string& remoteDir, const std::string& targetPath,
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority) {
+    TransferTask* job = createDirectoryJob(remoteDir, targetPath, taskId, priority);
+    job->transferThread = std::thread(&Net_Tool::handleDirectoryDownloadTask, this, job);
+    job->transferThread.detach();//线程分离
+}
+
+// 创建并登记目录任务
+Net_Tool::TransferTask* Net_Tool::createDirectoryJob(const std::string& source, const std::string& targetPath,
+    const std::string& taskId, TransferPriority priority) {
+    TransferTask* job = new TransferTask();
+    job->taskId = taskId.empty() ? generateTaskId() : taskId;
+    job->fileName = source;
+    job->targetPath = targetPath;
+    job->fileSize = 0;
+    job->transferredSize = 0;
+    job->progressCallback = handleTransferProgress;  // 使用统一的进度处理函数
+    job->isPaused = false;
+    job->isCancelled = false;
+    job->flowId = job->taskId;
+    job->parent = nullptr;
+    job->refreshRemote = true;
+
+    {
+        std::lock_guard<std::mutex> lock(m_tasksMutex);
+        m_transferTasks[job->taskId] = job;
+    }
+    // 整个目录在调度器中是一个流，所有文件共享目录任务的权重
+    TransferScheduler::instance().registerTask(job->flowId,
+        TransferScheduler::weightForPriority(static_cast<int>(priority)));
+    return job;
+}
+
+// 目录上传任务处理函数
+// 遍历线程边扫描边产出条目，本线程先批量建目录，再把文件交给上传线程池，
+// 文件上传不必等待整个目录树扫描完成
+void Net_Tool::handleDirectoryUploadTask(TransferTask* job)
+{
+    std::string localRoot = job->fileName;
+    while (localRoot.size() > 1 && (localRoot.back() == '/' || localRoot.back() == '\\')) {
+        localRoot.pop_back();
+    }
+    std::string dirName = baseName(localRoot);
+    std::string remoteRoot = joinRemotePath(job->targetPath, dirName);
+
+    DirectoryJobState state;
+    LocalTreeWalker walker(localRoot);
+    auto report = [&](transfer::TransferStatus status) {
+        reportDirectoryProgress(job, state, dirName, walker.totalBytes(), walker.fileCount(), status);
+    };
+
+    // 先建根目录，失败则无需遍历
+    if (!makeRemoteDirectories(job, job->targetPath, std::vector<std::string>(1, dirName))) {
+        report(transfer::FAILED);
+        finishTask(job);
         return;
     }
 
-    // 接收下载响应
-    transfer::DownloadResponse response;
-    if (!receiveMessage(response, DOWNLOAD_TYPE)) {
-        if (m_errorCallback) {
-            m_errorCallback("Failed to receive download response");
+    walker.start(
+        [&state](const std::vector<LocalEntry>& batch) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.incoming.insert(state.incoming.end(), batch.begin(), batch.end());
+            state.cond.notify_all();
+        },
+        [&state]() {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.walkFinished = true;
+            state.cond.notify_all();
+        });
+
+    std::vector<std::thread> workers;
+    startDirectoryWorkers(job, state, workers,
+        [&](TransferTask& sub, const LocalEntry& entry) {
+            std::string relDir = parentOf(entry.relativePath);
+            sub.fileName = localRoot + "/" + entry.relativePath;
+            sub.targetPath = relDir.empty() ? remoteRoot : joinRemotePath(remoteRoot, relDir);
+        },
+        [this](TransferTask* sub) { return uploadFile(sub); },
+        [this, job](const std::deque<TransferTask>& subs, std::vector<bool>& results) {
+            std::vector<std::string> fileNames, targetPaths;
+            for (const auto& sub : subs) {
+                fileNames.push_back(sub.fileName);
+                targetPaths.push_back(sub.targetPath);
+            }
+            uploadFileBatch(job, fileNames, targetPaths, results);
+        });
+
+    bool mkdirFailed = false;
+    std::vector<LocalEntry> entries;
+    std::vector<std::string> dirs;
+    while (!job->isCancelled) {
+        bool walkFinished;
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cond.wait_for(lock, std::chrono::milliseconds(200), [&]() {
+                return job->isCancelled || !state.incoming.empty() || state.walkFinished;
+            });
+            entries.clear();
+            entries.swap(state.incoming);
+            walkFinished = state.walkFinished;
         }
-        return;
+
+        // 本批中的目录先建好，文件再进入上传队列；
+        // 遍历器保证父目录先于子条目产出，所以文件的父目录此时一定已存在
+        dirs.clear();
+        for (const auto& entry : entries) {
+            if (entry.isDirectory) {
+                dirs.push_back(dirName + "/" + entry.relativePath);
+            }
+        }
+        for (size_t i = 0; i < dirs.size() && !mkdirFailed; i += MKDIR_BATCH_SIZE) {
+            size_t end = std::min(dirs.size(), i + MKDIR_BATCH_SIZE);
+            mkdirFailed = !makeRemoteDirectories(job, job->targetPath,
+                std::vector<std::string>(dirs.begin() + i, dirs.begin() + end));
+        }
+        if (mkdirFailed) {
+            job->isCancelled = true;
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (auto& entry : entries) {
+                if (entry.isDirectory) {
+                    continue;
+                }
+                // 小文件单独排队，由上传线程打包发送
+                if (entry.size <= SMALL_FILE_SIZE) {
+                    state.smallFiles.push_back(std::move(entry));
+                } else {
+                    state.readyFiles.push_back(std::move(entry));
+                }
+            }
+            // 遍历结束后不会再有新条目
+            if (walkFinished && state.incoming.empty()) {
+                state.dispatchFinished = true;
+            }
+            state.cond.notify_all();
+            if (state.dispatchFinished) {
+                break;
+            }
+        }
+        report(transfer::TRANSFERRING);
+    }
+
+    walker.cancel();
+    walker.wait();
+    if (walker.skippedCount() > 0 && m_errorCallback) {
+        m_errorCallback("Skipped " + std::to_string(walker.skippedCount())
+            + " special files (pipes, sockets, devices) in " + localRoot);
+    }
+    waitDirectoryWorkers(job, state, workers, [&]() { report(transfer::TRANSFERRING); });
+
+    // 新上传的整棵目录树在缓存中都已过期
+    DirectoryCache::instance().invalidateTree(serverAddress(), remoteRoot);
+    if (!job->isCancelled) {
+        report(state.failedFiles == 0 ? transfer::COMPLETED : transfer::FAILED);
+        refreshRemoteDirectory(job->targetPath);
+    } else if (mkdirFailed) {
+        report(transfer::FAILED);
     }
+    finishTask(job);
+}
 
-    // 检查响应结果
-    if (response.results().empty() || !response.results(0).exists()) {
+// 批量创建远端目录
+bool Net_Tool::makeRemoteDirectories(TransferTask* job, const std::string& basePath,
+    const std::vector<std::string>& paths)
+{
+    transfer::MakeDirectoryRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::MKDIR)));
+    request.set_base_path(basePath);
+    uint64_t bytes = 0;
+    for (const auto& path : paths) {
+        request.add_paths(path);
+        bytes += path.size();
+    }
+
+    transfer::MakeDirectoryResponse response;
+    bool sent = exchangeRetrying(job, request, response, bytes);
+    DirectoryCache::instance().invalidate(serverAddress(), basePath);
+    if (!sent) {
         if (m_errorCallback) {
-            m_errorCallback("File not found on server");
+            m_errorCallback("Failed to create remote directories under: " + basePath);
         }
-        return;
+        return false;
+    }
+    if (!response.header().success() || response.failed_paths_size() > 0) {
+        if (m_errorCallback) {
+            std::string message = "Failed to create remote directory";
+            if (response.failed_paths_size() > 0) {
+                message += ": " + response.failed_paths(0);
+                if (response.errors_size() > 0) {
+                    message += " (" + response.errors(0) + ")";
+                }
+            } else if (!response.header().error_message().empty()) {
+                message += ": " + response.header().error_message();
+            }
+            m_errorCallback(message);
+        }
+        return false;
     }
+    return true;
+}
 
-    const auto& fileInfo = response.results(0);//响应的数据
-    task->fileSize = fileInfo.file_size();
+// 下载任务处理函数
+void Net_Tool::handleDownloadTask(TransferTask* task) {
+    downloadFile(task);
+    finishTask(task);
+}
 
-    // 创建输出文件
-    std::string target_file = convertToGBK(fileInfo.target_path() + "/" + fileInfo.file_name());//文件名转换为GBK编码
+// 下载单个文件
+bool Net_Tool::downloadFile(TransferTask* task) {
+    // 创建下载请求，之后每个分片都是一次 请求-响应 交互
+    auto request = createDownloadRequest(task->fileName, task->targetPath);
+    transfer::DownloadResponse response;
+    std::ofstream file;
+    std::string target_file;
+    uint64_t file_total_len = 0;//以获取文件数据长度
+    int retry = 0;
+    bool completed = false;
 
-    if(fileInfo.need_chunk())
+    while (1)
     {
-        std::ofstream file(target_file,fileInfo.chunk_sequence()==0?
+        // 检查任务是否被取消
+        if (task->cancelled()) {
+            if (file.is_open()) {
+                file.close();
+                std::remove(target_file.c_str());
+            }
+            break;
+        }
+        // 处理暂停状态
+        while (task->paused() && !task->cancelled()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        // 预估本次交互的数据量，供调度器按权重分配
+        uint64_t expected = CHUNK_SIZE;
+        if (task->fileSize > 0 && task->fileSize - file_total_len < expected) {
+            expected = task->fileSize - file_total_len;
+        }
+        uint64_t generation = m_connectionGeneration;
+        if (!exchangeMessage(request, response, task->flowId, expected)) {
+            // 连接中断时等待自动重连，重连后从已收到的偏移续传
+            if (waitForReconnect(task, generation)) {
+                continue;
+            }
+            if (m_errorCallback) {
+                m_errorCallback("Failed to receive download response");
+            }
+            break;
+        }
+
+        // 检查响应结果
+        if (response.results().empty() || !response.results(0).exists()) {
+            if (m_errorCallback) {
+                m_errorCallback("File not found on server");
+            }
+            break;
+        }
+
+        const auto& fileInfo = response.results(0);//响应的数据
+        // 接收方向限速：按已收数据记账，延后下一个分片请求
+        BandwidthLimiter::instance().acquire(serverAddress(), task->flowId, fileInfo.data().length());
+
+        if (!file.is_open()) {
+            task->fileSize = fileInfo.file_size();
+            // 创建输出文件
+            target_file = convertToGBK(fileInfo.target_path() + "/" + fileInfo.file_name());//文件名转换为GBK编码
+            file.open(target_file, fileInfo.chunk_sequence()==0?
                 std::ios::binary | std::ios::trunc : 
                 std::ios::binary | std::ios::app);
-        if (!file) {
-                //request.files(0)->set_error_message("Failed to open file for writing");
+            if (!file) {
+                if (m_errorCallback) {
+                    m_errorCallback("Failed to open file for writing: " + target_file);
+                }
+                break;
+            }
         }
-        uint64_t file_total_len = 0;//以获取文件数据长度
 
-        //分片校验
-        uint32_t calculated_crc = calculateCRC32(fileInfo.data().c_str(), fileInfo.data().length());
-        if(calculated_crc == fileInfo.checksum())
-        {
-            file.seekp(file_total_len);
+        if (!fileInfo.need_chunk())
+        {//不分片，一次收完
+            file.seekp(fileInfo.chunk_size()*fileInfo.chunk_sequence());
             file.write(fileInfo.data().c_str(), fileInfo.data().length());
-            file_total_len += fileInfo.data().length();
-            //file.close();
-            
-            auto req_info = request.mutable_files(0);
-            req_info->set_offset(file_total_len);
+            file.close();
+            std::string downloaded_md5 = calculateFileMD5(target_file);
+            completed = (downloaded_md5 == fileInfo.md5());
+            if (!completed) {
+                if (m_errorCallback) {
+                    m_errorCallback("File MD5 verification failed");
+                }
+                std::remove(target_file.c_str());
+            }
+
             // 更新进度回调
             if (task->progressCallback) {
                 transfer::TransferProgressResponse progress;
                 progress.set_task_id(task->taskId);
                 progress.set_task_name(task->fileName);
-                progress.set_status(file_total_len < task->fileSize ? 
-                                    transfer::TRANSFERRING : transfer::COMPLETED);
-                progress.set_transferred_size(file_total_len);
+                progress.set_status(transfer::COMPLETED);
+                progress.set_transferred_size(task->fileSize);
                 progress.set_total_size(task->fileSize);
-                progress.set_progress(static_cast<uint32_t>((file_total_len * 100) / task->fileSize));
+                progress.set_progress(100);
                 task->progressCallback(progress);
             }
+            break;
         }
-        else
+
+        //分片校验，失败时按原偏移重新请求
+        uint32_t calculated_crc = calculateCRC32(fileInfo.data().c_str(), fileInfo.data().length());
+        if(calculated_crc != fileInfo.checksum())
         {
             if (m_errorCallback) {
                 m_errorCallback("Chunk checksum verification failed");
             }
-        }
-        
-        if (!sendMessage(request, DOWNLOAD_TYPE)) {
-        if (m_errorCallback) {
-                m_errorCallback("Failed to send download request");
-            }
-            return;
-        }
-        do
-        {
-            // 检查任务是否被取消
-            if (task->isCancelled) {
+            if (++retry > MAX_CHUNK_RETRY) {
                 file.close();
                 std::remove(target_file.c_str());
                 break;
             }
-            // 处理暂停状态
-            while (task->isPaused && !task->isCancelled) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
+            continue;
+        }
+        retry = 0;
+
+        file.seekp(file_total_len);
+        file.write(fileInfo.data().c_str(), fileInfo.data().length());
+        file_total_len += fileInfo.data().length();
+        request.mutable_files(0)->set_offset(file_total_len);
+        // 更新进度回调
+        if (task->progressCallback) {
+            transfer::TransferProgressResponse progress;
+            progress.set_task_id(task->taskId);
+            progress.set_task_name(task->fileName);
+            progress.set_status(file_total_len < task->fileSize ? 
+                                transfer::TRANSFERRING : transfer::COMPLETED);
+            progress.set_transferred_size(file_total_len);
+            progress.set_total_size(task->fileSize);
+            progress.set_progress(task->fileSize > 0 ?
+                static_cast<uint32_t>((file_total_len * 100) / task->fileSize) : 100);
+            task->progressCallback(progress);
+        }
 
-            if (!receiveMessage(response, DOWNLOAD_TYPE)) {
+        if(fileInfo.is_last() == true)
+        {
+            file.close();
+            //验证文件md5
+            std::string downloaded_md5 = calculateFileMD5(target_file);
+            completed = (downloaded_md5 == fileInfo.md5());
+            if (!completed) {
                 if (m_errorCallback) {
-                    m_errorCallback("Failed to receive download response");
+                    m_errorCallback("File MD5 verification failed");
                 }
-                return;
+                std::remove(target_file.c_str());
             }
-            if (response.results().empty() || !response.results(0).exists()) {
-                if (m_errorCallback) {
-                    m_errorCallback("File not found on server");
-                }
-                return;
-            }
-
-            auto fileInfo = response.results(0);
-            //分片校验
-            uint32_t calculated_crc = calculateCRC32(fileInfo.data().c_str(), fileInfo.data().length());
-            if(calculated_crc == fileInfo.checksum())
-            {
-                file.seekp(file_total_len);
-                file.write(fileInfo.data().c_str(), fileInfo.data().length());
-                file_total_len += fileInfo.data().length();
-                //file.close();
-                auto req_info = request.mutable_files(0);
-                req_info->set_offset(file_total_len);
-                // 更新进度回调
-                if (task->progressCallback) {
-                    transfer::TransferProgressResponse progress;
-                    progress.set_task_id(task->taskId);
-                    progress.set_task_name(task->fileName);
-                    progress.set_status(file_total_len < task->fileSize ? 
-                                        transfer::TRANSFERRING : transfer::COMPLETED);
-                    progress.set_transferred_size(file_total_len);
-                    progress.set_total_size(task->fileSize);
-                    progress.set_progress(static_cast<uint32_t>((file_total_len * 100) / task->fileSize));
-                    task->progressCallback(progress);
-                }
+            break;
+        }
+    }
+
+    return completed;
+}
+
+// 目录下载任务处理函数
+// 分页拉取服务端的递归列表，每页先在本地建目录，再把文件交给下载线程池，
+// 下载与后续页的列表请求同时进行
+void Net_Tool::handleDirectoryDownloadTask(TransferTask* job)
+{
+    std::string remoteRoot = job->fileName;
+    while (remoteRoot.size() > 1 && remoteRoot.back() == '/') {
+        remoteRoot.pop_back();
+    }
+    std::string dirName = baseName(remoteRoot);
+    std::string localRoot = job->targetPath + "/" + dirName;
+
+    DirectoryJobState state;
+    std::atomic<uint64_t> totalBytes(0);
+    std::atomic<uint64_t> totalFiles(0);
+    auto report = [&](transfer::TransferStatus status) {
+        reportDirectoryProgress(job, state, dirName, totalBytes, totalFiles, status);
+    };
+
+    if (!QDir().mkpath(QString::fromStdString(localRoot))) {
+        if (m_errorCallback) {
+            m_errorCallback("Failed to create local directory: " + localRoot);
+        }
+        report(transfer::FAILED);
+        finishTask(job);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    startDirectoryWorkers(job, state, workers,
+        [&](TransferTask& sub, const LocalEntry& entry) {
+            std::string relDir = parentOf(entry.relativePath);
+            sub.fileName = joinRemotePath(remoteRoot, entry.relativePath);
+            sub.targetPath = relDir.empty() ? localRoot : localRoot + "/" + relDir;
+        },
+        [this](TransferTask* sub) { return downloadFile(sub); });
+
+    bool listFailed = false;
+    std::string cursor;
+    transfer::TreeListResponse response;
+    while (!job->isCancelled) {
+        transfer::TreeListRequest request;
+        request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::TREE_LIST)));
+        request.set_root_path(remoteRoot);
+        request.set_cursor(cursor);
+        request.set_page_size(TREE_LIST_PAGE_SIZE);
+        if (!exchangeRetrying(job, request, response)
+            || !response.header().success()) {
+            if (m_errorCallback) {
+                m_errorCallback("Failed to list remote directory: " + remoteRoot
+                    + (response.header().error_message().empty() ? "" : " (" + response.header().error_message() + ")"));
             }
-            else
-            {
+            listFailed = true;
+            job->isCancelled = true;
+            break;
+        }
+
+        // 本页的目录先在本地建好，文件再进入下载队列
+        // 条目路径来自服务端，拼接前先检查，含".."或绝对路径时整个任务失败
+        std::vector<LocalEntry> files;
+        bool unsafe = false;
+        for (const auto& item : response.entries()) {
+            if (!isSafeRelativePath(item.relative_path())) {
                 if (m_errorCallback) {
-                    m_errorCallback("Chunk checksum verification failed");
+                    m_errorCallback("Unsafe path in remote directory listing: " + item.relative_path());
                 }
+                unsafe = true;
+                break;
             }
-            if(fileInfo.is_last() == true)
-            {
-                file.close();
-                //验证文件md5
-                std::string downloaded_md5 = calculateFileMD5(target_file);
-                if (downloaded_md5 != fileInfo.md5()) {
-                    if (m_errorCallback) {
-                        m_errorCallback("File MD5 verification failed");
-                    }
-                    std::remove(target_file.c_str());
-                }
+            if (item.is_directory()) {
+                QDir().mkpath(QString::fromStdString(localRoot + "/" + item.relative_path()));
+                continue;
+            }
+            LocalEntry entry;
+            entry.relativePath = item.relative_path();
+            entry.isDirectory = false;
+            entry.size = item.size();
+            totalBytes += entry.size;
+            ++totalFiles;
+            files.push_back(std::move(entry));
+        }
+        if (unsafe) {
+            listFailed = true;
+            job->isCancelled = true;
+            break;
+        }
+
+        bool lastPage = !response.has_more();
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (auto& entry : files) {
+                state.readyFiles.push_back(std::move(entry));
+            }
+            state.dispatchFinished = lastPage;
+            state.cond.notify_all();
+        }
+        report(transfer::TRANSFERRING);
+        if (lastPage) {
+            break;
+        }
+        cursor = response.next_cursor();
+    }
+
+    waitDirectoryWorkers(job, state, workers, [&]() { report(transfer::TRANSFERRING); });
+
+    if (!job->isCancelled) {
+        report(state.failedFiles == 0 ? transfer::COMPLETED : transfer::FAILED);
+    } else if (listFailed) {
+        report(transfer::FAILED);
+    }
+    finishTask(job);
+}
+
+// 按归档流约定压缩一块数据(qCompress格式：4字节大端序原始长度 + zlib数据)
+// 使用最快的压缩级别，保证压缩速度跟得上网络
+static std::string compressBlock(const std::string& raw) {
+    QByteArray packed = qCompress(reinterpret_cast<const uchar*>(raw.data()), static_cast<int>(raw.size()), 1);
+    return std::string(packed.constData(), packed.size());
+}
+
+// 解压一块归档流数据
+static bool uncompressBlock(const std::string& packed, std::string& raw) {
+    QByteArray data = qUncompress(reinterpret_cast<const uchar*>(packed.data()), static_cast<int>(packed.size()));
+    if (data.isEmpty()) {
+        return false;  // 发送方不会压缩空块，解压结果为空说明数据损坏
+    }
+    raw.assign(data.constData(), data.size());
+    return true;
+}
+
+// 开始归档流上传任务
+void Net_Tool::startArchiveUploadTask(const std::string& localDir, const std::string& targetPath,
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority, bool compress) {
+    TransferTask* job = createDirectoryJob(localDir, targetPath, taskId, priority);
+    // 只有握手协商了zlib才压缩
+    bool useCompression = compress && capabilities()->compression == COMPRESSION_ZLIB;
+    job->transferThread = std::thread(&Net_Tool::handleArchiveUploadTask, this, job, useCompression);
+    job->transferThread.detach();//线程分离
+}
+
+// 开始归档流下载任务
+void Net_Tool::startArchiveDownloadTask(const std::string& remoteDir, const std::string& targetPath,
+    std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+    const std::string& taskId, TransferPriority priority, bool compress) {
+    TransferTask* job = createDirectoryJob(remoteDir, targetPath, taskId, priority);
+    // 只有握手协商了zlib才压缩
+    bool useCompression = compress && capabilities()->compression == COMPRESSION_ZLIB;
+    job->transferThread = std::thread(&Net_Tool::handleArchiveDownloadTask, this, job, useCompression);
+    job->transferThread.detach();//线程分离
+}
+
+// 发送一块归档流请求并接收响应
+// PUSH时rawData为待发送的原始数据，PULL时rawResponseData返回解压后的数据
+bool Net_Tool::exchangeArchiveBlock(TransferTask* job, transfer::ArchiveRequest& request,
+    const std::string& rawData, transfer::ArchiveResponse& response, std::string& rawResponseData)
+{
+    bool push = request.direction() == transfer::ArchiveRequest::PUSH;
+    if (push) {
+        if (request.compression() == ARCHIVE_COMPRESSION_ZLIB && !rawData.empty()) {
+            request.set_data(compressBlock(rawData));
+        } else {
+            request.set_compression(ARCHIVE_COMPRESSION_NONE);
+            request.set_data(rawData);
+        }
+    }
+
+    while (job->paused() && !job->cancelled()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    if (job->cancelled()) {
+        return false;
+    }
+
+    uint64_t bytes = push ? request.data().size() : ARCHIVE_BLOCK_SIZE;
+    if (push) {
+        BandwidthLimiter::instance().acquire(serverAddress(), job->flowId, bytes);
+    }
+    // 归档流的状态只存在于原连接上，连接中断后无法接续，不等待重连
+    if (!exchangeMessage(request, response, job->flowId, bytes)
+        || !response.header().success() || response.archive_id() != request.archive_id()) {
+        if (m_errorCallback) {
+            m_errorCallback("Archive transfer failed: " + request.base_path()
+                + (response.header().error_message().empty() ? "" : " (" + response.header().error_message() + ")"));
+        }
+        return false;
+    }
+    if (push) {
+        return true;
+    }
+
+    // 接收方向限速：按实际收到的数据记账
+    BandwidthLimiter::instance().acquire(serverAddress(), job->flowId, response.data().size());
+    if (response.compression() == ARCHIVE_COMPRESSION_ZLIB && !response.data().empty()) {
+        if (!uncompressBlock(response.data(), rawResponseData)) {
+            if (m_errorCallback) {
+                m_errorCallback("Failed to decompress archive block");
+            }
+            return false;
+        }
+    } else {
+        rawResponseData = response.data();
+    }
+    return true;
+}
+
+// 归档流上传任务处理函数
+// 遍历结果按顺序写入一个连续的归档流，攒够一块就发送，服务端边收边解包
+void Net_Tool::handleArchiveUploadTask(TransferTask* job, bool compress)
+{
+    std::string localRoot = job->fileName;
+    while (localRoot.size() > 1 && (localRoot.back() == '/' || localRoot.back() == '\\')) {
+        localRoot.pop_back();
+    }
+    std::string dirName = baseName(localRoot);
+
+    DirectoryJobState state;
+    LocalTreeWalker walker(localRoot);
+    auto lastReport = std::chrono::steady_clock::now();
+    auto report = [&](transfer::TransferStatus status) {
+        reportDirectoryProgress(job, state, dirName, walker.totalBytes(), walker.fileCount(), status);
+        lastReport = std::chrono::steady_clock::now();
+    };
+
+    walker.start(
+        [&state](const std::vector<LocalEntry>& batch) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.incoming.insert(state.incoming.end(), batch.begin(), batch.end());
+            state.cond.notify_all();
+        },
+        [&state]() {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.walkFinished = true;
+            state.cond.notify_all();
+        });
+
+    // 服务端支持时每个文件带状态和校验和，读取中途出错的文件由服务端丢弃
+    ArchiveWriter writer(hasFeature(FEATURE_ARCHIVE_TRAILER));
+    transfer::ArchiveRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::ARCHIVE)));
+    request.set_direction(transfer::ArchiveRequest::PUSH);
+    request.set_archive_id(generateTaskId());
+    request.set_base_path(job->targetPath);
+    transfer::ArchiveResponse response;
+    std::string unused;
+    uint64_t blockSequence = 0;
+    auto sendBlock = [&](bool last) {
+        request.set_compression(compress ? ARCHIVE_COMPRESSION_ZLIB : ARCHIVE_COMPRESSION_NONE);
+        request.set_block_sequence(blockSequence++);
+        request.set_is_last(last);
+        bool ok = exchangeArchiveBlock(job, request, writer.data(), response, unused);
+        writer.clear();
+        return ok;
+    };
+
+    writer.addDirectory(dirName);
+    bool failed = false;
+    bool walkDone = false;
+    std::vector<LocalEntry> entries;
+    std::vector<char> buffer(1024 * 1024);
+    while (!job->isCancelled && !failed && !walkDone) {
+        bool walkFinished;
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cond.wait_for(lock, std::chrono::milliseconds(200), [&]() {
+                return job->isCancelled || !state.incoming.empty() || state.walkFinished;
+            });
+            entries.clear();
+            entries.swap(state.incoming);
+            walkFinished = state.walkFinished;
+        }
+
+        for (const auto& entry : entries) {
+            if (job->isCancelled || failed) {
                 break;
             }
-            else
-            {
-                if (!sendMessage(request, DOWNLOAD_TYPE)) {
+            std::string path = dirName + "/" + entry.relativePath;
+            if (entry.isDirectory) {
+                writer.addDirectory(path);
+            } else {
+                std::ifstream file(convertToGBK(localRoot + "/" + entry.relativePath), std::ios::binary | std::ios::ate);
+                if (!file) {
                     if (m_errorCallback) {
-                        m_errorCallback("Failed to send download request");
+                        m_errorCallback("Failed to open file: " + localRoot + "/" + entry.relativePath);
+                    }
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    ++state.failedFiles;
+                    continue;
+                }
+                uint64_t remaining = file.tellg();
+                file.seekg(0);
+                writer.beginFile(path, remaining);
+                bool complete = true;
+                while (remaining > 0) {
+                    size_t length = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
+                    if (complete && !file.read(buffer.data(), length)) {
+                        // 文件在传输期间变短或读取出错，剩余部分补零以保持流中声明的大小，该文件按失败处理
+                        std::fill(buffer.begin() + file.gcount(), buffer.begin() + length, 0);
+                        complete = false;
+                    } else if (!complete) {
+                        std::fill(buffer.begin(), buffer.begin() + length, 0);
+                    }
+                    writer.appendData(buffer.data(), length);
+                    remaining -= length;
+                    state.transferredBytes += length;
+                    if (writer.size() >= ARCHIVE_BLOCK_SIZE && !sendBlock(false)) {
+                        failed = true;
+                        break;
                     }
-                    return;
                 }
+                if (failed) {
+                    break;
+                }
+                writer.endFile(complete);
+                if (!complete && m_errorCallback) {
+                    m_errorCallback("File changed while reading: " + localRoot + "/" + entry.relativePath);
+                }
+                std::lock_guard<std::mutex> lock(state.mutex);
+                ++(complete ? state.doneFiles : state.failedFiles);
             }
-        } while (1);
+            if (!failed && writer.size() >= ARCHIVE_BLOCK_SIZE && !sendBlock(false)) {
+                failed = true;
+            }
+            if (std::chrono::steady_clock::now() - lastReport > std::chrono::milliseconds(200)) {
+                report(transfer::TRANSFERRING);
+            }
+        }
+
+        // 遍历结束后不会再有新条目
+        if (walkFinished) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            walkDone = state.incoming.empty();
+        }
     }
-    else
-    {
-        std::ofstream file(target_file,fileInfo.chunk_sequence()==0?
-                std::ios::binary | std::ios::trunc : 
-                std::ios::binary | std::ios::app);
-        if (!file) {
-                //request.files(0)->set_error_message("Failed to open file for writing");
+
+    walker.cancel();
+    walker.wait();
+    if (walker.skippedCount() > 0 && m_errorCallback) {
+        m_errorCallback("Skipped " + std::to_string(walker.skippedCount())
+            + " special files (pipes, sockets, devices) in " + localRoot);
+    }
+
+    if (!failed && !job->isCancelled) {
+        writer.finish();
+        failed = !sendBlock(true);
+    }
+    DirectoryCache::instance().invalidateTree(serverAddress(), joinRemotePath(job->targetPath, dirName));
+    if (failed) {
+        report(transfer::FAILED);
+    } else if (!job->isCancelled) {
+        report(state.failedFiles == 0 ? transfer::COMPLETED : transfer::FAILED);
+        refreshRemoteDirectory(job->targetPath);
+    }
+    finishTask(job);
+}
+
+// 归档流下载任务处理函数
+// 逐块拉取服务端生成的归档流，边收边解包到本地
+void Net_Tool::handleArchiveDownloadTask(TransferTask* job, bool compress)
+{
+    std::string remoteRoot = job->fileName;
+    while (remoteRoot.size() > 1 && remoteRoot.back() == '/') {
+        remoteRoot.pop_back();
+    }
+    std::string dirName = baseName(remoteRoot);
+    std::string localParent = job->targetPath;
+
+    DirectoryJobState state;
+    uint64_t totalBytes = 0;
+    uint64_t totalFiles = 0;
+    auto lastReport = std::chrono::steady_clock::now();
+    auto report = [&](transfer::TransferStatus status) {
+        reportDirectoryProgress(job, state, dirName, totalBytes, totalFiles, status);
+        lastReport = std::chrono::steady_clock::now();
+    };
+
+    std::ofstream out;
+    std::string currentFile;
+    ArchiveReader reader(
+        [&](const std::string& path) {
+            return QDir().mkpath(QString::fromStdString(localParent + "/" + path));
+        },
+        [&](const std::string& path, uint64_t) {
+            std::string parent = parentOf(path);
+            if (!parent.empty()) {
+                QDir().mkpath(QString::fromStdString(localParent + "/" + parent));
+            }
+            currentFile = convertToGBK(localParent + "/" + path);
+            out.open(currentFile, std::ios::binary | std::ios::trunc);
+            return out.is_open();
+        },
+        [&](const char* data, size_t length) {
+            out.write(data, length);
+            state.transferredBytes += length;
+            return !out.fail();
+        },
+        [&](bool complete) {
+            out.close();
+            bool written = !out.fail();
+            // 服务端读取该文件时出错或数据校验不符，删除已写入的内容
+            if (!complete) {
+                std::remove(currentFile.c_str());
+                if (m_errorCallback) {
+                    m_errorCallback("Archive entry is incomplete, discarded: " + currentFile);
+                }
+            }
+            std::lock_guard<std::mutex> lock(state.mutex);
+            ++(complete ? state.doneFiles : state.failedFiles);
+            return written;
+        });
+
+    transfer::ArchiveRequest request;
+    request.set_allocated_header(new transfer::RequestHeader(createRequestHeader(transfer::ARCHIVE)));
+    request.set_direction(transfer::ArchiveRequest::PULL);
+    request.set_archive_id(generateTaskId());
+    request.set_base_path(remoteRoot);
+    request.set_compression(compress ? ARCHIVE_COMPRESSION_ZLIB : ARCHIVE_COMPRESSION_NONE);
+    transfer::ArchiveResponse response;
+    std::string data;
+    uint64_t blockSequence = 0;
+    bool failed = false;
+    while (!job->isCancelled) {
+        request.set_block_sequence(blockSequence++);
+        if (!exchangeArchiveBlock(job, request, std::string(), response, data)) {
+            failed = !job->isCancelled;
+            break;
         }
-        file.seekp(fileInfo.chunk_size()*fileInfo.chunk_sequence());
-        file.write(fileInfo.data().c_str(), fileInfo.data().length());
-        file.close();
-        std::string downloaded_md5 = calculateFileMD5(target_file);
-        if (downloaded_md5 != fileInfo.md5()) {
+        totalBytes = std::max(totalBytes, response.total_size());
+        totalFiles = std::max(totalFiles, response.total_files());
+        if (!reader.feed(data.data(), data.size())) {
             if (m_errorCallback) {
-                m_errorCallback("File MD5 verification failed");
+                m_errorCallback("Failed to unpack archive: " + reader.errorString());
             }
-            std::remove(target_file.c_str());
+            failed = true;
+            break;
         }
-
-        // 更新进度回调
-        if (task->progressCallback) {
-            transfer::TransferProgressResponse progress;
-            progress.set_task_id(task->taskId);
-            progress.set_task_name(task->fileName);
-            progress.set_status(transfer::COMPLETED);
-            progress.set_transferred_size(task->fileSize);
-            progress.set_total_size(task->fileSize);
-            progress.set_progress(100);
-            task->progressCallback(progress);
+        if (response.is_last()) {
+            break;
+        }
+        if (std::chrono::steady_clock::now() - lastReport > std::chrono::milliseconds(200)) {
+            report(transfer::TRANSFERRING);
+        }
+    }
+    if (!failed && !job->isCancelled && !reader.isFinished()) {
+        if (m_errorCallback) {
+            m_errorCallback("Archive stream ended unexpectedly: " + remoteRoot);
         }
+        failed = true;
+    }
 
+    // 删除未收完的文件
+    if (out.is_open()) {
+        out.close();
+        std::remove(currentFile.c_str());
+    }
+    if (failed) {
+        report(transfer::FAILED);
+    } else if (!job->isCancelled) {
+        totalFiles = state.doneFiles + state.failedFiles;
+        totalBytes = state.transferredBytes;
+        report(state.failedFiles == 0 ? transfer::COMPLETED : transfer::FAILED);
     }
+    finishTask(job);
+}
 
-    // 清理任务资源
-    {
-        std::lock_guard<std::mutex> lock(m_tasksMutex);
-        auto it = m_transferTasks.find(task->taskId);
+// 传输结束后释放限速器、调度器和任务表中的资源
+void Net_Tool::finishTask(TransferTask* task)
+{
+    BandwidthLimiter::instance().removeTask(task->taskId);
+    TransferScheduler::instance().unregisterTask(task->taskId);
+
+    {   // 使用花括号创建局部作用域,确保互斥锁的RAII特性,锁会在作用域结束时自动释放
+        std::lock_guard<std::mutex> lock(m_tasksMutex);  // 加锁保护共享资源m_transferTasks
+        auto it = m_transferTasks.find(task->taskId);    // 查找当前任务
         if (it != m_transferTasks.end()) {
-            delete it->second;
-            m_transferTasks.erase(it);
+            delete it->second;  // 释放任务对象占用的内存
+            m_transferTasks.erase(it);  // 从任务映射中移除该任务
         }
-    }
+    }   // 作用域结束,锁自动释放
+}
+
+// 调整任务优先级，对运行中的任务立即生效
+void Net_Tool::setTaskPriority(const std::string& taskId, TransferPriority priority) {
+    TransferScheduler::instance().setWeight(taskId,
+        TransferScheduler::weightForPriority(static_cast<int>(priority)));
+}
+
+// 设置单个任务的限速
+void Net_Tool::setTaskSpeedLimit(const std::string& taskId, uint64_t bytesPerSecond) {
+    BandwidthLimiter::instance().setTaskLimit(taskId, bytesPerSecond);
 }
 
 // 暂停传输任务
@@ -996,12 +3062,7 @@ void Net_Tool::cancelTransfer(const std::string& taskId) {
     std::lock_guard<std::mutex> lock(m_tasksMutex);
     auto it = m_transferTasks.find(taskId);
     if (it != m_transferTasks.end()) {
-        TransferTask* task = it->second;
-        task->isCancelled = true;
-        if (task->transferThread.joinable()) {
-            task->transferThread.join();
-        }
-        delete task;  // 释放内存
-        m_transferTasks.erase(it);
+        // 传输线程已分离，由其检测到取消后在finishTask中释放任务
+        it->second->isCancelled = true;
     }
 }
@@ -8,10 +8,18 @@
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <queue>
+#include <set>
+#include <atomic>
 #include <functional>
 #include <openssl/md5.h>
 #include "../protos/transfer.pb.h"
+#include "BandwidthLimiter.h"
+#include "TransferDefs.h"
+#include "PendingRequests.h"
+#include "MessageRegistry.h"
+#include "TlsTransport.h"
 
 #ifdef _WIN32
     #include <WinSock2.h>
@@ -21,27 +29,103 @@
     #define INVALID_SOCK INVALID_SOCKET
     #define SOCK_ERROR SOCKET_ERROR
     #define CLOSE_SOCKET closesocket
+    #define SHUTDOWN_BOTH SD_BOTH
 #else
     #include <sys/socket.h>
+    #include <sys/select.h>
     #include <netinet/in.h>
+    #include <netinet/tcp.h>
     #include <arpa/inet.h>
+    #include <netdb.h>
+    #include <fcntl.h>
     #include <unistd.h>
     #include <errno.h>
     typedef int socket_t;
     #define INVALID_SOCK (-1)
     #define SOCK_ERROR (-1)
     #define CLOSE_SOCKET close
+    #define SHUTDOWN_BOTH SHUT_RDWR
 #endif
 
-//用于区分底层收发请求类型
-#define DIRECTORY_TYPE 1
-#define UPLOAD_TYPE 2
-#define DOWNLOAD_TYPE 3
-#define TRANSFER_CONTROL_TYPE 4
-#define TRANSFER_PROGRESS_TYPE 5
+#define CHUNK_SIZE 1024 * 1024 * 50 //每次传输的数据大小，类似带宽
+#define MAX_CHUNK_RETRY 3            //单个分片的最大重试次数
+#define PREFETCH_FLOW_ID "__prefetch" //目录预取在调度器中的流，按低优先级与传输共享socket
+#define DIR_TRANSFER_WORKERS 4       //目录传输时并发传输文件的线程数
+#define MKDIR_BATCH_SIZE 1000        //单次批量建目录请求的最大目录数
+#define TREE_LIST_PAGE_SIZE 2000     //递归列表每页的最大条目数
+#define DIRECTORY_PAGE_SIZE 5000     //目录列表每页的最大条目数
+#define SEARCH_PAGE_SIZE 500         //远程搜索每个响应的最大结果数
+#define WATCH_POLL_INTERVAL_MS 200   //空闲时检查服务端推送的间隔
+#define SMALL_FILE_SIZE (256 * 1024)        //不超过该大小的文件按小文件打包上传
+#define SMALL_BATCH_BYTES (4 * 1024 * 1024) //单个打包请求的最大数据量
+#define SMALL_BATCH_COUNT 256               //单个打包请求的最大文件数
+#define ARCHIVE_BLOCK_SIZE (8 * 1024 * 1024) //归档流每块的原始数据量
+#define ARCHIVE_COMPRESSION_NONE 0
+#define ARCHIVE_COMPRESSION_ZLIB 1
+
+#define PROTOCOL_VERSION 2                   //当前协议版本，1为没有握手的旧协议
+#define MIN_PROTOCOL_VERSION 1
+#define MAX_FRAME_SIZE (256ULL * 1024 * 1024) //能接收的最大帧，超过视为数据错误
+#define HELLO_TIMEOUT_MS 3000                //等待握手响应的时间，超时按旧协议处理
+#define CONNECT_TIMEOUT_MS 10000             //建立连接的总超时，包括解析域名和尝试所有地址
+#define CONNECT_ATTEMPT_DELAY_MS 250         //域名有多个地址时，上一个地址未连上多久后并行尝试下一个
+#define IO_TIMEOUT_MS 30000                  //单次收发无任何进展的最长时间，超时视为连接已断开(含服务端处理时间)
+#define FRAME_STALL_TIMEOUT_MS 5000          //帧头到达后帧体无任何进展的最长时间，不含服务端处理时间，传输中途断线更快发现
+#define UNACKED_TIMEOUT_MS 10000             //已发出的数据多久未被对端确认视为连接已断开(仅Linux)
+#define HEARTBEAT_INTERVAL_MS 5000           //连接空闲多久后发送心跳
+#define HEARTBEAT_TIMEOUT_MS 3000            //等待心跳响应的时间
+#define RECONNECT_MIN_DELAY_MS 500           //连接中断后首次重连的等待时间，之后每次翻倍
+#define RECONNECT_MAX_DELAY_MS 5000
+#define RECONNECT_WAIT_MS 60000              //传输任务等待重连的最长时间，超过后任务失败
+#define CLIENT_WINDOW_SIZE 1                 //可同时在途的请求数(目前按请求-响应串行)
+#define COMPRESSION_ZLIB "zlib"
+#define HASH_MD5 "md5"
+// 可选功能，握手时协商，服务端不支持的功能客户端不使用
+#define FEATURE_LISTING_V2 "listing_v2"        //列式目录列表编码
+#define FEATURE_LISTING_DELTA "listing_delta"  //按版本只取目录变化
+#define FEATURE_WATCH "watch"                  //目录变化推送
+#define FEATURE_SEARCH "search"                //远程搜索
+#define FEATURE_SEARCH_CURSOR "search_cursor"  //远程搜索按游标逐页请求
+#define FEATURE_ARCHIVE "archive"              //归档流传输
+#define FEATURE_ARCHIVE_TRAILER "archive_trailer" //归档流文件条目带状态和校验和(FCA2)
+#define FEATURE_HEARTBEAT "heartbeat"          //空闲连接心跳
+
+// 连接模式，决定建立连接时的socket选项
+enum class ConnectionProfile {
+    Balanced,     // 均衡：缓冲区由系统自动调节
+    LowLatency,   // 低延迟：适合频繁浏览目录，更快发现断线
+    Throughput    // 高吞吐：大缓冲区，系统支持时使用BBR拥塞控制，适合高延迟链路上的大文件
+};
 
+// 建立连接时应用的socket选项
+struct SocketProfile {
+    bool noDelay;               // 关闭Nagle算法，请求-响应式的小消息不等待合并
+    int sendBufferSize;         // SO_SNDBUF，0表示由系统自动调节
+    int receiveBufferSize;      // SO_RCVBUF，0表示由系统自动调节
+    std::string congestion;     // 拥塞控制算法(仅Linux)，为空使用系统默认，设置失败时忽略
+    int keepAliveIdle;          // 连接空闲多少秒后开始保活探测
+    int keepAliveInterval;      // 保活探测间隔(秒)
+    int keepAliveCount;         // 连续多少次探测无响应判定连接已断开
+
+    static SocketProfile forProfile(ConnectionProfile profile);
+};
 
-#define CHUNK_SIZE 1024 * 1024 * 50 //每次传输的数据大小，类似带宽
+// 握手协商出的连接能力，旧服务端(无握手)时为默认值
+struct ServerCapabilities {
+    uint32_t protocolVersion;       // 协商后的协议版本
+    uint64_t maxFrameSize;          // 服务端能接收的最大帧
+    std::string compression;        // 压缩算法，为空表示不压缩
+    std::string hashAlgorithm;      // 校验算法
+    bool rawDataFrames;             // 文件数据是否可用原始帧
+    uint32_t windowSize;            // 可同时在途的请求数
+    bool multiplexing;              // 是否可交错多个请求
+    std::set<std::string> features; // 双方都支持的可选功能
+    std::string serverName;
+
+    ServerCapabilities()
+        : protocolVersion(1), maxFrameSize(MAX_FRAME_SIZE), hashAlgorithm(HASH_MD5)
+        , rawDataFrames(false), windowSize(1), multiplexing(false) {}
+};
 
 class Net_Tool {
 public:
@@ -50,8 +134,17 @@ public:
         return &instance;
     }
 
-    // 连接到服务器
-    bool connectToServer(const std::string& serverIP, uint16_t port);
+    // 连接到服务器，host可以是IP地址或域名；阻塞直到连上或超时，GUI线程请在后台线程调用
+    bool connectToServer(const std::string& host, uint16_t port);
+
+    // 设置连接模式和连接超时，下次连接时生效
+    void setConnectionProfile(ConnectionProfile profile) { m_socketProfile = SocketProfile::forProfile(profile); }
+    void setConnectTimeout(int timeoutMs) { m_connectTimeoutMs = timeoutMs; }
+    // 设置是否使用TLS加密传输，caFile为空时用系统证书校验服务端，下次连接时生效
+    void setTls(bool enabled, const std::string& caFile);
+    // 当前连接的加密状态
+    bool isEncrypted() const { return m_tls.isActive(); }
+    const TlsTransport& tls() const { return m_tls; }
     
     // 断开连接
     void disconnect();
@@ -78,13 +171,50 @@ public:
     // 处理传输进度
     static void handleTransferProgress(const transfer::TransferProgressResponse& progress);
 
-    // 开始文件上传任务
+    // 开始文件上传任务，taskId为空时自动生成
     void startUploadTask(const std::string& fileName, const std::string& targetPath,
-        std::function<void(const transfer::TransferProgressResponse&)> progressCallback);
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal);
 
-    // 开始文件下载任务
+    // 同时上传多个小文件(不超过SMALL_FILE_SIZE)到同一目录，按预算打包成少量请求；
+    // 每个文件仍是独立任务，taskIds与fileNames一一对应，打包失败的文件逐个重传
+    void startUploadBatchTask(const std::vector<std::string>& fileNames, const std::string& targetPath,
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::vector<std::string>& taskIds, TransferPriority priority = TransferPriority::Normal);
+
+    // 开始文件下载任务，taskId为空时自动生成
     void startDownloadTask(const std::string& fileName, const std::string& targetPath,
-        std::function<void(const transfer::TransferProgressResponse&)> progressCallback);
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal);
+
+    // 开始目录上传任务，递归上传localDir到targetPath下的同名目录
+    void startDirectoryUploadTask(const std::string& localDir, const std::string& targetPath,
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal);
+
+    // 开始目录下载任务，递归下载remoteDir到targetPath下的同名目录
+    void startDirectoryDownloadTask(const std::string& remoteDir, const std::string& targetPath,
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal);
+
+    // 以归档流方式上传目录，整个目录树作为一个连续流传输，适合海量小文件
+    void startArchiveUploadTask(const std::string& localDir, const std::string& targetPath,
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal, bool compress = true);
+
+    // 以归档流方式下载目录
+    void startArchiveDownloadTask(const std::string& remoteDir, const std::string& targetPath,
+        std::function<void(const transfer::TransferProgressResponse&)> progressCallback,
+        const std::string& taskId = std::string(),
+        TransferPriority priority = TransferPriority::Normal, bool compress = true);
+
+    // 调整传输任务优先级，运行中的任务立即按新权重分配带宽
+    void setTaskPriority(const std::string& taskId, TransferPriority priority);
 
     // 暂停传输任务
     void pauseTransfer(const std::string& taskId);
@@ -95,14 +225,56 @@ public:
     // 取消传输任务
     void cancelTransfer(const std::string& taskId);
 
-    // 发送目录请求并获取响应
+    // 发送目录请求并获取响应(阻塞，GUI线程请使用RemoteDirectoryLoader)
     transfer::DirectoryResponse sendDirectoryRequest(const transfer::DirectoryRequest& request);
 
+    // 发送目录请求，isCancelled在取得socket后检查，返回true时放弃发送
+    // 响应按页返回，cursor为空时取第一页(可命中缓存)，否则按游标取后续页
+    bool requestDirectory(const transfer::DirectoryRequest& request, transfer::DirectoryResponse& response,
+        std::function<bool()> isCancelled = nullptr);
+
+    // 后台预取目录列表到缓存，已缓存时直接返回
+    bool prefetchDirectory(const std::string& path, std::function<bool()> isCancelled = nullptr);
+
+    // 远程搜索：依次取得服务端的各页结果，每页调用一次onPage
+    // 服务端支持游标时每页一次请求，页与页之间让出socket，isCancelled返回true后不再请求下一页并通知服务端放弃；
+    // 旧服务端对一次请求连续回送各页，取消后不再回调，但仍读完剩余的页以保持连接同步
+    bool searchRemote(const transfer::SearchRequest& request,
+        const std::function<void(const transfer::SearchResponse&)>& onPage,
+        const std::function<bool()>& isCancelled = nullptr);
+
+    // 订阅目录变化，paths替换之前的全部订阅；服务端不支持时返回false
+    bool watchDirectories(const std::vector<std::string>& paths);
+    // 服务端是否接受了对path的订阅，已订阅的目录传输完成后不再主动刷新
+    bool isWatching(const std::string& path);
+    // 设置目录变化回调，在网络线程中调用
+    void setChangeCallback(std::function<void(const transfer::ChangeNotification&)> callback) {
+        m_changeCallback = callback;
+    }
+
+    // 设置单个任务的限速(字节/秒)，0表示不限速
+    void setTaskSpeedLimit(const std::string& taskId, uint64_t bytesPerSecond);
+
+    // 当前连接的服务器地址(ip:port)，用于服务器级限速
+    std::string serverAddress() const {
+        std::shared_ptr<const std::string> address = std::atomic_load(&m_serverAddress);
+        return address ? *address : std::string();
+    }
+    bool isConnected() const { return m_isConnected; }
+    // 握手协商出的能力，重连时整体替换，调用方持有的快照不受影响
+    std::shared_ptr<const ServerCapabilities> capabilities() const { return std::atomic_load(&m_capabilities); }
+    bool hasFeature(const std::string& feature) const { return capabilities()->features.count(feature) > 0; }
+
     // 设置错误回调
     void setErrorCallback(std::function<void(const std::string&)> callback) {
         m_errorCallback = callback;
     }
 
+    // 设置连接状态回调：连接意外中断时以false调用，自动重连成功后以true调用，在网络线程中调用
+    void setConnectionStateCallback(std::function<void(bool)> callback) {
+        m_connectionStateCallback = callback;
+    }
+
 private:
     Net_Tool();
     ~Net_Tool();
@@ -118,29 +290,75 @@ public:
     // 生成文件的MD5值
     std::string calculateFileMD5(const std::string& filePath);
 
+    // 生成内存数据的MD5值
+    std::string calculateDataMD5(const void* data, size_t length);
+
     // 生成数据的CRC32校验和
     uint32_t calculateCRC32(const void* data, size_t length);
 
     // 生成请求头
     transfer::RequestHeader createRequestHeader(transfer::MessageType type);
+    // 发送前填入本连接的会话ID和新的序列号，返回序列号；同一请求对象重发时每次重新分配
+    uint64_t stampHeader(transfer::RequestHeader* header);
 
     // 发送数据
     bool sendData(const void* data, size_t length);
 
-    // 接收数据
-    bool receiveData(void* buffer, size_t length);
+    // 接收数据，stallTimeoutMs为无任何进展的最长等待时间
+    bool receiveData(void* buffer, size_t length, int stallTimeoutMs = IO_TIMEOUT_MS);
 
-    // 发送protobuf消息
+    // 发送protobuf消息，帧类型由MessageTraits<T>确定
     template<typename T>
-    bool sendMessage(const T& message, char type);
+    bool sendMessage(const T& message);
 
-    // 接收protobuf消息
+    // 接收一帧，返回帧类型和未解析的消息体
+    bool receiveFrame(char& type, std::string& frame);
+
+    // 接收protobuf消息；sequence不为0时只接收该请求的响应，
+    // 其他在途请求的响应转交给对应请求，已放弃的请求的响应丢弃；
+    // 期间到达的其他类型的帧交给m_dispatcher中登记的处理函数
     template<typename T>
-    bool receiveMessage(T& message, char type);
+    bool receiveMessage(T& message, uint64_t sequence = 0);
+
+    // 发送请求并接收响应，响应类型由ResponseOf<Req>确定，期间独占socket；taskId为空表示交互请求
+    // isCancelled在取得socket后检查，返回true时不再发送；发送前为request分配新的序列号
+    template<typename Req>
+    bool exchangeMessage(Req& request, typename ResponseOf<Req>::type& response,
+        const std::string& taskId = std::string(), uint64_t bytes = 0,
+        const std::function<bool()>& isCancelled = nullptr);
 
     //查看数据，返回本次查看的数据长度
     int peek_read(char *buf, int len);
 
+    // 建立TCP连接，解析出的多个地址按Happy Eyeballs交错并行尝试
+    bool openConnection(const std::string& host, uint16_t port);
+    // 握手协商能力，结果写入result；未协商成功时result为旧协议的默认能力
+    // legacy返回服务端是否明确不支持握手(回了别的消息)，等待超时不算；连接被服务端关闭时返回false
+    bool negotiateCapabilities(ServerCapabilities& result, bool& legacy);
+    // 发布新的连接能力
+    void setCapabilities(const ServerCapabilities& capabilities);
+    // 连接m_host并握手，旧服务端关闭连接时重连并按旧协议通信；
+    // 明确不支持握手的服务端记下来不再握手，握手超时只影响本次连接
+    bool establishConnection();
+    // 主动关闭socket，不触发重连
+    void closeSocket();
+    // 中止正在建立的连接：解析和连接不再等待，握手中的socket被关闭读写
+    void abortConnecting();
+    // 收发失败或超时后关闭socket并标记连接中断，由后台线程重连；调用时须持有m_sockMutex
+    void dropConnectionLocked(const std::string& reason);
+    // 后台线程中按退避间隔重连，直到成功或用户断开
+    void reconnect();
+    // 连接空闲时发送心跳，超时未响应则判定连接已断开
+    void sendHeartbeat();
+
+    // 等待socket可读，超时返回false
+    bool waitReadable(int timeoutMs);
+    // 后台线程：空闲时读取服务端推送、发送心跳，连接中断后重连
+    void watchLoop();
+    void stopWatchThread();
+    // 处理一条目录变化推送
+    void handleNotification(const transfer::ChangeNotification& notification);
+
     // 传输任务结构
     struct TransferTask {
         std::string taskId;
@@ -148,27 +366,102 @@ public:
         std::string targetPath;
         uint64_t fileSize;
         uint64_t transferredSize;
-        bool isPaused;
-        bool isCancelled;
+        std::atomic<bool> isPaused;     // 由界面线程设置，传输线程和子任务读取
+        std::atomic<bool> isCancelled;
         std::thread transferThread;
         std::function<void(const transfer::TransferProgressResponse&)> progressCallback;
+        std::string flowId;          // 调度器和限速器使用的标识，目录任务的子任务共用目录任务的标识
+        TransferTask* parent;        // 所属目录任务，独立任务为空
+        bool refreshRemote;          // 完成后是否刷新远端目录
+
+        bool paused() const { return isPaused || (parent && parent->isPaused); }
+        bool cancelled() const { return isCancelled || (parent && parent->isCancelled); }
     };
 
     socket_t m_sock;
-    bool m_isConnected;
+    std::atomic<bool> m_isConnected;
+    std::string m_host;              // 连接时使用的主机名，重连时重新解析
+    uint16_t m_port;
+    std::shared_ptr<const std::string> m_serverAddress; // 当前连接的服务器地址，用atomic_load读取
+    std::atomic<uint64_t> m_connectionGeneration; // 每建立一次连接加1，用于判断失败后是否已重连
+    std::atomic<int64_t> m_lastActivityMs;        // 最后一次收发成功的时间，用于判断是否空闲
+    std::atomic<bool> m_reconnecting;             // 是否在自动重连
+    std::atomic<bool> m_connectAborted;           // 用户断开了连接，正在建立的连接应尽快放弃
+    std::mutex m_connectingMutex;
+    socket_t m_connectingSock;                    // 已连上但还在TLS握手的socket，由m_connectingMutex保护
+    std::shared_ptr<const std::string> m_sessionId; // 本连接的会话ID，建立连接时生成，用atomic_load读取
+    std::atomic<uint64_t> m_nextSequence;         // 请求序列号，跨连接单调递增，旧连接的响应不会被误认
+    PendingRequests m_pendingRequests;            // 等待响应的请求，按序列号匹配
+    FrameDispatcher m_dispatcher;                 // 不属于请求的帧(服务端推送)的处理函数
+    std::condition_variable m_connectedCond;      // 重连成功或放弃时唤醒等待的传输任务
+    SocketProfile m_socketProfile;   // 新连接使用的socket选项
+    int m_connectTimeoutMs;          // 建立连接的超时
+    std::atomic<bool> m_tlsEnabled;  // 新连接是否进行TLS握手
+    TlsTransport m_tls;              // 当前连接的TLS状态，与m_sock一起由m_sockMutex保护(握手除外，见TlsTransport)
     std::mutex m_sockMutex;
     std::mutex m_tasksMutex;
     std::map<std::string, TransferTask*> m_transferTasks;
     std::function<void(const std::string&)> m_errorCallback;
+    std::function<void(const transfer::ChangeNotification&)> m_changeCallback;
+    std::function<void(bool)> m_connectionStateCallback;
+    std::shared_ptr<const ServerCapabilities> m_capabilities; // 用atomic_load读取，建立连接时整体替换
+    std::set<std::string> m_legacyServers;  // 明确不支持握手的服务端(host:port)，只在建立连接时访问
+    std::thread m_watchThread;
+    std::atomic<bool> m_watchRunning;   // 推送读取线程是否运行
+    std::atomic<bool> m_watchActive;    // 服务端是否接受了订阅
+    std::mutex m_watchMutex;
+    std::set<std::string> m_watchedPaths; // 服务端接受的订阅(规范化路径)，由m_watchMutex保护
 
     // 生成唯一的任务ID
     std::string generateTaskId();
 
     // 添加上传任务处理函数
     void handleUploadTask(TransferTask* task);
+    // 打包上传多个小文件，batch为打包请求使用的调度流，tasks为各文件的任务
+    void handleUploadBatchTask(TransferTask* batch, std::vector<TransferTask*> tasks);
+    // 上传单个文件，成功返回true，不负责清理任务
+    bool uploadFile(TransferTask* task);
+    // 把多个小文件打包进一个上传请求，results逐个返回文件是否上传成功
+    void uploadFileBatch(TransferTask* job, const std::vector<std::string>& fileNames,
+        const std::vector<std::string>& targetPaths, std::vector<bool>& results);
+
+    // 目录上传任务处理函数
+    void handleDirectoryUploadTask(TransferTask* job);
+    // 目录下载任务处理函数
+    void handleDirectoryDownloadTask(TransferTask* job);
+    // 归档流上传/下载任务处理函数
+    void handleArchiveUploadTask(TransferTask* job, bool compress);
+    void handleArchiveDownloadTask(TransferTask* job, bool compress);
+    // 发送一块归档流请求并接收响应，数据按需压缩/解压
+    bool exchangeArchiveBlock(TransferTask* job, transfer::ArchiveRequest& request,
+        const std::string& rawData, transfer::ArchiveResponse& response, std::string& rawResponseData);
+
+    // 批量创建远端目录
+    bool makeRemoteDirectories(TransferTask* job, const std::string& basePath,
+        const std::vector<std::string>& paths);
+    // 刷新远端目录显示
+    void refreshRemoteDirectory(const std::string& path);
     
     // 添加下载任务处理函数 
     void handleDownloadTask(TransferTask* task);
+    // 下载单个文件，成功返回true，不负责清理任务
+    bool downloadFile(TransferTask* task);
+
+    // 创建并登记目录任务
+    TransferTask* createDirectoryJob(const std::string& source, const std::string& targetPath,
+        const std::string& taskId, TransferPriority priority);
+
+    // 传输任务的交互失败后调用：连接在generation之后中断时等待重连，重连成功返回true
+    // 单文件上传/下载、打包上传、批量创建目录和目录列表分页在重连后重发；
+    // 归档流的状态只存在于原连接上，无法接续，连接中断时归档任务失败
+    bool waitForReconnect(TransferTask* task, uint64_t generation);
+    // 以task的调度流发送请求，连接中断时等待重连后重发；只用于可以重复执行的请求
+    template<typename Req>
+    bool exchangeRetrying(TransferTask* task, Req& request, typename ResponseOf<Req>::type& response,
+        uint64_t bytes = 0);
+
+    // 传输结束后清理任务资源
+    void finishTask(TransferTask* task);
 };
 
 #endif  // NET_TOOL_H
\ No newline at end of file
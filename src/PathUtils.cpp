@@ -0,0 +1,23 @@
+#include "PathUtils.h"
+
+bool isSafeRelativePath(const std::string& path)
+{
+    if (path.empty() || path[0] == '/' || path.find('\\') != std::string::npos
+        || path.find('\0') != std::string::npos
+        || (path.size() >= 2 && path[1] == ':')) {
+        return false;
+    }
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        std::string part = path.substr(start, end - start);
+        if (part.empty() || part == "." || part == "..") {
+            return false;
+        }
+        start = end + 1;
+    }
+    return true;
+}
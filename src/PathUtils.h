@@ -0,0 +1,10 @@
+#ifndef PATHUTILS_H
+#define PATHUTILS_H
+
+#include <string>
+
+// 检查服务端给出的相对路径能否安全地拼接到本地目标目录下：
+// 拒绝空路径、绝对路径、盘符、反斜杠、空字符以及空的、"."、".."路径段，防止写出目标目录
+bool isSafeRelativePath(const std::string& path);
+
+#endif // PATHUTILS_H
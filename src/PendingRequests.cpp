@@ -0,0 +1,107 @@
+#include "PendingRequests.h"
+#include <thread>
+
+PendingRequests::PendingRequests()
+{
+    for (Slot& slot : m_slots) {
+        slot.sequence.store(0, std::memory_order_relaxed);
+        slot.state.store(Waiting, std::memory_order_relaxed);
+        slot.type = 0;
+    }
+}
+
+bool PendingRequests::add(uint64_t sequence)
+{
+    if (sequence == 0) {
+        return false;
+    }
+    Slot& slot = slotFor(sequence);
+    uint64_t expected = 0;
+    return slot.sequence.compare_exchange_strong(expected, sequence, std::memory_order_acq_rel);
+}
+
+void PendingRequests::remove(uint64_t sequence)
+{
+    if (sequence != 0) {
+        release(slotFor(sequence), sequence);
+    }
+}
+
+bool PendingRequests::contains(uint64_t sequence) const
+{
+    return sequence != 0 && slotFor(sequence).sequence.load(std::memory_order_acquire) == sequence;
+}
+
+bool PendingRequests::deliver(uint64_t sequence, char type, std::string& frame)
+{
+    Slot& slot = slotFor(sequence);
+    if (sequence == 0 || slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    // 占住槽位再写，防止请求同时注销
+    int expected = Waiting;
+    if (!slot.state.compare_exchange_strong(expected, Writing, std::memory_order_acq_rel)) {
+        return false;
+    }
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        slot.state.store(Waiting, std::memory_order_release);
+        return false;
+    }
+    slot.type = type;
+    slot.frame.swap(frame);
+    slot.state.store(Delivered, std::memory_order_release);
+    return true;
+}
+
+bool PendingRequests::take(uint64_t sequence, char& type, std::string& frame)
+{
+    Slot& slot = slotFor(sequence);
+    if (sequence == 0 || slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+    int expected = Delivered;
+    if (!slot.state.compare_exchange_strong(expected, Writing, std::memory_order_acq_rel)) {
+        return false;
+    }
+    type = slot.type;
+    frame.swap(slot.frame);
+    slot.frame.clear();
+    slot.state.store(Waiting, std::memory_order_release);
+    return true;
+}
+
+void PendingRequests::clear()
+{
+    for (Slot& slot : m_slots) {
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 0) {
+            release(slot, sequence);
+        }
+    }
+}
+
+void PendingRequests::release(Slot& slot, uint64_t sequence)
+{
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return;
+    }
+    int state = slot.state.load(std::memory_order_acquire);
+    while (true) {
+        if (state == Writing) {
+            std::this_thread::yield();
+            state = slot.state.load(std::memory_order_acquire);
+            continue;
+        }
+        if (slot.state.compare_exchange_weak(state, Writing, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    // 占住槽位后再确认一次：检查之后槽位可能已被clear释放并由新的请求登记，此时原样归还
+    uint64_t expected = sequence;
+    if (!slot.sequence.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+        slot.state.store(state, std::memory_order_release);
+        return;
+    }
+    slot.frame.clear();
+    slot.state.store(Waiting, std::memory_order_release);
+}
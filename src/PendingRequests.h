@@ -0,0 +1,62 @@
+#ifndef PENDINGREQUESTS_H
+#define PENDINGREQUESTS_H
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief 在途请求表
+ *
+ * 负责:
+ * 1. 按请求序列号登记等待响应的请求，O(1)查找，不加锁
+ * 2. 读到不属于自己的响应时交给登记了该序列号的请求，由其稍后取走
+ * 3. 没有请求登记的响应(请求已放弃)由调用方丢弃
+ *
+ * 序列号单调递增，槽位按序列号取模直接映射；在途请求数不超过容量时不会冲突
+ */
+class PendingRequests
+{
+public:
+    static const size_t CAPACITY = 64;   // 不小于可同时在途的请求数
+
+    PendingRequests();
+
+    // 登记一个在途请求，槽位仍被更早的请求占用时返回false
+    bool add(uint64_t sequence);
+    // 注销请求，未取走的响应一并丢弃
+    void remove(uint64_t sequence);
+    // 是否有请求登记了该序列号
+    bool contains(uint64_t sequence) const;
+
+    // 把响应交给登记了该序列号的请求，未登记或已有响应时返回false
+    bool deliver(uint64_t sequence, char type, std::string& frame);
+    // 取走已送达的响应，尚未送达时返回false
+    bool take(uint64_t sequence, char& type, std::string& frame);
+
+    // 连接断开后放弃所有在途请求
+    void clear();
+
+private:
+    PendingRequests(const PendingRequests&) = delete;
+    PendingRequests& operator=(const PendingRequests&) = delete;
+
+    enum SlotState { Waiting = 0, Writing = 1, Delivered = 2 };
+
+    struct Slot {
+        std::atomic<uint64_t> sequence;   // 0表示空闲
+        std::atomic<int> state;
+        char type;
+        std::string frame;
+    };
+
+    Slot& slotFor(uint64_t sequence) { return m_slots[sequence % CAPACITY]; }
+    const Slot& slotFor(uint64_t sequence) const { return m_slots[sequence % CAPACITY]; }
+    // 等待正在写入的响应完成后释放槽位；槽位已不属于sequence时不动
+    void release(Slot& slot, uint64_t sequence);
+
+    Slot m_slots[CAPACITY];
+};
+
+#endif // PENDINGREQUESTS_H
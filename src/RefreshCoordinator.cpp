@@ -0,0 +1,76 @@
+#include "RefreshCoordinator.h"
+
+// 同一目录两次刷新的最小间隔
+static const qint64 REFRESH_INTERVAL_MS = 1000;
+
+RefreshCoordinator& RefreshCoordinator::instance()
+{
+    static RefreshCoordinator coordinator;
+    return coordinator;
+}
+
+RefreshCoordinator::RefreshCoordinator()
+    : QObject(nullptr)
+{
+    m_clock.start();
+    m_timer.setSingleShot(true);
+    connect(&m_timer, &QTimer::timeout, this, &RefreshCoordinator::flushDue);
+}
+
+void RefreshCoordinator::requestRefresh(const QString& path)
+{
+    QMetaObject::invokeMethod(this, "schedule", Qt::QueuedConnection, Q_ARG(QString, path));
+}
+
+void RefreshCoordinator::schedule(const QString& path)
+{
+    qint64 now = m_clock.elapsed();
+    auto it = m_states.find(path);
+    if (it == m_states.end() || now - it->second.lastRefresh >= REFRESH_INTERVAL_MS) {
+        // 间隔外的第一次请求立即刷新，单个文件上传后无需等待
+        State state;
+        state.lastRefresh = now;
+        state.pending = false;
+        m_states[path] = state;
+        emit refreshDue(path);
+    } else {
+        it->second.pending = true;
+    }
+    armTimer();
+}
+
+void RefreshCoordinator::flushDue()
+{
+    qint64 now = m_clock.elapsed();
+    for (auto it = m_states.begin(); it != m_states.end();) {
+        State& state = it->second;
+        if (now - state.lastRefresh < REFRESH_INTERVAL_MS) {
+            ++it;
+        } else if (state.pending) {
+            state.lastRefresh = now;
+            state.pending = false;
+            emit refreshDue(it->first);
+            ++it;
+        } else {
+            it = m_states.erase(it);  // 间隔内没有新的请求，不再跟踪
+        }
+    }
+    armTimer();
+}
+
+void RefreshCoordinator::armTimer()
+{
+    qint64 now = m_clock.elapsed();
+    qint64 next = -1;
+    for (const auto& item : m_states) {
+        qint64 due = item.second.lastRefresh + REFRESH_INTERVAL_MS;
+        if (next < 0 || due < next) {
+            next = due;
+        }
+    }
+    if (next < 0) {
+        m_timer.stop();
+    } else {
+        m_timer.start(static_cast<int>(qMax<qint64>(0, next - now)));
+    }
+}
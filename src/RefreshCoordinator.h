@@ -0,0 +1,55 @@
+#ifndef REFRESHCOORDINATOR_H
+#define REFRESHCOORDINATOR_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <map>
+
+/**
+ * @brief 传输完成后的远端目录刷新协调
+ *
+ * 负责:
+ * 1. 接收任意线程发来的刷新请求，统一转到GUI线程处理
+ * 2. 按目录节流：同一目录在一个间隔内最多刷新一次，间隔内的其余请求合并到间隔结束时再刷新一次
+ * 3. 批量上传大量文件时，目录列表请求数与文件数无关
+ */
+class RefreshCoordinator : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 需在GUI线程中首次调用
+    static RefreshCoordinator& instance();
+
+    // 请求刷新远端目录，可在任意线程调用
+    void requestRefresh(const QString& path);
+
+signals:
+    // 目录到了刷新时间(GUI线程)
+    void refreshDue(const QString& path);
+
+private slots:
+    void schedule(const QString& path);
+    void flushDue();
+
+private:
+    RefreshCoordinator();
+    RefreshCoordinator(const RefreshCoordinator&) = delete;
+    RefreshCoordinator& operator=(const RefreshCoordinator&) = delete;
+
+    // 按最早到期的待刷新目录设置定时器
+    void armTimer();
+
+    struct State {
+        qint64 lastRefresh;    // 上次刷新的时间(ms)
+        bool pending;          // 间隔内是否有新的刷新请求
+    };
+
+    std::map<QString, State> m_states;
+    QElapsedTimer m_clock;
+    QTimer m_timer;
+};
+
+#endif // REFRESHCOORDINATOR_H
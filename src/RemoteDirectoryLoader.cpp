@@ -0,0 +1,191 @@
+#include "RemoteDirectoryLoader.h"
+#include "Net_Tool.h"
+#include "DirectoryCache.h"
+#include <QCoreApplication>
+#include <QRunnable>
+#include <QThreadPool>
+#include <functional>
+
+namespace {
+// 所有加载器共用的后台线程数；请求在socket上本就串行，多开线程只会排队
+const int LOADER_THREADS = 2;
+// 线程池中的优先级：打开目录优先于取后续页，预取最后
+const int PRIORITY_LOAD = 2;
+const int PRIORITY_PAGE = 1;
+const int PRIORITY_PREFETCH = 0;
+
+class LoaderTask : public QRunnable
+{
+public:
+    explicit LoaderTask(std::function<void()> work) : m_work(work) {}
+    void run() override { m_work(); }
+
+private:
+    std::function<void()> m_work;
+};
+
+// 在GUI线程中首次使用时创建，随应用程序对象销毁
+void runInBackground(std::function<void()> work, int priority)
+{
+    static QThreadPool* pool = nullptr;
+    if (!pool) {
+        pool = new QThreadPool(QCoreApplication::instance());
+        pool->setMaxThreadCount(LOADER_THREADS);
+    }
+    pool->start(new LoaderTask(work), priority);
+}
+}
+
+RemoteDirectoryLoader::RemoteDirectoryLoader(QObject* parent)
+    : QObject(parent)
+    , m_shared(std::make_shared<Shared>())
+    , m_nextId(0)
+    , m_loading(false)
+{
+    m_shared->owner = this;
+    m_shared->current = 0;
+    qRegisterMetaType<transfer::DirectoryResponse>("transfer::DirectoryResponse");
+}
+
+RemoteDirectoryLoader::~RemoteDirectoryLoader()
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->owner = nullptr;
+    m_shared->current = 0;
+}
+
+quint64 RemoteDirectoryLoader::load(const transfer::DirectoryRequest& request)
+{
+    quint64 requestId = ++m_nextId;
+    m_shared->current = requestId;
+
+    // 命中缓存时直接交付，不显示加载动画
+    // 待验证的条目(已过期或来自磁盘)先显示，再在后台重新验证
+    Net_Tool* netTool = Net_Tool::getInstance();
+    transfer::DirectoryResponse cached;
+    bool stale = false;
+    bool hasCached = DirectoryCache::instance().lookup(netTool->serverAddress(),
+        DirectoryCache::resolveRequestPath(request), cached, &stale);
+    if (hasCached) {
+        setLoading(false);
+        QMetaObject::invokeMethod(this, "deliver", Qt::QueuedConnection,
+            Q_ARG(quint64, requestId),
+            Q_ARG(transfer::DirectoryResponse, cached),
+            Q_ARG(bool, true));
+        if (!stale) {
+            return requestId;
+        }
+    } else {
+        setLoading(true);
+    }
+
+    std::shared_ptr<Shared> shared = m_shared;
+    std::string cachedEtag = hasCached ? cached.etag() : std::string();
+    runInBackground([shared, requestId, request, hasCached, cachedEtag]() {
+        // 排队等线程或socket期间被新请求取代时不再发送
+        auto superseded = [shared, requestId]() { return shared->current != requestId; };
+        if (superseded()) {
+            return;
+        }
+        transfer::DirectoryResponse response;
+        bool ok = Net_Tool::getInstance()->requestDirectory(request, response, superseded);
+        // 重新验证后目录未变化，不必再刷新一次界面
+        if (hasCached && ok && !cachedEtag.empty() && response.etag() == cachedEtag) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        if (shared->owner && !superseded()) {
+            QMetaObject::invokeMethod(shared->owner, "deliver", Qt::QueuedConnection,
+                Q_ARG(quint64, requestId),
+                Q_ARG(transfer::DirectoryResponse, response),
+                Q_ARG(bool, ok));
+        }
+    }, PRIORITY_LOAD);
+    return requestId;
+}
+
+void RemoteDirectoryLoader::loadPage(const transfer::DirectoryRequest& request)
+{
+    // 后续页属于当前请求，用户导航到别的目录后结果被丢弃
+    std::shared_ptr<Shared> shared = m_shared;
+    quint64 requestId = m_shared->current;
+    runInBackground([shared, requestId, request]() {
+        auto superseded = [shared, requestId]() { return shared->current != requestId; };
+        if (superseded()) {
+            return;
+        }
+        transfer::DirectoryResponse response;
+        bool ok = Net_Tool::getInstance()->requestDirectory(request, response, superseded);
+
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        if (shared->owner && !superseded()) {
+            QMetaObject::invokeMethod(shared->owner, "deliverPage", Qt::QueuedConnection,
+                Q_ARG(quint64, requestId),
+                Q_ARG(transfer::DirectoryResponse, response),
+                Q_ARG(bool, ok));
+        }
+    }, PRIORITY_PAGE);
+}
+
+void RemoteDirectoryLoader::prefetch(const QStringList& paths)
+{
+    std::vector<std::string> pending;
+    for (const QString& path : paths) {
+        pending.push_back(path.toStdString());
+    }
+    if (pending.empty()) {
+        return;
+    }
+
+    // 预取不产生新的请求号，用户再次导航时即停止
+    std::shared_ptr<Shared> shared = m_shared;
+    quint64 generation = m_shared->current;
+    runInBackground([shared, generation, pending]() {
+        auto superseded = [shared, generation]() { return shared->current != generation; };
+        for (const auto& path : pending) {
+            if (superseded() || !Net_Tool::getInstance()->prefetchDirectory(path, superseded)) {
+                break;
+            }
+        }
+    }, PRIORITY_PREFETCH);
+}
+
+void RemoteDirectoryLoader::cancel()
+{
+    m_shared->current = ++m_nextId;
+    setLoading(false);
+}
+
+void RemoteDirectoryLoader::deliver(quint64 requestId, const transfer::DirectoryResponse& response, bool ok)
+{
+    if (requestId != m_shared->current) {
+        return;  // 已被新请求取代
+    }
+    setLoading(false);
+    if (ok) {
+        emit loaded(requestId, response);
+    } else {
+        emit failed(requestId);
+    }
+}
+
+void RemoteDirectoryLoader::deliverPage(quint64 requestId, const transfer::DirectoryResponse& response, bool ok)
+{
+    if (requestId != m_shared->current) {
+        return;
+    }
+    if (ok) {
+        emit pageLoaded(requestId, response);
+    } else {
+        emit failed(requestId);
+    }
+}
+
+void RemoteDirectoryLoader::setLoading(bool loading)
+{
+    if (m_loading != loading) {
+        m_loading = loading;
+        emit loadingChanged(loading);
+    }
+}
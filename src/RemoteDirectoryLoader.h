@@ -0,0 +1,67 @@
+#ifndef REMOTEDIRECTORYLOADER_H
+#define REMOTEDIRECTORYLOADER_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QStringList>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "../protos/transfer.pb.h"
+
+Q_DECLARE_METATYPE(transfer::DirectoryResponse)
+
+/**
+ * @brief 远程目录异步加载器
+ *
+ * 负责:
+ * 1. 在共用的后台线程池(线程数有上限)中发送目录请求，GUI线程不再等待网络往返
+ * 2. 通过信号在GUI线程交付结果
+ * 3. 新请求取代未完成的旧请求：尚未发出的旧请求直接放弃，已发出的旧请求结果被丢弃
+ * 4. 命中目录缓存时直接交付，待验证的缓存先显示再在后台重新验证；空闲时在后台预取子目录
+ * 5. 按游标加载大目录的后续页，导航到别的目录后未完成的页请求作废
+ */
+class RemoteDirectoryLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RemoteDirectoryLoader(QObject* parent = nullptr);
+    ~RemoteDirectoryLoader();
+
+    // 异步加载目录，返回本次请求号
+    quint64 load(const transfer::DirectoryRequest& request);
+    // 异步加载当前目录的后续页，不取代当前请求
+    void loadPage(const transfer::DirectoryRequest& request);
+    // 后台依次预取目录到缓存，下一次load或cancel时停止
+    void prefetch(const QStringList& paths);
+    // 取消未完成的请求
+    void cancel();
+    bool isLoading() const { return m_loading; }
+
+signals:
+    void loaded(quint64 requestId, const transfer::DirectoryResponse& response);
+    void failed(quint64 requestId);
+    void pageLoaded(quint64 requestId, const transfer::DirectoryResponse& response);
+    void loadingChanged(bool loading);
+
+private slots:
+    void deliver(quint64 requestId, const transfer::DirectoryResponse& response, bool ok);
+    void deliverPage(quint64 requestId, const transfer::DirectoryResponse& response, bool ok);
+
+private:
+    void setLoading(bool loading);
+
+    // 与后台线程共享的状态，加载器销毁后后台线程不再回调
+    struct Shared {
+        std::mutex mutex;
+        RemoteDirectoryLoader* owner;
+        std::atomic<quint64> current;   // 最新的请求号
+    };
+
+    std::shared_ptr<Shared> m_shared;
+    quint64 m_nextId;
+    bool m_loading;
+};
+
+#endif // REMOTEDIRECTORYLOADER_H
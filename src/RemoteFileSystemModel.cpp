@@ -1,10 +1,24 @@
 #include "RemoteFileSystemModel.h"
 #include <QFileIconProvider>
 #include <QDateTime>
+#include <algorithm>
+#include <cstring>
+
+// 收窄筛选时逐段删除行的最大段数，超过后把要删除的行移到末尾一次删除
+static const int FILTER_REMOVE_RUNS_MAX = 64;
 
 RemoteFileSystemModel::RemoteFileSystemModel(QObject* parent)
     : QAbstractItemModel(parent)
+    , m_indexedRows(0)
+    , m_sortColumn(0)
+    , m_sortOrder(Qt::AscendingOrder)
+    , m_hasMore(false)
+    , m_fetching(false)
+    , m_version(0)
 {
+    // 名称按自然顺序比较，file2排在file10之前
+    m_collator.setNumericMode(true);
+    m_collator.setCaseSensitivity(Qt::CaseInsensitive);
 }
 
 QModelIndex RemoteFileSystemModel::index(int row, int column, const QModelIndex& parent) const
@@ -25,7 +39,7 @@ int RemoteFileSystemModel::rowCount(const QModelIndex& parent) const
 {
     if (parent.isValid())
         return 0;
-    return m_files.size();
+    return static_cast<int>(m_order.size());
 }
 
 int RemoteFileSystemModel::columnCount(const QModelIndex& parent) const
@@ -36,23 +50,24 @@ int RemoteFileSystemModel::columnCount(const QModelIndex& parent) const
 
 QVariant RemoteFileSystemModel::data(const QModelIndex& index, int role) const
 {
-    if (!index.isValid() || index.row() >= m_files.size())
+    if (!index.isValid() || index.row() >= rowCount())
         return QVariant();
 
-    const RemoteFileInfo& fileInfo = m_files[index.row()];
+    int row = sourceRow(index.row());
+    bool isDirectory = m_listing.isDirectory(row);
 
     if (role == Qt::DisplayRole) {
         switch (index.column()) {
-            case 0: return fileInfo.name;
-            case 1: return fileInfo.isDirectory ? QVariant() : QString::number(fileInfo.size);
-            case 2: return fileInfo.isDirectory ? tr("文件夹") : tr("文件");
-            case 3: return fileInfo.modifyTime.toString("yyyy-MM-dd hh:mm:ss");
+            case 0: return m_listing.name(row);
+            case 1: return isDirectory ? QVariant() : QString::number(m_listing.fileSize(row));
+            case 2: return isDirectory ? tr("文件夹") : tr("文件");
+            case 3: return m_listing.modifyDateTime(row).toString("yyyy-MM-dd hh:mm:ss");
         }
     }
     else if (role == Qt::DecorationRole && index.column() == 0) {
         static QFileIconProvider iconProvider;
-        return fileInfo.isDirectory ? iconProvider.icon(QFileIconProvider::Folder)
-                                  : iconProvider.icon(QFileIconProvider::File);
+        return isDirectory ? iconProvider.icon(QFileIconProvider::Folder)
+                           : iconProvider.icon(QFileIconProvider::File);
     }
 
     return QVariant();
@@ -74,58 +89,539 @@ QVariant RemoteFileSystemModel::headerData(int section, Qt::Orientation orientat
 void RemoteFileSystemModel::clear()
 {
     beginResetModel();
-    m_files.clear();
+    m_listing.clear();
+    m_sorted.clear();
+    m_order.clear();
+    m_visible.clear();
+    m_sortKeys.clear();
+    m_lowerNames.clear();
+    m_lowerOffsets.clear();
+    m_rowByName.clear();
+    m_indexedRows = 0;
+    m_version = 0;
     endResetModel();
 }
 
 void RemoteFileSystemModel::addFile(const RemoteFileInfo& fileInfo)
 {
-    beginInsertRows(QModelIndex(), m_files.size(), m_files.size());
-    m_files.append(fileInfo);
+    uint32_t row = static_cast<uint32_t>(m_listing.size());
+    m_listing.append(fileInfo.name.toUtf8().toStdString(), fileInfo.isDirectory, fileInfo.size,
+                     RemoteListing::fromDateTime(fileInfo.modifyTime));
+    m_sorted.push_back(row);
+    updateVisibility(row);
+    if(!m_visible[row])
+        return;
+    beginInsertRows(QModelIndex(), rowCount(), rowCount());
+    m_order.push_back(row);
     endInsertRows();
 }
 
+RemoteFileInfo RemoteFileSystemModel::fileInfo(const QModelIndex& index) const
+{
+    RemoteFileInfo info;
+    int row = sourceRow(index.row());
+    info.name = m_listing.name(row);
+    info.path = m_listing.path();
+    info.isDirectory = m_listing.isDirectory(row);
+    info.size = static_cast<qint64>(m_listing.fileSize(row));
+    info.modifyTime = m_listing.modifyDateTime(row);
+    return info;
+}
+
+RemoteListing RemoteFileSystemModel::buildListing(const transfer::DirectoryResponse& response)
+{
+    RemoteListing listing;
+    // 所有条目共享同一个目录路径
+    listing.setPath(QString::fromStdString(response.path()));
+    // 按响应的编码解码，.项和根目录下..项不显示
+    listing.appendEntries(response);
+    return listing;
+}
+
+void RemoteFileSystemModel::updatePaging(const transfer::DirectoryResponse& response)
+{
+    m_hasMore = response.has_more() && !response.next_cursor().empty();
+    m_nextCursor = QString::fromStdString(response.next_cursor());
+    m_fetching = false;
+}
+
 void RemoteFileSystemModel::updateModel(const transfer::DirectoryResponse& response) 
 {
     if(response.header().success()) {
-        // 清空当前数据
-        clear();
-        
-        // 遍历并添加新的文件条目
-        // 创建两个向量，分别存储目录文件和普通文件信息
-        std::vector<RemoteFileInfo> directoryFiles;
-        std::vector<RemoteFileInfo> normalFiles;
-        // 遍历响应中的所有文件
-        for(const auto& file : response.files()) {
-            RemoteFileInfo fileInfo;
-            // 设置文件信息的名称和路径
-            fileInfo.name = QString::fromStdString(file.name());
-            fileInfo.path = QString::fromStdString(response.path());
-            // 过滤掉当前目录和根目录下的上级目录项
-            if(fileInfo.name=="." || (response.path()=="/"&&fileInfo.name == ".."))
-            {//.项和根目录下..项不显示
-                continue;
-            }
-            // 根据文件类型设置是否为目录
-            fileInfo.isDirectory = file.is_directory();
-            // 设置文件大小
-            fileInfo.size = file.size();
-            // 设置文件修改时间
-            fileInfo.modifyTime = QDateTime::fromString(QString::fromStdString(file.modify_time()), Qt::ISODate);
-            
-            // 根据文件类型将文件信息添加到对应的向量中
-            if(fileInfo.isDirectory)
-                directoryFiles.push_back(fileInfo);
+        // 先在模型外建好完整列表，再一次重置换入，视图只重新布局一次
+        RemoteListing listing = buildListing(response);
+        beginResetModel();
+        m_listing.swap(listing);
+        m_sortKeys.clear();
+        m_lowerNames.clear();
+        m_lowerOffsets.clear();
+        m_rowByName.clear();
+        m_indexedRows = 0;
+        m_version = response.version();
+        m_sorted.resize(static_cast<size_t>(m_listing.size()));
+        for(size_t i = 0; i < m_sorted.size(); ++i)
+            m_sorted[i] = static_cast<uint32_t>(i);
+        // 新列表沿用用户选择的排序和筛选
+        sortRows(m_sorted);
+        m_visible.clear();
+        updateVisibility(0);
+        m_order = visibleRows(m_sorted);
+        updatePaging(response);
+        endResetModel();
+    }
+}
+
+void RemoteFileSystemModel::appendPage(const transfer::DirectoryResponse& response)
+{
+    if(!response.header().success()) {
+        m_fetching = false;
+        return;
+    }
+    updatePaging(response);
+
+    // 整页追加到末尾，一页只触发一次插入，再按当前排序整体重排
+    RemoteListing page = buildListing(response);
+    if(page.isEmpty())
+        return;
+    uint32_t first = static_cast<uint32_t>(m_listing.size());
+    m_listing.append(page);
+    updateVisibility(first);
+
+    std::vector<uint32_t> added;
+    for(uint32_t row = first; row < static_cast<uint32_t>(m_listing.size()); ++row) {
+        m_sorted.push_back(row);
+        if(m_visible[row])
+            added.push_back(row);
+    }
+    if(!added.empty()) {
+        beginInsertRows(QModelIndex(), rowCount(), rowCount() + static_cast<int>(added.size()) - 1);
+        m_order.insert(m_order.end(), added.begin(), added.end());
+        endInsertRows();
+    }
+
+    sortRows(m_sorted);
+    std::vector<uint32_t> order = visibleRows(m_sorted);
+    applyOrder(order);
+}
+
+bool RemoteFileSystemModel::applyDelta(const transfer::DirectoryResponse& response)
+{
+    // 增量只能应用在它所基于的完整列表上
+    if(!response.header().success() || !response.is_delta() || m_version == 0
+        || response.base_version() != m_version || m_hasMore)
+        return false;
+
+    ensureSortKeys();
+    ensureNameIndex();
+    for(const auto& name : response.removed()) {
+        auto it = m_rowByName.find(name);
+        if(it == m_rowByName.end())
+            continue;
+        uint32_t row = it->second;
+        m_rowByName.erase(it);
+        removeRow(row);
+    }
+
+    RemoteListing changes = buildListing(response);
+    for(int i = 0; i < changes.size(); ++i) {
+        std::string name(changes.nameData(i), static_cast<size_t>(changes.nameLength(i)));
+        auto it = m_rowByName.find(name);
+        if(it != m_rowByName.end()) {
+            updateRow(it->second, changes.isDirectory(i), changes.fileSize(i), changes.modifyTime(i));
+            continue;
+        }
+        uint32_t row = static_cast<uint32_t>(m_listing.size());
+        m_listing.append(name, changes.isDirectory(i), changes.fileSize(i), changes.modifyTime(i));
+        ensureSortKeys();
+        ensureNameIndex();
+        insertRow(row);
+    }
+    m_version = response.version();
+    return true;
+}
+
+void RemoteFileSystemModel::ensureNameIndex()
+{
+    for(int row = m_indexedRows; row < m_listing.size(); ++row) {
+        if(!m_listing.isRemoved(row))
+            m_rowByName[std::string(m_listing.nameData(row), static_cast<size_t>(m_listing.nameLength(row)))] =
+                static_cast<uint32_t>(row);
+    }
+    m_indexedRows = m_listing.size();
+}
+
+void RemoteFileSystemModel::insertRow(uint32_t row)
+{
+    // m_sorted和m_order都保持有序，二分查找插入位置
+    auto less = [this](uint32_t a, uint32_t b) { return rowLess(a, b); };
+    updateVisibility(row);
+    m_sorted.insert(std::lower_bound(m_sorted.begin(), m_sorted.end(), row, less), row);
+    if(!m_visible[row])
+        return;
+    auto pos = std::lower_bound(m_order.begin(), m_order.end(), row, less);
+    int viewRow = static_cast<int>(pos - m_order.begin());
+    beginInsertRows(QModelIndex(), viewRow, viewRow);
+    m_order.insert(pos, row);
+    endInsertRows();
+}
+
+void RemoteFileSystemModel::removeRow(uint32_t row)
+{
+    auto less = [this](uint32_t a, uint32_t b) { return rowLess(a, b); };
+    auto sortedPos = std::lower_bound(m_sorted.begin(), m_sorted.end(), row, less);
+    if(sortedPos != m_sorted.end() && *sortedPos == row)
+        m_sorted.erase(sortedPos);
+    // 列表行号不变，条目只做删除标记
+    m_listing.markRemoved(static_cast<int>(row));
+
+    auto pos = std::lower_bound(m_order.begin(), m_order.end(), row, less);
+    m_visible[row] = 0;
+    if(pos == m_order.end() || *pos != row)
+        return;
+    int viewRow = static_cast<int>(pos - m_order.begin());
+    beginRemoveRows(QModelIndex(), viewRow, viewRow);
+    m_order.erase(pos);
+    endRemoveRows();
+}
+
+void RemoteFileSystemModel::updateRow(uint32_t row, bool isDirectory, uint64_t size, int64_t modifyTime)
+{
+    auto less = [this](uint32_t a, uint32_t b) { return rowLess(a, b); };
+    // 先按旧属性找到当前位置，更新后再按新属性找到新位置
+    auto sortedPos = std::lower_bound(m_sorted.begin(), m_sorted.end(), row, less);
+    int oldView = -1;
+    if(m_visible[row]) {
+        auto pos = std::lower_bound(m_order.begin(), m_order.end(), row, less);
+        if(pos != m_order.end() && *pos == row)
+            oldView = static_cast<int>(pos - m_order.begin());
+    }
+    if(sortedPos != m_sorted.end() && *sortedPos == row)
+        m_sorted.erase(sortedPos);
+    m_listing.update(static_cast<int>(row), isDirectory, size, modifyTime);
+    m_sorted.insert(std::lower_bound(m_sorted.begin(), m_sorted.end(), row, less), row);
+    if(oldView < 0)
+        return;
+
+    // 在去掉自身的视图行中查找新位置，位置变化时移动该行
+    m_order.erase(m_order.begin() + oldView);
+    int newView = static_cast<int>(std::lower_bound(m_order.begin(), m_order.end(), row, less) - m_order.begin());
+    m_order.insert(m_order.begin() + oldView, row);
+    if(newView != oldView) {
+        beginMoveRows(QModelIndex(), oldView, oldView, QModelIndex(), newView > oldView ? newView + 1 : newView);
+        m_order.erase(m_order.begin() + oldView);
+        m_order.insert(m_order.begin() + newView, row);
+        endMoveRows();
+    }
+    emit dataChanged(index(newView, 0), index(newView, columnCount() - 1));
+}
+
+bool RemoteFileSystemModel::canFetchMore(const QModelIndex& parent) const
+{
+    return !parent.isValid() && m_hasMore && !m_fetching;
+}
+
+void RemoteFileSystemModel::fetchMore(const QModelIndex& parent)
+{
+    if(!canFetchMore(parent))
+        return;
+    m_fetching = true;
+    emit fetchMoreRequested(m_currentPath, m_nextCursor);
+}
+
+void RemoteFileSystemModel::sort(int column, Qt::SortOrder order)
+{
+    if(column < 0 || column >= columnCount())
+        return;
+    m_sortColumn = column;
+    m_sortOrder = order;
+
+    // 对全部条目排序，当前可见的行按新顺序排列
+    sortRows(m_sorted);
+    std::vector<uint32_t> rows = visibleRows(m_sorted);
+    applyOrder(rows);
+}
+
+void RemoteFileSystemModel::ensureSortKeys()
+{
+    m_sortKeys.reserve(static_cast<size_t>(m_listing.size()));
+    for(int row = static_cast<int>(m_sortKeys.size()); row < m_listing.size(); ++row)
+        m_sortKeys.push_back(m_collator.sortKey(m_listing.name(row)));
+}
+
+// 扩展名(小写)，按类型排序时使用
+static QString lowerSuffix(const QString& name)
+{
+    int dot = name.lastIndexOf('.');
+    return dot > 0 ? name.mid(dot + 1).toLower() : QString();
+}
+
+bool RemoteFileSystemModel::isParentEntry(uint32_t row) const
+{
+    return m_listing.nameLength(static_cast<int>(row)) == 2
+        && memcmp(m_listing.nameData(static_cast<int>(row)), "..", 2) == 0;
+}
+
+int RemoteFileSystemModel::compareRows(uint32_t a, uint32_t b, const std::vector<QString>* suffixes) const
+{
+    // 上级目录项始终在最前，其次是目录，都不受升降序影响
+    bool upA = isParentEntry(a);
+    bool upB = isParentEntry(b);
+    if(upA != upB)
+        return upA ? -1 : 1;
+
+    bool dirA = m_listing.isDirectory(static_cast<int>(a));
+    bool dirB = m_listing.isDirectory(static_cast<int>(b));
+    if(dirA != dirB)
+        return dirA ? -1 : 1;
+
+    int cmp = 0;
+    switch(m_sortColumn) {
+        case 1: {
+            uint64_t sizeA = m_listing.fileSize(static_cast<int>(a));
+            uint64_t sizeB = m_listing.fileSize(static_cast<int>(b));
+            cmp = sizeA < sizeB ? -1 : (sizeA > sizeB ? 1 : 0);
+            break;
+        }
+        case 2:
+            if(suffixes)
+                cmp = (*suffixes)[a].compare((*suffixes)[b]);
             else
-                normalFiles.push_back(fileInfo);
+                cmp = lowerSuffix(m_listing.name(static_cast<int>(a)))
+                    .compare(lowerSuffix(m_listing.name(static_cast<int>(b))));
+            break;
+        case 3: {
+            int64_t timeA = m_listing.modifyTime(static_cast<int>(a));
+            int64_t timeB = m_listing.modifyTime(static_cast<int>(b));
+            cmp = timeA < timeB ? -1 : (timeA > timeB ? 1 : 0);
+            break;
+        }
+    }
+    // 其余情况按名称，名称相同时按原始顺序，保证排序结果确定
+    if(cmp == 0)
+        cmp = m_sortKeys[a].compare(m_sortKeys[b]);
+    if(cmp == 0)
+        cmp = a < b ? -1 : (a > b ? 1 : 0);
+    return m_sortOrder == Qt::AscendingOrder ? cmp : -cmp;
+}
+
+void RemoteFileSystemModel::sortRows(std::vector<uint32_t>& rows)
+{
+    if(rows.size() < 2)
+        return;
+    ensureSortKeys();
+
+    // 按类型排序时比较扩展名，扩展名先统一转为小写
+    std::vector<QString> suffixes;
+    if(m_sortColumn == 2) {
+        suffixes.resize(static_cast<size_t>(m_listing.size()));
+        for(uint32_t row : rows)
+            suffixes[row] = lowerSuffix(m_listing.name(static_cast<int>(row)));
+    }
+
+    const std::vector<QString>* suffixList = m_sortColumn == 2 ? &suffixes : nullptr;
+    std::sort(rows.begin(), rows.end(), [this, suffixList](uint32_t a, uint32_t b) {
+        return compareRows(a, b, suffixList) < 0;
+    });
+}
+
+void RemoteFileSystemModel::applyOrder(std::vector<uint32_t>& order)
+{
+    emit layoutAboutToBeChanged();
+
+    // 记录每个列表行的新视图行，用于迁移持久索引(选中项、当前项)
+    std::vector<int> newRowOf(static_cast<size_t>(m_listing.size()), -1);
+    for(size_t i = 0; i < order.size(); ++i)
+        newRowOf[order[i]] = static_cast<int>(i);
+
+    QModelIndexList from = persistentIndexList();
+    QModelIndexList to;
+    to.reserve(from.size());
+    for(const QModelIndex& index : from) {
+        int newRow = newRowOf[m_order[index.row()]];
+        to.append(newRow < 0 ? QModelIndex() : createIndex(newRow, index.column()));
+    }
+    m_order.swap(order);
+    changePersistentIndexList(from, to);
+
+    emit layoutChanged();
+}
+
+// 布局变化信号不能改变行数，行数变化通过增删行信号通知，视图和选中项才能保持一致
+void RemoteFileSystemModel::replaceRows(std::vector<uint32_t>& order)
+{
+    std::vector<uint8_t> inOrder(static_cast<size_t>(m_listing.size()), 0);
+    for(uint32_t row : order)
+        inOrder[row] = 1;
+
+    // 不再显示的行先移到末尾(行数不变)，再一次删除
+    std::vector<uint32_t> current;
+    std::vector<uint32_t> dropped;
+    current.reserve(m_order.size());
+    bool droppedAtEnd = true;
+    for(uint32_t row : m_order) {
+        if(inOrder[row]) {
+            droppedAtEnd = droppedAtEnd && dropped.empty();
+            current.push_back(row);
+        } else {
+            dropped.push_back(row);
+        }
+    }
+    if(!dropped.empty()) {
+        int kept = static_cast<int>(current.size());
+        if(!droppedAtEnd) {
+            current.insert(current.end(), dropped.begin(), dropped.end());
+            applyOrder(current);
+        }
+        beginRemoveRows(QModelIndex(), kept, static_cast<int>(m_order.size()) - 1);
+        m_order.resize(static_cast<size_t>(kept));
+        endRemoveRows();
+    }
+
+    // 新显示的行追加到末尾
+    std::vector<uint8_t> shown(static_cast<size_t>(m_listing.size()), 0);
+    for(uint32_t row : m_order)
+        shown[row] = 1;
+    std::vector<uint32_t> added;
+    for(uint32_t row : order) {
+        if(!shown[row])
+            added.push_back(row);
+    }
+    if(!added.empty()) {
+        beginInsertRows(QModelIndex(), rowCount(), rowCount() + static_cast<int>(added.size()) - 1);
+        m_order.insert(m_order.end(), added.begin(), added.end());
+        endInsertRows();
+    }
+
+    applyOrder(order);
+}
+
+// 在hay中查找pattern，用memchr定位首字节候选位置(标准库实现已向量化)，再逐个比较
+static bool containsBytes(const char* hay, size_t hayLength, const std::string& pattern)
+{
+    size_t length = pattern.size();
+    if(length == 0)
+        return true;
+    if(length > hayLength)
+        return false;
+    const char first = pattern[0];
+    const char* end = hay + hayLength - length + 1;
+    for(const char* p = hay; p < end; ++p) {
+        p = static_cast<const char*>(memchr(p, first, static_cast<size_t>(end - p)));
+        if(!p)
+            return false;
+        if(memcmp(p + 1, pattern.data() + 1, length - 1) == 0)
+            return true;
+    }
+    return false;
+}
+
+void RemoteFileSystemModel::ensureLowerNames()
+{
+    if(m_lowerOffsets.empty())
+        m_lowerOffsets.push_back(0);
+    for(int row = static_cast<int>(m_lowerOffsets.size()) - 1; row < m_listing.size(); ++row) {
+        const char* name = m_listing.nameData(row);
+        int length = m_listing.nameLength(row);
+        bool ascii = true;
+        for(int i = 0; i < length && ascii; ++i)
+            ascii = (static_cast<unsigned char>(name[i]) & 0x80) == 0;
+        if(ascii) {
+            // 纯ASCII名称直接按字节转小写，非ASCII名称交给QString处理
+            for(int i = 0; i < length; ++i) {
+                char c = name[i];
+                m_lowerNames.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+            }
+        } else {
+            QByteArray lower = QString::fromUtf8(name, length).toLower().toUtf8();
+            m_lowerNames.append(lower.constData(), static_cast<size_t>(lower.size()));
+        }
+        m_lowerOffsets.push_back(static_cast<uint32_t>(m_lowerNames.size()));
+    }
+}
+
+bool RemoteFileSystemModel::matchesFilter(uint32_t row) const
+{
+    if(m_filterPattern.empty())
+        return true;
+    // 上级目录项始终显示，便于返回
+    if(isParentEntry(row))
+        return true;
+    uint32_t begin = m_lowerOffsets[row];
+    return containsBytes(m_lowerNames.data() + begin, m_lowerOffsets[row + 1] - begin, m_filterPattern);
+}
+
+void RemoteFileSystemModel::updateVisibility(uint32_t first)
+{
+    if(!m_filterPattern.empty())
+        ensureLowerNames();
+    m_visible.resize(static_cast<size_t>(m_listing.size()));
+    for(uint32_t row = first; row < m_visible.size(); ++row)
+        m_visible[row] = matchesFilter(row) ? 1 : 0;
+}
+
+std::vector<uint32_t> RemoteFileSystemModel::visibleRows(const std::vector<uint32_t>& rows) const
+{
+    if(m_filterPattern.empty())
+        return rows;
+    std::vector<uint32_t> visible;
+    visible.reserve(m_order.size());
+    for(uint32_t row : rows) {
+        if(m_visible[row])
+            visible.push_back(row);
+    }
+    return visible;
+}
+
+void RemoteFileSystemModel::setFilterText(const QString& text)
+{
+    std::string pattern = text.trimmed().toLower().toUtf8().toStdString();
+    if(pattern == m_filterPattern)
+        return;
+    // 新关键字包含旧关键字时，结果必然是当前结果的子集，只需在可见行中继续筛选
+    bool narrowing = !pattern.empty()
+        && (m_filterPattern.empty() || pattern.find(m_filterPattern) != std::string::npos);
+    m_filterPattern = pattern;
+    if(!m_filterPattern.empty())
+        ensureLowerNames();
+
+    if(!narrowing) {
+        // 放宽或换了关键字：增删行后按排序重排，保留的行迁移选中项
+        updateVisibility(0);
+        std::vector<uint32_t> order = visibleRows(m_sorted);
+        replaceRows(order);
+        return;
+    }
+
+    // 收窄筛选：只删除不再匹配的行，保留的行和选中项不受影响
+    int runs = 0;
+    bool previousDropped = false;
+    for(uint32_t row : m_order) {
+        bool visible = matchesFilter(row);
+        m_visible[row] = visible ? 1 : 0;
+        if(!visible && !previousDropped)
+            ++runs;
+        previousDropped = !visible;
+    }
+    if(runs == 0)
+        return;
+    if(runs > FILTER_REMOVE_RUNS_MAX) {
+        // 删除的行过于分散时逐段发信号反而更慢，改为集中到末尾一次删除
+        std::vector<uint32_t> order = visibleRows(m_order);
+        replaceRows(order);
+        return;
+    }
+    // 从后往前删除连续段，前面的行号不受影响
+    int row = static_cast<int>(m_order.size()) - 1;
+    while(row >= 0) {
+        if(m_visible[m_order[row]]) {
+            --row;
+            continue;
         }
-        // 对目录文件和普通文件进行排序，以便按名称排序显示
-        std::sort(directoryFiles.begin(), directoryFiles.end(), [](const RemoteFileInfo& a, const RemoteFileInfo& b) { return a.name < b.name; });
-        std::sort(normalFiles.begin(), normalFiles.end(), [](const RemoteFileInfo& a, const RemoteFileInfo& b) { return a.name < b.name; });
-        // 将排序后的目录文件和普通文件添加到模型中
-        for(const auto& file : directoryFiles)
-            addFile(file);
-        for(const auto& file : normalFiles)
-            addFile(file);
-    }
-} 
\ No newline at end of file
+        int last = row;
+        while(row >= 0 && !m_visible[m_order[row]])
+            --row;
+        beginRemoveRows(QModelIndex(), row + 1, last);
+        m_order.erase(m_order.begin() + row + 1, m_order.begin() + last + 1);
+        endRemoveRows();
+    }
+}
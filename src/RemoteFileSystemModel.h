@@ -2,18 +2,32 @@
 #define REMOTEFILESYSTEMMODEL_H
 
 #include "CommHead.h"
+#include "RemoteListing.h"
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <vector>
+#include <unordered_map>
 
+// 单个远程条目的信息，按需从列式存储中生成
 struct RemoteFileInfo {
     QString name;
     QString path;
     bool isDirectory;
     qint64 size;
     QDateTime modifyTime;
-    QString permissions;
-    QString taskId;
-    int status;
 };
 
+/**
+ * @brief 远程文件列表模型
+ *
+ * 负责:
+ * 1. 以列式存储保存当前远程目录的条目，显示内容按需生成
+ * 2. 大目录分页加载，滚动到底部时请求下一页
+ * 3. 按名称(自然排序)、大小、类型、修改时间排序，目录始终在前
+ * 4. 排序只重排行号映射，不移动条目；名称排序键每个列表只生成一次
+ * 5. 按名称筛选，输入时在上一次的结果中逐步缩小范围
+ * 6. 就地应用目录增量(新增、删除、修改)，只对变化的行发出插入、删除、移动和数据变化信号
+ */
 class RemoteFileSystemModel : public QAbstractItemModel {
     Q_OBJECT
 public:
@@ -26,6 +40,7 @@ public:
     int columnCount(const QModelIndex& parent = QModelIndex()) const override;
     QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
 
     // 添加和清理数据的方法
     void clear();
@@ -34,16 +49,85 @@ public:
     QString currentPath() const { return m_currentPath; }
 
     // 添加 fileInfo 方法
-    const RemoteFileInfo& fileInfo(const QModelIndex& index) const {
-        return m_files[index.row()];
-    }
+    RemoteFileInfo fileInfo(const QModelIndex& index) const;
+    // 当前列表的内存占用
+    size_t memoryUsage() const { return m_listing.memoryUsage(); }
 
-    // 使用响应数据更新模型
+    // 使用响应数据更新模型(目录的第一页)
     void updateModel(const transfer::DirectoryResponse& response);
+    // 追加目录的后续页
+    void appendPage(const transfer::DirectoryResponse& response);
+    // 按名称筛选(不区分大小写的子串匹配)，空字符串表示不筛选
+    void setFilterText(const QString& text);
+    // 后续页请求失败，允许下次滚动时重试
+    void abortFetch() { m_fetching = false; }
+    // 应用基于当前版本的增量，版本不符或列表未加载完整时返回false，需整体重新加载
+    bool applyDelta(const transfer::DirectoryResponse& response);
+    // 当前列表的版本，服务端不支持时为0
+    quint64 version() const { return m_version; }
+    // 所有分页是否均已加载
+    bool isComplete() const { return !m_hasMore; }
+
+    // 分页加载：视图滚动到底部时请求下一页
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+signals:
+    // 需要按游标加载下一页
+    void fetchMoreRequested(const QString& path, const QString& cursor);
 
 private:
-    QVector<RemoteFileInfo> m_files;
+    // 把一页响应转换为列式列表
+    static RemoteListing buildListing(const transfer::DirectoryResponse& response);
+    // 记录分页状态
+    void updatePaging(const transfer::DirectoryResponse& response);
+    // 为尚未生成排序键的条目生成名称排序键
+    void ensureSortKeys();
+    // 是否是上级目录项".."
+    bool isParentEntry(uint32_t row) const;
+    // 按当前排序比较两个列表行，负数表示a排在b前；suffixes为空时按需计算扩展名
+    int compareRows(uint32_t a, uint32_t b, const std::vector<QString>* suffixes) const;
+    bool rowLess(uint32_t a, uint32_t b) const { return compareRows(a, b, nullptr) < 0; }
+    // 按当前排序列和顺序对行号排序
+    void sortRows(std::vector<uint32_t>& rows);
+    // 换入新的行号映射并更新持久索引，order与当前的行数必须相同
+    void applyOrder(std::vector<uint32_t>& order);
+    // 换入行数可能不同的行号映射：先删除不再显示的行、追加新显示的行，再按order重排
+    void replaceRows(std::vector<uint32_t>& order);
+    // 视图行号对应的列表行号
+    int sourceRow(int row) const { return static_cast<int>(m_order[row]); }
+    // 为尚未生成小写名称的条目生成小写名称
+    void ensureLowerNames();
+    bool matchesFilter(uint32_t row) const;
+    // 重新计算从first开始的条目是否可见
+    void updateVisibility(uint32_t first);
+    // 从已排序的行号中取出可见的行
+    std::vector<uint32_t> visibleRows(const std::vector<uint32_t>& rows) const;
+    // 为尚未建立索引的条目建立 名称 -> 列表行 索引
+    void ensureNameIndex();
+    // 增量中的单个变化，按排序位置发出对应的行信号
+    void insertRow(uint32_t row);
+    void removeRow(uint32_t row);
+    void updateRow(uint32_t row, bool isDirectory, uint64_t size, int64_t modifyTime);
+
+    RemoteListing m_listing;
+    std::vector<uint32_t> m_sorted;              // 全部列表行，按当前排序
+    std::vector<uint32_t> m_order;               // 视图行 -> 列表行(m_sorted中可见的部分)
+    std::vector<uint8_t> m_visible;              // 列表行是否通过筛选
+    std::vector<QCollatorSortKey> m_sortKeys;    // 列表行的名称排序键
+    std::string m_lowerNames;                    // 小写名称区，筛选时使用
+    std::vector<uint32_t> m_lowerOffsets;        // 列表行在小写名称区中的起止位置
+    std::string m_filterPattern;                 // 小写UTF-8筛选关键字
+    std::unordered_map<std::string, uint32_t> m_rowByName;  // 名称 -> 列表行，应用增量时使用
+    int m_indexedRows;                           // 已建立名称索引的列表行数
+    QCollator m_collator;
+    int m_sortColumn;
+    Qt::SortOrder m_sortOrder;
     QString m_currentPath;
+    QString m_nextCursor;  // 下一页的游标
+    bool m_hasMore;        // 是否还有后续页
+    bool m_fetching;       // 后续页请求是否在途
+    quint64 m_version;     // 列表版本
 };
 
 #endif // REMOTEFILESYSTEMMODEL_H 
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include "RemoteListing.h"
+#include <limits>
+
+const int64_t RemoteListing::INVALID_TIME = std::numeric_limits<int64_t>::min();
+
+// 1970-01-01的儒略日
+static const int64_t UNIX_EPOCH_JULIAN_DAY = 2440588;
+static const int64_t SECONDS_PER_DAY = 86400;
+static const int64_t SECONDS_PER_HOUR = 3600;
+
+// POSIX st_mode的类型位
+static const uint32_t MODE_TYPE_MASK = 0170000;
+static const uint32_t MODE_DIRECTORY = 0040000;
+
+// 解析count位数字，遇到非数字返回-1
+static int parseDigits(const char* p, int count)
+{
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        if (p[i] < '0' || p[i] > '9') {
+            return -1;
+        }
+        value = value * 10 + (p[i] - '0');
+    }
+    return value;
+}
+
+// 日期时间换算为秒数(不做时区换算，只表示墙上时间)
+static int64_t wallClockSeconds(const QDate& date, const QTime& time)
+{
+    return (date.toJulianDay() - UNIX_EPOCH_JULIAN_DAY) * SECONDS_PER_DAY
+        + time.msecsSinceStartOfDay() / 1000;
+}
+
+// Unix纪元时间换算为本地墙上时间，同一小时内的条目复用时区偏移，整个列表只需换算几次
+class LocalTimeConverter
+{
+public:
+    LocalTimeConverter() : m_hour(std::numeric_limits<int64_t>::min()), m_offset(0) {}
+
+    int64_t fromEpochNanos(uint64_t nanos)
+    {
+        if (nanos == 0) {
+            return RemoteListing::INVALID_TIME;
+        }
+        int64_t seconds = static_cast<int64_t>(nanos / 1000000000ULL);
+        int64_t hour = seconds / SECONDS_PER_HOUR;
+        if (hour != m_hour) {
+            m_hour = hour;
+            m_offset = QDateTime::fromMSecsSinceEpoch(hour * SECONDS_PER_HOUR * 1000).offsetFromUtc();
+        }
+        return seconds + m_offset;
+    }
+
+private:
+    int64_t m_hour;
+    int64_t m_offset;
+};
+
+// 不应显示的条目
+static bool isSkippedName(const char* name, size_t length, bool isRoot)
+{
+    return (length == 1 && name[0] == '.') || (isRoot && length == 2 && name[0] == '.' && name[1] == '.');
+}
+
+RemoteListing::RemoteListing()
+{
+}
+
+void RemoteListing::clear()
+{
+    m_path.clear();
+    m_names.clear();
+    m_nameRefs.clear();
+    m_sizes.clear();
+    m_times.clear();
+    m_flags.clear();
+}
+
+void RemoteListing::reserve(size_t count, size_t nameBytes)
+{
+    m_names.reserve(nameBytes);
+    m_nameRefs.reserve(count);
+    m_sizes.reserve(count);
+    m_times.reserve(count);
+    m_flags.reserve(count);
+}
+
+void RemoteListing::swap(RemoteListing& other)
+{
+    m_path.swap(other.m_path);
+    m_names.swap(other.m_names);
+    m_nameRefs.swap(other.m_nameRefs);
+    m_sizes.swap(other.m_sizes);
+    m_times.swap(other.m_times);
+    m_flags.swap(other.m_flags);
+}
+
+void RemoteListing::append(const std::string& name, bool isDirectory, uint64_t size, int64_t modifyTime)
+{
+    append(name.data(), name.size(), isDirectory, size, modifyTime);
+}
+
+void RemoteListing::append(const char* name, size_t length, bool isDirectory, uint64_t size, int64_t modifyTime)
+{
+    NameRef ref;
+    ref.offset = static_cast<uint32_t>(m_names.size());
+    ref.length = static_cast<uint32_t>(length);
+    m_names.append(name, length);
+    m_nameRefs.push_back(ref);
+    m_sizes.push_back(size);
+    m_times.push_back(modifyTime);
+    m_flags.push_back(isDirectory ? DirectoryFlag : 0);
+}
+
+void RemoteListing::append(const RemoteListing& other)
+{
+    uint32_t base = static_cast<uint32_t>(m_names.size());
+    m_names.append(other.m_names);
+    m_nameRefs.reserve(m_nameRefs.size() + other.m_nameRefs.size());
+    for (const NameRef& ref : other.m_nameRefs) {
+        NameRef moved = ref;
+        moved.offset += base;
+        m_nameRefs.push_back(moved);
+    }
+    m_sizes.insert(m_sizes.end(), other.m_sizes.begin(), other.m_sizes.end());
+    m_times.insert(m_times.end(), other.m_times.begin(), other.m_times.end());
+    m_flags.insert(m_flags.end(), other.m_flags.begin(), other.m_flags.end());
+}
+
+void RemoteListing::appendEntries(const transfer::DirectoryResponse& response)
+{
+    const bool isRoot = response.path() == "/";
+    LocalTimeConverter converter;
+
+    if (response.encoding() == transfer::LISTING_V2_COLUMNS) {
+        // 列式编码：名称区整块预留，各列按下标读取，缺失的列取默认值
+        const transfer::ListingColumns& columns = response.columns();
+        const std::string& names = columns.names();
+        int count = columns.name_lengths_size();
+        reserve(m_sizes.size() + static_cast<size_t>(count), m_names.size() + names.size());
+        size_t offset = 0;
+        for (int i = 0; i < count; ++i) {
+            size_t length = columns.name_lengths(i);
+            if (offset + length > names.size()) {
+                break;  // 数据不完整
+            }
+            const char* name = names.data() + offset;
+            offset += length;
+            if (isSkippedName(name, length, isRoot)) {
+                continue;
+            }
+            uint32_t mode = i < columns.modes_size() ? columns.modes(i) : 0;
+            uint64_t size = i < columns.sizes_size() ? columns.sizes(i) : 0;
+            uint64_t nanos = i < columns.modify_times_size() ? columns.modify_times(i) : 0;
+            append(name, length, (mode & MODE_TYPE_MASK) == MODE_DIRECTORY, size, converter.fromEpochNanos(nanos));
+        }
+        return;
+    }
+
+    size_t nameBytes = 0;
+    for (const auto& file : response.files()) {
+        nameBytes += file.name().size();
+    }
+    reserve(m_sizes.size() + static_cast<size_t>(response.files_size()), m_names.size() + nameBytes);
+    for (const auto& file : response.files()) {
+        if (isSkippedName(file.name().data(), file.name().size(), isRoot)) {
+            continue;
+        }
+        // v2条目用纳秒时间和模式位，v1条目用字符串时间
+        bool isDirectory = file.is_directory() || (file.mode() & MODE_TYPE_MASK) == MODE_DIRECTORY;
+        int64_t modifyTime = file.modify_time_ns() != 0 ? converter.fromEpochNanos(file.modify_time_ns())
+                                                        : parseModifyTime(file.modify_time());
+        append(file.name(), isDirectory, file.size(), modifyTime);
+    }
+}
+
+void RemoteListing::update(int row, bool isDirectory, uint64_t size, int64_t modifyTime)
+{
+    m_sizes[row] = size;
+    m_times[row] = modifyTime;
+    m_flags[row] = static_cast<uint8_t>((m_flags[row] & ~DirectoryFlag) | (isDirectory ? DirectoryFlag : 0));
+}
+
+QString RemoteListing::name(int row) const
+{
+    return QString::fromUtf8(nameData(row), static_cast<int>(m_nameRefs[row].length));
+}
+
+QDateTime RemoteListing::modifyDateTime(int row) const
+{
+    int64_t seconds = m_times[row];
+    if (seconds == INVALID_TIME) {
+        return QDateTime();
+    }
+    // 向下取整，保证1970年以前的时间也落在正确的日期
+    int64_t days = seconds / SECONDS_PER_DAY;
+    int64_t rest = seconds % SECONDS_PER_DAY;
+    if (rest < 0) {
+        rest += SECONDS_PER_DAY;
+        --days;
+    }
+    return QDateTime(QDate::fromJulianDay(days + UNIX_EPOCH_JULIAN_DAY),
+                     QTime(0, 0).addSecs(static_cast<int>(rest)));
+}
+
+size_t RemoteListing::memoryUsage() const
+{
+    return m_names.capacity()
+        + m_nameRefs.capacity() * sizeof(NameRef)
+        + m_sizes.capacity() * sizeof(uint64_t)
+        + m_times.capacity() * sizeof(int64_t)
+        + m_flags.capacity() * sizeof(uint8_t)
+        + static_cast<size_t>(m_path.capacity()) * sizeof(QChar);
+}
+
+// 常见的"yyyy-MM-ddThh:mm:ss"(或以空格分隔)直接按位解析，其余格式退回QDateTime::fromString
+int64_t RemoteListing::parseModifyTime(const std::string& text)
+{
+    const char* p = text.c_str();
+    if (text.size() == 19 && p[4] == '-' && p[7] == '-' && (p[10] == 'T' || p[10] == ' ')
+        && p[13] == ':' && p[16] == ':') {
+        QDate date(parseDigits(p, 4), parseDigits(p + 5, 2), parseDigits(p + 8, 2));
+        QTime time(parseDigits(p + 11, 2), parseDigits(p + 14, 2), parseDigits(p + 17, 2));
+        if (date.isValid() && time.isValid()) {
+            return wallClockSeconds(date, time);
+        }
+    }
+    if (text.empty()) {
+        return INVALID_TIME;
+    }
+    return fromDateTime(QDateTime::fromString(QString::fromStdString(text), Qt::ISODate));
+}
+
+int64_t RemoteListing::fromDateTime(const QDateTime& dateTime)
+{
+    if (!dateTime.isValid()) {
+        return INVALID_TIME;
+    }
+    // 带时区的时间换算为本地时间后再取墙上时间
+    QDateTime local = dateTime.toLocalTime();
+    return wallClockSeconds(local.date(), local.time());
+}
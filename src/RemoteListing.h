@@ -0,0 +1,88 @@
+#ifndef REMOTELISTING_H
+#define REMOTELISTING_H
+
+#include <QString>
+#include <QDateTime>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../protos/transfer.pb.h"
+
+/**
+ * @brief 远程目录列表的列式存储
+ *
+ * 负责:
+ * 1. 所有条目共享一个目录路径，文件名连续存放在一块UTF-8名称区中
+ * 2. 大小、修改时间(秒)、标志位各占一列，排序和遍历时缓存友好
+ * 3. 显示需要的QString/QDateTime在读取时按需生成，不随条目常驻内存
+ * 4. 解码目录响应的各种列表编码(字符串时间、纳秒时间、列式打包)
+ */
+class RemoteListing
+{
+public:
+    // 条目标志位
+    enum Flag {
+        DirectoryFlag = 0x01,
+        RemovedFlag = 0x02      // 已删除，行号保留到下次整体重建
+    };
+
+    // 修改时间未知
+    static const int64_t INVALID_TIME;
+
+    RemoteListing();
+
+    void clear();
+    void reserve(size_t count, size_t nameBytes);
+    void swap(RemoteListing& other);
+
+    void setPath(const QString& path) { m_path = path; }
+    const QString& path() const { return m_path; }
+    int size() const { return static_cast<int>(m_sizes.size()); }
+    bool isEmpty() const { return m_sizes.empty(); }
+
+    // 追加一个条目，modifyTime为本地墙上时间的秒数
+    void append(const std::string& name, bool isDirectory, uint64_t size, int64_t modifyTime);
+    void append(const char* name, size_t length, bool isDirectory, uint64_t size, int64_t modifyTime);
+    // 把另一个列表的条目整体追加到末尾
+    void append(const RemoteListing& other);
+    // 把目录响应中的条目(任意编码)追加到末尾，'.'和根目录下的'..'不是有效条目，直接跳过
+    void appendEntries(const transfer::DirectoryResponse& response);
+    // 就地更新条目的属性，名称不变
+    void update(int row, bool isDirectory, uint64_t size, int64_t modifyTime);
+    // 标记条目已删除，不移动其他条目的行号
+    void markRemoved(int row) { m_flags[row] |= RemovedFlag; }
+
+    QString name(int row) const;
+    // 名称在名称区中的UTF-8原始数据
+    const char* nameData(int row) const { return m_names.data() + m_nameRefs[row].offset; }
+    int nameLength(int row) const { return static_cast<int>(m_nameRefs[row].length); }
+    bool isDirectory(int row) const { return (m_flags[row] & DirectoryFlag) != 0; }
+    bool isRemoved(int row) const { return (m_flags[row] & RemovedFlag) != 0; }
+    uint64_t fileSize(int row) const { return m_sizes[row]; }
+    int64_t modifyTime(int row) const { return m_times[row]; }
+    QDateTime modifyDateTime(int row) const;
+
+    // 估算的内存占用(字节)
+    size_t memoryUsage() const;
+
+    // 解析服务端返回的修改时间，无法解析时返回INVALID_TIME
+    static int64_t parseModifyTime(const std::string& text);
+    // 本地时间换算为存储用的秒数
+    static int64_t fromDateTime(const QDateTime& dateTime);
+
+private:
+    // 名称在名称区中的位置
+    struct NameRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    QString m_path;                  // 所有条目共享的目录路径
+    std::string m_names;             // 名称区
+    std::vector<NameRef> m_nameRefs;
+    std::vector<uint64_t> m_sizes;
+    std::vector<int64_t> m_times;
+    std::vector<uint8_t> m_flags;
+};
+
+#endif // REMOTELISTING_H
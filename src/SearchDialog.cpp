@@ -0,0 +1,247 @@
+#include "SearchDialog.h"
+#include "FileClient.h"
+#include "FileTabPage.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFormLayout>
+#include <QHeaderView>
+
+// 默认结果上限
+static const int DEFAULT_SEARCH_LIMIT = 10000;
+
+SearchDialog::SearchDialog(const QString& rootPath, QWidget* parent)
+    : QDialog(parent)
+    , m_model(nullptr)
+    , m_rootEdit(nullptr)
+    , m_patternEdit(nullptr)
+    , m_regexCheck(nullptr)
+    , m_caseCheck(nullptr)
+    , m_dirCheck(nullptr)
+    , m_minSizeSpin(nullptr)
+    , m_maxSizeSpin(nullptr)
+    , m_afterCheck(nullptr)
+    , m_afterEdit(nullptr)
+    , m_beforeCheck(nullptr)
+    , m_beforeEdit(nullptr)
+    , m_limitSpin(nullptr)
+    , m_resultView(nullptr)
+    , m_statusLabel(nullptr)
+    , m_searchBtn(nullptr)
+    , m_downloadBtn(nullptr)
+    , m_closeBtn(nullptr)
+{
+    m_model = new SearchResultModel(this);
+    setupUI(rootPath);
+
+    connect(m_searchBtn, &QPushButton::clicked, this, &SearchDialog::startOrStopSearch);
+    connect(m_patternEdit, &QLineEdit::returnPressed, this, &SearchDialog::startOrStopSearch);
+    connect(m_downloadBtn, &QPushButton::clicked, this, &SearchDialog::downloadSelected);
+    connect(m_closeBtn, &QPushButton::clicked, this, &QDialog::close);
+    connect(m_resultView, &QTreeView::doubleClicked, this, &SearchDialog::openResult);
+    connect(m_model, &SearchResultModel::searchingChanged, this, &SearchDialog::onSearchingChanged);
+    connect(m_model, &SearchResultModel::finished, this, &SearchDialog::onSearchFinished);
+    connect(m_model, &SearchResultModel::rowsInserted, this, &SearchDialog::updateStatus);
+    connect(m_afterCheck, &QCheckBox::toggled, m_afterEdit, &QWidget::setEnabled);
+    connect(m_beforeCheck, &QCheckBox::toggled, m_beforeEdit, &QWidget::setEnabled);
+}
+
+SearchDialog::~SearchDialog()
+{
+    m_model->stop();
+}
+
+void SearchDialog::setupUI(const QString& rootPath)
+{
+    setWindowTitle(tr("搜索远程文件"));
+    resize(800, 600);
+
+    QVBoxLayout* mainLayout = new QVBoxLayout(this);
+
+    // 搜索条件
+    QFormLayout* formLayout = new QFormLayout;
+    m_rootEdit = new QLineEdit(rootPath.isEmpty() ? QString("/") : rootPath, this);
+    formLayout->addRow(tr("搜索目录:"), m_rootEdit);
+
+    QHBoxLayout* patternLayout = new QHBoxLayout;
+    m_patternEdit = new QLineEdit(this);
+    m_patternEdit->setPlaceholderText(tr("例如 *.log"));
+    m_regexCheck = new QCheckBox(tr("正则表达式"), this);
+    m_caseCheck = new QCheckBox(tr("区分大小写"), this);
+    m_dirCheck = new QCheckBox(tr("包含目录"), this);
+    patternLayout->addWidget(m_patternEdit);
+    patternLayout->addWidget(m_regexCheck);
+    patternLayout->addWidget(m_caseCheck);
+    patternLayout->addWidget(m_dirCheck);
+    formLayout->addRow(tr("名称:"), patternLayout);
+
+    QHBoxLayout* sizeLayout = new QHBoxLayout;
+    m_minSizeSpin = new QSpinBox(this);
+    m_maxSizeSpin = new QSpinBox(this);
+    for (QSpinBox* spin : { m_minSizeSpin, m_maxSizeSpin }) {
+        spin->setRange(0, 1024 * 1024 * 1024);
+        spin->setSuffix(" KB");
+        spin->setSpecialValueText(tr("不限"));
+    }
+    sizeLayout->addWidget(m_minSizeSpin);
+    sizeLayout->addWidget(new QLabel(tr("至"), this));
+    sizeLayout->addWidget(m_maxSizeSpin);
+    sizeLayout->addStretch();
+    formLayout->addRow(tr("大小:"), sizeLayout);
+
+    QHBoxLayout* timeLayout = new QHBoxLayout;
+    m_afterCheck = new QCheckBox(tr("晚于"), this);
+    m_afterEdit = new QDateTimeEdit(QDateTime::currentDateTime().addDays(-7), this);
+    m_beforeCheck = new QCheckBox(tr("早于"), this);
+    m_beforeEdit = new QDateTimeEdit(QDateTime::currentDateTime(), this);
+    for (QDateTimeEdit* edit : { m_afterEdit, m_beforeEdit }) {
+        edit->setCalendarPopup(true);
+        edit->setEnabled(false);
+    }
+    timeLayout->addWidget(m_afterCheck);
+    timeLayout->addWidget(m_afterEdit);
+    timeLayout->addWidget(m_beforeCheck);
+    timeLayout->addWidget(m_beforeEdit);
+    timeLayout->addStretch();
+    formLayout->addRow(tr("修改时间:"), timeLayout);
+
+    m_limitSpin = new QSpinBox(this);
+    m_limitSpin->setRange(1, 1000000);
+    m_limitSpin->setValue(DEFAULT_SEARCH_LIMIT);
+    formLayout->addRow(tr("最多结果数:"), m_limitSpin);
+    mainLayout->addLayout(formLayout);
+
+    // 结果列表
+    m_resultView = new QTreeView(this);
+    m_resultView->setModel(m_model);
+    m_resultView->setRootIsDecorated(false);
+    m_resultView->setAlternatingRowColors(true);
+    m_resultView->setUniformRowHeights(true);
+    m_resultView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    m_resultView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_resultView->header()->setSectionResizeMode(0, QHeaderView::Interactive);
+    m_resultView->setColumnWidth(0, 220);
+    m_resultView->setColumnWidth(1, 300);
+    mainLayout->addWidget(m_resultView);
+
+    m_statusLabel = new QLabel(this);
+    mainLayout->addWidget(m_statusLabel);
+
+    // 按钮布局
+    QHBoxLayout* buttonLayout = new QHBoxLayout;
+    m_searchBtn = new QPushButton(tr("搜索"), this);
+    m_downloadBtn = new QPushButton(tr("下载到本地"), this);
+    m_closeBtn = new QPushButton(tr("关闭"), this);
+    buttonLayout->addWidget(m_searchBtn);
+    buttonLayout->addWidget(m_downloadBtn);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(m_closeBtn);
+    mainLayout->addLayout(buttonLayout);
+}
+
+transfer::SearchRequest SearchDialog::buildRequest() const
+{
+    transfer::SearchRequest request;
+    request.mutable_header()->set_type(transfer::SEARCH);
+    request.set_root_path(m_rootEdit->text().trimmed().toStdString());
+    request.set_name_pattern(m_patternEdit->text().trimmed().toStdString());
+    request.set_pattern_type(m_regexCheck->isChecked()
+        ? transfer::SearchRequest::REGEX : transfer::SearchRequest::GLOB);
+    request.set_case_sensitive(m_caseCheck->isChecked());
+    request.set_include_directories(m_dirCheck->isChecked());
+    request.set_min_size(static_cast<uint64_t>(m_minSizeSpin->value()) * 1024);
+    request.set_max_size(static_cast<uint64_t>(m_maxSizeSpin->value()) * 1024);
+    if (m_afterCheck->isChecked()) {
+        request.set_modified_after(static_cast<uint64_t>(m_afterEdit->dateTime().toMSecsSinceEpoch() / 1000));
+    }
+    if (m_beforeCheck->isChecked()) {
+        request.set_modified_before(static_cast<uint64_t>(m_beforeEdit->dateTime().toMSecsSinceEpoch() / 1000));
+    }
+    request.set_limit(static_cast<uint32_t>(m_limitSpin->value()));
+    return request;
+}
+
+void SearchDialog::startOrStopSearch()
+{
+    if (m_model->isSearching()) {
+        m_model->stop();
+        return;
+    }
+    if (!Net_Tool::getInstance()->isConnected()) {
+        m_statusLabel->setText(tr("请先连接到远程服务器"));
+        return;
+    }
+    if (!Net_Tool::getInstance()->hasFeature(FEATURE_SEARCH)) {
+        m_statusLabel->setText(tr("服务端不支持远程搜索"));
+        return;
+    }
+    if (m_rootEdit->text().trimmed().isEmpty()) {
+        m_statusLabel->setText(tr("请输入搜索目录"));
+        return;
+    }
+    m_model->start(buildRequest());
+}
+
+void SearchDialog::downloadSelected()
+{
+    FileClient* client = FileClient::instance();
+    FileTabPage* remotePage = qobject_cast<FileTabPage*>(client->getRemoteView()->currentWidget());
+    QString localPath = client->getLocalView()->rootPath();
+    if (!remotePage || localPath.isEmpty()) {
+        m_statusLabel->setText(tr("请先在本地视图中打开下载目标目录"));
+        return;
+    }
+
+    int count = 0;
+    for (const QModelIndex& index : m_resultView->selectionModel()->selectedRows(0)) {
+        remotePage->downloadRemoteItem(m_model->remotePath(index), m_model->isDirectory(index), localPath);
+        ++count;
+    }
+    if (count == 0) {
+        m_statusLabel->setText(tr("请选择要下载的结果"));
+    } else {
+        m_statusLabel->setText(tr("已添加 %1 个下载任务到 %2").arg(count).arg(localPath));
+    }
+}
+
+void SearchDialog::openResult(const QModelIndex& index)
+{
+    // 目录直接打开，文件打开其所在目录
+    QString path = m_model->remotePath(index);
+    if (!m_model->isDirectory(index)) {
+        int slash = path.lastIndexOf('/');
+        path = slash <= 0 ? QString("/") : path.left(slash);
+    }
+    transfer::DirectoryRequest request;
+    request.mutable_header()->set_type(transfer::DIRECTORY);
+    request.set_current_path("");
+    request.set_dir_name(path.toStdString());
+    request.set_is_parent(false);
+    FileClient::instance()->getRemoteView()->loadRemoteDirectory(request);
+}
+
+void SearchDialog::onSearchingChanged(bool searching)
+{
+    m_searchBtn->setText(searching ? tr("停止") : tr("搜索"));
+    updateStatus();
+}
+
+void SearchDialog::onSearchFinished(bool ok)
+{
+    if (!ok) {
+        m_statusLabel->setText(tr("搜索未完成，已找到 %1 个结果").arg(m_model->rowCount()));
+        return;
+    }
+    updateStatus();
+}
+
+void SearchDialog::updateStatus()
+{
+    int count = m_model->rowCount();
+    if (m_model->isSearching()) {
+        m_statusLabel->setText(tr("正在搜索... 已找到 %1 个结果").arg(count));
+    } else if (m_model->isTruncated()) {
+        m_statusLabel->setText(tr("找到 %1 个结果(已达到结果上限)").arg(count));
+    } else {
+        m_statusLabel->setText(tr("找到 %1 个结果").arg(count));
+    }
+}
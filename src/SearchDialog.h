@@ -0,0 +1,63 @@
+#ifndef SEARCHDIALOG_H
+#define SEARCHDIALOG_H
+
+#include <QDialog>
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QSpinBox>
+#include <QDateTimeEdit>
+#include <QPushButton>
+#include <QTreeView>
+#include <QLabel>
+#include "SearchResultModel.h"
+
+/**
+ * @brief 远程搜索对话框
+ *
+ * 负责:
+ * 1. 设置搜索根目录、名称模式(通配符/正则)、大小和修改时间范围、结果上限
+ * 2. 一次请求由服务端递归查找，结果边到达边显示
+ * 3. 选中结果直接下载到本地视图的当前目录
+ * 4. 双击结果在远程视图中打开其所在目录
+ */
+class SearchDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit SearchDialog(const QString& rootPath, QWidget* parent = nullptr);
+    ~SearchDialog();
+
+private slots:
+    void startOrStopSearch();
+    void downloadSelected();
+    void openResult(const QModelIndex& index);
+    void onSearchingChanged(bool searching);
+    void onSearchFinished(bool ok);
+
+private:
+    void setupUI(const QString& rootPath);
+    void updateStatus();
+    transfer::SearchRequest buildRequest() const;
+
+    SearchResultModel* m_model;
+    QLineEdit* m_rootEdit;
+    QLineEdit* m_patternEdit;
+    QCheckBox* m_regexCheck;
+    QCheckBox* m_caseCheck;
+    QCheckBox* m_dirCheck;
+    QSpinBox* m_minSizeSpin;
+    QSpinBox* m_maxSizeSpin;
+    QCheckBox* m_afterCheck;
+    QDateTimeEdit* m_afterEdit;
+    QCheckBox* m_beforeCheck;
+    QDateTimeEdit* m_beforeEdit;
+    QSpinBox* m_limitSpin;
+    QTreeView* m_resultView;
+    QLabel* m_statusLabel;
+    QPushButton* m_searchBtn;
+    QPushButton* m_downloadBtn;
+    QPushButton* m_closeBtn;
+};
+
+#endif // SEARCHDIALOG_H
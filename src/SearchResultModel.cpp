@@ -0,0 +1,194 @@
+#include "SearchResultModel.h"
+#include "Net_Tool.h"
+#include <QFileIconProvider>
+#include <thread>
+
+SearchResultModel::SearchResultModel(QObject* parent)
+    : QAbstractItemModel(parent)
+    , m_shared(std::make_shared<Shared>())
+    , m_nextId(0)
+    , m_searching(false)
+    , m_truncated(false)
+{
+    m_shared->owner = this;
+    m_shared->current = 0;
+    qRegisterMetaType<transfer::SearchResponse>("transfer::SearchResponse");
+}
+
+SearchResultModel::~SearchResultModel()
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->owner = nullptr;
+    m_shared->current = 0;
+}
+
+QModelIndex SearchResultModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (!hasIndex(row, column, parent))
+        return QModelIndex();
+    return createIndex(row, column);
+}
+
+QModelIndex SearchResultModel::parent(const QModelIndex& child) const
+{
+    Q_UNUSED(child)
+    return QModelIndex();
+}
+
+int SearchResultModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_results.size();
+}
+
+int SearchResultModel::columnCount(const QModelIndex& parent) const
+{
+    Q_UNUSED(parent)
+    return 4; // 名称、所在目录、大小、修改时间
+}
+
+QVariant SearchResultModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_results.size())
+        return QVariant();
+
+    int row = index.row();
+    bool isDirectory = m_results.isDirectory(row);
+
+    if (role == Qt::DisplayRole) {
+        QString relativePath = m_results.name(row);
+        int slash = relativePath.lastIndexOf('/');
+        switch (index.column()) {
+            case 0: return slash < 0 ? relativePath : relativePath.mid(slash + 1);
+            case 1: return slash < 0 ? QString() : relativePath.left(slash);
+            case 2: return isDirectory ? QVariant() : QString::number(m_results.fileSize(row));
+            case 3: return m_results.modifyDateTime(row).toString("yyyy-MM-dd hh:mm:ss");
+        }
+    }
+    else if (role == Qt::DecorationRole && index.column() == 0) {
+        static QFileIconProvider iconProvider;
+        return isDirectory ? iconProvider.icon(QFileIconProvider::Folder)
+                           : iconProvider.icon(QFileIconProvider::File);
+    }
+    else if (role == Qt::ToolTipRole) {
+        return remotePath(index);
+    }
+
+    return QVariant();
+}
+
+QVariant SearchResultModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole) {
+        switch (section) {
+            case 0: return tr("名称");
+            case 1: return tr("所在目录");
+            case 2: return tr("大小");
+            case 3: return tr("修改时间");
+        }
+    }
+    return QVariant();
+}
+
+void SearchResultModel::start(const transfer::SearchRequest& request)
+{
+    quint64 searchId = ++m_nextId;
+    m_shared->current = searchId;
+
+    beginResetModel();
+    m_results.clear();
+    m_rootPath = QString::fromStdString(request.root_path());
+    m_results.setPath(m_rootPath);
+    m_truncated = false;
+    endResetModel();
+    setSearching(true);
+
+    std::shared_ptr<Shared> shared = m_shared;
+    std::thread([shared, searchId, request]() {
+        auto superseded = [shared, searchId]() { return shared->current != searchId; };
+        // 每页结果到达即交给GUI线程显示
+        auto onPage = [shared, searchId](const transfer::SearchResponse& response) {
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (shared->owner && shared->current == searchId) {
+                QMetaObject::invokeMethod(shared->owner, "appendPage", Qt::QueuedConnection,
+                    Q_ARG(quint64, searchId),
+                    Q_ARG(transfer::SearchResponse, response));
+            }
+        };
+        bool ok = Net_Tool::getInstance()->searchRemote(request, onPage, superseded);
+
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        if (shared->owner && !superseded()) {
+            QMetaObject::invokeMethod(shared->owner, "searchDone", Qt::QueuedConnection,
+                Q_ARG(quint64, searchId),
+                Q_ARG(bool, ok));
+        }
+    }).detach();
+}
+
+void SearchResultModel::stop()
+{
+    if (!m_searching) {
+        return;
+    }
+    m_shared->current = ++m_nextId;
+    setSearching(false);
+    emit finished(false);
+}
+
+QString SearchResultModel::remotePath(const QModelIndex& index) const
+{
+    if (!index.isValid() || index.row() >= m_results.size())
+        return QString();
+    QString relativePath = m_results.name(index.row());
+    return m_rootPath.endsWith('/') ? m_rootPath + relativePath : m_rootPath + '/' + relativePath;
+}
+
+bool SearchResultModel::isDirectory(const QModelIndex& index) const
+{
+    return index.isValid() && index.row() < m_results.size() && m_results.isDirectory(index.row());
+}
+
+void SearchResultModel::appendPage(quint64 searchId, const transfer::SearchResponse& response)
+{
+    if (searchId != m_shared->current) {
+        return;  // 已被新搜索取代
+    }
+    m_truncated = response.truncated();
+    if (response.entries_size() == 0) {
+        return;
+    }
+
+    RemoteListing page;
+    size_t nameBytes = 0;
+    for (const auto& entry : response.entries()) {
+        nameBytes += entry.relative_path().size();
+    }
+    page.reserve(static_cast<size_t>(response.entries_size()), nameBytes);
+    for (const auto& entry : response.entries()) {
+        page.append(entry.relative_path(), entry.is_directory(), entry.size(),
+                    RemoteListing::parseModifyTime(entry.modify_time()));
+    }
+
+    beginInsertRows(QModelIndex(), m_results.size(), m_results.size() + page.size() - 1);
+    m_results.append(page);
+    endInsertRows();
+}
+
+void SearchResultModel::searchDone(quint64 searchId, bool ok)
+{
+    if (searchId != m_shared->current) {
+        return;
+    }
+    setSearching(false);
+    emit finished(ok);
+}
+
+void SearchResultModel::setSearching(bool searching)
+{
+    if (m_searching != searching) {
+        m_searching = searching;
+        emit searchingChanged(searching);
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef SEARCHRESULTMODEL_H
+#define SEARCHRESULTMODEL_H
+
+#include <QAbstractItemModel>
+#include <QMetaType>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "RemoteListing.h"
+#include "../protos/transfer.pb.h"
+
+Q_DECLARE_METATYPE(transfer::SearchResponse)
+
+/**
+ * @brief 远程搜索结果模型
+ *
+ * 负责:
+ * 1. 在后台线程发出搜索请求，服务端回送的每页结果到达即追加显示
+ * 2. 结果以列式存储保存，名称为相对搜索根目录的路径
+ * 3. 提供结果的完整远程路径，供直接下载
+ * 4. 新的搜索取代未完成的旧搜索，旧搜索的结果被丢弃
+ */
+class SearchResultModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    explicit SearchResultModel(QObject* parent = nullptr);
+    ~SearchResultModel();
+
+    QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    // 开始搜索，清空之前的结果
+    void start(const transfer::SearchRequest& request);
+    // 停止当前搜索，已收到的结果保留
+    void stop();
+    bool isSearching() const { return m_searching; }
+    bool isTruncated() const { return m_truncated; }
+
+    // 结果的完整远程路径
+    QString remotePath(const QModelIndex& index) const;
+    bool isDirectory(const QModelIndex& index) const;
+
+signals:
+    void searchingChanged(bool searching);
+    void finished(bool ok);
+
+private slots:
+    void appendPage(quint64 searchId, const transfer::SearchResponse& response);
+    void searchDone(quint64 searchId, bool ok);
+
+private:
+    void setSearching(bool searching);
+
+    // 与后台线程共享的状态，模型销毁后后台线程不再回调
+    struct Shared {
+        std::mutex mutex;
+        SearchResultModel* owner;
+        std::atomic<quint64> current;   // 最新的搜索号
+    };
+
+    std::shared_ptr<Shared> m_shared;
+    quint64 m_nextId;
+    RemoteListing m_results;
+    QString m_rootPath;
+    bool m_searching;
+    bool m_truncated;
+};
+
+#endif // SEARCHRESULTMODEL_H
@@ -86,6 +86,42 @@ void TaskManagerDialog::setupUI()
             TransferQueue::instance().resumeTask(taskId);
         }
     });
+    // 优先级子菜单，运行中的任务调整后立即按新权重分配带宽
+    QMenu* priorityMenu = m_contextMenu->addMenu(tr("优先级"));
+    const QList<QPair<QString, TransferPriority>> priorities = {
+        qMakePair(tr("低"), TransferPriority::Low),
+        qMakePair(tr("普通"), TransferPriority::Normal),
+        qMakePair(tr("高"), TransferPriority::High),
+        qMakePair(tr("紧急"), TransferPriority::Urgent)
+    };
+    for (const auto& entry : priorities) {
+        TransferPriority priority = entry.second;
+        priorityMenu->addAction(entry.first, this, [this, priority]() {
+            for (QTreeWidgetItem* item : m_taskList->selectedItems()) {
+                QString taskId = item->data(0, Qt::UserRole).toString();
+                TransferQueue::instance().setTaskPriority(taskId, priority);
+            }
+        });
+    }
+    // 限速子菜单，与全局和服务器限速同时生效
+    QMenu* speedLimitMenu = m_contextMenu->addMenu(tr("限速"));
+    const QList<QPair<QString, qint64>> speedLimits = {
+        qMakePair(tr("不限制"), qint64(0)),
+        qMakePair(tr("256 KB/s"), qint64(256 * 1024)),
+        qMakePair(tr("1 MB/s"), qint64(1024 * 1024)),
+        qMakePair(tr("5 MB/s"), qint64(5 * 1024 * 1024)),
+        qMakePair(tr("10 MB/s"), qint64(10 * 1024 * 1024))
+    };
+    for (const auto& entry : speedLimits) {
+        qint64 bytesPerSecond = entry.second;
+        speedLimitMenu->addAction(entry.first, this, [this, bytesPerSecond]() {
+            for (QTreeWidgetItem* item : m_taskList->selectedItems()) {
+                QString taskId = item->data(0, Qt::UserRole).toString();
+                TransferQueue::instance().setTaskSpeedLimit(taskId, bytesPerSecond);
+            }
+        });
+    }
+    m_contextMenu->addSeparator();
     m_contextMenu->addAction(tr("取消"), this, [this]() {
         if (QMessageBox::question(this, tr("确认"), tr("确定要取消选中的任务吗？")) 
             == QMessageBox::Yes) {
@@ -117,6 +153,8 @@ void TaskManagerDialog::setupConnections()
             this, &TaskManagerDialog::handleTaskStatusChanged);
     connect(&TransferQueue::instance(), &TransferQueue::taskProgressUpdated,
             this, &TaskManagerDialog::handleTaskProgressUpdated);
+    connect(&TransferQueue::instance(), &TransferQueue::taskPriorityChanged,
+            this, &TaskManagerDialog::handleTaskPriorityChanged);
 }
 
 void TaskManagerDialog::refreshTaskList()
@@ -154,6 +192,15 @@ void TaskManagerDialog::handleTaskProgressUpdated(const QString& taskId, qint64
     }
 }
 
+void TaskManagerDialog::handleTaskPriorityChanged(const QString& taskId, TransferPriority priority)
+{
+    Q_UNUSED(priority)
+    QTreeWidgetItem* item = findTaskItem(taskId);
+    if (item) {
+        updateTaskItem(item, TransferQueue::instance().getTaskInfo(taskId));
+    }
+}
+
 QTreeWidgetItem* TaskManagerDialog::findTaskItem(const QString& taskId)
 {
     QList<QTreeWidgetItem*> items = m_taskList->findItems("*", Qt::MatchWildcard);
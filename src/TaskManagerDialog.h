@@ -32,6 +32,7 @@ private slots:
     void handleContextMenu(const QPoint& pos);
     void handleTaskStatusChanged(const QString& taskId, TransferStatus status);
     void handleTaskProgressUpdated(const QString& taskId, qint64 transferredSize);
+    void handleTaskPriorityChanged(const QString& taskId, TransferPriority priority);
 
 private:
     void setupUI();
@@ -0,0 +1,254 @@
+#include "TlsTransport.h"
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/x509v3.h>
+#include <climits>
+
+// 取出OpenSSL错误队列中最早的错误
+static std::string lastSslError() {
+    unsigned long code = ERR_get_error();
+    if (code == 0) {
+        return "unknown error";
+    }
+    char buf[256];
+    ERR_error_string_n(code, buf, sizeof(buf));
+    ERR_clear_error();
+    return buf;
+}
+
+TlsTransport::TlsTransport()
+    : m_ctx(nullptr)
+    , m_ssl(nullptr)
+    , m_resumed(false)
+    , m_kernelSend(false)
+    , m_kernelReceive(false)
+{
+}
+
+TlsTransport::~TlsTransport()
+{
+    close(false);
+    freeSessions();
+    if (m_ctx) {
+        SSL_CTX_free(m_ctx);
+    }
+}
+
+bool TlsTransport::kernelOffloadAvailable()
+{
+#ifdef SSL_OP_ENABLE_KTLS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void TlsTransport::setCaFile(const std::string& caFile)
+{
+    std::lock_guard<std::mutex> lock(m_contextMutex);
+    if (caFile == m_caFile) {
+        return;
+    }
+    // 信任的证书变了，之前的上下文和会话都不再可用；已建立的连接持有上下文的引用，不受影响
+    freeSessions();
+    if (m_ctx) {
+        SSL_CTX_free(m_ctx);
+        m_ctx = nullptr;
+    }
+    m_caFile = caFile;
+}
+
+bool TlsTransport::ensureContext(std::string& error)
+{
+    if (m_ctx) {
+        return true;
+    }
+    m_ctx = SSL_CTX_new(TLS_client_method());
+    if (!m_ctx) {
+        error = "Failed to create TLS context: " + lastSslError();
+        return false;
+    }
+    SSL_CTX_set_min_proto_version(m_ctx, TLS1_3_VERSION);
+    SSL_CTX_set_verify(m_ctx, SSL_VERIFY_PEER, nullptr);
+    int loaded = m_caFile.empty() ? SSL_CTX_set_default_verify_paths(m_ctx)
+                                  : SSL_CTX_load_verify_locations(m_ctx, m_caFile.c_str(), nullptr);
+    if (loaded != 1) {
+        error = "Failed to load CA certificates: " + lastSslError();
+        SSL_CTX_free(m_ctx);
+        m_ctx = nullptr;
+        return false;
+    }
+
+    // 会话票据由本对象保存，不使用OpenSSL内部的会话缓存
+    SSL_CTX_set_session_cache_mode(m_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(m_ctx, &TlsTransport::onNewSession);
+    SSL_CTX_set_app_data(m_ctx, this);
+#ifdef SSL_OP_ENABLE_KTLS
+    // 内核支持时握手后由内核加解密，OpenSSL不支持或内核未加载tls模块时自动退回用户态
+    SSL_CTX_set_options(m_ctx, SSL_OP_ENABLE_KTLS);
+#endif
+    return true;
+}
+
+void TlsTransport::freeSessions()
+{
+    for (auto& entry : m_sessions) {
+        if (entry.second) {
+            SSL_SESSION_free(entry.second);
+            entry.second = nullptr;
+        }
+    }
+}
+
+ssl_st* TlsTransport::handshake(int sock, const std::string& host, uint16_t port, std::string& error)
+{
+    ssl_st* ssl = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_contextMutex);
+        if (!ensureContext(error)) {
+            return nullptr;
+        }
+        ssl = SSL_new(m_ctx);
+        if (!ssl) {
+            error = "Failed to create TLS connection: " + lastSslError();
+            return nullptr;
+        }
+        // IP地址按证书中的IP校验，域名按主机名校验并发送SNI
+        if (X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(ssl), host.c_str()) != 1) {
+            SSL_set_tlsext_host_name(ssl, host.c_str());
+            SSL_set1_host(ssl, host.c_str());
+        }
+        // 同一主机的不同端口可能是不同的服务，票据按host:port区分
+        auto it = m_sessions.insert(std::make_pair(host + ":" + std::to_string(port), nullptr)).first;
+        SSL_set_app_data(ssl, const_cast<std::string*>(&it->first));
+        if (it->second) {
+            SSL_set_session(ssl, it->second);
+        }
+    }
+    SSL_set_fd(ssl, sock);
+
+    // 握手可能持续到socket的收发超时，期间不持有锁
+    ERR_clear_error();
+    if (SSL_connect(ssl) != 1) {
+        long verifyResult = SSL_get_verify_result(ssl);
+        error = verifyResult != X509_V_OK
+            ? std::string("TLS certificate verification failed: ") + X509_verify_cert_error_string(verifyResult)
+            : "TLS handshake failed: " + lastSslError();
+        SSL_free(ssl);
+        return nullptr;
+    }
+    return ssl;
+}
+
+void TlsTransport::attach(ssl_st* ssl)
+{
+    close(false);
+    m_ssl = ssl;
+    if (!m_ssl) {
+        return;
+    }
+    m_resumed = SSL_session_reused(m_ssl) == 1;
+#ifdef SSL_OP_ENABLE_KTLS
+    m_kernelSend = BIO_get_ktls_send(SSL_get_wbio(m_ssl)) == 1;
+    m_kernelReceive = BIO_get_ktls_recv(SSL_get_rbio(m_ssl)) == 1;
+#endif
+}
+
+void TlsTransport::discard(ssl_st* ssl)
+{
+    if (ssl) {
+        SSL_free(ssl);
+    }
+}
+
+void TlsTransport::close(bool graceful)
+{
+    if (m_ssl) {
+        if (graceful) {
+            ERR_clear_error();
+            SSL_shutdown(m_ssl);
+        }
+        SSL_free(m_ssl);
+        m_ssl = nullptr;
+    }
+    m_resumed = false;
+    m_kernelSend = false;
+    m_kernelReceive = false;
+}
+
+int TlsTransport::onNewSession(ssl_st* ssl, ssl_session_st* session)
+{
+    // TLS 1.3的会话票据在握手之后随数据到达
+    TlsTransport* self = static_cast<TlsTransport*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+    const std::string* server = static_cast<const std::string*>(SSL_get_app_data(ssl));
+    if (!self || !server) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(self->m_contextMutex);
+    // 更换证书前建立的连接收到的票据不再保存，否则会绕过新证书的校验恢复会话
+    if (SSL_get_SSL_CTX(ssl) != self->m_ctx) {
+        return 0;
+    }
+    ssl_session_st*& slot = self->m_sessions[*server];
+    if (slot) {
+        SSL_SESSION_free(slot);
+    }
+    slot = session;
+    return 1;  // 保留票据的引用
+}
+
+int TlsTransport::send(const void* data, size_t length)
+{
+    ERR_clear_error();
+    int result = SSL_write(m_ssl, data, static_cast<int>(length > INT_MAX ? INT_MAX : length));
+    return result > 0 ? result : translateResult(result);
+}
+
+int TlsTransport::receive(void* buffer, size_t length)
+{
+    ERR_clear_error();
+    int result = SSL_read(m_ssl, buffer, static_cast<int>(length > INT_MAX ? INT_MAX : length));
+    return result > 0 ? result : translateResult(result);
+}
+
+int TlsTransport::peek(void* buffer, size_t length)
+{
+    ERR_clear_error();
+    int result = SSL_peek(m_ssl, buffer, static_cast<int>(length > INT_MAX ? INT_MAX : length));
+    return result > 0 ? result : translateResult(result);
+}
+
+int TlsTransport::pending() const
+{
+    return m_ssl ? SSL_pending(m_ssl) : 0;
+}
+
+bool TlsTransport::applicationDataReady()
+{
+    if (!m_ssl) {
+        return false;
+    }
+    if (SSL_pending(m_ssl) > 0) {
+        return true;
+    }
+    char probe = 0;
+    ERR_clear_error();
+    int result = SSL_peek(m_ssl, &probe, 1);
+    if (result > 0) {
+        return true;
+    }
+    int code = SSL_get_error(m_ssl, result);
+    ERR_clear_error();
+    return code != SSL_ERROR_WANT_READ && code != SSL_ERROR_WANT_WRITE;
+}
+
+int TlsTransport::translateResult(int result) const
+{
+    int code = SSL_get_error(m_ssl, result);
+    // 对端发送了close_notify，或未发送就关闭了TCP连接
+    if (code == SSL_ERROR_ZERO_RETURN || (code == SSL_ERROR_SYSCALL && result == 0)) {
+        return 0;
+    }
+    // 超时(socket设置了收发超时)时errno保留EAGAIN，由调用方区分
+    return -1;
+}
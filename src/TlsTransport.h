@@ -0,0 +1,90 @@
+#ifndef TLSTRANSPORT_H
+#define TLSTRANSPORT_H
+
+#include <string>
+#include <cstddef>
+#include <mutex>
+#include <map>
+#include <cstdint>
+
+struct ssl_st;
+struct ssl_ctx_st;
+struct ssl_session_st;
+
+/**
+ * @brief TLS传输层
+ *
+ * 负责:
+ * 1. 在已连接的socket上完成TLS 1.3握手，校验服务端证书和主机名
+ * 2. 按服务器(host:port)保存服务端下发的会话票据，重连同一服务器时恢复会话，省去完整握手
+ * 3. Linux下OpenSSL支持时启用内核TLS(kTLS)，加解密由内核完成，不再经过用户态缓冲区
+ * 4. 握手后替代send/recv收发数据
+ *
+ * 握手与当前连接互不影响：handshake只使用内部加锁保护的上下文和会话票据，
+ * 得到的连接由attach换入，调用方负责用保护socket的锁保护attach、close和收发
+ */
+class TlsTransport
+{
+public:
+    TlsTransport();
+    ~TlsTransport();
+
+    // 构建所用的OpenSSL是否支持内核TLS(OpenSSL 3.0起)，不支持时始终在用户态加解密
+    static bool kernelOffloadAvailable();
+
+    // caFile为空时使用系统证书库校验服务端证书
+    void setCaFile(const std::string& caFile);
+
+    // 在阻塞socket上握手，host用于SNI和证书主机名校验，host和port确定使用哪个会话票据；
+    // 成功时返回新连接，失败返回nullptr。不改动当前连接，可以在不持有socket锁时调用
+    ssl_st* handshake(int sock, const std::string& host, uint16_t port, std::string& error);
+    // 释放当前连接并换入handshake返回的连接，ssl为空表示不加密
+    void attach(ssl_st* ssl);
+    // 释放handshake返回但不再使用的连接，ssl可以为空
+    static void discard(ssl_st* ssl);
+    // 释放连接状态；graceful为true时先发送close_notify
+    void close(bool graceful);
+
+    bool isActive() const { return m_ssl != nullptr; }
+    // 本次握手是否恢复了上次的会话
+    bool sessionResumed() const { return m_resumed; }
+    // 发送/接收方向是否由内核完成加解密
+    bool kernelSend() const { return m_kernelSend; }
+    bool kernelReceive() const { return m_kernelReceive; }
+
+    // 与send/recv相同的返回值约定：>0为字节数，0为对端关闭，<0为出错(含超时)
+    int send(const void* data, size_t length);
+    int receive(void* buffer, size_t length);
+    int peek(void* buffer, size_t length);
+    // 已解密但尚未读取的字节数，select看不到这部分数据
+    int pending() const;
+    // 须在非阻塞socket上调用：处理已到达的TLS记录，有应用数据可读时返回true；
+    // 到达的只是会话票据等非应用数据时返回false，连接关闭或出错时返回true，留给接下来的读取报告
+    bool applicationDataReady();
+
+private:
+    TlsTransport(const TlsTransport&) = delete;
+    TlsTransport& operator=(const TlsTransport&) = delete;
+
+    bool ensureContext(std::string& error);
+    // 释放所有会话票据，保留条目
+    void freeSessions();
+    // OpenSSL收到新会话票据时的回调，与handshake同样持有m_contextMutex；
+    // 票据所属的服务器由handshake设置的连接app data给出
+    static int onNewSession(ssl_st* ssl, ssl_session_st* session);
+    // 按SSL_get_error转换为send/recv的返回值约定
+    int translateResult(int result) const;
+
+    std::mutex m_contextMutex;     // 保护上下文和会话票据
+    ssl_ctx_st* m_ctx;
+    ssl_st* m_ssl;
+    // 各服务器(host:port)最近一次的会话票据，可用于恢复；条目只增不删，
+    // 键的地址作为连接的app data，票据释放后值为nullptr
+    std::map<std::string, ssl_session_st*> m_sessions;
+    std::string m_caFile;
+    bool m_resumed;
+    bool m_kernelSend;
+    bool m_kernelReceive;
+};
+
+#endif // TLSTRANSPORT_H
@@ -20,16 +20,7 @@ QString TransferQueue::addTask(const QString& sourcePath, const QString& targetP
     QMutexLocker locker(&m_mutex);
     
     // 创建新任务
-    TransferTask task;
-    task.id = QUuid::createUuid().toString();
-    task.sourcePath = sourcePath;
-    task.targetPath = targetPath;
-    task.priority = priority;
-    task.status = TransferStatus::Waiting;
-    task.fileSize = QFileInfo(sourcePath).size();
-    task.transferredSize = 0;
-    task.createTime = QDateTime::currentDateTime();
-    task.isUpload = isUpload;
+    TransferTask task = createTask(sourcePath, targetPath, priority, isUpload);
     
     // 添加到任务列表和等待队列
     m_tasks[task.id] = task;
@@ -42,6 +33,36 @@ QString TransferQueue::addTask(const QString& sourcePath, const QString& targetP
     return task.id;
 }
 
+QString TransferQueue::addRunningTask(const QString& sourcePath, const QString& targetPath,
+                             TransferPriority priority, bool isUpload)
+{
+    QMutexLocker locker(&m_mutex);
+    
+    TransferTask task = createTask(sourcePath, targetPath, priority, isUpload);
+    task.status = TransferStatus::Running;
+    m_tasks[task.id] = task;
+    
+    emit taskAdded(task);
+    return task.id;
+}
+
+TransferTask TransferQueue::createTask(const QString& sourcePath, const QString& targetPath,
+                             TransferPriority priority, bool isUpload) const
+{
+    TransferTask task;
+    task.id = QUuid::createUuid().toString();
+    task.sourcePath = sourcePath;
+    task.targetPath = targetPath;
+    task.priority = priority;
+    task.speedLimit = 0;
+    task.status = TransferStatus::Waiting;
+    task.fileSize = isUpload ? QFileInfo(sourcePath).size() : 0;
+    task.transferredSize = 0;
+    task.createTime = QDateTime::currentDateTime();
+    task.isUpload = isUpload;
+    return task;
+}
+
 TransferTask TransferQueue::getNextTask()
 {
     QMutexLocker locker(&m_mutex);
@@ -74,7 +95,7 @@ void TransferQueue::updateTaskStatus(const QString& taskId, TransferStatus statu
     emit taskStatusChanged(taskId, status);
 }
 
-void TransferQueue::updateTaskProgress(const QString& taskId, qint64 transferredSize)
+void TransferQueue::updateTaskProgress(const QString& taskId, qint64 transferredSize, qint64 totalSize)
 {
     QMutexLocker locker(&m_mutex);
     if (!m_tasks.contains(taskId)) {
@@ -83,9 +104,45 @@ void TransferQueue::updateTaskProgress(const QString& taskId, qint64 transferred
     
     TransferTask& task = m_tasks[taskId];
     task.transferredSize = transferredSize;
+    if (totalSize >= 0) {
+        task.fileSize = totalSize;
+    }
     emit taskProgressUpdated(taskId, transferredSize);
 }
 
+void TransferQueue::setTaskPriority(const QString& taskId, TransferPriority priority)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_tasks.contains(taskId)) {
+        return;
+    }
+    
+    TransferTask& task = m_tasks[taskId];
+    if (task.priority == priority) {
+        return;
+    }
+    task.priority = priority;
+    if (task.status == TransferStatus::Waiting) {
+        reorderQueue();
+    }
+    emit taskPriorityChanged(taskId, priority);
+}
+
+void TransferQueue::setTaskSpeedLimit(const QString& taskId, qint64 bytesPerSecond)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_tasks.contains(taskId)) {
+        return;
+    }
+    
+    TransferTask& task = m_tasks[taskId];
+    if (task.speedLimit == bytesPerSecond) {
+        return;
+    }
+    task.speedLimit = bytesPerSecond;
+    emit taskSpeedLimitChanged(taskId, bytesPerSecond);
+}
+
 void TransferQueue::pauseTask(const QString& taskId)
 {
     QMutexLocker locker(&m_mutex);
@@ -15,6 +15,7 @@ struct TransferTask {
     QString sourcePath;         // 源路径
     QString targetPath;         // 目标路径
     TransferPriority priority;  // 优先级
+    qint64 speedLimit;         // 任务限速(字节/秒)，0表示不限制
     TransferStatus status;      // 状态
     qint64 fileSize;           // 文件大小
     qint64 transferredSize;    // 已传输大小
@@ -43,12 +44,23 @@ public:
                    TransferPriority priority = TransferPriority::Normal,
                    bool isUpload = true);
     
+    // 添加已直接开始执行的任务(不进入等待队列)，返回任务ID
+    QString addRunningTask(const QString& sourcePath, const QString& targetPath,
+                   TransferPriority priority = TransferPriority::Normal,
+                   bool isUpload = true);
+    
     // 获取下一个任务
     TransferTask getNextTask();
     
     // 更新任务状态
     void updateTaskStatus(const QString& taskId, TransferStatus status);
-    void updateTaskProgress(const QString& taskId, qint64 transferredSize);
+    void updateTaskProgress(const QString& taskId, qint64 transferredSize, qint64 totalSize = -1);
+    
+    // 调整任务优先级
+    void setTaskPriority(const QString& taskId, TransferPriority priority);
+    
+    // 设置任务限速，0表示不限制
+    void setTaskSpeedLimit(const QString& taskId, qint64 bytesPerSecond);
     
     // 暂停/恢复任务
     void pauseTask(const QString& taskId);
@@ -67,12 +79,18 @@ signals:
     void taskAdded(const TransferTask& task);
     void taskStatusChanged(const QString& taskId, TransferStatus status);
     void taskProgressUpdated(const QString& taskId, qint64 transferredSize);
+    void taskPriorityChanged(const QString& taskId, TransferPriority priority);
+    void taskSpeedLimitChanged(const QString& taskId, qint64 bytesPerSecond);
     void taskCompleted(const TransferTask& task);
     void taskFailed(const TransferTask& task, const QString& error);
     
 private:
     explicit TransferQueue(QObject *parent = nullptr);
     
+    // 创建任务记录
+    TransferTask createTask(const QString& sourcePath, const QString& targetPath,
+                   TransferPriority priority, bool isUpload) const;
+    
     // 重新排序队列
     void reorderQueue();
     
@@ -0,0 +1,150 @@
+#include "TransferScheduler.h"
+#include <algorithm>
+
+// 优先级权重：低、普通、高、紧急
+static const int PRIORITY_WEIGHTS[] = { 1, 2, 4, 16 };
+
+TransferScheduler& TransferScheduler::instance()
+{
+    static TransferScheduler scheduler;
+    return scheduler;
+}
+
+TransferScheduler::TransferScheduler()
+    : m_virtualTime(0)
+    , m_busy(false)
+    , m_interactiveWaiting(0)
+    , m_nextTicket(0)
+{
+}
+
+int TransferScheduler::weightForPriority(int priority)
+{
+    if (priority < 0) {
+        priority = 0;
+    } else if (priority > 3) {
+        priority = 3;
+    }
+    return PRIORITY_WEIGHTS[priority];
+}
+
+void TransferScheduler::registerTask(const std::string& taskId, int weight)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TaskState& state = m_tasks[taskId];
+    state.weight = std::max(1, weight);
+    state.lastFinish = m_virtualTime;
+    state.startTag = m_virtualTime;
+}
+
+void TransferScheduler::unregisterTask(const std::string& taskId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.erase(taskId);
+    m_cond.notify_all();
+}
+
+void TransferScheduler::setWeight(const std::string& taskId, int weight)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_tasks.find(taskId);
+    if (it == m_tasks.end()) {
+        return;
+    }
+
+    TaskState& state = it->second;
+    int newWeight = std::max(1, weight);
+    // 按新旧权重缩放已欠下的虚拟时间，提升优先级后无需等旧的欠账还清
+    if (state.lastFinish > m_virtualTime) {
+        state.lastFinish = m_virtualTime + (state.lastFinish - m_virtualTime) * state.weight / newWeight;
+    }
+    if (!state.waiters.empty()) {
+        state.startTag = std::max(m_virtualTime, state.lastFinish);
+    }
+    state.weight = newWeight;
+    m_cond.notify_all();
+}
+
+std::string TransferScheduler::pickNext() const
+{
+    std::string next;
+    double bestTag = 0;
+    int bestWeight = 0;
+    for (const auto& pair : m_tasks) {
+        const TaskState& state = pair.second;
+        if (state.waiters.empty()) {
+            continue;
+        }
+        // 起始时间相同时权重大的优先
+        if (next.empty() || state.startTag < bestTag
+            || (state.startTag == bestTag && state.weight > bestWeight)) {
+            next = pair.first;
+            bestTag = state.startTag;
+            bestWeight = state.weight;
+        }
+    }
+    return next;
+}
+
+bool TransferScheduler::acquire(const std::string& taskId, uint64_t bytes)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_tasks.find(taskId);
+    if (it == m_tasks.end()) {
+        return false;  // 未注册或已结束的任务不再调度
+    }
+
+    Waiter waiter;
+    waiter.ticket = ++m_nextTicket;
+    waiter.bytes = std::max<uint64_t>(1, bytes);
+    if (it->second.waiters.empty()) {
+        it->second.startTag = std::max(m_virtualTime, it->second.lastFinish);
+    }
+    it->second.waiters.push_back(waiter);
+
+    // 排队号单调递增且按顺序出队，队首排队号比自己大说明自己已不在队中
+    // (等待期间任务被注销，又以同一标识重新注册)
+    auto dequeued = [this, &taskId, &waiter]() {
+        auto found = m_tasks.find(taskId);
+        return found == m_tasks.end() || found->second.waiters.empty()
+            || found->second.waiters.front().ticket > waiter.ticket;
+    };
+    m_cond.wait(lock, [this, &taskId, &waiter, &dequeued]() {
+        if (dequeued()) {
+            return true;
+        }
+        return !m_busy && m_interactiveWaiting == 0
+            && m_tasks[taskId].waiters.front().ticket == waiter.ticket
+            && pickNext() == taskId;
+    });
+
+    if (dequeued()) {
+        return false;
+    }
+    it = m_tasks.find(taskId);
+    TaskState& state = it->second;
+    state.waiters.pop_front();
+    m_virtualTime = state.startTag;
+    state.lastFinish = state.startTag + static_cast<double>(waiter.bytes) / state.weight;
+    if (!state.waiters.empty()) {
+        state.startTag = std::max(m_virtualTime, state.lastFinish);
+    }
+    m_busy = true;
+    return true;
+}
+
+void TransferScheduler::acquireInteractive()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ++m_interactiveWaiting;
+    m_cond.wait(lock, [this]() { return !m_busy; });
+    --m_interactiveWaiting;
+    m_busy = true;
+}
+
+void TransferScheduler::release()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_busy = false;
+    m_cond.notify_all();
+}
@@ -0,0 +1,73 @@
+#ifndef TRANSFERSCHEDULER_H
+#define TRANSFERSCHEDULER_H
+
+#include <string>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+/**
+ * @brief 传输调度器(加权公平队列)
+ *
+ * 负责:
+ * 1. 在多个运行中的传输任务之间按权重分配唯一的socket
+ * 2. 采用起始时间公平排队(SFQ)，按 字节数/权重 推进虚拟时间
+ * 3. 目录浏览等交互请求优先于所有批量传输
+ * 4. 运行中调整权重立即影响下一次调度
+ * 5. 同一任务(如目录传输)可由多个线程同时排队，按先来后到依次调度
+ */
+class TransferScheduler
+{
+public:
+    static TransferScheduler& instance();
+
+    // 由优先级(TransferPriority的整数值)换算权重
+    static int weightForPriority(int priority);
+
+    // 注册/注销任务
+    void registerTask(const std::string& taskId, int weight);
+    void unregisterTask(const std::string& taskId);
+    // 调整任务权重，对排队中的请求立即生效
+    void setWeight(const std::string& taskId, int weight);
+
+    // 批量传输申请一次socket交互(bytes为本次交互的数据量)，返回true后独占socket
+    // 任务未注册或等待期间被注销时返回false
+    bool acquire(const std::string& taskId, uint64_t bytes);
+    // 交互请求申请socket，优先于所有批量传输
+    void acquireInteractive();
+    // 释放socket
+    void release();
+
+private:
+    TransferScheduler();
+    TransferScheduler(const TransferScheduler&) = delete;
+    TransferScheduler& operator=(const TransferScheduler&) = delete;
+
+    // 排队中的一次请求
+    struct Waiter {
+        uint64_t ticket;      // 排队号
+        uint64_t bytes;       // 本次交互的数据量
+    };
+
+    struct TaskState {
+        int weight;
+        double lastFinish;    // 上次调度的虚拟完成时间
+        double startTag;      // 队首请求的虚拟起始时间
+        std::deque<Waiter> waiters; // 排队中的请求
+    };
+
+    // 选出虚拟起始时间最小的排队任务(调用方需持有锁)
+    std::string pickNext() const;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::map<std::string, TaskState> m_tasks;
+    double m_virtualTime;     // 系统虚拟时间
+    bool m_busy;              // socket是否被占用
+    int m_interactiveWaiting; // 排队中的交互请求数
+    uint64_t m_nextTicket;    // 排队号生成
+};
+
+#endif // TRANSFERSCHEDULER_H